@@ -0,0 +1,104 @@
+#!/bin/bash
+
+##############################################################################
+# Compare the time taken by two builds of a solver to read MPS files. Random
+# MILP instances of the given sizes are generated, written as plain and
+# gzip-compressed MPS files, and each solver is run on them with presolve and
+# solve turned off, so that the run time is mostly the time to read the file.
+#
+# Usage: OLD=/path/to/old/mbnb NEW=./bin/mbnb mps-bench.sh [rows:cols ...]
+#
+# Each argument is the number of rows and columns of an instance, e.g.
+# 100000:500000. Every column has NZPC nonzeros in the constraints.
+
+# Set the following parameters before running
+
+OLD=${OLD:-}                                ## solver built with old reader
+NEW=${NEW:-./bin/mbnb}                      ## solver built with new reader
+OPTS=${OPTS:-"--presolve 0 --solve 0"}      ## other options
+NZPC=${NZPC:-5}                             ## nonzeros per column
+MPSDIR=${MPSDIR:-/tmp}                      ## where instances are written
+REPEAT=${REPEAT:-3}                         ## number of timed runs
+
+# End of parameters
+
+##############################################################################
+
+# Write a random instance with $1 rows and $2 columns to file $3.
+genmps() {
+  awk -v m=$1 -v n=$2 -v d=$NZPC 'BEGIN {
+    srand(1);
+    print "NAME          SYNTH";
+    print "ROWS";
+    print " N  obj";
+    for (i = 0; i < m; ++i) {
+      printf " %s  r%d\n", substr("LGE", i % 3 + 1, 1), i;
+    }
+    print "COLUMNS";
+    for (j = 0; j < n; ++j) {
+      if (j % 4 == 0) {
+        print "    MARKER                 '"'"'MARKER'"'"'                 '"'"'INTORG'"'"'";
+      }
+      printf "    x%d  obj  %d", j, int(rand() * 20) - 10;
+      for (k = 0; k < d; ++k) {
+        if (k % 2 == 0) {
+          printf "\n    x%d", j;
+        }
+        printf "  r%d  %.6g", int(rand() * m), rand() * 10 - 5;
+      }
+      printf "\n";
+      if (j % 4 == 0) {
+        print "    MARKER                 '"'"'MARKER'"'"'                 '"'"'INTEND'"'"'";
+      }
+    }
+    print "RHS";
+    for (i = 0; i < m; i += 2) {
+      printf "    RHS  r%d  %.4g\n", i, rand() * 6 - 3;
+    }
+    print "BOUNDS";
+    for (j = 0; j < n; j += 3) {
+      printf " UP BND x%d %d\n", j, int(rand() * 10) + 1;
+    }
+    print "ENDATA";
+  }' > $3
+}
+
+walltime() {
+  local s e
+  s=$(date +%s.%N)
+  "$@" > /dev/null 2>&1
+  e=$(date +%s.%N)
+  echo "$e - $s" | bc
+}
+
+avgtime() {
+  local t=0
+  for ((i=0; i<$REPEAT; i++))
+  do
+    t=$(echo "$t + $(walltime "$@")" | bc)
+  done
+  echo "scale=3; $t / $REPEAT" | bc
+}
+
+printf "%-22s %10s %10s %10s %10s\n" instance MB old[s] new[s] new-gz[s]
+
+for sz in "${@:-20000:100000}"
+do
+  m=${sz%:*}
+  n=${sz#*:}
+  name=synth-$m-$n
+  inst=$MPSDIR/$name.mps
+  genmps $m $n $inst
+  gzip -kf $inst
+  mb=$(echo "scale=1; $(stat -c %s $inst) / 1048576" | bc)
+
+  told="-"
+  if [ -n "$OLD" ];
+  then
+    told=$(avgtime $OLD $OPTS $inst)
+  fi
+  tnew=$(avgtime $NEW $OPTS $inst)
+  tgz=$(avgtime $NEW $OPTS $inst.gz)
+  printf "%-22s %10s %10s %10s %10s\n" $name $mb $told $tnew $tgz
+  rm -f $inst $inst.gz
+done
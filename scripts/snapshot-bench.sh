@@ -0,0 +1,55 @@
+#!/bin/bash
+
+##############################################################################
+# Compare startup time of a solver when reading a .nl file and presolving it
+# against loading a presolved snapshot (options save_presolved and
+# load_presolved). For each instance, the snapshot is written once and then
+# both ways of starting are timed with solve set to 0, i.e., the run stops
+# just before the root node.
+#
+# Usage: snapshot-bench.sh instance1.nl [instance2.nl ...]
+
+# Set the following parameters before running
+
+EXEC=${EXEC:-./bin/mbnb}                    ## which solver to run
+OPTS=${OPTS:-"--log_level 3"}               ## other options
+SNAPDIR=${SNAPDIR:-/tmp}                    ## where snapshots are written
+REPEAT=${REPEAT:-3}                         ## number of timed runs
+
+# End of parameters
+
+##############################################################################
+
+walltime() {
+  local s e
+  s=$(date +%s.%N)
+  "$@" > /dev/null 2>&1
+  e=$(date +%s.%N)
+  echo "$e - $s" | bc
+}
+
+printf "%-30s %12s %12s %10s\n" instance read+pres[s] load[s] speedup
+
+for inst in "$@"
+do
+  name=$(basename $inst .nl)
+  snap=$SNAPDIR/$name.msnap
+  $EXEC $OPTS --solve 0 --save_presolved $snap $inst > /dev/null 2>&1
+  if [ ! -f $snap ];
+  then
+    echo "$name: could not write snapshot"
+    continue
+  fi
+
+  tr=0
+  tl=0
+  for ((i=0; i<$REPEAT; i++))
+  do
+    tr=$(echo "$tr + $(walltime $EXEC $OPTS --solve 0 $inst)" | bc)
+    tl=$(echo "$tl + $(walltime $EXEC $OPTS --solve 0 --load_presolved $snap)" | bc)
+  done
+  tr=$(echo "scale=3; $tr / $REPEAT" | bc)
+  tl=$(echo "scale=3; $tl / $REPEAT" | bc)
+  printf "%-30s %12s %12s %10s\n" $name $tr $tl $(echo "scale=2; $tr / $tl" | bc)
+  rm -f $snap
+done
@@ -0,0 +1,94 @@
+#!/bin/bash
+
+##############################################################################
+# Compare the time taken by two builds of mglob to reformulate factorable
+# problems. Random nonconvex QCQP instances with the given number of bilinear
+# terms are generated as MPS files, and each solver is run on them with
+# solve turned off. The time reported by Glob for reformulating is printed.
+#
+# Usage: OLD=/path/to/old/mglob NEW=./bin/mglob transformer-bench.sh [terms ...]
+#
+# Each argument is the total number of bilinear terms in the constraints,
+# e.g. 100000. Every constraint has TPC terms and the number of variables is
+# a quarter of the number of terms, so that many products repeat and the
+# transformer has to find the auxiliary variables it added before.
+
+# Set the following parameters before running
+
+OLD=${OLD:-}                                ## mglob built before the change
+NEW=${NEW:-./bin/mglob}                     ## mglob built after the change
+TRANS=${TRANS:-"simp quad"}                 ## transformers to try
+OPTS=${OPTS:-"--solve 0 --log_level 3"}     ## other options
+TPC=${TPC:-20}                              ## bilinear terms per constraint
+MPSDIR=${MPSDIR:-/tmp}                      ## where instances are written
+
+# End of parameters
+
+##############################################################################
+
+# Write a random instance with $1 bilinear terms to file $2.
+genmps() {
+  awk -v t=$1 -v d=$TPC 'BEGIN {
+    srand(1);
+    n = int(t / 4) + 10;
+    m = int((t + d - 1) / d);
+    print "NAME          QSYNTH";
+    print "ROWS";
+    print " N  obj";
+    for (i = 0; i < m; ++i) {
+      printf " L  q%d\n", i;
+    }
+    print "COLUMNS";
+    for (j = 0; j < n; ++j) {
+      printf "    x%d  obj  %d\n", j, int(rand() * 20) - 10;
+    }
+    print "RHS";
+    for (i = 0; i < m; ++i) {
+      printf "    RHS  q%d  %d\n", i, int(rand() * 10) + 1;
+    }
+    print "BOUNDS";
+    for (j = 0; j < n; ++j) {
+      printf " LO BND x%d -2\n UP BND x%d 3\n", j, j;
+    }
+    for (i = 0; i < m; ++i) {
+      printf "QCMATRIX   q%d\n", i;
+      for (k = 0; k < d; ++k) {
+        a = int(rand() * n);
+        b = int(rand() * n);
+        c = rand() * 4 - 2;
+        printf "    x%d  x%d  %.6g\n", a, b, c;
+        if (a != b) {
+          printf "    x%d  x%d  %.6g\n", b, a, c;
+        }
+      }
+    }
+    print "ENDATA";
+  }' > $2
+}
+
+# Print the reformulation time reported by solver $1 with transformer $2 on
+# instance $3.
+reftime() {
+  $1 $OPTS --transformer $2 $3 2>&1 \
+    | awk '/time used in reformulating/ { print $NF }'
+}
+
+printf "%-18s %6s %10s %10s\n" instance trans old[s] new[s]
+
+for t in "${@:-20000 80000}"
+do
+  name=qsynth-$t
+  inst=$MPSDIR/$name.mps
+  genmps $t $inst
+  for tr in $TRANS
+  do
+    told="-"
+    if [ -n "$OLD" ];
+    then
+      told=$(reftime $OLD $tr $inst)
+    fi
+    tnew=$(reftime $NEW $tr $inst)
+    printf "%-18s %6s %10s %10s\n" $name $tr ${told:-"-"} ${tnew:-"-"}
+  done
+  rm -f $inst
+done
@@ -37,12 +37,26 @@ namespace Minotaur {
     /// Destroy.
     virtual ~ActiveNodeStore() {}
 
+    /**
+     * \brief Remove given nodes from the store.
+     *
+     * \param[in] nodes Nodes to be removed. Each must be in the store.
+     */
+    virtual void erase(const NodePtrVector &nodes) = 0;
+
     /// Find the minimum lower bound of all the active nodes.
     virtual double getBestLB() const = 0;
 
     /// Find the maximum depth of all active nodes.
     virtual UInt getDeepestLevel() const = 0;
 
+    /**
+     * \brief Get all active nodes, in no particular order.
+     *
+     * \param[out] nodes The active nodes are appended to it.
+     */
+    virtual void getNodes(NodePtrVector &nodes) const = 0;
+
     /// Get the number of active nodes.
     virtual size_t getSize() const = 0;
 
@@ -20,6 +20,7 @@
 #include "Logger.h"
 #include "Node.h"
 #include "Option.h"
+#include "Profiler.h"
 #include "Modification.h"
 #include "Relaxation.h"
 #include "SolutionPool.h"
@@ -38,6 +39,7 @@ BndProcessor::BndProcessor()
     engine_(EnginePtr()),
     engineStatus_(EngineUnknownStatus),
     numSolutions_(0),
+    prof_(0),
     oATol_(1e-5),
     oRTol_(1e-5),
     relaxation_(RelaxationPtr()),
@@ -60,6 +62,7 @@ BndProcessor::BndProcessor (EnvPtr env, EnginePtr engine,
     engine_(engine),
     engineStatus_(EngineUnknownStatus),
     numSolutions_(0),
+    prof_(0),
     oATol_(1e-5),
     oRTol_(1e-5),
     relaxation_(RelaxationPtr()),
@@ -68,6 +71,7 @@ BndProcessor::BndProcessor (EnvPtr env, EnginePtr engine,
   cutOff_ = env->getOptions()->findDouble("obj_cut_off")->getValue();
   handlers_ = handlers;
   logger_ = env->getLogger();
+  prof_ = env->getProfiler();
   stats_.bra = 0;
   stats_.inf = 0;
   stats_.opt = 0;
@@ -114,6 +118,15 @@ WarmStartPtr BndProcessor::getWarmStart()
 }
 
 
+ConstSolutionPtr BndProcessor::getRelSolution()
+{
+  if (engineStatus_ == ProvenOptimal || engineStatus_ == ProvenLocalOptimal) {
+    return engine_->getSolution();
+  }
+  return 0;
+}
+
+
 bool BndProcessor::isFeasible_(NodePtr node, ConstSolutionPtr sol, 
                               SolutionPoolPtr s_pool, bool &should_prune)
 {
@@ -150,6 +163,7 @@ void BndProcessor::process(NodePtr node, RelaxationPtr rel,
   ConstSolutionPtr sol;
   ModVector mods;
   int iter = 0;
+  ProfScope scope(prof_, ZoneNode);
 
   ++stats_.proc;
   relaxation_ = rel;
@@ -246,8 +260,11 @@ void BndProcessor::process(NodePtr node, RelaxationPtr rel,
     if (ws_) {
       ws_->incrUseCnt();
     }
-    branches_ = brancher_->findBranches(relaxation_, node, sol, s_pool, 
-                                        br_status, mods);
+    {
+      ProfScope bscope(prof_, ZoneBranch);
+      branches_ = brancher_->findBranches(relaxation_, node, sol, s_pool,
+                                          br_status, mods);
+    }
     if (br_status==PrunedByBrancher) {
 
       should_prune = true;
@@ -413,6 +430,7 @@ bool BndProcessor::shouldPrune_(NodePtr node, double solval,
 
 void BndProcessor::solveRelaxation_() 
 {
+  ProfScope scope(prof_, ZoneRelax);
   engineStatus_ = EngineError;
   engine_->solve();
   engineStatus_ = engine_->getStatus();
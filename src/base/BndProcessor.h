@@ -20,6 +20,7 @@ namespace Minotaur {
 
   class Engine;
   class Problem;
+  class Profiler;
   class Solution;
   typedef Engine* EnginePtr;
   typedef const Solution* ConstSolutionPtr;
@@ -61,6 +62,9 @@ namespace Minotaur {
       // Get warm-start information.
       WarmStartPtr getWarmStart();
 
+      // Implement NodeProcessor::getRelSolution().
+      ConstSolutionPtr getRelSolution();
+
       // Implement NodeProcessor::process().
       void process(NodePtr node, RelaxationPtr rel, 
                    SolutionPoolPtr s_pool);
@@ -103,6 +107,9 @@ namespace Minotaur {
       /// How many new solutions were found by the processor.
       UInt numSolutions_;
 
+      /// Profiler of the environment.
+      Profiler *prof_;
+
       /// Absolute tolerance for pruning a node on basis of bounds.
       double oATol_;
 
@@ -0,0 +1,67 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file BoundTrail.cpp
+ * \brief Define class BoundTrail for recording and undoing changes in
+ * bounds of variables of a problem.
+ * \author The Minotaur Team
+ */
+
+#include <algorithm>
+
+#include "MinotaurConfig.h"
+#include "BoundTrail.h"
+#include "Problem.h"
+
+using namespace Minotaur;
+
+BoundTrail::BoundTrail(ProblemPtr p)
+  : p_(p),
+    round_(0)
+{
+  p_->setBoundTrail(this);
+}
+
+
+BoundTrail::~BoundTrail()
+{
+  if (p_->getBoundTrail() == this) {
+    p_->setBoundTrail(0);
+  }
+}
+
+
+void BoundTrail::undo(UInt mark)
+{
+  if (recs_.size() <= mark) {
+    return;
+  }
+  if (stamp_.size() < p_->getNumVars()) {
+    stamp_.resize(p_->getNumVars(), 0);
+  }
+  ++round_;
+  if (0 == round_) {
+    std::fill(stamp_.begin(), stamp_.end(), 0);
+    round_ = 1;
+  }
+
+  // the first record of a variable after the mark has the bounds it had at
+  // the mark. Later ones are skipped. Detach while restoring so that the
+  // restoration itself is not recorded.
+  p_->setBoundTrail(0);
+  p_->beginUpdate();
+  for (UInt i=mark; i<recs_.size(); ++i) {
+    const BoundRec &r = recs_[i];
+    if (stamp_[r.ind] != round_) {
+      stamp_[r.ind] = round_;
+      p_->changeBoundByInd(r.ind, r.lb, r.ub);
+    }
+  }
+  p_->commitUpdate();
+  p_->setBoundTrail(this);
+  recs_.resize(mark);
+}
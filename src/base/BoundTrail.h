@@ -0,0 +1,99 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file BoundTrail.h
+ * \brief Declare class BoundTrail for recording and undoing changes in
+ * bounds of variables of a problem.
+ * \author The Minotaur Team
+ */
+
+#ifndef MINOTAURBOUNDTRAIL_H
+#define MINOTAURBOUNDTRAIL_H
+
+#include "Types.h"
+
+namespace Minotaur {
+
+  /**
+   * \brief A trail of bound changes made to variables of a problem.
+   *
+   * When a trail is attached to a problem, the problem records the bounds
+   * of a variable in the trail every time, before they are changed. The
+   * changes can then be undone back to a mark, restoring every variable
+   * that was changed after the mark to the bounds it had at the mark. The
+   * cost of undoing is proportional to the number of changes recorded, not
+   * to the number of variables in the problem, and the bounds of each
+   * variable are sent to the engine only once.
+   *
+   * Heuristics like diving use it instead of saving and restoring bounds
+   * of all variables:
+   * \code
+   * BoundTrail trail(p);
+   * UInt mark = trail.getMark();
+   * // dive, changing bounds of p ...
+   * trail.undo(mark);
+   * \endcode
+   */
+  class BoundTrail {
+  public:
+    /// Create a trail and attach it to the problem p.
+    BoundTrail(ProblemPtr p);
+
+    /// Detach from the problem and destroy.
+    ~BoundTrail();
+
+    /// Return a mark that can later be passed to undo().
+    UInt getMark() const { return recs_.size(); }
+
+    /// Return the number of bound changes recorded since the mark.
+    UInt getNumChanges(UInt mark = 0) const { return recs_.size() - mark; }
+
+    /**
+     * \brief Save the current bounds of a variable. Called by the problem
+     * before it changes the bounds.
+     *
+     * \param [in] ind Index of the variable in the problem.
+     * \param [in] lb Lower bound before the change.
+     * \param [in] ub Upper bound before the change.
+     */
+    void record(UInt ind, double lb, double ub)
+    {
+      BoundRec r = {ind, lb, ub};
+      recs_.push_back(r);
+    }
+
+    /**
+     * \brief Restore bounds of all variables changed after a mark.
+     *
+     * The changes recorded after the mark are removed from the trail.
+     * \param [in] mark A value returned by getMark(). Undo all changes if
+     * zero.
+     */
+    void undo(UInt mark = 0);
+
+  private:
+    /// Bounds of a variable before a change.
+    struct BoundRec {
+      UInt ind;   /// Index of the variable.
+      double lb;  /// Lower bound.
+      double ub;  /// Upper bound.
+    };
+
+    /// Problem whose bounds are recorded.
+    ProblemPtr p_;
+
+    /// The changes, oldest first.
+    std::vector<BoundRec> recs_;
+
+    /// Incremented on every undo, used with stamp_.
+    UInt round_;
+
+    /// stamp_[i] is round_ if variable i has been restored in this undo.
+    UIntVector stamp_;
+  };
+}
+#endif
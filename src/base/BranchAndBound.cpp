@@ -13,7 +13,12 @@
 #include <iomanip>
 
 #include "BranchAndBound.h"
+#include "HeurScheduler.h"
+#include "HeurWorker.h"
 #include "MinotaurConfig.h"
+#include "NodeRecorder.h"
+#include "RaceBoard.h"
+#include "RCHandler.h"
 
 //#define MDBUG 1
 //#define SPEW 1
@@ -24,9 +29,16 @@ const std::string BranchAndBound::me_ = "BranchAndBound: ";
 
 BranchAndBound::BranchAndBound()
   : env_(0),
+    heurSched_(0),
+    fixNodes_(false),
+    heurWorker_(0),
+    recorder_(0),
     nodePrcssr_(),
     nodeRlxr_(0),
     options_(0),
+    raceBoard_(0),
+    raceId_(0),
+    rcHandler_(0),
     problem_(0),
     solPool_(0),
     stats_(0),
@@ -37,8 +49,15 @@ BranchAndBound::BranchAndBound()
 
 BranchAndBound::BranchAndBound(EnvPtr env, ProblemPtr p)
   : env_(env),
+    heurSched_(0),
+    fixNodes_(false),
+    heurWorker_(0),
+    recorder_(0),
     nodePrcssr_(0),
     nodeRlxr_(0),
+    raceBoard_(0),
+    raceId_(0),
+    rcHandler_(0),
     problem_(p),
     solPool_(0),
     stats_(0),
@@ -48,6 +67,7 @@ BranchAndBound::BranchAndBound(EnvPtr env, ProblemPtr p)
   tm_ = (TreeManagerPtr) new TreeManager(env);
   options_ = (BabOptionsPtr) new BabOptions(env);
   logger_ = env->getLogger();
+  heurSched_ = new HeurScheduler(env);
 }
 
 BranchAndBound::~BranchAndBound()
@@ -73,11 +93,21 @@ BranchAndBound::~BranchAndBound()
     delete *it;
   }
   preHeurs_.clear();
+  if(heurSched_) {
+    delete heurSched_;
+  }
+  if(recorder_) {
+    delete recorder_;
+  }
+  if(heurWorker_) {
+    delete heurWorker_;
+  }
 }
 
 void BranchAndBound::addPreRootHeur(HeurPtr h)
 {
   preHeurs_.push_back(h);
+  heurSched_->addHeur(h);
 }
 
 double BranchAndBound::getPerGap()
@@ -90,6 +120,66 @@ double BranchAndBound::getLb()
   return tm_->getLb();
 }
 
+void BranchAndBound::fixActiveNodes_(NodePtr current_node)
+{
+  NodePtrVector nodes, pruned;
+
+  if (!rcHandler_ || !fixNodes_) {
+    return;
+  }
+  fixNodes_ = false;
+  tm_->copyActiveNodes(nodes);
+  rcHandler_->tightenActiveNodes(nodes, current_node, tm_->getUb(), pruned);
+  if (!pruned.empty()) {
+    tm_->pruneActiveNodes(pruned);
+#if SPEW
+    logger_->msgStream(LogDebug) << me_ << "pruned " << pruned.size()
+                                 << " open nodes by reduced costs"
+                                 << std::endl;
+#endif
+  }
+}
+
+
+void BranchAndBound::syncHeurWorker_()
+{
+  if (!heurWorker_) {
+    return;
+  }
+  if (nodePrcssr_->foundNewSolution()) {
+    heurWorker_->postIncumbent(solPool_->getBestSolution());
+  }
+  heurWorker_->postPoint(nodePrcssr_->getRelSolution());
+  if (heurWorker_->getSolutions(solPool_)) {
+    tm_->setUb(solPool_->getBestSolutionValue());
+    fixNodes_ = true;
+  }
+}
+
+
+void BranchAndBound::syncRace_()
+{
+  DoubleVector x;
+  double val;
+
+  if (!raceBoard_) {
+    return;
+  }
+  if (solPool_->getBestSolutionValue() < raceBoard_->getBestValue()) {
+    raceBoard_->post(raceId_, solPool_->getBestSolution()->getPrimal(),
+                     solPool_->getBestSolutionValue());
+  }
+  if (raceBoard_->getBest(tm_->getUb(), x, val)) {
+    // a runner that added variables to its problem can only use the value.
+    if (x.size() == problem_->getNumVars()) {
+      solPool_->addSolution(&x[0], val);
+    }
+    tm_->setUb(val);
+    fixNodes_ = true;
+  }
+}
+
+
 NodeProcessorPtr BranchAndBound::getNodeProcessor()
 {
   return nodePrcssr_;
@@ -162,11 +252,16 @@ NodePtr BranchAndBound::processRoot_(bool* should_prune, bool* should_dive)
     logger_->msgStream(LogDebug) << me_ << "processing root node" << std::endl;
 #endif
 
+    if(recorder_) {
+      recorder_->record(current_node, rel);
+    }
     nodePrcssr_->processRootNode(current_node, rel, solPool_);
     ++stats_->nodesProc;
     if(nodePrcssr_->foundNewSolution()) {
       tm_->setUb(solPool_->getBestSolutionValue());
     }
+    syncHeurWorker_();
+    syncRace_();
 
     prune = shouldPrune_(current_node);
   }
@@ -208,6 +303,10 @@ void BranchAndBound::setLogLevel(LogLevel level)
 void BranchAndBound::setNodeProcessor(NodeProcessorPtr p)
 {
   nodePrcssr_ = p;
+  // heuristics before the root and at nodes share one time budget.
+  if (p) {
+    p->shareHeurBudget(heurSched_);
+  }
 }
 
 void BranchAndBound::setNodeRelaxer(NodeRelaxerPtr nr)
@@ -215,6 +314,28 @@ void BranchAndBound::setNodeRelaxer(NodeRelaxerPtr nr)
   nodeRlxr_ = nr;
 }
 
+void BranchAndBound::setRCHandler(RCHandler *h)
+{
+  rcHandler_ = h;
+}
+
+
+void BranchAndBound::setHeurWorker(HeurWorker *w)
+{
+  if (heurWorker_) {
+    delete heurWorker_;
+  }
+  heurWorker_ = w;
+}
+
+
+void BranchAndBound::setRaceBoard(RaceBoard *board, UInt id)
+{
+  raceBoard_ = board;
+  raceId_ = id;
+}
+
+
 void BranchAndBound::shouldCreateRoot(bool b)
 {
   options_->createRoot = b;
@@ -259,7 +380,9 @@ bool BranchAndBound::shouldStop_()
   } else if(tm_->getPerGap() <= options_->perGapLimit) {
     stop_bnb = true;
     status_ = SolvedGapLimit;
-  } else if(timer_->query() > options_->timeLimit) {
+  } else if((raceBoard_ ? timer_->wQuery() : timer_->query()) >
+             options_->timeLimit) {
+    // runners of a race share the cpu time of the process.
     stop_bnb = true;
     status_ = TimeLimitReached;
   } else if(stats_->nodesProc >= options_->nodeLimit) {
@@ -268,6 +391,9 @@ bool BranchAndBound::shouldStop_()
   } else if(solPool_->getNumSolsFound() >= options_->solLimit) {
     stop_bnb = true;
     status_ = SolLimitReached;
+  } else if(raceBoard_ && raceBoard_->isOver()) {
+    stop_bnb = true;
+    status_ = Interrupted;
   }
 
   return stop_bnb;
@@ -364,15 +490,22 @@ void BranchAndBound::solve()
   // TODO: use user options to set the pool size. For now it is 1.
   solPool_ = (SolutionPoolPtr) new SolutionPool(env_, problem_, 1);
 
+  // the worker runs its heuristics while the tree is searched.
+  if(heurWorker_) {
+    heurWorker_->start();
+  }
+
   // call heuristics before the root, if needed
-  for(HeurVector::iterator it = preHeurs_.begin(); it != preHeurs_.end();
-      ++it) {
-    (*it)->solve(current_node, rel, solPool_);
-    if(solPool_->getBestSolutionValue() < INFINITY) {
-      break;
+  heurSched_->solve(current_node, rel, solPool_);
+  tm_->setUb(solPool_->getBestSolutionValue());
+
+  if(!options_->recordFile.empty() && !recorder_) {
+    recorder_ = new NodeRecorder(env_);
+    if(0 != recorder_->open(options_->recordFile)) {
+      delete recorder_;
+      recorder_ = 0;
     }
   }
-  tm_->setUb(solPool_->getBestSolutionValue());
 
   // do the root
   current_node = processRoot_(&should_prune, &dived_prev);
@@ -418,6 +551,9 @@ void BranchAndBound::solve()
     should_dive = false;
     rel =
         nodeRlxr_->createNodeRelaxation(current_node, dived_prev, should_prune);
+    if(recorder_) {
+      recorder_->record(current_node, rel);
+    }
     nodePrcssr_->process(current_node, rel, solPool_);
 
     ++stats_->nodesProc;
@@ -431,7 +567,10 @@ void BranchAndBound::solve()
 
     if(nodePrcssr_->foundNewSolution()) {
       tm_->setUb(solPool_->getBestSolutionValue());
+      fixNodes_ = true;
     }
+    syncHeurWorker_();
+    syncRace_();
 
     should_prune = shouldPrune_(current_node);
     if(should_prune) {
@@ -443,6 +582,8 @@ void BranchAndBound::solve()
       if(!dived_prev) {
         tm_->removeActiveNode(current_node);
       }
+      // current_node may have been deleted by pruneNode.
+      fixActiveNodes_(0);
       new_node = tm_->getCandidate();
       dived_prev = false;
     } else {
@@ -455,6 +596,7 @@ void BranchAndBound::solve()
       if(!dived_prev) {
         tm_->removeActiveNode(current_node);
       }
+      fixActiveNodes_(current_node);
       should_dive = tm_->shouldDive();
 
       new_node = tm_->branch(branches, current_node, ws);
@@ -499,6 +641,20 @@ void BranchAndBound::solve()
 #endif
     }
   }
+  if(heurWorker_) {
+    heurWorker_->stop();
+    if(heurWorker_->getSolutions(solPool_)) {
+      tm_->setUb(solPool_->getBestSolutionValue());
+      tm_->updateLb();
+    }
+  }
+  if(raceBoard_) {
+    if(solPool_->getBestSolutionValue() < raceBoard_->getBestValue()) {
+      raceBoard_->post(raceId_, solPool_->getBestSolution()->getPrimal(),
+                       solPool_->getBestSolutionValue());
+    }
+    raceBoard_->finish(raceId_, status_);
+  }
   showStatus_(false, true);
   //logger_->msgStream(LogError) << " " << std::endl;
   logger_->msgStream(LogError)
@@ -511,6 +667,9 @@ void BranchAndBound::solve()
       << me_ << "stopping branch-and-bound" << std::endl
       << me_ << "nodes processed = " << stats_->nodesProc << std::endl
       << me_ << "nodes created   = " << tm_->getSize() << std::endl;
+  if(recorder_) {
+    recorder_->close();
+  }
   stats_->timeUsed = timer_->query()-tstart;
 }
 
@@ -526,7 +685,15 @@ void BranchAndBound::writeStats(std::ostream& out)
       ++it) {
     (*it)->writeStats(out);
   }
+  heurSched_->writeStats(out);
+  if(heurWorker_) {
+    heurWorker_->writeStats(out);
+  }
   solPool_->writeStats(out);
+  if(recorder_) {
+    recorder_->writeStats(out);
+  }
+  env_->getProfiler()->writeStats(out);
 }
 
 double BranchAndBound::totalTime()
@@ -563,6 +730,7 @@ BabOptions::BabOptions(EnvPtr env)
   perGapLimit = options->findDouble("obj_gap_percent")->getValue();
   solLimit = options->findInt("sol_limit")->getValue();
   timeLimit = options->findDouble("time_limit")->getValue();
+  recordFile = options->findString("record_file")->getValue();
   createRoot = true;
 }
 
@@ -29,6 +29,11 @@ namespace Minotaur {
 
   struct  BabOptions;
   struct  BabStats;
+  class   HeurScheduler;
+  class   HeurWorker;
+  class   NodeRecorder;
+  class   RaceBoard;
+  class   RCHandler;
   typedef BabOptions* BabOptionsPtr;
 
 
@@ -50,7 +55,8 @@ namespace Minotaur {
     /** 
      * \brief Add a heuristic that will be called before root node.
      * \param [in] h The heuristic that should be called. This heuristic will
-     * be called after all previously added heuristic.
+     * be called after all previously added heuristic. Heuristics are called
+     * through a HeurScheduler that accounts for their effort.
      */
     void addPreRootHeur(HeurPtr h);
 
@@ -119,7 +125,8 @@ namespace Minotaur {
     void setLogLevel(LogLevel level);
 
     /**
-     * \brief Set the NodeProcessor that processes each node.
+     * \brief Set the NodeProcessor that processes each node. Heuristics
+     * it calls share the time budget of the heuristics added here.
      *
      * \param [in] p The desired node-processor.
      */
@@ -132,6 +139,36 @@ namespace Minotaur {
      */
     void setNodeRelaxer(NodeRelaxerPtr nr);
 
+    /**
+     * \brief Set the handler used to tighten open nodes by reduced costs
+     * whenever a better solution is found.
+     *
+     * \param [in] h The reduced cost handler. It must also be one of the
+     * handlers of the node processor, and save reduced costs of nodes.
+     */
+    void setRCHandler(RCHandler *h);
+
+    /**
+     * \brief Set a worker that runs heuristics in a separate thread during
+     * the search. It is started at the beginning of solve() and stopped at
+     * the end. Branch-and-bound owns it.
+     *
+     * \param [in] w The worker.
+     */
+    void setHeurWorker(HeurWorker *w);
+
+    /**
+     * \brief Take part in a race with other solvers. Better solutions are
+     * exchanged through the board after each node, and the search stops
+     * when another runner wins. The time limit is then checked against
+     * wall time, because all runners use the cpu time of one process. The
+     * board is not owned.
+     *
+     * \param [in] board The board shared by all runners.
+     * \param [in] id The number of this runner on the board.
+     */
+    void setRaceBoard(RaceBoard *board, UInt id);
+
     /**
      * \brief Switch to turn on/off root-node creation.
      *
@@ -157,9 +194,21 @@ namespace Minotaur {
     /// Pointer to the enviroment.
     EnvPtr env_;
 
+    /// Decides which of the preHeurs_ to call and records their effort.
+    HeurScheduler *heurSched_;
+
+    /// True if a better solution was found and open nodes are not yet fixed.
+    bool fixNodes_;
+
+    /// Runs heuristics in a separate thread. May be NULL.
+    HeurWorker *heurWorker_;
+
     /// Log manager for displaying messages.
     LoggerPtr logger_;
 
+    /// Records relaxations of nodes if options_->recordFile is set.
+    NodeRecorder *recorder_;
+
     /// String name used in log messages.
     static const std::string me_;
 
@@ -172,6 +221,15 @@ namespace Minotaur {
     /// Options.
     BabOptionsPtr options_;
 
+    /// Board of the race this search is part of. May be NULL.
+    RaceBoard *raceBoard_;
+
+    /// Number of this runner on raceBoard_.
+    UInt raceId_;
+
+    /// Handler for tightening open nodes by reduced costs. May be NULL.
+    RCHandler *rcHandler_;
+
     /**
      * \brief Heuristics that need to be called before creating and solving the root
      * node.
@@ -205,6 +263,30 @@ namespace Minotaur {
     /// The TreeManager used to manage the search tree.
     TreeManagerPtr tm_;
 
+    /**
+     * \brief Prune or tighten open nodes by reduced costs if a better
+     * solution was found since the last call (fixNodes_ is true).
+     *
+     * Pruning reorders the heap of open nodes. So it must be called only
+     * after current_node has been removed from it.
+     *
+     * \param [in] current_node The node being processed, or NULL if it has
+     * been pruned. It is not changed.
+     */
+    void fixActiveNodes_(NodePtr current_node);
+
+    /**
+     * \brief Exchange points and solutions with heurWorker_ after a node is
+     * processed.
+     */
+    void syncHeurWorker_();
+
+    /**
+     * \brief Post a better solution to raceBoard_ after a node is processed,
+     * and take a better solution of another runner from it.
+     */
+    void syncRace_();
+
     /**
      * \brief Process the root node.
      *
@@ -281,6 +363,9 @@ namespace Minotaur {
     /// Limit on number of nodes processed.
     UInt solLimit;
 
+    /// File for recording relaxations of nodes. Not recorded if empty.
+    std::string recordFile;
+
     /// Time limit in seconds for the branch-and-bound.
     double timeLimit;
   };
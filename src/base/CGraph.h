@@ -32,6 +32,9 @@ namespace Minotaur {
 
   class CGraph : public NonlinearFunction {
   public:
+    /// ProbSnapshot writes the nodes of the graph directly.
+    friend class ProbSnapshot;
+
     /// Default constructor.
     CGraph();
 
@@ -12,6 +12,7 @@
  * \author Ashutosh Mahajan, Argonne National Laboratory
  */
 
+#include <algorithm>
 #include <cerrno>
 #include <cmath>
 #include <iostream>
@@ -19,6 +20,7 @@
 
 #include "MinotaurConfig.h"
 #include "CNode.h"
+#include "Interval.h"
 #include "Operations.h"
 #include "Variable.h"
 
@@ -1248,6 +1250,7 @@ void CNode::propBounds(bool *is_inf, int *error)
   errno = 0;  //declared in cerrno
   double lb = -INFINITY;
   double ub = INFINITY;
+  Interval iv;
   switch (op_) {
   case (OpAbs):
     assert(lb_ > -1e-12);
@@ -1292,14 +1295,17 @@ void CNode::propBounds(bool *is_inf, int *error)
     // TODO: Implement me
     break;
   case (OpDiv):
-    BoundsOnProduct(false, r_->lb_, r_->ub_, lb_, ub_, lb, ub);
-    l_->propBounds_(lb, ub, is_inf);
-    BoundsOnDiv(l_->lb_, l_->ub_, lb_, ub_, lb, ub);
-    r_->propBounds_(lb, ub, is_inf);
+    iv = IntervalMul(Interval(r_->lb_, r_->ub_), Interval(lb_, ub_));
+    l_->propBounds_(iv.getLb(), iv.getUb(), is_inf);
+    iv = IntervalRevMul(Interval(l_->lb_, l_->ub_), Interval(lb_, ub_));
+    r_->propBounds_(iv.getLb(), iv.getUb(), is_inf);
     break;
   case (OpExp):
-    lb = log(lb_);
-    ub = log(ub_);
+    // log(0) is a pole error, and exp is positive anyway.
+    if (lb_ > 0.0) {
+      lb = LibmDown(log(lb_));
+    }
+    ub = (ub_ > 0.0) ? LibmUp(log(ub_)) : -INFINITY;
     l_->propBounds_(lb, ub, is_inf);
     break;
   case (OpFloor):
@@ -1311,40 +1317,36 @@ void CNode::propBounds(bool *is_inf, int *error)
     // TODO: Implement me
     break;
   case (OpLog):
-    lb = exp(lb_);
-    ub = exp(ub_);
+    lb = LibmDown(exp(lb_));
+    ub = LibmUp(exp(ub_));
     l_->propBounds_(lb, ub, is_inf);
     break;
   case (OpLog10):
-    lb = pow(10.0, lb_);
-    ub = pow(10.0, ub_);
+    lb = LibmDown(pow(10.0, lb_));
+    ub = LibmUp(pow(10.0, ub_));
     l_->propBounds_(lb, ub, is_inf);
     break;
   case (OpMinus):
-    lb = lb_ + r_->lb_;
-    ub = ub_ + r_->ub_;
-    l_->propBounds_(lb, ub, is_inf);
-    lb = l_->lb_ - ub_;
-    ub = l_->ub_ - lb_;
-    r_->propBounds_(lb, ub, is_inf);
+    iv = IntervalAdd(Interval(lb_, ub_), Interval(r_->lb_, r_->ub_));
+    l_->propBounds_(iv.getLb(), iv.getUb(), is_inf);
+    iv = IntervalSub(Interval(l_->lb_, l_->ub_), Interval(lb_, ub_));
+    r_->propBounds_(iv.getLb(), iv.getUb(), is_inf);
     break;
   case (OpMult):
-    BoundsOnDiv(lb_, ub_, r_->lb_, r_->ub_, lb, ub);
-    l_->propBounds_(lb, ub, is_inf);
-    BoundsOnDiv(lb_, ub_, l_->lb_, l_->ub_, lb, ub);
-    r_->propBounds_(lb, ub, is_inf);
+    iv = IntervalRevMul(Interval(lb_, ub_), Interval(r_->lb_, r_->ub_));
+    l_->propBounds_(iv.getLb(), iv.getUb(), is_inf);
+    iv = IntervalRevMul(Interval(lb_, ub_), Interval(l_->lb_, l_->ub_));
+    r_->propBounds_(iv.getLb(), iv.getUb(), is_inf);
     break;
   case (OpNone):
     break;
   case (OpNum):
     break;
   case (OpPlus):
-    lb = lb_ - r_->ub_;
-    ub = ub_ - r_->lb_;
-    l_->propBounds_(lb, ub, is_inf);
-    lb = lb_ - l_->ub_;
-    ub = ub_ - l_->lb_;
-    r_->propBounds_(lb, ub, is_inf);
+    iv = IntervalSub(Interval(lb_, ub_), Interval(r_->lb_, r_->ub_));
+    l_->propBounds_(iv.getLb(), iv.getUb(), is_inf);
+    iv = IntervalSub(Interval(lb_, ub_), Interval(l_->lb_, l_->ub_));
+    r_->propBounds_(iv.getLb(), iv.getUb(), is_inf);
     break;
   case (OpPow):
     // TODO: Implement me
@@ -1355,21 +1357,21 @@ void CNode::propBounds(bool *is_inf, int *error)
         if (ub_ < -1e-12) {
           *error = 3141;
         } else {
-          ub = pow(ub_, 1.0 / r_->val_);
+          ub = RootUp(std::max(ub_, 0.0), r_->val_);
           lb = -ub;
           l_->propBounds_(lb, ub, is_inf);
           // std::cout << "new bounds = " << lb << " " << ub << std::endl;
         }
       } else if (isInt((r_->val_ + 1) / 2.0)) {
-        if (lb < 0) {
-          lb = -pow(-lb_, 1.0 / r_->val_);
+        if (lb_ < 0) {
+          lb = -RootUp(-lb_, r_->val_);
         } else {
-          lb = pow(lb_, 1.0 / r_->val_);
+          lb = RootDown(lb_, r_->val_);
         }
-        if (ub < 0) {
-          ub = -pow(-ub_, 1.0 / r_->val_);
+        if (ub_ < 0) {
+          ub = -RootDown(-ub_, r_->val_);
         } else {
-          ub = pow(ub_, 1.0 / r_->val_);
+          ub = RootUp(ub_, r_->val_);
         }
         l_->propBounds_(lb, ub, is_inf);
       }
@@ -1384,17 +1386,17 @@ void CNode::propBounds(bool *is_inf, int *error)
     // TODO: Implement me
     break;
   case (OpSqr):
-    ub = sqrt(ub);
+    ub = SqrtUp(std::max(ub_, 0.0));
     lb = -ub;
     l_->propBounds_(lb, ub, is_inf);
     break;
   case (OpSqrt):
     if (ub_ < 0.0) {
       *is_inf = true;
-    } else if (lb >= 0.0) {
-      l_->propBounds_(lb * lb, ub * ub, is_inf);
+    } else if (lb_ >= 0.0) {
+      l_->propBounds_(MulDown(lb_, lb_), MulUp(ub_, ub_), is_inf);
     } else {
-      l_->propBounds_(0.0, ub * ub, is_inf);
+      l_->propBounds_(0.0, MulUp(ub_, ub_), is_inf);
     }
     break;
   case (OpSumList): {
@@ -1408,7 +1410,7 @@ void CNode::propBounds(bool *is_inf, int *error)
     lb = 0.0;
     for (UInt i = 0; i < numChild_; ++i, ++c) {
       if ((*c)->lb_ > -INFINITY) {
-        lb += (*c)->lb_;
+        lb = AddDown(lb, (*c)->lb_);
       } else if (true == inf_lb) {
         lb = -INFINITY;
         break;
@@ -1421,7 +1423,7 @@ void CNode::propBounds(bool *is_inf, int *error)
     ub = 0.0;
     for (UInt i = 0; i < numChild_; ++i, ++c) {
       if ((*c)->ub_ < INFINITY) {
-        ub += (*c)->ub_;
+        ub = AddUp(ub, (*c)->ub_);
       } else if (true == inf_ub) {
         ub = INFINITY;
         break;
@@ -1437,22 +1439,22 @@ void CNode::propBounds(bool *is_inf, int *error)
         tub = INFINITY;
         if (ub < INFINITY) {
           if (false == inf_ub) {
-            tlb = lb_ - (ub - (*c)->ub_);
+            tlb = SubDown(lb_, SubUp(ub, (*c)->ub_));
           } else if ((*c)->ub_ < INFINITY) {
             tlb = -INFINITY;
           } else {
-            tlb = lb_ - ub;
+            tlb = SubDown(lb_, ub);
           }
         } else {
           tlb = -INFINITY;
         }
         if (lb > -INFINITY) {
           if (false == inf_lb) {
-            tub = ub_ - (lb - (*c)->lb_);
+            tub = SubUp(ub_, SubDown(lb, (*c)->lb_));
           } else if ((*c)->lb_ > -INFINITY) {
             tub = INFINITY;
           } else {
-            tub = ub_ - lb;
+            tub = SubUp(ub_, lb);
           }
         } else {
           tub = INFINITY;
@@ -1683,6 +1685,8 @@ void CNode::setVal(double v)
 
 void CNode::updateBnd(int *error)
 {
+  Interval iv;
+
   errno = 0;  //declared in cerrno
   switch (op_) {
   case (OpAbs):
@@ -1705,7 +1709,7 @@ void CNode::updateBnd(int *error)
     break;
   case (OpAcos):
     lb_ = 0.0;
-    ub_ = PI;
+    ub_ = NextUp(PI);
     break;
   case (OpAcosh):
     // TODO: Implement me
@@ -1713,8 +1717,8 @@ void CNode::updateBnd(int *error)
     ub_ = INFINITY;
     break;
   case (OpAsin):
-    lb_ = -PI / 2;
-    ub_ = PI / 2;
+    lb_ = NextDown(-PI / 2);
+    ub_ = NextUp(PI / 2);
     break;
   case (OpAsinh):
     // TODO: Implement me
@@ -1722,8 +1726,8 @@ void CNode::updateBnd(int *error)
     ub_ = INFINITY;
     break;
   case (OpAtan):
-    lb_ = -PI / 2;
-    ub_ = PI / 2;
+    lb_ = NextDown(-PI / 2);
+    ub_ = NextUp(PI / 2);
     break;
   case (OpAtanh):
     // TODO: Implement me
@@ -1749,18 +1753,20 @@ void CNode::updateBnd(int *error)
     ub_ = INFINITY;
     break;
   case (OpDiv):
-    BoundsOnDiv(l_->lb_, l_->ub_, r_->lb_, r_->ub_, lb_, ub_);
+    iv = IntervalDiv(Interval(l_->lb_, l_->ub_), Interval(r_->lb_, r_->ub_));
+    lb_ = iv.getLb();
+    ub_ = iv.getUb();
     break;
   case (OpExp):
     if (l_->lb_ == -INFINITY) {
       lb_ = 0.0;
     } else {
-      lb_ = exp(l_->lb_);
+      lb_ = std::max(0.0, LibmDown(exp(l_->lb_)));
     }
     if (l_->ub_ == INFINITY) {
       ub_ = INFINITY;
     } else {
-      ub_ = exp(l_->ub_);
+      ub_ = LibmUp(exp(l_->ub_));
     }
     break;
   case (OpFloor):
@@ -1776,24 +1782,27 @@ void CNode::updateBnd(int *error)
     if (l_->lb_ <= 0.0) {
       lb_ = -INFINITY;
     } else {
-      lb_ = log(l_->lb_);
+      lb_ = LibmDown(log(l_->lb_));
     }
-    ub_ = log(l_->ub_);
+    ub_ = LibmUp(log(l_->ub_));
     break;
   case (OpLog10):
     if (l_->lb_ <= 0.0) {
       lb_ = -INFINITY;
     } else {
-      lb_ = log10(l_->lb_);
+      lb_ = LibmDown(log10(l_->lb_));
     }
-    ub_ = log10(l_->ub_);
+    ub_ = LibmUp(log10(l_->ub_));
     break;
   case (OpMinus):
-    lb_ = l_->lb_ - r_->ub_;
-    ub_ = l_->ub_ - r_->lb_;
+    iv = IntervalSub(Interval(l_->lb_, l_->ub_), Interval(r_->lb_, r_->ub_));
+    lb_ = iv.getLb();
+    ub_ = iv.getUb();
     break;
   case (OpMult):
-    BoundsOnProduct(true, l_->lb_, l_->ub_, r_->lb_, r_->ub_, lb_, ub_);
+    iv = IntervalMul(Interval(l_->lb_, l_->ub_), Interval(r_->lb_, r_->ub_));
+    lb_ = iv.getLb();
+    ub_ = iv.getUb();
     break;
   case (OpNone):
     break;
@@ -1806,8 +1815,9 @@ void CNode::updateBnd(int *error)
     ub_ = d_;
     break;
   case (OpPlus):
-    lb_ = l_->lb_ + r_->lb_;
-    ub_ = l_->ub_ + r_->ub_;
+    iv = IntervalAdd(Interval(l_->lb_, l_->ub_), Interval(r_->lb_, r_->ub_));
+    lb_ = iv.getLb();
+    ub_ = iv.getUb();
     break;
   case (OpPow):
     // TODO: Implement me
@@ -1834,23 +1844,26 @@ void CNode::updateBnd(int *error)
     ub_ = INFINITY;
     break;
   case (OpSqr):
-    BoundsOnSquare(l_->lb_, l_->ub_, lb_, ub_);
+    iv = IntervalSqr(Interval(l_->lb_, l_->ub_));
+    lb_ = iv.getLb();
+    ub_ = iv.getUb();
     break;
   case (OpSqrt):
     if (l_->lb_ < 1e-12) {
       lb_ = 0.0;
     } else {
-      lb_ = sqrt(l_->lb_);
+      lb_ = SqrtDown(l_->lb_);
     }
-    ub_ = sqrt(l_->ub_);
+    ub_ = SqrtUp(l_->ub_);
     break;
   case (OpSumList): {
-    lb_ = ub_ = 0.0;
     CNode **c = child_;
+    iv = Interval(0.0, 0.0);
     for (UInt i = 0; i < numChild_; ++i, ++c) {
-      lb_ += (*c)->lb_;
-      ub_ += (*c)->ub_;
+      iv = IntervalAdd(iv, Interval((*c)->lb_, (*c)->ub_));
     }
+    lb_ = iv.getLb();
+    ub_ = iv.getUb();
   } break;
   case (OpTan):
     // TODO: Implement me
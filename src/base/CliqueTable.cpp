@@ -0,0 +1,392 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file CliqueTable.cpp
+ * \brief Define class CliqueTable for storing implications and cliques of
+ * binary variables of a problem.
+ * \author The Minotaur Team
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+#include "MinotaurConfig.h"
+#include "CliqueTable.h"
+#include "Constraint.h"
+#include "Environment.h"
+#include "Function.h"
+#include "LinearFunction.h"
+#include "Logger.h"
+#include "Problem.h"
+#include "Timer.h"
+#include "VarBoundMod.h"
+#include "Variable.h"
+
+using namespace Minotaur;
+
+const std::string CliqueTable::me_ = "CliqueTable: ";
+
+CliqueTable::CliqueTable(EnvPtr env, ProblemPtr p)
+  : env_(env),
+    p_(p),
+    nvars_(0)
+{
+  stats_.rows = 0;
+  stats_.added = 0;
+  stats_.time = 0.0;
+  cStart_.push_back(0);
+}
+
+
+CliqueTable::~CliqueTable()
+{
+  pending_.clear();
+}
+
+
+void CliqueTable::addClique(const UIntVector &lits)
+{
+  if (lits.size() > 1) {
+    pending_.push_back(lits);
+    ++stats_.added;
+  }
+}
+
+
+void CliqueTable::addImplication(UInt lit1, UInt lit2)
+{
+  UIntVector lits(2);
+  lits[0] = lit1;
+  lits[1] = negate(lit2);
+  addClique(lits);
+}
+
+
+void CliqueTable::build()
+{
+  Timer *timer = env_->getNewTimer();
+  ConstraintPtr c;
+  LinearFunctionPtr lf;
+  std::vector<std::pair<VariablePtr, double> > terms;
+
+  timer->start();
+  for (ConstraintConstIterator it=p_->consBegin(); it!=p_->consEnd(); ++it) {
+    c = *it;
+    if (Linear != c->getFunctionType()) {
+      continue;
+    }
+    lf = c->getLinearFunction();
+    terms.clear();
+    for (VariableGroupConstIterator it2=lf->termsBegin(); it2!=lf->termsEnd();
+         ++it2) {
+      terms.push_back(std::make_pair(it2->first, it2->second));
+    }
+    if (c->getUb() < INFINITY) {
+      rowClique_(terms, c->getUb());
+    }
+    if (c->getLb() > -INFINITY) {
+      for (UInt i=0; i<terms.size(); ++i) {
+        terms[i].second = -terms[i].second;
+      }
+      rowClique_(terms, -c->getLb());
+    }
+  }
+  finalize();
+  stats_.time += timer->query();
+  delete timer;
+
+  writeStats(env_->getLogger()->msgStream(LogExtraInfo));
+}
+
+
+void CliqueTable::finalize()
+{
+  std::vector<UIntVector> all;
+  UIntVector cnt;
+  UIntVector pos;
+
+  // old cliques, then new ones.
+  for (UInt i=0; i+1<cStart_.size(); ++i) {
+    all.push_back(UIntVector(litsBegin(i), litsEnd(i)));
+  }
+  nvars_ = std::max(nvars_, (UInt) p_->getNumVars());
+  for (UInt i=0; i<pending_.size(); ++i) {
+    UIntVector &lits = pending_[i];
+    std::sort(lits.begin(), lits.end());
+    lits.erase(std::unique(lits.begin(), lits.end()), lits.end());
+    bool both = false;
+    for (UInt j=0; j+1<lits.size(); ++j) {
+      if (lits[j+1] == negate(lits[j])) {
+        both = true;
+        break;
+      }
+    }
+    // a clique with both literals of a variable fixes all the others.
+    // That is a fixing, not a conflict, and is left to presolve.
+    if (lits.size() > 1 && false == both) {
+      all.push_back(lits);
+      nvars_ = std::max(nvars_, getVarIndex(lits.back())+1);
+    }
+  }
+  pending_.clear();
+
+  cStart_.assign(1, 0);
+  clit_.clear();
+  cnt.assign(2*nvars_+1, 0);
+  for (UInt i=0; i<all.size(); ++i) {
+    for (UInt j=0; j<all[i].size(); ++j) {
+      clit_.push_back(all[i][j]);
+      ++cnt[all[i][j]+1];
+    }
+    cStart_.push_back(clit_.size());
+  }
+
+  // cliques of each literal, in increasing order.
+  lStart_.assign(2*nvars_+1, 0);
+  for (UInt l=0; l<2*nvars_; ++l) {
+    lStart_[l+1] = lStart_[l] + cnt[l+1];
+  }
+  lcl_.assign(clit_.size(), 0);
+  pos.assign(lStart_.begin(), lStart_.end()-1);
+  for (UInt i=0; i<all.size(); ++i) {
+    for (UInt j=0; j<all[i].size(); ++j) {
+      lcl_[pos[all[i][j]]++] = i;
+    }
+  }
+}
+
+
+bool CliqueTable::isConflict(UInt lit1, UInt lit2) const
+{
+  if (lit1 == lit2 || getDegree(lit1) == 0 || getDegree(lit2) == 0) {
+    return false;
+  }
+  if (getDegree(lit1) > getDegree(lit2)) {
+    std::swap(lit1, lit2);
+  }
+  for (const UInt *c=cliquesBegin(lit1); c!=cliquesEnd(lit1); ++c) {
+    if (std::binary_search(litsBegin(*c), litsEnd(*c), lit2)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+double CliqueTable::litVal_(const double *x, ProblemPtr p, UInt lit) const
+{
+  VariablePtr v = p->getVariable(getVarIndex(lit));
+  double val;
+
+  if (Binary != v->getType()) {
+    return -1.0;
+  }
+  val = x[getVarIndex(lit)];
+  return getValue(lit) ? val : 1.0 - val;
+}
+
+
+UInt CliqueTable::propagate(ProblemPtr p, UIntQ &lits, ModQ *mods,
+                            bool *is_inf) const
+{
+  UInt n = std::min(nvars_, (UInt) p->getNumVars());
+  UInt nfixed = 0;
+  VariablePtr v;
+  VarBoundModPtr mod;
+
+  *is_inf = false;
+  if (isEmpty()) {
+    lits.clear();
+    return 0;
+  }
+
+  // every other literal in a clique of a true literal is false.
+  while (false == lits.empty()) {
+    UInt l = lits.front();
+    lits.pop_front();
+    if (getVarIndex(l) >= n) {
+      continue;
+    }
+    for (const UInt *c=cliquesBegin(l); c!=cliquesEnd(l); ++c) {
+      for (const UInt *m=litsBegin(*c); m!=litsEnd(*c); ++m) {
+        if (*m == l || getVarIndex(*m) >= n) {
+          continue;
+        }
+        v = p->getVariable(getVarIndex(*m));
+        if (Binary != v->getType()) {
+          continue;
+        }
+        if (getValue(*m)) {
+          if (v->getLb() > 0.5) {
+            *is_inf = true;
+            lits.clear();
+            return nfixed;
+          } else if (v->getUb() > 0.5) {
+            mod = (VarBoundModPtr) new VarBoundMod(v, Upper, 0.0);
+          } else {
+            continue;
+          }
+        } else {
+          if (v->getUb() < 0.5) {
+            *is_inf = true;
+            lits.clear();
+            return nfixed;
+          } else if (v->getLb() < 0.5) {
+            mod = (VarBoundModPtr) new VarBoundMod(v, Lower, 1.0);
+          } else {
+            continue;
+          }
+        }
+        mod->applyToProblem(p);
+        mods->push_back(mod);
+        lits.push_back(negate(*m));
+        ++nfixed;
+      }
+    }
+  }
+  return nfixed;
+}
+
+
+void CliqueTable::rowClique_(const std::vector<std::pair<VariablePtr, double> >
+                             &terms, double b)
+{
+  const double tol = 1e-6;
+  std::vector<std::pair<double, UInt> > w;
+  VariablePtr v;
+  double a;
+
+  // write the constraint as sum_i w_i l_i <= b with positive weights w_i on
+  // literals l_i, and move the least value of other terms to the right.
+  for (UInt i=0; i<terms.size(); ++i) {
+    v = terms[i].first;
+    a = terms[i].second;
+    if (fabs(a) < tol) {
+      continue;
+    }
+    if (v->getLb() == v->getUb()) {
+      b -= a*v->getLb();
+    } else if (Binary == v->getType()) {
+      if (a > 0) {
+        w.push_back(std::make_pair(a, getLiteral(v->getIndex(), true)));
+      } else {
+        w.push_back(std::make_pair(-a, getLiteral(v->getIndex(), false)));
+        b -= a;
+      }
+    } else if (a > 0 && v->getLb() > -INFINITY) {
+      b -= a*v->getLb();
+    } else if (a < 0 && v->getUb() < INFINITY) {
+      b -= a*v->getUb();
+    } else {
+      return;
+    }
+  }
+  if (w.size() < 2) {
+    return;
+  }
+
+  // the largest weights that pairwise exceed b form a clique.
+  std::sort(w.begin(), w.end(), std::greater<std::pair<double, UInt> >());
+  UInt k = 0;
+  while (k+1 < w.size() && w[k].first + w[k+1].first > b + tol) {
+    ++k;
+  }
+  if (k > 0) {
+    UIntVector lits(k+1);
+    for (UInt i=0; i<=k; ++i) {
+      lits[i] = w[i].second;
+    }
+    pending_.push_back(lits);
+    ++stats_.rows;
+  }
+}
+
+
+void CliqueTable::separate(const double *x, ProblemPtr p,
+                           std::vector<UIntVector> &cuts, UInt max_cuts) const
+{
+  const double tol = 1e-6;
+  const double vtol = 1e-4;
+  UInt n = std::min(nvars_, (UInt) p->getNumVars());
+  std::vector<std::pair<double, UInt> > frac;
+  std::vector<std::pair<double, UInt> > cand;
+  std::set<UIntVector> found;
+  UIntVector clique;
+  UInt ncuts = 0;
+  double val, sum;
+
+  if (isEmpty()) {
+    return;
+  }
+
+  for (UInt i=0; i<n; ++i) {
+    val = litVal_(x, p, getLiteral(i, true));
+    if (val > tol && val < 1.0 - tol) {
+      frac.push_back(std::make_pair(val, getLiteral(i, true)));
+      frac.push_back(std::make_pair(1.0 - val, getLiteral(i, false)));
+    }
+  }
+  std::sort(frac.begin(), frac.end(), std::greater<std::pair<double, UInt> >());
+
+  for (UInt f=0; f<frac.size() && ncuts<max_cuts; ++f) {
+    UInt l = frac[f].second;
+    cand.clear();
+    for (const UInt *c=cliquesBegin(l); c!=cliquesEnd(l); ++c) {
+      for (const UInt *m=litsBegin(*c); m!=litsEnd(*c); ++m) {
+        if (*m != l && getVarIndex(*m) < n) {
+          val = litVal_(x, p, *m);
+          if (val > tol) {
+            cand.push_back(std::make_pair(val, *m));
+          }
+        }
+      }
+    }
+    std::sort(cand.begin(), cand.end(),
+              std::greater<std::pair<double, UInt> >());
+    cand.erase(std::unique(cand.begin(), cand.end()), cand.end());
+
+    // neighbours of l are in conflict with it, check the others.
+    clique.assign(1, l);
+    sum = frac[f].first;
+    for (UInt i=0; i<cand.size(); ++i) {
+      bool add = true;
+      for (UInt j=1; j<clique.size(); ++j) {
+        if (false == isConflict(cand[i].second, clique[j])) {
+          add = false;
+          break;
+        }
+      }
+      if (add) {
+        clique.push_back(cand[i].second);
+        sum += cand[i].first;
+      }
+    }
+    if (sum > 1.0 + vtol) {
+      std::sort(clique.begin(), clique.end());
+      if (found.insert(clique).second) {
+        cuts.push_back(clique);
+        ++ncuts;
+      }
+    }
+  }
+}
+
+
+void CliqueTable::writeStats(std::ostream &out) const
+{
+  out << me_ << "number of cliques              = " << getNumCliques()
+      << std::endl
+      << me_ << "cliques from constraints       = " << stats_.rows
+      << std::endl
+      << me_ << "cliques added                  = " << stats_.added
+      << std::endl
+      << me_ << "number of literals in cliques  = " << clit_.size()
+      << std::endl
+      << me_ << "time taken to build table      = " << stats_.time
+      << std::endl;
+}
@@ -0,0 +1,190 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file CliqueTable.h
+ * \brief Declare class CliqueTable for storing implications and cliques of
+ * binary variables of a problem.
+ * \author The Minotaur Team
+ */
+
+#ifndef MINOTAURCLIQUETABLE_H
+#define MINOTAURCLIQUETABLE_H
+
+#include <iostream>
+
+#include "Types.h"
+
+namespace Minotaur {
+
+  /// Statistics of a clique table.
+  struct CliqueTableStats {
+    UInt rows;     ///> Number of constraints that gave a clique.
+    UInt added;    ///> Number of cliques added by addClique/addImplication.
+    double time;   ///> Time taken to build the table.
+  };
+
+  /**
+   * \brief A store of conflicts between binary variables.
+   *
+   * A literal is a binary variable or its complement. Literal 2i is true
+   * when the variable with index i is one, and 2i+1 is true when it is zero.
+   * A clique is a set of literals at most one of which can be true in any
+   * feasible solution. An implication "literal a true implies literal b
+   * true" is the clique {a, not b}.
+   *
+   * Cliques are extracted from linear constraints of the problem, including
+   * set-packing and set-partitioning constraints classified by
+   * Problem::classifyCon(), and may be added by other routines, e.g.
+   * probing. After finalize(), literals and cliques are stored in compact
+   * adjacency arrays: the cliques of each literal and the literals of each
+   * clique. Fixing a literal to true then fixes all its neighbours to false
+   * in time proportional to its degree.
+   *
+   * The table is built once after presolve and saved in the problem, see
+   * Problem::getCliqueTable(). Handlers use it for propagation at nodes and
+   * for separating clique inequalities, and heuristics may use it to check
+   * conflicts before fixing variables. It is indexed by the indices of the
+   * variables of the problem, which are the same as those of the original
+   * variables in relaxations created from it.
+   */
+  class CliqueTable {
+  public:
+    /// Create an empty table for problem p.
+    CliqueTable(EnvPtr env, ProblemPtr p);
+
+    /// Destroy.
+    ~CliqueTable();
+
+    /// Literal of variable with index ind taking value one (val true) or zero.
+    static UInt getLiteral(UInt ind, bool val) { return 2*ind + (val ? 0 : 1); }
+
+    /// Index of the variable of a literal.
+    static UInt getVarIndex(UInt lit) { return lit/2; }
+
+    /// Value of the variable when the literal is true.
+    static bool getValue(UInt lit) { return 0 == (lit & 1); }
+
+    /// Complement of a literal.
+    static UInt negate(UInt lit) { return lit ^ 1; }
+
+    /**
+     * \brief Add a clique. It is stored only when the table is finalized.
+     *
+     * \param [in] lits Literals, at most one of which can be true. Cliques
+     * with less than two literals are ignored.
+     */
+    void addClique(const UIntVector &lits);
+
+    /// Add implication: if lit1 is true, then lit2 is true.
+    void addImplication(UInt lit1, UInt lit2);
+
+    /**
+     * \brief Find cliques in the linear constraints of the problem and
+     * finalize the table.
+     */
+    void build();
+
+    /// Build adjacency arrays of all cliques added so far.
+    void finalize();
+
+    /// Number of cliques in the adjacency arrays.
+    UInt getNumCliques() const { return cStart_.size() - 1; }
+
+    /// Number of cliques that contain the literal.
+    UInt getDegree(UInt lit) const
+    { return (lit+1 < lStart_.size()) ? lStart_[lit+1] - lStart_[lit] : 0; }
+
+    /// First of the cliques that contain a literal.
+    const UInt* cliquesBegin(UInt lit) const
+    { return lcl_.empty() ? 0 : &lcl_[0] + lStart_[lit]; }
+
+    /// End of the cliques that contain a literal.
+    const UInt* cliquesEnd(UInt lit) const
+    { return lcl_.empty() ? 0 : &lcl_[0] + lStart_[lit+1]; }
+
+    /// First literal of a clique. Literals of a clique are sorted.
+    const UInt* litsBegin(UInt clique) const
+    { return &clit_[0] + cStart_[clique]; }
+
+    /// End of literals of a clique.
+    const UInt* litsEnd(UInt clique) const
+    { return &clit_[0] + cStart_[clique+1]; }
+
+    /// Return true if lit1 and lit2 are in a common clique.
+    bool isConflict(UInt lit1, UInt lit2) const;
+
+    /// Return true if the table has no cliques.
+    bool isEmpty() const { return clit_.empty(); }
+
+    /**
+     * \brief Fix binary variables of p that conflict with literals that
+     * have just become true, and so on for the variables fixed in turn.
+     * Only the cliques of these literals are visited. Does not change the
+     * table and may be called by several threads at once.
+     *
+     * \param [in] p The problem or a relaxation of it. Its first variables
+     * must be the variables of the problem of the table.
+     * \param [in,out] lits Literals that are true in p, e.g. of variables
+     * fixed by branching. It is empty on return.
+     * \param [out] mods Modifications made to p are appended here.
+     * \param [out] is_inf True if p is found to be infeasible.
+     * \return Number of variables fixed.
+     */
+    UInt propagate(ProblemPtr p, UIntQ &lits, ModQ *mods, bool *is_inf) const;
+
+    /**
+     * \brief Find cliques violated by a point.
+     *
+     * A clique is grown greedily from each literal with a fractional value,
+     * adding conflicting literals in decreasing order of value.
+     * \param [in] x The point, in the space of variables of p.
+     * \param [in] p The problem or a relaxation of it.
+     * \param [out] cuts Violated cliques, as literals, are appended here.
+     * \param [in] max_cuts Maximum number of cliques to find.
+     */
+    void separate(const double *x, ProblemPtr p,
+                  std::vector<UIntVector> &cuts, UInt max_cuts) const;
+
+    /// Write statistics to out.
+    void writeStats(std::ostream &out) const;
+
+  private:
+    /// Environment.
+    EnvPtr env_;
+
+    /// The problem whose variables are in the table.
+    ProblemPtr p_;
+
+    /// Statistics.
+    CliqueTableStats stats_;
+
+    /// Cliques added but not yet finalized.
+    std::vector<UIntVector> pending_;
+
+    /// Number of variables when the table was finalized.
+    UInt nvars_;
+
+    /// Literals of clique i are clit_[cStart_[i]], ..., clit_[cStart_[i+1]-1].
+    UIntVector cStart_;
+    UIntVector clit_;
+
+    /// Cliques of literal l are lcl_[lStart_[l]], ..., lcl_[lStart_[l+1]-1].
+    UIntVector lStart_;
+    UIntVector lcl_;
+
+    /// For logging.
+    static const std::string me_;
+
+    /// Find the clique in constraint sum_i a_i x_i <= b, if any.
+    void rowClique_(const std::vector<std::pair<VariablePtr, double> > &terms,
+                    double b);
+
+    /// Value of a literal at a point, -1 if the variable is not binary.
+    double litVal_(const double *x, ProblemPtr p, UInt lit) const;
+  };
+}
+#endif
@@ -43,6 +43,18 @@ namespace Minotaur {
     /// Add a new constraint to the engine.
     virtual void addConstraint(ConstraintPtr) = 0;
 
+    /**
+     * \brief Start a batch of changes to the loaded problem.
+     *
+     * Changes of bounds of variables made until the batch is committed may
+     * be saved and applied together, e.g. when the bounds of all variables
+     * modified at a node are restored. Batches may be nested, the changes
+     * are applied when the outermost one is committed. Any other operation
+     * on the engine, such as solve(), applies the saved changes first. By
+     * default, every change is applied when it is made.
+     */
+    virtual void beginUpdate() {};
+
     /// Change a bound of a constraint. 
     virtual void changeBound(ConstraintPtr cons, BoundType lu, 
                              double new_val) = 0;
@@ -78,6 +90,9 @@ namespace Minotaur {
     /// Clear the loaded problem, if any, from the engine.
     virtual void clear() = 0;
 
+    /// Commit a batch of changes started by beginUpdate().
+    virtual void commitUpdate() {};
+
     /// Restore settings after strong branching.
     virtual void disableStrBrSetup() = 0;
 
@@ -36,11 +36,18 @@ Environment::Environment()
   timer_->start();
   logger_ = (LoggerPtr) new Logger();
   options_ = (OptionDBPtr) new OptionDB();
+  profiler_ = new Profiler();
   createDefaultOptions_();
 }
 
 Environment::~Environment()
 {
+  if(profiler_->writeTrace()) {
+    logger_->errStream() << me_ << "could not write trace file "
+                         << options_->findString("trace_file")->getValue()
+                         << std::endl;
+  }
+  delete profiler_;
   delete logger_;
   delete options_;
   delete timer_;
@@ -163,6 +170,22 @@ void Environment::createDefaultOptions_()
       true);
   options_->insert(b_option);
 
+  b_option = (BoolOptionPtr) new Option<bool>(
+      "profile", "Should measure time spent by each thread in nodes, "
+      "relaxations, separation, branching, presolve and heuristics: <0/1>",
+      true, false);
+  options_->insert(b_option);
+
+  b_option = (BoolOptionPtr) new Option<bool>(
+      "clique_table", "Should find cliques of binary variables after "
+      "presolve and use them in propagation: <0/1>", true, false);
+  options_->insert(b_option);
+
+  b_option = (BoolOptionPtr) new Option<bool>(
+      "clique_cuts", "Should add clique inequalities found from the "
+      "clique table: <0/1>", true, false);
+  options_->insert(b_option);
+
   b_option = (BoolOptionPtr) new Option<bool>(
       "quad_presolve", "Should presolve using quadratic handler: <0/1>", true,
       false);
@@ -208,6 +231,13 @@ void Environment::createDefaultOptions_()
       "FPump", "Use feasibility pump heuristic for MINLP: <0/1>", true, false);
   options_->insert(b_option);
 
+  b_option = (BoolOptionPtr) new Option<bool>(
+      "heur_worker",
+      "Run NLP heuristics in a separate thread during serial "
+      "branch-and-bound, with their own copy of the problem: <0/1>",
+      true, false);
+  options_->insert(b_option);
+
   b_option = (BoolOptionPtr) new Option<bool>(
       "modify_rel_only",
       "If true, apply all modifications to relaxation only  <0/1>", true, true);
@@ -239,6 +269,13 @@ void Environment::createDefaultOptions_()
       true, false);
   options_->insert(b_option);
 
+  b_option = (BoolOptionPtr) new Option<bool>(
+      "bnbpar_share_cuts",
+      "If true, threads of parallel QG share globally valid cuts through a "
+      "lock-free store: <0/1>",
+      true, true);
+  options_->insert(b_option);
+
   b_option = (BoolOptionPtr) new Option<bool>(
       "bnbpar_oppor_mode",
       "If true, run the parallel branch-and-bound algorithm in opportunistic "
@@ -253,6 +290,13 @@ void Environment::createDefaultOptions_()
       true, false);
   options_->insert(b_option);
 
+  b_option = (BoolOptionPtr) new Option<bool>(
+      "bnbpar_log_buffer",
+      "If true, threads in parallel branch-and-bound write log messages to "
+      "their own buffers, which are written by a background thread: <0/1>",
+      true, true);
+  options_->insert(b_option);
+
   b_option = (BoolOptionPtr) new Option<bool>(
       "prerootheur", "Enable pre root heuristics: <0/1>", true, true);
   options_->insert(b_option);
@@ -282,6 +326,12 @@ void Environment::createDefaultOptions_()
       true);
   options_->insert(b_option);
 
+  b_option = (BoolOptionPtr) new Option<bool>(
+      "rc_tree_fix",
+      "If true and rc_fix is true, tighten open nodes using reduced costs "
+      "whenever a better solution is found: <0/1>", true, false);
+  options_->insert(b_option);
+
   b_option = (BoolOptionPtr) new Option<bool>(
       "varshuff",
       "Create a new problem with shuffled variable order in the problem: <0/1>",
@@ -366,6 +416,18 @@ void Environment::createDefaultOptions_()
       "Intensity of separability detection: 0-1", true, 0);
   options_->insert(i_option); // MS: disable later after confirming with sir.
 
+  i_option = (IntOptionPtr) new Option<int>(
+      "bnbpar_cut_store_size",
+      "Maximum number of cuts in the store shared by threads of parallel QG: "
+      ">0", true, 100000);
+  options_->insert(i_option);
+
+  i_option = (IntOptionPtr) new Option<int>(
+      "bnbpar_round_nodes",
+      "Maximum number of nodes processed by a thread in a round of "
+      "deterministic parallel branch-and-bound: >0", true, 4);
+  options_->insert(i_option);
+
   i_option = (IntOptionPtr) new Option<int>(
       "pres_freq", "Frequency of node-presolves in branch-and-bound", true, 5);
   options_->insert(i_option);
@@ -450,6 +512,13 @@ void Environment::createDefaultOptions_()
       true, 3);
   options_->insert(i_option);
 
+  i_option = (IntOptionPtr) new Option<int>(
+      "lp_row_age",
+      "Remove a cut from the LP engine after it is not binding in this many "
+      "solves in a row. It is added back if violated. 0: never: >=0",
+      true, 0);
+  options_->insert(i_option);
+
   i_option = (IntOptionPtr) new Option<int>(
       "oa_iter_limit",
       "The maximum number of iterations for Outer approximation algorithm to "
@@ -457,6 +526,11 @@ void Environment::createDefaultOptions_()
       true, 10000);
   options_->insert(i_option);
 
+  i_option = (IntOptionPtr) new Option<int>(
+      "race_log_level", "Verbosity of each solver run by mrace: 0-6", true,
+      1);
+  options_->insert(i_option);
+
   // Initial workspace option for FilterSQP engine
   i_option = (IntOptionPtr) new Option<int>(
       "filter_mxws", "Extra workspace for Filter-SQP", true, 0);
@@ -495,6 +569,11 @@ void Environment::createDefaultOptions_()
       true, 10);
   options_->insert(d_option);
 
+  d_option = (DoubleOptionPtr) new Option<double>(
+      "heur_time_pct",
+      "Percentage of total time that may be spent in heuristics: 0-100", true, 10.);
+  options_->insert(d_option);
+
   d_option = (DoubleOptionPtr) new Option<double>(
       "log_interval",
       "Display interval in seconds for branch-and-bound status: >0", true, 5.);
@@ -638,11 +717,35 @@ void Environment::createDefaultOptions_()
       true, "");
   options_->insert(s_option);
 
+  s_option = (StringOptionPtr) new Option<std::string>(
+      "load_presolved",
+      "Name of snapshot file (written by save_presolved) to load the "
+      "presolved problem from instead of reading and presolving the instance",
+      true, "");
+  options_->insert(s_option);
+
+  s_option = (StringOptionPtr) new Option<std::string>(
+      "save_presolved",
+      "Name of file to which a binary snapshot of the presolved problem is "
+      "written", true, "");
+  options_->insert(s_option);
+
   s_option = (StringOptionPtr) new Option<std::string>(
       "qp_engine", "Engine for solving QP relaxations: bqpd, None", true,
       "bqpd");
   options_->insert(s_option);
 
+  s_option = (StringOptionPtr) new Option<std::string>(
+      "replay_engine", "Type of engine used by mreplay for solving recorded "
+      "relaxations: lp, qp, nlp", true, "lp");
+  options_->insert(s_option);
+
+  s_option = (StringOptionPtr) new Option<std::string>(
+      "race_solvers", "Comma separated solvers run at the same time by "
+      "mrace. Each is bnb or qg, optionally followed by options as in "
+      "bnb:brancher=maxvio:divheur=-1", true, "bnb,qg");
+  options_->insert(s_option);
+
   s_option = (StringOptionPtr) new Option<std::string>(
       "tb_rule",
       "Tie breaking rule for node selection in branch-and-bound: twoChild, "
@@ -660,6 +763,17 @@ void Environment::createDefaultOptions_()
       "");
   options_->insert(s_option);
 
+  s_option = (StringOptionPtr) new Option<std::string>(
+      "record_file", "File name for recording the linear relaxation solved "
+      "at each node of branch-and-bound, to be solved again by mreplay. In "
+      "parallel branch-and-bound, the thread number is appended", true, "");
+  options_->insert(s_option);
+
+  s_option = (StringOptionPtr) new Option<std::string>(
+      "trace_file", "File name for writing a trace of the times spent by "
+      "threads, in Chrome trace format. Used if profile is 1", true, "");
+  options_->insert(s_option);
+
   s_option = (StringOptionPtr) new Option<std::string>(
       "cutMethod", "Name of method for generating cuts: ecp, esh", true, "esh");
   options_->insert(s_option);
@@ -928,7 +1042,11 @@ void Environment::readOptions(int argc, char** argv)
   auto isCaseSenseOpt = [](const std::string &optionName) {
     return optionName == "config_file" ||
            optionName == "debug_sol" ||
+           optionName == "load_presolved" ||
            optionName == "problem_file" ||
+           optionName == "record_file" ||
+           optionName == "save_presolved" ||
+           optionName == "trace_file" ||
            optionName == "vbc_file";
   };
 
@@ -1002,6 +1120,8 @@ void Environment::readOptions(int argc, char** argv)
   // update the log level if set by the user
   logger_->setMaxLevel(
       (LogLevel)getOptions()->findInt("log_level")->getValue());
+  profiler_->enable(options_->findBool("profile")->getValue(),
+                    options_->findString("trace_file")->getValue());
   // display all the new options set.
   logger_->msgStream(LogInfo) << ostr.str();
 
@@ -1021,6 +1141,24 @@ void Environment::readOptions(int argc, char** argv)
 #endif
 }
 
+void Environment::readOptions(const std::string& str)
+{
+  std::istringstream istr(str);
+  std::vector<std::string> words;
+  std::vector<char*> argv;
+  std::string word;
+
+  // words are read as if they were given on the command line of a program.
+  words.push_back("minotaur");
+  while(istr >> word) {
+    words.push_back(word);
+  }
+  for(UInt i = 0; i < words.size(); ++i) {
+    argv.push_back(&(words[i][0]));
+  }
+  readOptions((int)argv.size(), &argv[0]);
+}
+
 
 
 ////////////////////////////////////
@@ -16,14 +16,15 @@
 #include "Types.h"
 #include "Logger.h"
 #include "Option.h"
+#include "Profiler.h"
 #include "Timer.h"
 
 namespace Minotaur {
 
   /**
    * The environment is a container class that has pointers to the
-   * Logger, interrupt handler, timer factory and options that need to be
-   * passed to Minotaur.
+   * Logger, interrupt handler, timer factory, profiler and options that
+   * need to be passed to Minotaur.
    */
   class Environment {
     public:
@@ -45,6 +46,9 @@ namespace Minotaur {
       /// Get the options database.
       OptionDBPtr getOptions();
 
+      /// Get the profiler. It is enabled by option "profile".
+      Profiler* getProfiler() const { return profiler_; }
+
       /**
        * Get the time from the 'global timer' i.e. the total time consumed so
        * far.
@@ -103,6 +107,9 @@ namespace Minotaur {
       /// The options database
       OptionDBPtr options_;
 
+      /// Times spent by threads in parts of the solver.
+      Profiler *profiler_;
+
       /// The global timer
       Timer *timer_;
 
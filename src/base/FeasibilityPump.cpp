@@ -14,6 +14,7 @@
  */
 
 #include "MinotaurConfig.h"
+#include "BoundTrail.h"
 #include "Constraint.h"
 #include "Engine.h"
 #include "Environment.h"
@@ -183,13 +184,10 @@ void FeasibilityPump::convertSol_(SolutionPoolPtr s_pool,
                                   ConstSolutionPtr sol)
 {
   UInt i = 0;
-  UInt numvars = p_->getNumVars();
   const double *x = sol->getPrimal();
-  double *LB_copy = new double[numvars];
-  double *UB_copy = new double[numvars];
+  BoundTrail trail(p_);
   int err = 0;
 
-  saveBounds_(LB_copy, UB_copy, numvars);
   // fix bounds for binary variables
   for (VariableConstIterator v_iter = p_->varsBegin();
        v_iter != p_->varsEnd(); ++v_iter, ++i) {
@@ -217,15 +215,7 @@ void FeasibilityPump::convertSol_(SolutionPoolPtr s_pool,
   original_sol->write(logger_->msgStream(LogDebug2));
 #endif
 
-  restoreBounds_(LB_copy, UB_copy, numvars);
-
-  if (LB_copy) {
-    delete[] LB_copy;
-  }
-
-  if (UB_copy) {
-    delete[] UB_copy;
-  }
+  trail.undo();
 }
 
 
@@ -279,7 +269,7 @@ void FeasibilityPump::implementFP_(const double *x, SolutionPoolPtr s_pool)
 
   e_->load(prob);
   while (cont_FP && stats_->numNLPs < max_iter &&
-         stats_->numCycles < max_cycle) {
+         stats_->numCycles < max_cycle && false == isStopped_()) {
     constructObj_(prob, 0);
     e_->solve();
     ++(stats_->numNLPs);
@@ -375,27 +365,6 @@ void FeasibilityPump::perturb_(double hash_val, UInt n_to_flip)
 }
 
 
-void FeasibilityPump::restoreBounds_(double *LB_copy, double *UB_copy,
-                                     UInt vars)
-{
-  for (UInt i = 0; i < vars; ++i, ++LB_copy, ++UB_copy) {
-    p_->changeBoundByInd(i, Lower, *LB_copy);
-    p_->changeBoundByInd(i, Upper, *UB_copy);
-  }
-}
-
-
-void FeasibilityPump::saveBounds_(double *LB_copy, double *UB_copy, UInt vars)
-{
-  VariablePtr variable;
-  for (UInt i = 0; i < vars; ++i, ++LB_copy, ++UB_copy) {
-    variable = p_->getVariable(i);
-    *LB_copy = variable->getLb();
-    *UB_copy = variable->getUb();
-  }
-}
-
-
 VarVector FeasibilityPump::selectToFlip_(UInt n_to_flip)
 {
   double U;
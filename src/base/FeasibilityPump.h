@@ -55,6 +55,12 @@ namespace Minotaur {
     /// call to the heuristic
     void solve(NodePtr node, RelaxationPtr rel, SolutionPoolPtr s_pool);
 
+    /// Return the name of this heuristic.
+    std::string getName() const { return "Feasibility Pump"; }
+
+    /// Number of NLPs solved so far.
+    UInt getNumSolves() const { return stats_->numNLPs; }
+
     /// write statistic to the logger
     void writeStats(std::ostream &out) const;
 
@@ -183,30 +189,6 @@ namespace Minotaur {
      */
     void perturb_(double hash_val, UInt n_to_flip);
 
-    /**
-     * \brief A function to restore the upper and lower bounds of the
-     * problem.
-     *
-     * \param[in] LB_copy. Pointer to an array of lower bound. 
-     * \param[in] UB_copy. Pointer to an array of upper bound. 
-     * \param[in] numvars. Number of variables in the problem.
-     *
-     */
-    void restoreBounds_(double* LB_copy, double* UB_copy, UInt vars);
-
-    /**
-     * \brief A function to save the upper and lower bounds of the
-     * problem.
-     *
-     * \param[in] LB_copy. Pointer to an array of lower bound. Space has
-     * to be allocated.
-     * \param[in] UB_copy. Pointer to an array of upper bound. Space has
-     * to be allocated.
-     * \param[in] numvars. Number of variables in the problem.
-     *
-     */
-    void saveBounds_(double* LB_copy, double* UB_copy, UInt vars);
-
     /**
      * \brief A funtion to randomly select "n" binary/integer 
      * variable to be flipped.
@@ -45,6 +45,7 @@ FixVarsHeur::FixVarsHeur(EnvPtr env, ProblemPtr p)
   mnl_ = 0;
   stats_ = (FixVarsHeurStats*)new FixVarsHeurStats();
   stats_->numSol = 0;
+  stats_->numPresolve = 0;
   stats_->time = 0;
   handlers_.clear();
 }
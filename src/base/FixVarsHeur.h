@@ -48,6 +48,12 @@ public:
   /// set handlers of the problem
   void setHandlers(HandlerVector& handlers);
 
+  /// Return the name of this heuristic.
+  std::string getName() const { return "FixVars"; }
+
+  /// Return the number of times presolve was done.
+  UInt getNumSolves() const { return stats_->numPresolve; }
+
   /// writing the statistics to the logger
   void writeStats(std::ostream& out) const;
 
@@ -0,0 +1,199 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file HeurScheduler.cpp
+ * \brief Define class HeurScheduler for deciding which heuristics to call
+ * and for keeping track of their effort.
+ * \author The Minotaur Team
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+#include "MinotaurConfig.h"
+#include "Environment.h"
+#include "HeurScheduler.h"
+#include "Heuristic.h"
+#include "Logger.h"
+#include "Node.h"
+#include "Option.h"
+#include "Profiler.h"
+#include "SolutionPool.h"
+
+using namespace Minotaur;
+
+const std::string HeurScheduler::me_ = "HeurScheduler: ";
+
+HeurScheduler::HeurScheduler(EnvPtr env)
+  : budgetOf_(this),
+    env_(env),
+    rounds_(0),
+    spent_(0.0),
+    time_(0.0)
+{
+  logger_ = env->getLogger();
+  budget_ = env->getOptions()->findDouble("heur_time_pct")->getValue()/100.0;
+}
+
+
+HeurScheduler::~HeurScheduler()
+{
+  heurs_.clear();
+}
+
+
+void HeurScheduler::addHeur(HeurPtr h)
+{
+  HeurRec r;
+  r.h = h;
+  r.calls = 0;
+  r.sols = 0;
+  r.solves = 0;
+  r.time = 0.0;
+  r.reward = 0.0;
+  heurs_.push_back(r);
+}
+
+
+double HeurScheduler::bound_(const HeurRec &r) const
+{
+  if (0 == r.calls) {
+    return INFINITY;
+  }
+  return r.reward/r.calls + sqrt(2.0*log((double) std::max(rounds_, 1U))
+                                 /r.calls);
+}
+
+
+bool HeurScheduler::canRun_() const
+{
+  return (budgetOf_->spent_ <= budget_*env_->getTime());
+}
+
+
+std::vector<UInt> HeurScheduler::order_() const
+{
+  std::vector<double> b(heurs_.size());
+  std::vector<UInt> ord(heurs_.size());
+
+  for (UInt i=0; i<heurs_.size(); ++i) {
+    b[i] = bound_(heurs_[i]);
+    ord[i] = i;
+  }
+  std::stable_sort(ord.begin(), ord.end(),
+                   [&b](UInt i, UInt j) { return b[i] > b[j]; });
+  return ord;
+}
+
+
+void HeurScheduler::run_(HeurRec &r, ConstSolutionPtr sol, NodePtr node,
+                         RelaxationPtr rel, SolutionPoolPtr s_pool)
+{
+  double before = s_pool->getBestSolutionValue();
+  double after;
+  double tstart = env_->getTime();
+  UInt nsolves = r.h->getNumSolves();
+  double t;
+
+  {
+    ProfScope scope(env_->getProfiler(), ZoneHeur);
+    if (sol) {
+      r.h->solveNode(sol, node, rel, s_pool);
+    } else {
+      r.h->solve(node, rel, s_pool);
+    }
+  }
+
+  t = env_->getTime() - tstart;
+  after = s_pool->getBestSolutionValue();
+  ++r.calls;
+  r.solves += r.h->getNumSolves() - nsolves;
+  r.time += t;
+  time_ += t;
+  budgetOf_->spent_ += t;
+  if (after < before) {
+    ++r.sols;
+    if (before == INFINITY) {
+      r.reward += 1.0;
+    } else {
+      // any improvement is worth something, larger ones are worth more.
+      r.reward += std::min(1.0, 0.1 + (before-after)/(fabs(before)+1e-6));
+    }
+  }
+  logger_->msgStream(LogDebug) << me_ << r.h->getName() << " took "
+    << t << " s, incumbent " << before << " -> " << after << std::endl;
+}
+
+
+void HeurScheduler::shareBudget(HeurScheduler *s)
+{
+  budgetOf_ = (s) ? s->budgetOf_ : this;
+}
+
+
+void HeurScheduler::solve(NodePtr node, RelaxationPtr rel,
+                          SolutionPoolPtr s_pool)
+{
+  std::vector<UInt> ord = order_();
+
+  ++rounds_;
+  for (UInt i=0; i<ord.size(); ++i) {
+    HeurRec &r = heurs_[ord[i]];
+    if (!canRun_()) {
+      logger_->msgStream(LogDebug) << me_ << "skipping " << r.h->getName()
+        << ", heuristic time budget used up" << std::endl;
+      continue;
+    }
+    run_(r, 0, node, rel, s_pool);
+    if (s_pool->getBestSolutionValue() < INFINITY) {
+      break;
+    }
+  }
+}
+
+
+void HeurScheduler::solveNode(ConstSolutionPtr sol, NodePtr node,
+                              RelaxationPtr rel, SolutionPoolPtr s_pool)
+{
+  std::vector<UInt> ord;
+
+  if (heurs_.empty()) {
+    return;
+  }
+  ++rounds_;
+  ord = order_();
+  if (!node || !node->getParent()) {
+    for (UInt i=0; i<ord.size(); ++i) {
+      if (canRun_()) {
+        run_(heurs_[ord[i]], sol, node, rel, s_pool);
+      }
+    }
+  } else if (bound_(heurs_[ord[0]]) >= 1.0 && canRun_()) {
+    run_(heurs_[ord[0]], sol, node, rel, s_pool);
+  }
+}
+
+
+void HeurScheduler::writeStats(std::ostream &out) const
+{
+  if (heurs_.empty()) {
+    return;
+  }
+  out << me_ << "time in heuristics = " << std::fixed
+      << std::setprecision(2) << time_ << std::endl;
+  for (UInt i=0; i<heurs_.size(); ++i) {
+    const HeurRec &r = heurs_[i];
+    out << me_ << std::setw(18) << std::left << r.h->getName() << std::right
+        << " calls = " << std::setw(6) << r.calls
+        << " improved = " << std::setw(4) << r.sols
+        << " solves = " << std::setw(7) << r.solves
+        << " time = " << std::setw(8) << std::setprecision(2) << r.time
+        << " reward = " << std::setprecision(3)
+        << ((r.calls > 0) ? r.reward/r.calls : 0.0) << std::endl;
+  }
+}
@@ -0,0 +1,158 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file HeurScheduler.h
+ * \brief Declare class HeurScheduler for deciding which heuristics to call
+ * and for keeping track of their effort.
+ * \author The Minotaur Team
+ */
+
+#ifndef MINOTAURHEURSCHEDULER_H
+#define MINOTAURHEURSCHEDULER_H
+
+#include "Types.h"
+#include "SolutionPool.h"
+
+namespace Minotaur {
+
+  class Relaxation;
+  typedef Relaxation* RelaxationPtr;
+
+  /**
+   * \brief Call heuristics adaptively within a time budget.
+   *
+   * The scheduler records, for every heuristic, the time it took, the
+   * number of relaxations it solved and how much it improved the incumbent.
+   * Each call is rewarded by the relative improvement in the incumbent (1 if
+   * there was no incumbent before). Heuristics are picked by the upper
+   * confidence bound
+   * \f$\bar{r}_i + \sqrt{2 \ln N / n_i}\f$,
+   * where \f$\bar{r}_i\f$ is the average reward of heuristic \f$i\f$,
+   * \f$n_i\f$ is the number of times it was called and \f$N\f$ is the
+   * number of times the scheduler was asked to run heuristics. A heuristic
+   * that has never been called has an infinite bound.
+   *
+   * Heuristics are called only while the total time spent in them is at
+   * most "heur_time_pct" percent of the total time used by the solver. The
+   * first heuristic called always runs, since no time has been spent yet.
+   * A heuristic that is slow before the root node may thus keep the others
+   * from running until the solver has spent enough time elsewhere. Several
+   * schedulers of one solver share a budget through shareBudget().
+   *
+   * The scheduler does not own the heuristics.
+   */
+  class HeurScheduler {
+  public:
+    /// Constructor.
+    HeurScheduler(EnvPtr env);
+
+    /// Destroy.
+    ~HeurScheduler();
+
+    /// Add a heuristic to the portfolio.
+    void addHeur(HeurPtr h);
+
+    /// Return the number of heuristics added.
+    UInt getNumHeurs() const { return heurs_.size(); }
+
+    /**
+     * \brief Count the time of this scheduler against the budget of
+     * another one, so that the heuristics of both get "heur_time_pct"
+     * percent of the time together.
+     *
+     * \param [in] s The scheduler that keeps the budget. It must outlive
+     * this one.
+     */
+    void shareBudget(HeurScheduler *s);
+
+    /**
+     * \brief Call heuristics before the root node.
+     *
+     * Heuristics are called in decreasing order of their bounds (the order
+     * in which they were added, if none has been called before) until one
+     * of them finds a solution or the budget is exhausted.
+     *
+     * \param [in] node The node, may be NULL.
+     * \param [in] rel The relaxation, may be NULL.
+     * \param [in] s_pool The pool where solutions are saved.
+     */
+    void solve(NodePtr node, RelaxationPtr rel, SolutionPoolPtr s_pool);
+
+    /**
+     * \brief Call heuristics at a node using its relaxation solution.
+     *
+     * At the root node all heuristics are called in decreasing order of
+     * their bounds, as long as the budget allows. At other nodes, at most
+     * one heuristic, the one with the highest bound, is called, and only
+     * if its bound is at least one, i.e., if it is still worth exploring or
+     * has been finding better solutions.
+     *
+     * \param [in] sol Solution of the relaxation at the node.
+     * \param [in] node The node being processed.
+     * \param [in] rel The relaxation at the node.
+     * \param [in] s_pool The pool where solutions are saved.
+     */
+    void solveNode(ConstSolutionPtr sol, NodePtr node, RelaxationPtr rel,
+                   SolutionPoolPtr s_pool);
+
+    /// Write statistics of each heuristic.
+    void writeStats(std::ostream &out) const;
+
+  private:
+    /// Effort and rewards of one heuristic.
+    struct HeurRec {
+      HeurPtr h;       /// The heuristic.
+      UInt calls;      /// Number of times it was called.
+      UInt sols;       /// Number of calls that improved the incumbent.
+      UInt solves;     /// Relaxations solved in all calls.
+      double time;     /// Time taken in all calls.
+      double reward;   /// Sum of rewards of all calls.
+    };
+
+    /// Fraction of the total time that may be spent in heuristics.
+    double budget_;
+
+    /// The scheduler whose spent_ is checked against the budget: this one
+    /// unless the budget is shared.
+    HeurScheduler *budgetOf_;
+
+    /// Environment.
+    EnvPtr env_;
+
+    /// Heuristics and their records.
+    std::vector<HeurRec> heurs_;
+
+    /// Logger.
+    LoggerPtr logger_;
+
+    /// For logging.
+    static const std::string me_;
+
+    /// Number of times solve() or solveNode() was called.
+    UInt rounds_;
+
+    /// Time spent in heuristics of all schedulers sharing this budget.
+    double spent_;
+
+    /// Total time spent in heuristics of this scheduler.
+    double time_;
+
+    /// Upper confidence bound of the reward of a heuristic.
+    double bound_(const HeurRec &r) const;
+
+    /// True if the time spent in heuristics is within the budget.
+    bool canRun_() const;
+
+    /// Return the indices of heuristics in decreasing order of bounds.
+    std::vector<UInt> order_() const;
+
+    /// Call one heuristic and update its record.
+    void run_(HeurRec &r, ConstSolutionPtr sol, NodePtr node,
+              RelaxationPtr rel, SolutionPoolPtr s_pool);
+  };
+}
+#endif
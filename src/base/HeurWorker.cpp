@@ -0,0 +1,246 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file HeurWorker.cpp
+ * \brief Define class HeurWorker for running heuristics in a thread of
+ * their own while branch-and-bound searches the tree.
+ * \author The Minotaur Team
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+#include "MinotaurConfig.h"
+#include "Environment.h"
+#include "Heuristic.h"
+#include "HeurWorker.h"
+#include "Logger.h"
+#include "Problem.h"
+#include "Solution.h"
+#include "SolutionPool.h"
+
+using namespace Minotaur;
+
+const std::string HeurWorker::me_ = "HeurWorker: ";
+
+HeurWorker::HeurWorker(EnvPtr env, ProblemPtr p)
+  : env_(env),
+    incVal_(INFINITY),
+    lastSent_(INFINITY),
+    p_(p),
+    hasPoint_(false),
+    pool_(0),
+    stop_(false),
+    wantPoint_(false)
+{
+  logger_ = env->getLogger();
+  pool_ = (SolutionPoolPtr) new SolutionPool(env, p, 1);
+  stats_.calls = 0;
+  stats_.points = 0;
+  stats_.rounds = 0;
+  stats_.sent = 0;
+  stats_.taken = 0;
+  stats_.firstSol = -1.0;
+}
+
+
+HeurWorker::~HeurWorker()
+{
+  stop();
+  for (HeurVector::iterator it=heurs_.begin(); it!=heurs_.end(); ++it) {
+    delete *it;
+  }
+  heurs_.clear();
+  delete pool_;
+  delete p_;
+}
+
+
+void HeurWorker::addHeur(HeurPtr h)
+{
+  h->setStopFlag(&stop_);
+  heurs_.push_back(h);
+}
+
+
+bool HeurWorker::getSolutions(SolutionPoolPtr s_pool)
+{
+  double before = s_pool->getBestSolutionValue();
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  for (UInt i=0; i<sols_.size(); ++i) {
+    if (sols_[i].second < s_pool->getBestSolutionValue()) {
+      s_pool->addSolution(&(sols_[i].first[0]), sols_[i].second);
+    }
+  }
+  sols_.clear();
+  return (s_pool->getBestSolutionValue() < before);
+}
+
+
+void HeurWorker::postIncumbent(ConstSolutionPtr sol)
+{
+  const double *x;
+
+  if (!sol || !sol->getPrimal()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (sol->getObjValue() < incVal_) {
+    x = sol->getPrimal();
+    incX_.assign(x, x + p_->getNumVars());
+    incVal_ = sol->getObjValue();
+  }
+}
+
+
+void HeurWorker::postPoint(ConstSolutionPtr sol)
+{
+  const double *x;
+
+  // cheap test first, so that nothing is copied while heuristics run.
+  if (!sol || !sol->getPrimal() ||
+      false == wantPoint_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    x = sol->getPrimal();
+    point_.assign(x, x + p_->getNumVars());
+    hasPoint_ = true;
+    wantPoint_.store(false, std::memory_order_relaxed);
+  }
+  cv_.notify_one();
+}
+
+
+void HeurWorker::run_()
+{
+  DoubleVector x;
+  bool has_x;
+
+  while (false == stop_) {
+    has_x = takeInputs_(x);
+    if (stats_.rounds > 0 && false == has_x) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      wantPoint_.store(true, std::memory_order_relaxed);
+      cv_.wait(lock, [this]() { return stop_ || hasPoint_; });
+      wantPoint_.store(false, std::memory_order_relaxed);
+      continue;
+    }
+    if (has_x) {
+      p_->setInitialPoint(&x[0]);
+    }
+    ++stats_.rounds;
+    for (HeurVector::iterator it=heurs_.begin(); it!=heurs_.end(); ++it) {
+      if (stop_) {
+        break;
+      }
+      (*it)->solve(0, 0, pool_);
+      ++stats_.calls;
+      sendSolutions_();
+      takeInputs_(x);
+    }
+  }
+}
+
+
+void HeurWorker::sendSolutions_()
+{
+  SolutionPtr sol;
+  const double *x;
+  double val = pool_->getBestSolutionValue();
+
+  if (val >= lastSent_) {
+    return;
+  }
+  sol = pool_->getBestSolution();
+  x = sol->getPrimal();
+  std::lock_guard<std::mutex> lock(mutex_);
+  sols_.push_back(std::make_pair(DoubleVector(x, x + p_->getNumVars()),
+                                 val));
+  lastSent_ = val;
+  ++stats_.sent;
+  if (stats_.firstSol < 0.0) {
+    stats_.firstSol = env_->getTime();
+  }
+  logger_->msgStream(LogExtraInfo) << me_ << "found solution of value "
+                                   << val << std::endl;
+}
+
+
+void HeurWorker::start()
+{
+  if (heurs_.empty() || thread_.joinable()) {
+    return;
+  }
+  stop_ = false;
+  logger_->msgStream(LogInfo) << me_ << "running " << heurs_.size()
+                              << " heuristics in a separate thread"
+                              << std::endl;
+  thread_ = std::thread(&HeurWorker::run_, this);
+}
+
+
+void HeurWorker::stop()
+{
+  if (false == thread_.joinable()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  thread_.join();
+}
+
+
+bool HeurWorker::takeInputs_(DoubleVector &x)
+{
+  bool has_x = false;
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // an incumbent of the tree is a cutoff for the heuristics. It is not
+  // sent back.
+  if (!incX_.empty()) {
+    if (incVal_ < pool_->getBestSolutionValue()) {
+      pool_->addSolution(&incX_[0], incVal_);
+      ++stats_.taken;
+    }
+    lastSent_ = std::min(lastSent_, incVal_);
+    incX_.clear();
+  }
+  if (hasPoint_) {
+    x.swap(point_);
+    hasPoint_ = false;
+    ++stats_.points;
+    has_x = true;
+  }
+  return has_x;
+}
+
+
+void HeurWorker::writeStats(std::ostream &out) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  out << me_ << "rounds                     = " << stats_.rounds << std::endl
+      << me_ << "calls to heuristics        = " << stats_.calls << std::endl
+      << me_ << "points from tree           = " << stats_.points << std::endl
+      << me_ << "incumbents from tree       = " << stats_.taken << std::endl
+      << me_ << "solutions sent to tree     = " << stats_.sent << std::endl;
+  if (stats_.firstSol >= 0.0) {
+    out << me_ << "time to first solution     = " << std::fixed
+        << std::setprecision(2) << stats_.firstSol << std::endl;
+  }
+  for (HeurVector::const_iterator it=heurs_.begin(); it!=heurs_.end();
+       ++it) {
+    (*it)->writeStats(out);
+  }
+}
@@ -0,0 +1,183 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file HeurWorker.h
+ * \brief Declare class HeurWorker for running heuristics in a thread of
+ * their own while branch-and-bound searches the tree.
+ * \author The Minotaur Team
+ */
+
+#ifndef MINOTAURHEURWORKER_H
+#define MINOTAURHEURWORKER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "Types.h"
+#include "SolutionPool.h"
+
+namespace Minotaur {
+
+  /// Counters of a HeurWorker.
+  struct HeurWorkerStats {
+    UInt calls;        ///> Number of calls to heuristics.
+    UInt points;       ///> Number of points taken from the tree.
+    UInt rounds;       ///> Number of rounds over all heuristics.
+    UInt sent;         ///> Solutions passed to branch-and-bound.
+    UInt taken;        ///> Incumbents taken from branch-and-bound.
+    double firstSol;   ///> Time when the first solution was found.
+  };
+
+
+  /**
+   * \brief Run heuristics in a separate thread, alongside serial
+   * branch-and-bound.
+   *
+   * The worker has its own copy of the problem, and its heuristics must be
+   * created with that copy and with engines not used by anyone else. It
+   * never touches the tree, the relaxation or the solution pool of
+   * branch-and-bound. All exchange goes through a small channel guarded by
+   * a mutex:
+   *
+   * - postPoint() gives the worker the latest solution of a relaxation. It
+   *   is copied only if the worker is waiting for one, so it costs nothing
+   *   while heuristics run. The point becomes the initial point of the copy
+   *   of the problem, from where NLP engines start.
+   *
+   * - postIncumbent() gives the worker a better solution found by the tree.
+   *   It goes into the pool of the worker so that heuristics can use it as
+   *   cutoff.
+   *
+   * - getSolutions() moves solutions found by the worker into the pool of
+   *   branch-and-bound.
+   *
+   * In the first round, every heuristic is called once, as before the root.
+   * In later rounds, the heuristics are called again from each new point,
+   * and the worker sleeps while there is none. stop() raises a flag that
+   * the heuristics check between solves of their relaxations (see
+   * Heuristic::setStopFlag()), so it waits at most for the relaxation
+   * being solved, whose engine has its own limits.
+   */
+  class HeurWorker {
+  public:
+    /**
+     * \brief Create a worker.
+     *
+     * \param [in] env Environment.
+     * \param [in] p Copy of the problem solved by branch-and-bound, with
+     * variables in the same order. The worker owns it.
+     */
+    HeurWorker(EnvPtr env, ProblemPtr p);
+
+    /// Stop the thread, and destroy the heuristics and the problem.
+    ~HeurWorker();
+
+    /// Add a heuristic created with the problem of the worker. The worker
+    /// owns it, and makes it watch the stop flag of the worker.
+    void addHeur(HeurPtr h);
+
+    /// Return the number of heuristics added.
+    UInt getNumHeurs() const { return heurs_.size(); }
+
+    /**
+     * \brief Move solutions found by the worker since the last call to a
+     * pool.
+     *
+     * \param [in] s_pool Pool of branch-and-bound.
+     * \return True if the best value of s_pool improved.
+     */
+    bool getSolutions(SolutionPoolPtr s_pool);
+
+    /// Return the problem of the worker. Heuristics must be created with it.
+    ProblemPtr getProblem() const { return p_; }
+
+    /// Give the worker a better solution found by branch-and-bound.
+    void postIncumbent(ConstSolutionPtr sol);
+
+    /// Give the worker the solution of the latest relaxation. It may be
+    /// NULL. Only the values of variables of the problem are used.
+    void postPoint(ConstSolutionPtr sol);
+
+    /// Start the thread. Does nothing if there are no heuristics.
+    void start();
+
+    /// Ask the thread to stop and wait for it.
+    void stop();
+
+    /// Write statistics of the worker and of its heuristics.
+    void writeStats(std::ostream &out) const;
+
+  private:
+    /// Wakes the thread when a point arrives or when asked to stop.
+    std::condition_variable cv_;
+
+    /// Environment.
+    EnvPtr env_;
+
+    /// Heuristics, called in this order.
+    HeurVector heurs_;
+
+    /// Incumbent of branch-and-bound not yet in pool_, and its value.
+    DoubleVector incX_;
+    double incVal_;
+
+    /// Best value sent to branch-and-bound.
+    double lastSent_;
+
+    /// Logger.
+    LoggerPtr logger_;
+
+    /// For logging.
+    static const std::string me_;
+
+    /// Guards point_, incX_, incVal_ and sols_. Counters are changed only by
+    /// the thread.
+    mutable std::mutex mutex_;
+
+    /// The copy of the problem.
+    ProblemPtr p_;
+
+    /// Latest point posted, valid if hasPoint_.
+    DoubleVector point_;
+    bool hasPoint_;
+
+    /// Pool of the worker.
+    SolutionPoolPtr pool_;
+
+    /// Solutions for branch-and-bound, not yet taken, and their values.
+    std::vector<std::pair<DoubleVector, double> > sols_;
+
+    /// Counters.
+    HeurWorkerStats stats_;
+
+    /// True when the thread should stop.
+    std::atomic<bool> stop_;
+
+    /// The thread, if started.
+    std::thread thread_;
+
+    /// True if the thread is waiting for a point.
+    std::atomic<bool> wantPoint_;
+
+    /// Body of the thread.
+    void run_();
+
+    /// Copy new solutions in pool_ into sols_.
+    void sendSolutions_();
+
+    /**
+     * \brief Take the incumbent and point posted by branch-and-bound.
+     *
+     * \param [out] x The point, if there is one.
+     * \return True if a point was taken.
+     */
+    bool takeInputs_(DoubleVector &x);
+  };
+}
+#endif
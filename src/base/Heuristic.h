@@ -15,6 +15,8 @@
 #ifndef MINOTAURHEURISTIC_H
 #define MINOTAURHEURISTIC_H
 
+#include <atomic>
+
 #include "Types.h"
 #include "SolutionPool.h"
 
@@ -31,7 +33,7 @@ namespace Minotaur {
     public:
 
       /// Default constructor.
-      Heuristic() {};
+      Heuristic() : stopFlag_(0) {};
 
       /// Destroy
       virtual ~Heuristic() {};
@@ -45,9 +47,35 @@ namespace Minotaur {
           SolutionPoolPtr )
       {}
   
+      /// Return the name of this heuristic, used in statistics.
+      virtual std::string getName() const { return "Heuristic"; }
+
+      /**
+       * Return the number of relaxations (LPs, NLPs or other problems)
+       * solved by this heuristic so far, or of whatever unit of work it
+       * repeats, e.g. points checked. Used for measuring its effort.
+       */
+      virtual UInt getNumSolves() const { return 0; }
+
+
+      /**
+       * Watch a flag that another thread sets when the heuristic should
+       * return early. Heuristics that solve many relaxations check it
+       * between solves. The flag must outlive all calls to solve().
+       */
+      void setStopFlag(const std::atomic<bool> *flag) { stopFlag_ = flag; }
 
       /// Write statistics to the logger.
       virtual void writeStats(std::ostream &out) const = 0;
+
+    protected:
+      /// True if the flag given to setStopFlag() is set.
+      bool isStopped_() const
+      { return stopFlag_ && stopFlag_->load(std::memory_order_relaxed); }
+
+    private:
+      /// Flag set by another thread to stop the heuristic, may be NULL.
+      const std::atomic<bool> *stopFlag_;
   };
 
 }
@@ -0,0 +1,280 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file Interval.cpp
+ * \brief Define functions for interval arithmetic with outward rounding.
+ * \author The Minotaur Team
+ */
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <limits>
+
+#include "MinotaurConfig.h"
+#include "Interval.h"
+
+using namespace Minotaur;
+
+
+double Minotaur::AddUp(double a, double b)
+{
+  // two-sum: err is exactly a+b-s, unless s overflows, and then it is NaN.
+  double s = a + b;
+  double bb = s - a;
+  double err = (a - (s - bb)) + (b - bb);
+
+  if (err > 0.0) {
+    s = NextUp(s);
+  }
+  // a sum of finite numbers that overflows to -inf is not an upper bound.
+  if (-INFINITY == s && a > -INFINITY && b > -INFINITY) {
+    s = -DBL_MAX;
+  }
+  return s;
+}
+
+
+double Minotaur::AddDown(double a, double b)
+{
+  return -AddUp(-a, -b);
+}
+
+
+double Minotaur::MulUp(double a, double b)
+{
+  double p;
+
+  if (0.0 == a || 0.0 == b) {
+    return 0.0;
+  }
+  p = a * b;
+  if (std::fma(a, b, -p) > 0.0) {
+    p = NextUp(p);
+  }
+  return p;
+}
+
+
+double Minotaur::MulDown(double a, double b)
+{
+  double p;
+
+  if (0.0 == a || 0.0 == b) {
+    return 0.0;
+  }
+  p = a * b;
+  if (std::fma(a, b, -p) < 0.0) {
+    p = NextDown(p);
+  }
+  return p;
+}
+
+
+double Minotaur::DivUp(double a, double b)
+{
+  double q = a / b;
+  double r;
+
+  if (std::isnan(q)) {
+    return INFINITY;
+  }
+  // a/b - q has the sign of r/b.
+  r = std::fma(-q, b, a);
+  if ((r > 0.0 && b > 0.0) || (r < 0.0 && b < 0.0)) {
+    q = NextUp(q);
+  }
+  return q;
+}
+
+
+double Minotaur::DivDown(double a, double b)
+{
+  double q = a / b;
+  double r;
+
+  if (std::isnan(q)) {
+    return -INFINITY;
+  }
+  r = std::fma(-q, b, a);
+  if ((r < 0.0 && b > 0.0) || (r > 0.0 && b < 0.0)) {
+    q = NextDown(q);
+  }
+  return q;
+}
+
+
+double Minotaur::SqrtUp(double a)
+{
+  double s = sqrt(a);
+
+  if (std::fma(-s, s, a) > 0.0) {
+    s = NextUp(s);
+  }
+  return s;
+}
+
+
+double Minotaur::SqrtDown(double a)
+{
+  double s = sqrt(a);
+
+  if (std::fma(-s, s, a) < 0.0) {
+    s = std::max(0.0, NextDown(s));
+  }
+  return s;
+}
+
+
+double Minotaur::LibmUp(double f)
+{
+  // glibc documents errors of at most 2 ulps for exp, log, log10 and pow.
+  // 4 eps relative is at least 4 ulps.
+  if (std::isfinite(f)) {
+    f += std::fabs(f) * 4.0 * DBL_EPSILON +
+         std::numeric_limits<double>::denorm_min();
+  }
+  return f;
+}
+
+
+double Minotaur::LibmDown(double f)
+{
+  if (std::isfinite(f)) {
+    f -= std::fabs(f) * 4.0 * DBL_EPSILON +
+         std::numeric_limits<double>::denorm_min();
+  }
+  return f;
+}
+
+
+double Minotaur::RootUp(double a, double k)
+{
+  double r;
+
+  if (0.0 == a || std::isinf(a)) {
+    return a;
+  }
+  // 1/k is rounded, which changes a^(1/k) by up to |log(r)| eps/2 relative.
+  r = pow(a, 1.0 / k);
+  return LibmUp(r + r * std::fabs(log(r)) * DBL_EPSILON);
+}
+
+
+double Minotaur::RootDown(double a, double k)
+{
+  double r;
+
+  if (0.0 == a || std::isinf(a)) {
+    return a;
+  }
+  r = pow(a, 1.0 / k);
+  return std::max(0.0, LibmDown(r - r * std::fabs(log(r)) * DBL_EPSILON));
+}
+
+
+Interval Minotaur::IntervalAdd(const Interval &a, const Interval &b)
+{
+  Interval c;
+
+  for (int i = 0; i < 2; ++i) {
+    c.v_[i] = AddUp(a.v_[i], b.v_[i]);
+  }
+  return c;
+}
+
+
+Interval Minotaur::IntervalSub(const Interval &a, const Interval &b)
+{
+  Interval c;
+
+  for (int i = 0; i < 2; ++i) {
+    c.v_[i] = AddUp(a.v_[i], b.v_[1 - i]);
+  }
+  return c;
+}
+
+
+Interval Minotaur::IntervalScale(const Interval &a, double c)
+{
+  Interval d;
+
+  if (c >= 0.0) {
+    for (int i = 0; i < 2; ++i) {
+      d.v_[i] = MulUp(a.v_[i], c);
+    }
+  } else {
+    for (int i = 0; i < 2; ++i) {
+      d.v_[i] = MulUp(a.v_[1 - i], -c);
+    }
+  }
+  return d;
+}
+
+
+Interval Minotaur::IntervalMul(const Interval &a, const Interval &b)
+{
+  const double l0 = a.getLb();
+  const double u0 = a.getUb();
+  const double l1 = b.getLb();
+  const double u1 = b.getUb();
+  double lb, ub;
+
+  lb = std::min(std::min(MulDown(l0, l1), MulDown(l0, u1)),
+                std::min(MulDown(u0, l1), MulDown(u0, u1)));
+  ub = std::max(std::max(MulUp(l0, l1), MulUp(l0, u1)),
+                std::max(MulUp(u0, l1), MulUp(u0, u1)));
+  return Interval(lb, ub);
+}
+
+
+Interval Minotaur::IntervalDiv(const Interval &a, const Interval &b)
+{
+  const double l0 = a.getLb();
+  const double u0 = a.getUb();
+  const double l1 = b.getLb();
+  const double u1 = b.getUb();
+  double lb, ub;
+
+  if (l1 > 0.0 || u1 < 0.0) {
+    lb = std::min(std::min(DivDown(l0, l1), DivDown(l0, u1)),
+                  std::min(DivDown(u0, l1), DivDown(u0, u1)));
+    ub = std::max(std::max(DivUp(l0, l1), DivUp(l0, u1)),
+                  std::max(DivUp(u0, l1), DivUp(u0, u1)));
+    return Interval(lb, ub);
+  } else if (0.0 == l1 && u1 > 0.0) {
+    return IntervalMul(a, Interval(DivDown(1.0, u1), INFINITY));
+  } else if (0.0 == u1 && l1 < 0.0) {
+    return IntervalMul(a, Interval(-INFINITY, DivUp(1.0, l1)));
+  }
+  return Interval();
+}
+
+
+Interval Minotaur::IntervalRevMul(const Interval &a, const Interval &b)
+{
+  if (a.getLb() <= 0.0 && a.getUb() >= 0.0 && b.getLb() <= 0.0 &&
+      b.getUb() >= 0.0) {
+    return Interval();
+  }
+  return IntervalDiv(a, b);
+}
+
+
+Interval Minotaur::IntervalSqr(const Interval &a)
+{
+  const double l = a.getLb();
+  const double u = a.getUb();
+
+  if (u < 0.0) {
+    return Interval(MulDown(u, u), MulUp(l, l));
+  } else if (l > 0.0) {
+    return Interval(MulDown(l, l), MulUp(u, u));
+  }
+  return Interval(0.0, std::max(MulUp(l, l), MulUp(u, u)));
+}
+
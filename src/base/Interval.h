@@ -0,0 +1,142 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file Interval.h
+ * \brief Declare class Interval and functions for interval arithmetic with
+ * outward rounding.
+ * \author The Minotaur Team
+ */
+
+#ifndef MINOTAURINTERVAL_H
+#define MINOTAURINTERVAL_H
+
+#include <cmath>
+
+namespace Minotaur {
+
+  /**
+   * \brief An interval [lb, ub] of reals, for computing bounds that are
+   * safe under rounding.
+   *
+   * Both ends are kept in one array of two lanes, as (-lb, ub). Rounding the
+   * lower bound down is then the same as rounding the first lane up, so
+   * that sums, differences and scaling do the same operation on both lanes,
+   * without any test on signs. Negation is a swap of lanes.
+   *
+   * The processor rounds to nearest. Directed rounding is obtained from the
+   * exact error of each operation: two-sum for sums, and fma for products,
+   * quotients and square roots. A result is moved by one ulp only when the
+   * error says that it is on the wrong side. Results of exp, log, log10 and
+   * pow carry an error of a few ulps and are widened by more.
+   *
+   * Infinite ends are never attained, so that 0*inf is taken as 0.
+   */
+  class Interval {
+  public:
+    /// The interval [-inf, inf].
+    Interval()
+    { v_[0] = INFINITY; v_[1] = INFINITY; }
+
+    /// The interval [lb, ub].
+    Interval(double lb, double ub)
+    { v_[0] = -lb; v_[1] = ub; }
+
+    /// Return the lower bound.
+    double getLb() const { return -v_[0]; }
+
+    /// Return the upper bound.
+    double getUb() const { return v_[1]; }
+
+    /// Lanes (-lb, ub).
+    double v_[2];
+  };
+
+
+  /// Return the next double above d, or d if it is infinite or NaN.
+  inline double NextUp(double d)
+  { return (d < INFINITY) ? std::nextafter(d, INFINITY) : d; }
+
+  /// Return the next double below d, or d if it is infinite or NaN.
+  inline double NextDown(double d)
+  { return (d > -INFINITY) ? std::nextafter(d, -INFINITY) : d; }
+
+  /// Return a+b rounded down, at most DBL_MAX if a and b are finite.
+  double AddDown(double a, double b);
+
+  /// Return a+b rounded up, at least -DBL_MAX if a and b are finite.
+  double AddUp(double a, double b);
+
+  /// Return a-b rounded down.
+  inline double SubDown(double a, double b) { return AddDown(a, -b); }
+
+  /// Return a-b rounded up.
+  inline double SubUp(double a, double b) { return AddUp(a, -b); }
+
+  /// Return a*b rounded down, taking 0*inf as 0.
+  double MulDown(double a, double b);
+
+  /// Return a*b rounded up, taking 0*inf as 0.
+  double MulUp(double a, double b);
+
+  /// Return a/b rounded down, -inf if it is not defined.
+  double DivDown(double a, double b);
+
+  /// Return a/b rounded up, inf if it is not defined.
+  double DivUp(double a, double b);
+
+  /// Return sqrt(a) rounded down.
+  double SqrtDown(double a);
+
+  /// Return sqrt(a) rounded up.
+  double SqrtUp(double a);
+
+  /// Return a value of libm, accurate to a few ulps, widened downwards.
+  double LibmDown(double f);
+
+  /// Return a value of libm, accurate to a few ulps, widened upwards.
+  double LibmUp(double f);
+
+  /// Return the k-th root of a >= 0, for k > 0, rounded down.
+  double RootDown(double a, double k);
+
+  /// Return the k-th root of a >= 0, for k > 0, rounded up.
+  double RootUp(double a, double k);
+
+  /// Return the interval a+b.
+  Interval IntervalAdd(const Interval &a, const Interval &b);
+
+  /// Return the interval a-b.
+  Interval IntervalSub(const Interval &a, const Interval &b);
+
+  /// Return the interval -a.
+  inline Interval IntervalNeg(const Interval &a)
+  { return Interval(-a.getUb(), -a.getLb()); }
+
+  /// Return the interval c*a for a number c.
+  Interval IntervalScale(const Interval &a, double c);
+
+  /// Return the interval a*b.
+  Interval IntervalMul(const Interval &a, const Interval &b);
+
+  /**
+   * \brief Return the interval a/b. It is [-inf, inf] if 0 is inside b,
+   * and half unbounded if 0 is an end of b.
+   */
+  Interval IntervalDiv(const Interval &a, const Interval &b);
+
+  /**
+   * \brief Return an interval containing x2, where \f$ y = x_1x_2 \f$,
+   * \f$ y \in a \f$ and \f$ x_1 \in b \f$. It is [-inf, inf] if both a and b
+   * contain 0.
+   */
+  Interval IntervalRevMul(const Interval &a, const Interval &b);
+
+  /// Return the interval a*a.
+  Interval IntervalSqr(const Interval &a);
+}
+#endif
+
@@ -13,10 +13,20 @@
 #ifndef MINOTAURLPENGINE_H
 #define MINOTAURLPENGINE_H
 
+#include <vector>
+
 #include "Engine.h"
 
 namespace Minotaur {
 
+/// A row of the optimal simplex tableau, B^{-1}A, keeping only nonzeros.
+struct TableauRow {
+  std::vector<int> ind;         // Indices of columns with nonzeros
+  std::vector<double> val;      // Values in those columns
+  std::vector<int> slackInd;    // Indices of slack columns with nonzeros
+  std::vector<double> slackVal; // Values in those slack columns
+};
+
 /**
  * The LPEengine class is an abstract class for interfacing LP solvers (like
  * OsiLPEngine). A derived class must implement calls to the LP solver for
@@ -46,6 +56,9 @@ class LPEngine : public Engine {
 
   virtual void getBInvARow(int, double*, double*){};
 
+  virtual void getBInvARows(const std::vector<int>&, double,
+                            std::vector<TableauRow>&){};
+
   virtual int getNumCols() { return 0; };
 
   virtual int getNumRows() { return 0; };
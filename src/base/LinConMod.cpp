@@ -20,6 +20,7 @@
 #include "LinConMod.h"
 #include "LinearFunction.h"
 #include "Problem.h"
+#include "Relaxation.h"
 #include "Variable.h"
 
 using namespace Minotaur;
@@ -59,6 +60,24 @@ void LinConMod::applyToProblem(ProblemPtr problem)
 }
 
 
+ModificationPtr LinConMod::toRel(ProblemPtr, RelaxationPtr rel) const
+{
+  LinConModPtr mod;
+
+  if (con_->getIndex() >= rel->getNumCons()) {
+    return LinConModPtr();
+  }
+  mod = (LinConModPtr) new LinConMod(rel->getConstraint(con_->getIndex()),
+                                     newLf_->cloneWithVars(rel->varsBegin()),
+                                     newLb_, newUb_);
+  delete mod->oldLf_;
+  mod->oldLf_ = oldLf_->cloneWithVars(rel->varsBegin());
+  mod->oldLb_ = oldLb_;
+  mod->oldUb_ = oldUb_;
+  return mod;
+}
+
+
 void LinConMod::undoToProblem(ProblemPtr problem) 
 {
   LinearFunctionPtr lf = oldLf_->clone();
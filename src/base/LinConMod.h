@@ -50,9 +50,16 @@ public:
   ModificationPtr fromRel(RelaxationPtr, ProblemPtr ) const
     {return LinConModPtr();};
 
-  // base class method.
-  ModificationPtr toRel(ProblemPtr, RelaxationPtr) const
-    {return LinConModPtr();};
+  /**
+   * \brief Convert the modification to one for another relaxation with the
+   * same variables and constraints, e.g. that of another thread.
+   *
+   * The constraint and variables are found by their indices, since the
+   * constraint usually has no counterpart in the problem.
+   * \return The modification for rel, or NULL if rel does not have the
+   * constraint.
+   */
+  ModificationPtr toRel(ProblemPtr, RelaxationPtr rel) const;
 
   /// Restore the modification for a problem.
   void undoToProblem(ProblemPtr problem);
@@ -151,9 +151,9 @@ void LinFeasPump::implementFP_(const double*, SolutionPoolPtr s_pool)
                      getNumVars() > max_non_zero_obj) ? false : true;
 
   while(!is_feasible && stats_->numNLPs < max_NLP && statsLFP_->numLPs < max_LP
-        && stats_->numCycles < max_cycle) {
+        && stats_->numCycles < max_cycle && false == isStopped_()) {
     while(to_continue && statsLFP_->numLPs < max_LP 
-        && stats_->numCycles < max_cycle) { 
+        && stats_->numCycles < max_cycle && false == isStopped_()) { 
       sol_found = false;
       constructObj_(r_, sol);
       lp_status = lpE_->solve();
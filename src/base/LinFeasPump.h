@@ -66,6 +66,12 @@ namespace Minotaur {
     /// Call to the heuristic
     void solve(NodePtr node, RelaxationPtr rel, SolutionPoolPtr s_pool);
 
+    /// Return the name of this heuristic.
+    std::string getName() const { return "Linear Feas Pump"; }
+
+    /// Number of LPs and NLPs solved so far.
+    UInt getNumSolves() const { return stats_->numNLPs + statsLFP_->numLPs; }
+
     /// Write statistics to the logger
     void writeStats(std::ostream &out) const;
 
@@ -107,9 +107,10 @@ bool LinMods::isEmpty() const
   return (lmods_.empty() && bmods2_.empty() && bmods_.empty());
 }
 
-ModificationPtr LinMods::fromRel(RelaxationPtr rel, ProblemPtr) const
+ModificationPtr LinMods::fromRel(RelaxationPtr rel, ProblemPtr p) const
 {
   LinModsPtr lmods = (LinModsPtr) new LinMods();
+  LinConModPtr lm;
   VarBoundModPtr bm;
   VarBoundMod2Ptr bm2;
   VariablePtr v;
@@ -132,12 +133,23 @@ ModificationPtr LinMods::fromRel(RelaxationPtr rel, ProblemPtr) const
     bm2 = (VarBoundMod2Ptr) new VarBoundMod2(v, newlb, newub);
     lmods->insert(bm2);
   }
+  // changed constraints, e.g. McCormick inequalities, are not in the
+  // problem. They are kept by index.
+  for(LinConModConstIter it = lmods_.begin(); it != lmods_.end(); ++it)
+  {
+    lm = (LinConModPtr) (*it)->toRel(p, rel);
+    if(lm)
+    {
+      lmods->insert(lm);
+    }
+  }
   return lmods;
 }
 
-ModificationPtr LinMods::toRel(ProblemPtr, RelaxationPtr rel) const
+ModificationPtr LinMods::toRel(ProblemPtr p, RelaxationPtr rel) const
 {
   LinModsPtr lmods = (LinModsPtr) new LinMods();
+  LinConModPtr lm;
   VarBoundModPtr bm;
   VarBoundMod2Ptr bm2;
   VariablePtr v;
@@ -160,6 +172,14 @@ ModificationPtr LinMods::toRel(ProblemPtr, RelaxationPtr rel) const
     bm2 = (VarBoundMod2Ptr) new VarBoundMod2(v, newlb, newub);
     lmods->insert(bm2);
   }
+  for(LinConModConstIter it = lmods_.begin(); it != lmods_.end(); ++it)
+  {
+    lm = (LinConModPtr) (*it)->toRel(p, rel);
+    if(lm)
+    {
+      lmods->insert(lm);
+    }
+  }
   return lmods;
 }
 
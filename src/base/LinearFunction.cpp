@@ -89,7 +89,9 @@ void LinearFunction::minus(LinearFunctionPtr lf){
 void LinearFunction::addTerm(ConstVariablePtr var, const double a) 
 {
   if (fabs(a) > tol_) {
-    terms_.insert(std::make_pair(var, a));
+    // terms are often added in increasing order of variables, the hint makes
+    // such insertions take constant time.
+    terms_.insert(terms_.end(), std::make_pair(var, a));
     hasChanged_ = true;
   }
 }
@@ -201,7 +203,7 @@ void LinearFunction::computeBounds(double *l, double *u)
 void LinearFunction::getVars(VariableSet *vars)
 {
   for (VariableGroupConstIterator it=terms_.begin(); it!=terms_.end(); ++it) {
-    vars->insert(it->first);
+    vars->insert(vars->end(), it->first);
   }
 }
 
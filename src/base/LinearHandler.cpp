@@ -15,10 +15,14 @@
 #include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <sstream>
 
 #include "BrCand.h"
 #include "Branch.h"
+#include "CliqueTable.h"
 #include "Constraint.h"
+#include "Cut.h"
+#include "CutManager.h"
 #include "Environment.h"
 #include "Function.h"
 #include "LinearFunction.h"
@@ -59,6 +63,7 @@ LinearHandler::LinearHandler()
     pStats_(0),
     pOpts_(0)
 {
+  cliqueCuts_ = false;
   linVars_.clear();
 }
 
@@ -72,6 +77,7 @@ LinearHandler::LinearHandler(EnvPtr env, ProblemPtr problem)
     pOpts_(0)
 {
   logger_ = env->getLogger();
+  cliqueCuts_ = env->getOptions()->findBool("clique_cuts")->getValue();
   pStats_ = new LinPresolveStats();
   pOpts_ = new LinPresolveOpts();
   pOpts_->doPresolve = env->getOptions()->findBool("lin_presolve")->getValue();
@@ -92,6 +98,8 @@ LinearHandler::LinearHandler(EnvPtr env, ProblemPtr problem)
   pStats_->time = 0.;
   pStats_->timeN = 0.;
   pStats_->nMods = 0;
+  pStats_->cFix = 0;
+  pStats_->cCuts = 0;
 }
 
 LinearHandler::~LinearHandler()
@@ -192,6 +200,26 @@ void LinearHandler::findAllBinCons_()
   }
 }
 
+void LinearHandler::fixedLit_(ModificationPtr mod, UIntQ& lits) const
+{
+  VarBoundModPtr m = dynamic_cast<VarBoundModPtr>(mod);
+  VarBoundMod2Ptr m2 = dynamic_cast<VarBoundMod2Ptr>(mod);
+  VariablePtr v = 0;
+
+  if(m) {
+    v = m->getVar();
+  } else if(m2) {
+    v = m2->getVar();
+  }
+  if(v && Binary == v->getType()) {
+    if(v->getLb() > 0.5) {
+      lits.push_back(CliqueTable::getLiteral(v->getIndex(), true));
+    } else if(v->getUb() < 0.5) {
+      lits.push_back(CliqueTable::getLiteral(v->getIndex(), false));
+    }
+  }
+}
+
 void LinearHandler::fixToCont_()
 {
   VariablePtr v;
@@ -205,11 +233,56 @@ void LinearHandler::fixToCont_()
   }
 }
 
-void LinearHandler::separate(ConstSolutionPtr, NodePtr, RelaxationPtr,
-                             CutManager*, SolutionPoolPtr, ModVector&,
-                             ModVector&, bool*, SeparationStatus*)
+void LinearHandler::separate(ConstSolutionPtr sol, NodePtr, RelaxationPtr rel,
+                             CutManager* cutman, SolutionPoolPtr, ModVector&,
+                             ModVector&, bool*, SeparationStatus* status)
 {
-  // do nothing.
+  CliqueTable* cliques = problem_->getCliqueTable();
+  std::vector<UIntVector> cliq;
+  CutVector cuts;
+  LinearFunctionPtr lf;
+  FunctionPtr f;
+  double rhs;
+  bool separated = false;
+  size_t n_added = 0;
+
+  if(false == cliqueCuts_ || !cliques || !cutman) {
+    return;
+  }
+
+  // add sum_{l in C} l <= 1 for every violated clique C, where the literal
+  // l is x or 1-x.
+  cliques->separate(sol->getPrimal(), rel, cliq, 50);
+  for(UInt i = 0; i < cliq.size(); ++i) {
+    lf = (LinearFunctionPtr) new LinearFunction();
+    rhs = 1.0;
+    for(UIntVector::const_iterator it = cliq[i].begin(); it != cliq[i].end();
+        ++it) {
+      if(CliqueTable::getValue(*it)) {
+        lf->addTerm(rel->getVariable(CliqueTable::getVarIndex(*it)), 1.0);
+      } else {
+        lf->addTerm(rel->getVariable(CliqueTable::getVarIndex(*it)), -1.0);
+        rhs -= 1.0;
+      }
+    }
+    f = (FunctionPtr) new Function(lf);
+    cuts.push_back((CutPtr) new Cut(rel->getNumVars(), f, -INFINITY, rhs,
+                                    false, false));
+  }
+  if(cuts.empty()) {
+    return;
+  }
+
+  // the cut manager decides which cuts go to the relaxation.
+  cutman->addCuts(cuts.begin(), cuts.end());
+  cutman->separate(rel, sol, &separated, &n_added);
+  if(n_added > 0) {
+    *status = SepaResolve;
+  }
+  {
+    std::lock_guard<std::mutex> lock(pStatsLock_);
+    pStats_->cCuts += cuts.size();
+  }
 }
 
 SolveStatus LinearHandler::presolve(PreModQ* pre_mods, bool* changed0,
@@ -319,6 +392,34 @@ SolveStatus LinearHandler::presolve(PreModQ* pre_mods, bool* changed0,
   return Finished;
 }
 
+SolveStatus LinearHandler::cliqueFix_(ProblemPtr p, UIntQ& lits,
+                                      bool* changed, ModQ* mods,
+                                      UInt* nintmods)
+{
+  CliqueTable* cliques = problem_->getCliqueTable();
+  bool is_inf = false;
+  UInt nfixed;
+  UInt nmods = mods->size();
+
+  if(!cliques) {
+    lits.clear();
+    return Started;
+  }
+  nfixed = cliques->propagate(p, lits, mods, &is_inf);
+  // constraints of fixed variables are checked again in varBndsFromCons_.
+  for(ModQ::const_iterator it = mods->begin() + nmods; it != mods->end();
+      ++it) {
+    changeBFlag_(((VarBoundModPtr) *it)->getVar());
+  }
+  if(nfixed > 0) {
+    *changed = true;
+    *nintmods += nfixed;
+    std::lock_guard<std::mutex> lock(pStatsLock_);
+    pStats_->cFix += nfixed;
+  }
+  return (true == is_inf) ? SolvedInfeasible : Started;
+}
+
 SolveStatus LinearHandler::checkBounds_(ProblemPtr p)
 {
   VariablePtr v;
@@ -1582,12 +1683,31 @@ void LinearHandler::purgeVars_(PreModQ* pre_mods)
   }
 }
 
-bool LinearHandler::presolveNode(RelaxationPtr rel, NodePtr,
+bool LinearHandler::presolveNode(RelaxationPtr rel, NodePtr node,
                                  SolutionPoolPtr spool, ModVector& p_mods,
                                  ModVector& r_mods)
 {
   SolveStatus status = Started;
-  simplePresolve(rel, spool, r_mods, status);
+  BranchPtr br = node ? node->getBranch() : 0;
+  bool changed = false;
+  UInt nintmods = 0;
+  UIntQ lits;
+  ModQ mods;
+
+  // variables fixed by branching were not seen by the cliques before.
+  if(br && problem_->getCliqueTable()) {
+    for(ModificationConstIterator it = br->rModsBegin(); it != br->rModsEnd();
+        ++it) {
+      fixedLit_(*it, lits);
+    }
+    status = cliqueFix_(rel, lits, &changed, &mods, &nintmods);
+    for(ModQ::const_iterator it = mods.begin(); it != mods.end(); ++it) {
+      r_mods.push_back(*it);
+    }
+  }
+  if(status != SolvedInfeasible) {
+    simplePresolve(rel, spool, r_mods, status);
+  }
   if(true == modProb_) {
     copyBndsFromRel_(rel, p_mods);
   }
@@ -1599,6 +1719,8 @@ void LinearHandler::simplePresolve(ProblemPtr p, SolutionPoolPtr spool,
 {
   bool changed = true;
   ModQ mods;
+  UIntQ lits;
+  UInt nseen = 0;
   UInt max_iters = 10;
   UInt min_iters = 2;
   UInt iters = 1;
@@ -1627,7 +1749,7 @@ void LinearHandler::simplePresolve(ProblemPtr p, SolutionPoolPtr spool,
 #pragma omp critical
 #endif
     {
-      if(spool && spool->getNumSols() > 0) {
+      if(spool && spool->hasBest()) {
         status = varBndsFromObj_(
             p, spool->getBestSolutionValue() - p->getObjective()->getConstant(),
             false, &changed, &mods);
@@ -1637,14 +1759,25 @@ void LinearHandler::simplePresolve(ProblemPtr p, SolutionPoolPtr spool,
       break;
     }
     tightenInts_(p, false, &changed, &mods);
+    for(; nseen < mods.size(); ++nseen) {
+      fixedLit_(mods[nseen], lits);
+    }
+    status = cliqueFix_(p, lits, &changed, &mods, &nintmods);
+    nseen = mods.size();
+    if(status == SolvedInfeasible) {
+      break;
+    }
     status = checkBounds_(p);
   }
 
   for(ModQ::const_iterator it = mods.begin(); it != mods.end(); ++it) {
     t_mods.push_back(*it);
   }
-  pStats_->nMods += mods.size();
-  pStats_->timeN += timer->query();
+  {
+    std::lock_guard<std::mutex> lock(pStatsLock_);
+    pStats_->nMods += mods.size();
+    pStats_->timeN += timer->query();
+  }
 
   delete timer;
 }
@@ -1756,6 +1889,10 @@ void LinearHandler::writePreStats(std::ostream& out) const
       << me_ << "Times binary variable relaxed  = " << pStats_->bImpl
       << std::endl
       << me_ << "Changes in nodes               = " << pStats_->nMods
+      << std::endl
+      << me_ << "Binaries fixed by cliques      = " << pStats_->cFix
+      << std::endl
+      << me_ << "Clique inequalities added      = " << pStats_->cCuts
       << std::endl;
 }
 
@@ -14,6 +14,8 @@
 #ifndef MINOTAURLINEARHANDLER_H
 #define MINOTAURLINEARHANDLER_H
 
+#include <mutex>
+
 #include "Handler.h"
 
 namespace Minotaur
@@ -33,6 +35,8 @@ struct LinPresolveStats {
   int cImp;     ///> Number of times coefficient in a constraint was improved.
   int bImpl;    ///> No. of times a binary var. was changed to implied binary.
   int nMods;    ///> Number of changes made in all nodes.
+  int cFix;     ///> Number of binary variables fixed by cliques in nodes.
+  int cCuts;    ///> Number of clique inequalities sent to the cut manager.
 };
 
 /// Options for presolve.
@@ -192,6 +196,12 @@ protected:
   /// If true, dupRows_ is run in presolve
   bool chkDupRows_;
 
+  /**
+   * If true, violated cliques of the clique table are sent to the cut
+   * manager in separate. Nothing is separated when there is no cut manager.
+   */
+  bool cliqueCuts_;
+
   /// Tolerance.
   const double eTol_;
 
@@ -201,6 +211,10 @@ protected:
   /// Statistics of presolve.
   LinPresolveStats* pStats_;
 
+  /// Lock for statistics that are updated in nodes, possibly by many
+  /// threads: timeN, nMods, cFix and cCuts.
+  std::mutex pStatsLock_;
+
   /// Options for presolve.
   LinPresolveOpts* pOpts_;
 
@@ -225,6 +239,13 @@ protected:
    */
   void chkSing_(bool* changed);
 
+  /**
+   * \brief Fix binary variables in conflict with the literals lits, that
+   * are true in p, using the clique table of the problem. lits is emptied.
+   */
+  SolveStatus cliqueFix_(ProblemPtr p, UIntQ& lits, bool* changed,
+                         ModQ* mods, UInt* nintmods);
+
   void coeffImp_(bool* changed);
   void computeImpBounds_(ConstraintPtr c, VariablePtr z, double zval,
                          double* lb, double* ub);
@@ -244,6 +265,10 @@ protected:
   void findLinVars_();
 
   void findAllBinCons_();
+
+  /// Append to lits the literal of the binary variable fixed by mod, if any.
+  void fixedLit_(ModificationPtr mod, UIntQ& lits) const;
+
   void fixToCont_();
 
   void getLfBnds_(LinearFunctionPtr lf, double* lo, double* up);
@@ -45,6 +45,10 @@
 #include "VarBoundMod.h"
 #include "Variable.h"
 
+#if USE_OPENMP
+#include <omp.h>
+#endif
+
 using namespace Minotaur;
 
 typedef std::vector<ConstraintPtr>::const_iterator CCIter;
@@ -68,7 +72,11 @@ Linearizations::Linearizations(EnvPtr env, RelaxationPtr rel,
   isBoundPt_(0)
 {
   nlCons_ = nlCons;
+  for (CCIter it = nlCons_.begin(); it != nlCons_.end(); ++it) {
+    nlFuns_.push_back((*it)->getFunction());
+  }
   logger_ = env->getLogger();
+  numThreads_ = env_->getOptions()->findInt("threads")->getValue();
   rs1_ = env_->getOptions()->findDouble("root_linScheme1")->getValue();
   rs2Per_ = env_->getOptions()->findDouble("root_linScheme2")->getValue();
   rs2NbhSize_ = env_->getOptions()->findDouble("root_linScheme2_nbhSize")->getValue();
@@ -143,6 +151,7 @@ Linearizations::~Linearizations()
   rel_ = 0;
   minlp_ = 0;
   nlCons_.clear();
+  nlFuns_.clear();
 }
 
 
@@ -682,6 +691,15 @@ void Linearizations::insertNewPt_(UInt j, UInt i, std::vector<double > &xc,
 void Linearizations::candLinCons_(const double *x,
                                   std::vector<UInt > &consToLin,
                                   bool &foundActive, bool &foundVio)
+{
+  candLinCons_(x, nlFuns_, consToLin, foundActive, foundVio);
+}
+
+
+void Linearizations::candLinCons_(const double *x,
+                                  const std::vector<FunctionPtr> &funs,
+                                  std::vector<UInt > &consToLin,
+                                  bool &foundActive, bool &foundVio)
 {
   UInt i = 0;
   int error = 0;
@@ -690,7 +708,7 @@ void Linearizations::candLinCons_(const double *x,
 
   for (CCIter it = nlCons_.begin(); it != nlCons_.end(); ++it, ++i) {
     c = *it;
-    act = c->getActivity(x, &error);
+    act = funs[i]->eval(x, &error);
     if (error == 0) {
       cUb = c->getUb();
       if ((act > cUb + solAbsTol_) &&
@@ -1579,7 +1597,9 @@ void Linearizations::rootLinGenScheme1_()
   
   // coordinate direction along each variable in varPtrs_.
   //if (!isBoundPt_) 
-  if (nlCons_.size() > 0 || (!isBoundPt_ && !hasEqCons_)) {
+  if (nlCons_.size() > 0) {
+    cutsAtBoundaryPar_();
+  } else if (!isBoundPt_ && !hasEqCons_) {
     changeVar_.push_back(0);
     for (UInt i = 0; i < varPtrs_.size(); ++i) {
       v = varPtrs_[i];
@@ -1813,6 +1833,108 @@ void Linearizations::cutsAtBoundary_(double *xOut)
 }
 
 
+void Linearizations::cutsAtBoundaryPar_()
+{
+  UInt n = minlp_->getNumVars();
+  UInt ndirs = 2*varPtrs_.size();
+  UInt nthreads = std::max(1, std::min((int) numThreads_, (int) ndirs));
+  std::vector<std::vector<FunctionPtr> > funs(nthreads);
+  std::vector<std::vector<UInt> > dirCons(ndirs);
+  std::vector<std::vector<double> > dirPt(ndirs);
+  std::vector<std::vector<UInt> > linDirs(nlCons_.size());
+  std::vector<UInt> consToLin;
+  FunctionPtr f;
+  int err = 0;
+
+  // functions are evaluated in nodes of their computational graph, so that
+  // every thread other than the first needs its own copy.
+  funs[0] = nlFuns_;
+  for (UInt t = 1; t < nthreads; ++t) {
+    for (UInt i = 0; i < nlFuns_.size() && 0 == err; ++i) {
+      f = nlFuns_[i]->cloneWithVars(minlp_->varsBegin(), &err);
+      funs[t].push_back(f);
+    }
+    if (err) {
+      for (UInt i = 0; i < funs[t].size(); ++i) {
+        delete funs[t][i];
+      }
+      nthreads = t;
+      break;
+    }
+  }
+
+  // a boundary point along each coordinate direction, and its opposite,
+  // from the center.
+#if USE_OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+#endif
+  for (int d = 0; d < (int) ndirs; ++d) {
+    UInt t = 0;
+    VariablePtr v = varPtrs_[d/2];
+    UInt vIdx = v->getIndex();
+    std::vector<UInt> changeVar(1, vIdx);
+    std::vector<double> xOut(solC_, solC_ + n);
+    bool active = false, vio = false;
+
+#if USE_OPENMP
+    t = omp_get_thread_num();
+#endif
+    if (0 == d%2) {
+      xOut[vIdx] = (v->getUb() == INFINITY) ? xOut[vIdx] + 50 : v->getUb();
+    } else {
+      xOut[vIdx] = (v->getLb() == -INFINITY) ? xOut[vIdx] - 50 : v->getLb();
+    }
+    candLinCons_(&xOut[0], funs[t], dirCons[d], active, vio);
+    if (vio) {
+      dirPt[d].resize(n);
+      if (!boundaryPtForCons_(&dirPt[d][0], &xOut[0], dirCons[d], changeVar,
+                              funs[t])) {
+        dirPt[d].clear();
+      }
+    } else if (active) {
+      dirPt[d].swap(xOut);
+    }
+  }
+
+  for (UInt t = 1; t < nthreads; ++t) {
+    for (UInt i = 0; i < funs[t].size(); ++i) {
+      delete funs[t][i];
+    }
+  }
+
+  // add cuts in the order of directions. A constraint is not linearized
+  // again at a point where it was linearized for an earlier direction.
+  for (UInt d = 0; d < ndirs; ++d) {
+    if (dirPt[d].empty()) {
+      continue;
+    }
+    consToLin.clear();
+    for (UInt k = 0; k < dirCons[d].size(); ++k) {
+      UInt c = dirCons[d][k];
+      bool dup = false;
+      for (UInt j = 0; j < linDirs[c].size() && !dup; ++j) {
+        const std::vector<double> &y = dirPt[linDirs[c][j]];
+        dup = true;
+        for (UInt i = 0; i < n; ++i) {
+          if (fabs(y[i] - dirPt[d][i]) > solAbsTol_) {
+            dup = false;
+            break;
+          }
+        }
+      }
+      if (!dup) {
+        consToLin.push_back(c);
+        linDirs[c].push_back(d);
+      }
+    }
+    if (!consToLin.empty()) {
+      genLin_(&dirPt[d][0], consToLin);
+    }
+  }
+  return;
+}
+
+
 void Linearizations::varsInNonlinCons_()
 {
   //// K is used to limit number of directions in root schemes 4 and 5
@@ -2088,12 +2210,21 @@ bool Linearizations::boundaryPtForObj_(double* xnew, const double *xOut,
 
 bool Linearizations::boundaryPtForCons_(double* xnew, const double *xOut,
                                      std::vector<UInt > &vioCons)
+{
+  return boundaryPtForCons_(xnew, xOut, vioCons, changeVar_, nlFuns_);
+}
+
+
+bool Linearizations::boundaryPtForCons_(double* xnew, const double *xOut,
+                                        std::vector<UInt > &vioCons,
+                                        const std::vector<UInt> &changeVar,
+                                        const std::vector<FunctionPtr> &funs)
 {
   UInt j;
   ConstraintPtr con;
   int error = 0, repPt = 0;
   bool firstVio, firstActive;
-  UInt numVars =  minlp_->getNumVars(), varToChange = changeVar_.size(); 
+  UInt numVars =  minlp_->getNumVars(), varToChange = changeVar.size(); 
 
   double* xl = new double[numVars];
   double* xu = new double[numVars];
@@ -2113,7 +2244,7 @@ bool Linearizations::boundaryPtForCons_(double* xnew, const double *xOut,
       }
     } else {
       for (UInt i = 0 ; i < varToChange; ++i) {
-        j = changeVar_[i];
+        j = changeVar[i];
         xnew[j] = lambdaIn*xl[j] + lambdaOut*xu[j];
       }
     }
@@ -2122,7 +2253,7 @@ bool Linearizations::boundaryPtForCons_(double* xnew, const double *xOut,
 
     for (UInt k = 0; k < vioCons.size(); ) {
       con = nlCons_[vioCons[k]];
-      act = con->getActivity(xnew, &error);
+      act = funs[vioCons[k]]->eval(xnew, &error);
       if (error != 0) {
         delete [] xl;
         delete [] xu;
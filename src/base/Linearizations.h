@@ -62,6 +62,12 @@ private:
   /// Vector of nonlinear constraints.
   std::vector<ConstraintPtr> nlCons_;
 
+  /// Functions of the constraints in nlCons_.
+  std::vector<FunctionPtr> nlFuns_;
+
+  /// Number of threads used for line searches in root schemes.
+  UInt numThreads_;
+
   /// LP Engine used in root linearization scheme 3
   //EnginePtr lpe_;
 
@@ -208,8 +214,21 @@ private:
   void candLinCons_(const double *x, std::vector<UInt > &consToLin,
                              bool &foundActive, bool &foundVio);
 
+  /// Same as above, but evaluate the constraints using functions funs.
+  void candLinCons_(const double *x, const std::vector<FunctionPtr> &funs,
+                    std::vector<UInt > &consToLin, bool &foundActive,
+                    bool &foundVio);
+
   void cutsAtBoundary_(double *xOut);
 
+  /**
+   * Add linearizations at boundary points along coordinate directions from
+   * the center. Points are found by several threads, each with its own
+   * copy of the constraint functions. Cuts are added in the order of
+   * directions, and a constraint is not linearized twice at the same point.
+   */
+  void cutsAtBoundaryPar_();
+
   /// Find intersection of two linearizations in root linearization scheme 1  
   bool findIntersectPt_(std::vector<UInt > newConsId, VariablePtr vl,
                        VariablePtr vnl, double * iP);
@@ -217,6 +236,15 @@ private:
   bool boundaryPtForCons_(double* xnew, const double *xOut, 
                                      std::vector<UInt > &vioCons);
 
+  /**
+   * Same as above, but change only variables in changeVar (all if empty),
+   * and evaluate the constraints using functions funs.
+   */
+  bool boundaryPtForCons_(double* xnew, const double *xOut,
+                          std::vector<UInt > &vioCons,
+                          const std::vector<UInt> &changeVar,
+                          const std::vector<FunctionPtr> &funs);
+
   void solveNLP_();
 
 
@@ -14,7 +14,8 @@ using namespace Minotaur;
 Logger::Logger(LogLevel max_level) 
   : maxLevel_(max_level),  nb_(), nout_(&nb_)
 {
-
+  // a bad stream does not format what is written to it.
+  nout_.setstate(std::ios_base::badbit);
 }
 
 
@@ -16,6 +16,7 @@
 #include <iomanip>
 
 #include "MinotaurConfig.h"
+#include "BoundTrail.h"
 #include "Constraint.h"
 #include "Engine.h"
 #include "Environment.h"
@@ -104,6 +105,7 @@ void MINLPDiving::backtrack_(UInt n_moded)
   VariablePtr variable;
   double old_bound_val;
 
+  p_->beginUpdate();
   for (ModVector::reverse_iterator m_iter=lastNodeMods_.rbegin(); 
        m_iter!=lastNodeMods_.rend(); ++m_iter) {
     (*m_iter)->undoToProblem(p_);
@@ -134,6 +136,7 @@ void MINLPDiving::backtrack_(UInt n_moded)
     mods_.push(temp_varmod);
     temp.pop();
   }
+  p_->commitUpdate();
 }
 
 
@@ -316,7 +319,7 @@ void MINLPDiving::implementDive_(int i, const double* x, SolutionPoolPtr s_pool)
 
   lastNodeMods_.clear();
   n_moded  = (this->*f)(numfrac, x, d, o);
-  while (stats_->totalNLPs < maxNLP_) {
+  while (stats_->totalNLPs < maxNLP_ && false == isStopped_()) {
     status = e_->solve();
     ++(stats_->numNLPs[i/8]);
     ++(stats_->totalNLPs);
@@ -558,15 +561,6 @@ UInt MINLPDiving::ReducedCost_(UInt numfrac, const double* x,
 }
 
 
-void MINLPDiving::restoreBounds_(double* LB_copy, double* UB_copy, UInt vars)
-{
-  for (UInt i=0; i<vars; ++i, ++LB_copy, ++UB_copy) {
-    p_->changeBoundByInd(i, Lower, *LB_copy);
-    p_->changeBoundByInd(i, Upper, *UB_copy);
-  }
-}
-
-
 double MINLPDiving::rounding_(double value, Direction d)
 {
   switch (d) {
@@ -594,17 +588,6 @@ double MINLPDiving::rounding_(double value, Direction d)
 }
 
 
-void MINLPDiving::saveBounds_(double* LB_copy, double* UB_copy, UInt vars)
-{
-  VariablePtr variable;
-  for (UInt i=0; i<vars; ++i, ++LB_copy, ++UB_copy) {
-    variable = p_->getVariable(i);
-    *LB_copy = variable->getLb();
-    *UB_copy = variable->getUb();
-  }
-}
-
-
 MINLPDiving::FuncPtr MINLPDiving::selectHeur_(int i, Direction &d, Order &o)
 {
   switch (i%4) {
@@ -680,8 +663,6 @@ void MINLPDiving::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
   UInt numvars           = p_->getNumVars();
   double* root_x;
   double* root_copy;
-  double* LB_copy;
-  double* UB_copy;
   logger_->msgStream(LogInfo) << me_ << "Starting" << std::endl;
   timer_->start();
   if (!shouldDive_()) {
@@ -691,8 +672,6 @@ void MINLPDiving::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
   }
   root_x             = new double[numvars];
   root_copy          = new double[numvars];
-  LB_copy            = new double[numvars];
-  UB_copy            = new double[numvars];
   e_->clear();
   e_->load(p_);
   e_->setIterationLimit(7000); // try to run for a loooong time.
@@ -711,16 +690,20 @@ void MINLPDiving::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
       << stats_->best_obj_value << std::endl;
     s_pool->addSolution(sol);
   } else {
-    lh_ = new LinearHandler(env_, p_);
-    saveBounds_(LB_copy, UB_copy, numvars);
+    // records the bounds changed in a dive, so that only they are restored
+    BoundTrail trail(p_);
+    if (!lh_) {
+      lh_ = new LinearHandler(env_, p_);
+    }
     // loop over the methods starts here
-    for (int i=0; i<num_method && stats_->totalSol < maxSol_; ++i) {
+    for (int i=0; i<num_method && stats_->totalSol < maxSol_ &&
+         false == isStopped_(); ++i) {
       logger_->msgStream(LogDebug) << me_<< "diving method "
         << i << std::endl;
       std::copy(root_x, root_x + numvars, root_copy); 
       x = root_copy;
       implementDive_(i, x, s_pool);
-      restoreBounds_(LB_copy, UB_copy, numvars);
+      trail.undo();
       // clear the stack of modification for this heuristic method
       while (!mods_.empty()) {
           mods_.pop();
@@ -737,12 +720,6 @@ void MINLPDiving::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
   if (root_x){
     delete [] root_x;
   }
-  if (LB_copy){
-    delete [] LB_copy;
-  }
-  if (UB_copy){
-    delete [] UB_copy;
-  }
   if (root_copy){
     delete [] root_copy;
   }
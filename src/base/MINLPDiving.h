@@ -90,6 +90,12 @@
      /// call to heuristic
      void solve(NodePtr node, RelaxationPtr rel, SolutionPoolPtr s_pool); 
 
+     /// Return the name of this heuristic.
+     std::string getName() const { return "MINLP Diving"; }
+
+     /// Number of NLPs solved so far.
+     UInt getNumSolves() const { return stats_->totalNLPs; }
+
      /// writing the statistics to the logger
      void writeStats(std::ostream &out) const;
 
@@ -237,15 +243,6 @@
      UInt ReducedCost_(UInt numfrac, const double* x, 
                        Direction d, Order o);
 
-     /**
-      * \brief Restore the bounds for the problem
-      *
-      * \param[in] LB_copy Pointer to saved bounds
-      * \param[in] UB_copt Pointer to saved bounds
-      * \param[in] vars Number of variables in the problem
-      */
-     void restoreBounds_(double* LB_copy, double* UB_copy, UInt vars);
-
      /**
       * \brief Rounding a value in a given direction
       *
@@ -256,15 +253,6 @@
       */
      double rounding_(double value, Direction d);
 
-     /** 
-      * \brief Save bounds of the problem
-      *
-      * \param[in] LB_copy Pointer to bounds, space has to be allocated
-      * \param[in] UB_copt Pointer to bounds, space has to be allocated
-      * \param[in] vars Number of variables in the problem
-      */
-     void saveBounds_(double* LB_copy, double* UB_copy, UInt vars);
-
      /**
       * \brief Select the method, ordering and direction.
       *
@@ -14,3 +14,6 @@
 /* Define to 1 if you have the getrusage() function. */
 #cmakedefine MINOTAUR_RUSAGE
 
+/* Define to 1 if zlib is available for reading compressed files. */
+#cmakedefine MINOTAUR_ZLIB
+
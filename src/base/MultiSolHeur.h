@@ -53,6 +53,12 @@ namespace Minotaur {
 
     void solve(NodePtr, RelaxationPtr, SolutionPoolPtr) {};
 
+    /// Return the name of this heuristic.
+    std::string getName() const { return "MultiSol"; }
+
+    /// Number of NLPs solved so far.
+    UInt getNumSolves() const { return stats_->nlpS; }
+
     /// write statistic to the logger
     void writeStats(std::ostream &out) const;
 
@@ -76,82 +76,82 @@ public:
   /**
    * Return rev_mlterms_
    */    
-  std::map <std::vector<ConstVariablePtr>, ConstVariablePtr > getRevMlterms() 
+  const std::map <std::vector<ConstVariablePtr>, ConstVariablePtr > & getRevMlterms() const 
   {return rev_mlterms_; }
 
   /**
    * Return mlterms_
    */    
-  std::map <ConstVariablePtr, std::vector<ConstVariablePtr> > getMlterms() 
+  const std::map <ConstVariablePtr, std::vector<ConstVariablePtr> > & getMlterms() const 
   {return mlterms_; }
 
   /**
    * Retrun the max_pow_
    */
-  std::map <ConstVariablePtr, UInt> getMaxPow() {return max_pow_; }
+  const std::map <ConstVariablePtr, UInt> & getMaxPow() const {return max_pow_; }
     
   /**
    * Retrun the blterms_
    */
-  std::map <ConstVariablePtr, ConstVariablePair> getBlterms() {return blterms_; }
+  const std::map <ConstVariablePtr, ConstVariablePair> & getBlterms() const {return blterms_; }
     
   /**
    * Retrun the rev_blterms_
    */
-  std::map <ConstVariablePair, ConstVariablePtr> getRevBlterms() {return rev_blterms_; }
+  const std::map <ConstVariablePair, ConstVariablePtr> & getRevBlterms() const {return rev_blterms_; }
     
   /**
    * Retrun the monomial_terms__
    */
-  std::map <VarIntMap, ConstVariablePtr> getMonomialterms() {return monomial_terms_; }
+  const std::map <VarIntMap, ConstVariablePtr> & getMonomialterms() const {return monomial_terms_; }
     
   /**
    * Retrun the sqterms_
    */
-  std::map <ConstVariablePtr, ConstVariablePair> getSqterms() {return sqterms_; }    
+  const std::map <ConstVariablePtr, ConstVariablePair> & getSqterms() const {return sqterms_; }    
     
   /**
    * Retrun the rev_sqterms_
    */
-  std::map <ConstVariablePair, ConstVariablePtr> getRevSqterms() {return rev_sqterms_; }    
+  const std::map <ConstVariablePair, ConstVariablePtr> & getRevSqterms() const {return rev_sqterms_; }    
     
   /**
    * Return the groups of variables that are made for the Grouped Convex Hull relaxation  
    */
-  std::vector<std::vector<ConstVariablePtr> > getGroups() {return groups_; }
+  const std::vector<std::vector<ConstVariablePtr> > & getGroups() const {return groups_; }
     
   /**
    * Return the lambda variables introduced for the Grouped Convex Hull relaxation
    */
-  std::vector<std::vector<ConstVariablePtr> > getAllLambdas() {return all_lambdas_; }
+  const std::vector<std::vector<ConstVariablePtr> > & getAllLambdas() const {return all_lambdas_; }
     
   /**
    * Return the map between the original variables and the variables in the relaxation
    */
-  std::map <ConstVariablePtr, ConstVariablePtr> getOriginalVariablesMap() {return oVars_; }
+  const std::map <ConstVariablePtr, ConstVariablePtr> & getOriginalVariablesMap() const {return oVars_; }
     
   /**
    * Return the REVERSE map between the original variables and the variables in the relaxation
    */
-  std::map <ConstVariablePtr, ConstVariablePtr> getRevOriginalVariablesMap() {return rev_oVars_; }
+  const std::map <ConstVariablePtr, ConstVariablePtr> & getRevOriginalVariablesMap() const {return rev_oVars_; }
     
   /**
    * Return the map between the original variables and the copy variables for
    * its exponents
    */
-  std::map<ConstVariablePtr, std::vector<ConstVariablePtr> > getNewCopyVariables() 
+  const std::map<ConstVariablePtr, std::vector<ConstVariablePtr> > & getNewCopyVariables() const 
     {return newCopyVariables_; }
     
   /**
    * Retrun the map of monomial terms
    */
-  std::map <VarIntMap, ConstVariablePtr> getMonomialTerms() {return monomial_terms_; }
+  const std::map <VarIntMap, ConstVariablePtr> & getMonomialTerms() const {return monomial_terms_; }
     
   /**
    * Return the map of bilinear terms (map of a variable pair and a
    * substiture variable)
    */
-  std::map <ConstVariablePair, ConstVariablePtr> getRevBilinearTerms() 
+  const std::map <ConstVariablePair, ConstVariablePtr> & getRevBilinearTerms() const 
     {return rev_blterms_; }
 
 
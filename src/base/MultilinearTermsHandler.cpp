@@ -480,9 +480,13 @@ MultilinearTermsHandler::relaxNodeInc(NodePtr node,
   relaxation->write(std::cout);
 #endif
 
+  // Rows are modified by the branches (getBrMod) and by earlier calls, so
+  // only those of variables whose bounds changed since need to be written.
   ModVector mods;
-  handleXDefConstraints_(relaxation, relaxNodeInc_Call, mods);
-  handleZDefConstraints_(relaxation, relaxNodeInc_Call, mods);
+  std::vector<SetOfVars> changed(groups_.size());
+  findChangedVars_(changed);
+  handleXDefConstraints_(relaxation, relaxNodeInc_Call, mods, &changed);
+  handleZDefConstraints_(relaxation, relaxNodeInc_Call, mods, &changed);
   
   ModificationConstIterator it;
   for (it = mods.begin(); it != mods.end(); ++it) {
@@ -498,18 +502,51 @@ MultilinearTermsHandler::relaxNodeInc(NodePtr node,
 
 
 void
-MultilinearTermsHandler::handleXDefConstraints_(RelaxationPtr relaxation, HandleCallingFunction wherefrom, ModVector &mods)
+MultilinearTermsHandler::findChangedVars_(std::vector<SetOfVars> &changed)
 {
   for (UInt gix = 0; gix < groups_.size(); ++gix) {
     for(SetOfVars::const_iterator it = groups_[gix].begin(); it != groups_[gix].end(); ++it) {
       ConstVariablePtr xvar = *it;
+      IntVarPtrPairConstraintMap::iterator pos;
+      IntVarPtrPairLamMap::iterator lpos;
+      pos = xConMap_.find(IntVarPtrPair(gix, xvar));
+      lpos = xLamMap_.find(IntVarPtrPair(gix, xvar));
+      assert(pos != xConMap_.end() && lpos != xLamMap_.end());
+
+      LinearFunctionPtr lf = pos->second->getLinearFunction();
+      if (lf->getWeight(lpos->second.first) != xvar->getLb() ||
+          lf->getWeight(lpos->second.second) != xvar->getUb()) {
+        changed[gix].insert(xvar);
+      }
+    }
+  }
+}
+
+
+void
+MultilinearTermsHandler::handleXDefConstraints_(RelaxationPtr relaxation, HandleCallingFunction wherefrom, ModVector &mods,
+                                                const std::vector<SetOfVars> *changed)
+{
+  for (UInt gix = 0; gix < groups_.size(); ++gix) {
+    for(SetOfVars::const_iterator it = groups_[gix].begin(); it != groups_[gix].end(); ++it) {
+      ConstVariablePtr xvar = *it;
+      if (changed && 0 == (*changed)[gix].count(xvar)) {
+        continue;
+      }
       LinearFunctionPtr lf = (LinearFunctionPtr) new LinearFunction();
       lf->addTerm(xvar, -1.0);
+      VarPtrPair lams(0, 0);
       
       int pix = 0;
       for (std::set<SetOfVars>::iterator it2 = points_[gix].begin(); it2 != points_[gix].end(); ++it2) {
         VariablePtr lam = lambdavars_[gix][pix];
-        double val = varIsAtLowerBoundAtPoint_(xvar, *it2) ? xvar->getLb() : xvar->getUb();
+        bool atLower = varIsAtLowerBoundAtPoint_(xvar, *it2);
+        double val = atLower ? xvar->getLb() : xvar->getUb();
+        if (atLower && !lams.first) {
+          lams.first = lam;
+        } else if (!atLower && !lams.second) {
+          lams.second = lam;
+        }
         lf->addTerm(lam, val);
 #if defined(DEBUG_MULTILINEARTERMS_HANDLER)
         std::cout << xvar->getName() << ", lam: " << gix << "," << pix << " value is: " 
@@ -522,6 +559,7 @@ MultilinearTermsHandler::handleXDefConstraints_(RelaxationPtr relaxation, Handle
       if (wherefrom == relaxInit_Call) {
         ConstraintPtr c = relaxation->newConstraint(f, 0.0, 0.0);
         xConMap_.insert(std::make_pair(IntVarPtrPair(gix, xvar), c));
+        xLamMap_.insert(std::make_pair(IntVarPtrPair(gix, xvar), lams));
       }
       else { 
         IntVarPtrPairConstraintMap::iterator pos;
@@ -530,8 +568,6 @@ MultilinearTermsHandler::handleXDefConstraints_(RelaxationPtr relaxation, Handle
           assert(0);
         }
         ConstraintPtr c = pos->second;
-        //XXX Here you should just check if the constraint really was going to
-        //change and do nothing if it doesn't...  (will be faster).
         if (wherefrom == relaxNodeInc_Call) {
           relaxation->changeConstraint(c, lf, 0.0, 0.0);
         }
@@ -551,7 +587,8 @@ MultilinearTermsHandler::handleXDefConstraints_(RelaxationPtr relaxation, Handle
 // z_t = \sum_{k=1}^{2 |V_g|} \lambda_k^g, \Prod_{j \in J_t} \chi_j^{g,k}
 //   \forall J_t \subseteq V_g
 void
-MultilinearTermsHandler::handleZDefConstraints_(RelaxationPtr relaxation, HandleCallingFunction wherefrom, ModVector &mods)
+MultilinearTermsHandler::handleZDefConstraints_(RelaxationPtr relaxation, HandleCallingFunction wherefrom, ModVector &mods,
+                                                const std::vector<SetOfVars> *changed)
 {
   for(ConstTermIterator it = termsR_.begin(); it != termsR_.end(); ++it) {
     ConstVariablePtr zt = it->first;
@@ -559,6 +596,18 @@ MultilinearTermsHandler::handleZDefConstraints_(RelaxationPtr relaxation, Handle
 
     for (UInt gix = 0; gix < groups_.size(); ++gix) {
       SetOfVars &vg = groups_[gix];
+
+      if (changed) {
+        // skip unless a variable of J_t has changed
+        SetOfVars const &cg = (*changed)[gix];
+        SetOfVars::const_iterator jt_it = jt.begin();
+        while (jt_it != jt.end() && 0 == cg.count(*jt_it)) {
+          ++jt_it;
+        }
+        if (jt_it == jt.end()) {
+          continue;
+        }
+      }
        
       if (std::includes(vg.begin(), vg.end(), jt.begin(), jt.end())) { 
         // jt is a subset of vg, add constraint
@@ -593,8 +642,6 @@ MultilinearTermsHandler::handleZDefConstraints_(RelaxationPtr relaxation, Handle
             assert(0);
           }
           ConstraintPtr c = pos->second;
-          //XXX Here you should just check if the constraint really was going to
-          //change and do nothing if it doesn't...  (will be faster).
           if (wherefrom == relaxNodeInc_Call) {
             relaxation->changeConstraint(c, lf, 0.0, 0.0);
           }
@@ -142,7 +142,8 @@ public:
   // Does nothing.
   void relaxNodeFull(NodePtr, RelaxationPtr, bool *) {assert(0); };
 
-  // All changes are in the branches to the relaxation, so this need not do anything
+  // Update the rows of groups whose variables have different bounds than
+  // the ones the rows were last written with.
   void relaxNodeInc(NodePtr n, RelaxationPtr r , bool *is_inf);
 
     
@@ -233,6 +234,13 @@ private:
   IntVarPtrPairConstraintMap xConMap_;
   IntVarPtrPairConstraintMap zConMap_;
 
+  // For each (group, x_j), a lambda whose point has x_j at its lower bound
+  // and one whose point has x_j at its upper bound. Their coefficients in
+  // the 'x =' row are the bounds of x_j used when the row was last written.
+  typedef std::pair<ConstVariablePtr, ConstVariablePtr> VarPtrPair;
+  typedef std::map<IntVarPtrPair, VarPtrPair> IntVarPtrPairLamMap;
+  IntVarPtrPairLamMap xLamMap_;
+
 
   // Hypergraph for termcover
   HypergraphPtr H_;
@@ -257,19 +265,29 @@ private:
   BranchPtr doBranch_(BranchDirection UpOrDown, ConstVariablePtr v, 
                       double bvalue);
 
+  // Find, for each group, the variables whose bounds differ from the ones
+  // in its 'x =' rows
+  void findChangedVars_(std::vector<SetOfVars> &changed);
+
   // A greedy dense term covering heuristic
   void greedyDenseHeuristic_();
 
   /* This chunk of code adds (or modifies)
      x_{V_g} = \sum_{k=1}^{2 |V_g|} \lambda_k^g \chi^{k,g} \forall g \in G
+     If changed is not NULL, only the rows of variables in changed[g] are
+     modified.
   */
-  void handleXDefConstraints_(RelaxationPtr relaxation, HandleCallingFunction wherefrom, ModVector &mods);
+  void handleXDefConstraints_(RelaxationPtr relaxation, HandleCallingFunction wherefrom, ModVector &mods,
+                              const std::vector<SetOfVars> *changed = 0);
 
   /* This chunk of code adds
    z_t = \sum_{k=1}^{2 |V_g|} \lambda_k^g, \Prod_{j \in J_t} \chi_j^{g,k}
                             \forall J_t \subseteq V_g
+     If changed is not NULL, only the rows with J_t containing a variable in
+     changed[g] are modified.
   */         
-  void handleZDefConstraints_(RelaxationPtr relaxation, HandleCallingFunction wherefrom, ModVector &mods); 
+  void handleZDefConstraints_(RelaxationPtr relaxation, HandleCallingFunction wherefrom, ModVector &mods,
+                              const std::vector<SetOfVars> *changed = 0); 
   
   // Helper function to make the groups
   void makeGroups_();
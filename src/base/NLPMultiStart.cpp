@@ -136,7 +136,8 @@ void NLPMultiStart::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
   e_->clear();
   e_->load(p_);
   for (UInt i=0, unchanged_obj_count=0; i < heur_bound &&
-       unchanged_obj_count < unchanged_obj_count_limit; ++i) {
+       unchanged_obj_count < unchanged_obj_count_limit &&
+       false == isStopped_(); ++i) {
     // XXX: ashu to bring this out of the loop.
     p_->setInitialPoint(initial_point);
     status = e_->solve();
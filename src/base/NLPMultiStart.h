@@ -57,6 +57,12 @@ namespace Minotaur {
       /// Use this heuristic.
       void solve(NodePtr node, RelaxationPtr rel, SolutionPoolPtr s_pool);
 
+      /// Return the name of this heuristic.
+      std::string getName() const { return "NLP Multi-Start"; }
+
+      /// Number of NLPs solved so far.
+      UInt getNumSolves() const { return stats_.numNLPs; }
+
       // Write statistics to logger
       void writeStats(std::ostream &out) const;
  
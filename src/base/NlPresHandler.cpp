@@ -21,6 +21,7 @@
 #include "Environment.h"
 #include "Function.h"
 #include "HessianOfLag.h"
+#include "Interval.h"
 #include "LinearFunction.h"
 #include "Logger.h"
 #include "MinotaurConfig.h"
@@ -132,8 +133,8 @@ void NlPresHandler::chkRed_(ProblemPtr p, bool purge_cons, bool* changed, ModQ*,
         assert(error == 0);
       }
 
-      impl_lb = nlfl + lfl;
-      impl_ub = nlfu + lfu;
+      impl_lb = AddDown(nlfl, lfl);
+      impl_ub = AddUp(nlfu, lfu);
 
       if(impl_ub + eTol_ < c->getLb() || impl_lb - eTol_ > c->getUb()) {
         status = SolvedInfeasible;
@@ -750,8 +751,8 @@ void NlPresHandler::computeImpBounds_(ConstraintPtr c, VariablePtr z,
   if(qf) {
     qf->computeBounds(&l1, &u1);
   }
-  ll += l1;
-  uu += u1;
+  ll = AddDown(ll, l1);
+  uu = AddUp(uu, u1);
   *lb = ll;
   *ub = uu;
   while(!mods.empty()) {
@@ -1103,7 +1104,7 @@ void NlPresHandler::fixObjBins_(ProblemPtr p, double ub, bool* changed,
         assert(error == 0);
       }
       lf->computeBounds(&lfl, &lfu);
-      olb = lfl + nlfl;
+      olb = AddDown(lfl, nlfl);
       if(olb <= -INFINITY) {
         return;
       } else if(olb > ub) {
@@ -114,6 +114,8 @@ void Node::applyRMods(RelaxationPtr rel)
 {
   ModificationConstIterator mod_iter;
   ModificationPtr mod;
+
+  rel->beginUpdate();
   // first apply the mods that created this node from its parent
   if (branch_) {
     for (mod_iter=branch_->rModsBegin(); mod_iter!=branch_->rModsEnd(); 
@@ -127,6 +129,7 @@ void Node::applyRMods(RelaxationPtr rel)
     mod = *mod_iter;
     mod->applyToProblem(rel);
   }
+  rel->commitUpdate();
 }
 
 
@@ -183,6 +186,7 @@ void Node::applyRModsTrans(RelaxationPtr rel)
   ModificationPtr pmod1, mod2;
   ProblemPtr p=0;   //not used, just passed
 
+  rel->beginUpdate();
   // first apply the mods that created this node from its parent
   if (branch_) {
     for (mod_iter=branch_->rModsBegin(); mod_iter!=branch_->rModsEnd();
@@ -195,7 +199,15 @@ void Node::applyRModsTrans(RelaxationPtr rel)
         mod2->applyToProblem(rel);
         delete mod2; mod2 = 0;
       } else {
-        mod->applyToProblem(rel);
+        // mods that have no counterpart in the problem, e.g. changes
+        // in cuts, are converted using indices only.
+        mod2 = mod->toRel(p, rel);
+        if (mod2) {
+          mod2->applyToProblem(rel);
+          delete mod2; mod2 = 0;
+        } else {
+          mod->applyToProblem(rel);
+        }
       }
       delete pmod1; pmod1 = 0;
     }
@@ -209,10 +221,17 @@ void Node::applyRModsTrans(RelaxationPtr rel)
       mod2->applyToProblem(rel);
       delete mod2; mod2 = 0;
     } else {
-      mod->applyToProblem(rel);
+      mod2 = mod->toRel(p, rel);
+      if (mod2) {
+        mod2->applyToProblem(rel);
+        delete mod2; mod2 = 0;
+      } else {
+        mod->applyToProblem(rel);
+      }
     }
     delete pmod1; pmod1 = 0;
   }
+  rel->commitUpdate();
 }
 
 
@@ -323,6 +342,7 @@ void Node::undoRMods(RelaxationPtr rel)
   ModificationRConstIterator rend = rMods_.rend();  
 
 
+  rel->beginUpdate();
   // first undo the mods that were added while processing the node.
   for (mod_iter=rMods_.rbegin(); mod_iter!= rend; ++mod_iter) {
     mod = *mod_iter;
@@ -337,6 +357,7 @@ void Node::undoRMods(RelaxationPtr rel)
       mod->undoToProblem(rel);
     }
   }
+  rel->commitUpdate();
 }
 
 
@@ -352,6 +373,7 @@ void Node::undoRModsTrans(RelaxationPtr rel)
   ModificationRConstIterator rend = rMods_.rend();
   ModificationPtr pmod1, mod2;
 
+  rel->beginUpdate();
   // first undo the mods that were added while processing the node.
   for (mod_iter=rMods_.rbegin(); mod_iter!= rend; ++mod_iter) {
     mod = *mod_iter;
@@ -362,7 +384,13 @@ void Node::undoRModsTrans(RelaxationPtr rel)
       mod2->undoToProblem(rel);
       delete mod2; mod2 = 0;
     } else {
-      mod->undoToProblem(rel);
+      mod2 = mod->toRel(p, rel);
+      if (mod2) {
+        mod2->undoToProblem(rel);
+        delete mod2; mod2 = 0;
+      } else {
+        mod->undoToProblem(rel);
+      }
     }
     delete pmod1; pmod1 = 0;
   }
@@ -378,11 +406,18 @@ void Node::undoRModsTrans(RelaxationPtr rel)
         mod2->undoToProblem(rel);
         delete mod2; mod2 = 0;
       } else {
-        mod->undoToProblem(rel);
+        mod2 = mod->toRel(p, rel);
+        if (mod2) {
+          mod2->undoToProblem(rel);
+          delete mod2; mod2 = 0;
+        } else {
+          mod->undoToProblem(rel);
+        }
       }
       delete pmod1; pmod1 = 0;
     }
   }
+  rel->commitUpdate();
 }
 
 
@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <set>
 
 #include "MinotaurConfig.h"
 #include "Node.h"
@@ -73,6 +74,26 @@ void NodeHeap::pop()
 }
 
 
+void NodeHeap::erase(const NodePtrVector &nodes)
+{
+  std::set<NodePtr> del(nodes.begin(), nodes.end());
+
+  nodes_.erase(std::remove_if(nodes_.begin(), nodes_.end(),
+                              [&del](NodePtr n) { return del.count(n) > 0; }),
+               nodes_.end());
+  switch(type_) {
+  case (Value):
+    make_heap(nodes_.begin(), nodes_.end(), valueGreaterThan);
+    break;
+  case (Depth):
+    make_heap(nodes_.begin(), nodes_.end(), depthGreaterThan);
+    break;
+  default:
+    assert(0);
+  }
+}
+
+
 double NodeHeap::getBestLB() const
 {
    double retval = INFINITY;
@@ -106,6 +127,12 @@ UInt NodeHeap::getDeepestLevel() const
 }
 
 
+void NodeHeap::getNodes(NodePtrVector &nodes) const
+{
+  nodes.insert(nodes.end(), nodes_.begin(), nodes_.end());
+}
+
+
 void NodeHeap::write(std::ostream &) const
 {
    //for(std::vector<NodePtr>::const_iterator it = nodes_.begin();
@@ -57,6 +57,9 @@ namespace Minotaur {
      */
     virtual bool isEmpty() const { return nodes_.empty(); }
 
+    /// Remove given nodes from the heap and restore the heap.
+    virtual void erase(const NodePtrVector &nodes);
+
     /**
      * Find the minimum lower bound of all the active nodes in the heap.
      * If the heap is ordered by best bound, then the root has the
@@ -67,6 +70,9 @@ namespace Minotaur {
     /// Find the maximum depth of all active nodes.
     virtual UInt getDeepestLevel() const;
 
+    /// Append all nodes in the heap to nodes.
+    virtual void getNodes(NodePtrVector &nodes) const;
+
     /// Remove the best node from the heap.
     virtual void pop();
 
@@ -99,6 +99,9 @@ RelaxationPtr NodeIncRelaxer::createNodeRelaxation(NodePtr node, bool dived,
   WarmStartPtr ws;
   prune = false;
 
+  // the bounds changed at all nodes on the path are given to the engine
+  // in one batch.
+  rel_->beginUpdate();
   if (!dived) {
     // traceback to root and put in all modifications that need to go into the
     // relaxation and the engine.
@@ -134,6 +137,7 @@ RelaxationPtr NodeIncRelaxer::createNodeRelaxation(NodePtr node, bool dived,
   } else {
     node->applyRMods(rel_);
   }
+  rel_->commitUpdate();
 
   for (HandlerIterator h = handlers_.begin(); h != handlers_.end() && !prune; 
       ++h) {
@@ -161,6 +165,7 @@ void NodeIncRelaxer::reset(NodePtr node, bool diving)
   NodePtr t_node = node;
 
   if (!diving) {
+    rel_->beginUpdate();
     if (modProb_) {
       while (t_node) {
         t_node->undoMods(rel_, p_);
@@ -172,6 +177,7 @@ void NodeIncRelaxer::reset(NodePtr node, bool diving)
         t_node = t_node->getParent();
       }
     }
+    rel_->commitUpdate();
   }
 }
 
@@ -20,12 +20,15 @@
 namespace Minotaur {
 
   class Brancher;
+  class HeurScheduler;
   class Relaxation;
+  class Solution;
   class SolutionPool;
   class WarmStart;
   class CutManager;
   typedef Brancher* BrancherPtr;
   typedef Relaxation* RelaxationPtr;
+  typedef const Solution* ConstSolutionPtr;
   typedef SolutionPool* SolutionPoolPtr;
   typedef WarmStart* WarmStartPtr;
   typedef CutManager* CutManagerPtr;
@@ -86,6 +89,13 @@ namespace Minotaur {
       /// Return brancher.
       virtual BrancherPtr getBrancher() { return brancher_;};
 
+      /**
+       * Return the solution of the last relaxation solved while processing
+       * the node, or NULL if it was not solved to optimality. It is valid
+       * until the next node is processed.
+       */
+      virtual ConstSolutionPtr getRelSolution() { return 0; };
+
       /// Write statistics to a given output stream
       virtual void writeStats(std::ostream &) const {};
 
@@ -93,6 +103,12 @@ namespace Minotaur {
       virtual void writeStats() const {};
 
       virtual void setCutManager(CutManager *) {};
+
+      /**
+       * Let heuristics called while processing nodes share the time budget
+       * of a scheduler of branch-and-bound.
+       */
+      virtual void shareHeurBudget(HeurScheduler *) {};
     protected:
       /// What brancher is used for this processor
       BrancherPtr brancher_;
@@ -0,0 +1,482 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file NodeRecorder.cpp
+ * \brief Define classes NodeRecorder and NodeReplayer for recording the
+ * relaxations solved at nodes and solving them again.
+ * \author The Minotaur Team
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+
+#include "MinotaurConfig.h"
+#include "Constraint.h"
+#include "Engine.h"
+#include "Environment.h"
+#include "Function.h"
+#include "LinearFunction.h"
+#include "Logger.h"
+#include "Node.h"
+#include "NodeRecorder.h"
+#include "Objective.h"
+#include "Problem.h"
+#include "Relaxation.h"
+#include "Timer.h"
+#include "Variable.h"
+#include "WarmStart.h"
+
+using namespace Minotaur;
+
+const std::string NodeRecorder::me_ = "NodeRecorder: ";
+const UInt NodeReplayer::maxWs_ = 1000;
+const std::string NodeReplayer::me_ = "NodeReplayer: ";
+
+static const char recMagic_[8] = {'M', 'N', 'T', 'R', 'N', 'R', 'E', 'C'};
+static const UInt recVersion_ = 1;
+
+template <class T> static void recPut_(std::ostream &out, T v)
+{
+  out.write((const char *) &v, sizeof(T));
+}
+
+template <class T> static bool recGet_(std::istream &in, T &v)
+{
+  in.read((char *) &v, sizeof(T));
+  return (bool) in;
+}
+
+
+NodeRecorder::NodeRecorder(EnvPtr env)
+  : enabled_(false),
+    logger_(env->getLogger()),
+    nBnds_(0),
+    nCons_(0),
+    nDels_(0),
+    nNodes_(0)
+{
+}
+
+
+NodeRecorder::~NodeRecorder()
+{
+  close();
+}
+
+
+void NodeRecorder::close()
+{
+  if (out_.is_open()) {
+    out_.close();
+  }
+  enabled_ = false;
+}
+
+
+int NodeRecorder::open(const std::string &fname)
+{
+  close();
+  out_.open(fname.c_str(), std::ios::out | std::ios::binary |
+            std::ios::trunc);
+  if (!out_.is_open()) {
+    logger_->errStream() << me_ << "could not open file " << fname
+                         << std::endl;
+    return 1;
+  }
+  fname_ = fname;
+  out_.write(recMagic_, sizeof(recMagic_));
+  recPut_(out_, recVersion_);
+  cons_.clear();
+  lb_.clear();
+  ub_.clear();
+  enabled_ = true;
+  return 0;
+}
+
+
+void NodeRecorder::record(NodePtr node, RelaxationPtr rel)
+{
+  ConstraintPtr c;
+  VariablePtr v;
+  ObjectivePtr o;
+  std::map<UInt, std::pair<double, double> >::iterator cit;
+  std::map<UInt, std::pair<double, double> > old;
+  UInt n;
+
+  if (!enabled_) {
+    return;
+  }
+
+  n = rel->getNumVars();
+  for (UInt i=0; i<n; ++i) {
+    v = rel->getVariable(i);
+    if (i >= lb_.size()) {
+      out_.put('V');
+      recPut_(out_, i);
+      recPut_(out_, v->getLb());
+      recPut_(out_, v->getUb());
+      out_.put((char) v->getType());
+      lb_.push_back(v->getLb());
+      ub_.push_back(v->getUb());
+    } else if (v->getLb() != lb_[i] || v->getUb() != ub_[i]) {
+      out_.put('B');
+      recPut_(out_, i);
+      recPut_(out_, v->getLb());
+      recPut_(out_, v->getUb());
+      lb_[i] = v->getLb();
+      ub_[i] = v->getUb();
+      ++nBnds_;
+    }
+  }
+
+  // the objective is written with the first node only, after the variables
+  // it uses.
+  if (0 == nNodes_) {
+    o = rel->getObjective();
+    out_.put('O');
+    if (!writeLinear_(o ? o->getFunction() : 0)) {
+      return;
+    }
+    recPut_(out_, o ? o->getConstant() : 0.0);
+  }
+
+  // constraints still in cons_ after the loop were deleted.
+  old.swap(cons_);
+  for (ConstraintConstIterator it=rel->consBegin(); it!=rel->consEnd();
+       ++it) {
+    c = *it;
+    cit = old.find(c->getId());
+    if (cit == old.end()) {
+      out_.put('C');
+      recPut_(out_, c->getId());
+      if (!writeLinear_(c->getFunction())) {
+        return;
+      }
+      recPut_(out_, c->getLb());
+      recPut_(out_, c->getUb());
+      ++nCons_;
+    } else {
+      if (c->getLb() != cit->second.first ||
+          c->getUb() != cit->second.second) {
+        out_.put('E');
+        recPut_(out_, c->getId());
+        recPut_(out_, c->getLb());
+        recPut_(out_, c->getUb());
+        ++nBnds_;
+      }
+      old.erase(cit);
+    }
+    cons_[c->getId()] = std::make_pair(c->getLb(), c->getUb());
+  }
+  for (cit=old.begin(); cit!=old.end(); ++cit) {
+    out_.put('D');
+    recPut_(out_, cit->first);
+    ++nDels_;
+  }
+
+  out_.put('S');
+  recPut_(out_, node->getId());
+  recPut_(out_, node->getParent() ? node->getParent()->getId() :
+          std::numeric_limits<UInt>::max());
+  out_.put(node->getWarmStart() ? (char) 1 : (char) 0);
+  ++nNodes_;
+  if (out_.fail()) {
+    logger_->errStream() << me_ << "error writing to file " << fname_
+                         << ". Recording stopped." << std::endl;
+    close();
+  }
+}
+
+
+bool NodeRecorder::writeLinear_(FunctionPtr f)
+{
+  LinearFunctionPtr lf = 0;
+  UInt n = 0;
+
+  if (f) {
+    if (f->getType() != Linear && f->getType() != Constant) {
+      logger_->errStream() << me_ << "relaxation is not linear. "
+                           << "Recording stopped." << std::endl;
+      close();
+      return false;
+    }
+    lf = f->getLinearFunction();
+  }
+  if (lf) {
+    n = lf->getNumTerms();
+  }
+  recPut_(out_, n);
+  if (lf) {
+    for (VariableGroupConstIterator it=lf->termsBegin(); it!=lf->termsEnd();
+         ++it) {
+      recPut_(out_, it->first->getIndex());
+      recPut_(out_, it->second);
+    }
+  }
+  return true;
+}
+
+
+void NodeRecorder::writeStats(std::ostream &out) const
+{
+  if (0 == nNodes_) {
+    return;
+  }
+  out << me_ << "nodes recorded                = " << nNodes_ << std::endl
+      << me_ << "bound changes recorded        = " << nBnds_ << std::endl
+      << me_ << "constraints added             = " << nCons_ << std::endl
+      << me_ << "constraints deleted           = " << nDels_ << std::endl;
+}
+
+
+NodeReplayer::NodeReplayer(EnvPtr env)
+  : env_(env),
+    logger_(env->getLogger())
+{
+  stats_.solves = 0;
+  stats_.failed = 0;
+  stats_.iters = 0;
+  stats_.time = 0;
+  timer_ = env->getNewTimer();
+}
+
+
+NodeReplayer::~NodeReplayer()
+{
+  clearWs_();
+  delete timer_;
+}
+
+
+void NodeReplayer::clearWs_()
+{
+  for (std::map<UInt, WarmStartPtr>::iterator it=ws_.begin();
+       it!=ws_.end(); ++it) {
+    delete it->second;
+  }
+  ws_.clear();
+  wsOrder_.clear();
+}
+
+
+int NodeReplayer::replay(const std::string &fname, EnginePtr engine,
+                         UInt num_stats, int iter_ind)
+{
+  std::ifstream in;
+  char magic[sizeof(recMagic_)];
+  ProblemPtr p = (ProblemPtr) new Problem(env_);
+  std::map<UInt, ConstraintPtr> cons;
+  std::map<UInt, WarmStartPtr>::iterator wit;
+  std::vector<double> est(num_stats, 0.0);
+  LinearFunctionPtr lf;
+  FunctionPtr f;
+  ConstraintPtr c;
+  EngineStatus status;
+  WarmStartPtr ws;
+  double lb, ub, val, t, iters = 0.0;
+  UInt version, idx, id, pid, n;
+  char tag, ch;
+  bool loaded = false, ok = true, has_del = false;
+  int err = 0;
+
+  // fillStats() writes all its entries, so est must be as long as the
+  // engine's vector.
+  if (iter_ind >= (int) num_stats) {
+    iter_ind = -1;
+  }
+  clearWs_();
+  in.open(fname.c_str(), std::ios::in | std::ios::binary);
+  if (!in.is_open()) {
+    logger_->errStream() << me_ << "could not open file " << fname
+                         << std::endl;
+    delete p;
+    return 1;
+  }
+  in.read(magic, sizeof(magic));
+  if (!in || !std::equal(magic, magic+sizeof(magic), recMagic_) ||
+      !recGet_(in, version) || version != recVersion_) {
+    logger_->errStream() << me_ << fname << " is not a node record file"
+                         << std::endl;
+    delete p;
+    return 1;
+  }
+
+  timer_->start();
+  while (ok && in.get(tag)) {
+    switch (tag) {
+    case 'V':
+      ok = recGet_(in, idx) && recGet_(in, lb) && recGet_(in, ub) &&
+        in.get(ch);
+      if (ok && (loaded || idx != p->getNumVars())) {
+        logger_->errStream() << me_ << "variables added after the first "
+                             << "node are not supported" << std::endl;
+        ok = false;
+      }
+      if (ok) {
+        p->newVariable(lb, ub, (VariableType) ch);
+      }
+      break;
+    case 'B':
+      ok = recGet_(in, idx) && recGet_(in, lb) && recGet_(in, ub) &&
+        idx < p->getNumVars();
+      if (ok) {
+        p->changeBound(p->getVariable(idx), lb, ub);
+      }
+      break;
+    case 'C':
+    case 'O':
+      if ('C' == tag) {
+        ok = recGet_(in, id);
+      }
+      ok = ok && recGet_(in, n);
+      lf = (LinearFunctionPtr) new LinearFunction();
+      for (UInt i=0; ok && i<n; ++i) {
+        ok = recGet_(in, idx) && recGet_(in, val) && idx < p->getNumVars();
+        if (ok) {
+          lf->addTerm(p->getVariable(idx), val);
+        }
+      }
+      if ('C' == tag) {
+        ok = ok && recGet_(in, lb) && recGet_(in, ub);
+      } else {
+        ok = ok && recGet_(in, lb);
+      }
+      if (!ok) {
+        delete lf;
+        break;
+      }
+      f = (FunctionPtr) new Function(lf);
+      if ('C' == tag) {
+        cons[id] = p->newConstraint(f, lb, ub);
+      } else {
+        p->newObjective(f, lb, Minimize);
+      }
+      break;
+    case 'D':
+      ok = recGet_(in, id) && cons.count(id) > 0;
+      if (ok) {
+        p->markDelete(cons[id]);
+        cons.erase(id);
+        has_del = true;
+      }
+      break;
+    case 'E':
+      ok = recGet_(in, id) && recGet_(in, lb) && recGet_(in, ub) &&
+        cons.count(id) > 0;
+      if (ok) {
+        // the two-bound version does not pass changes to the engine.
+        c = cons[id];
+        p->changeBound(c, Lower, lb);
+        p->changeBound(c, Upper, ub);
+      }
+      break;
+    case 'S':
+      ok = recGet_(in, id) && recGet_(in, pid) && in.get(ch);
+      if (!ok) {
+        break;
+      }
+      if (has_del) {
+        p->delMarkedCons();
+        has_del = false;
+      }
+      if (!loaded) {
+        p->setNativeDer();
+        p->prepareForSolve();
+        engine->load(p);
+        loaded = true;
+      }
+      if (ch) {
+        wit = ws_.find(pid);
+        if (wit != ws_.end()) {
+          engine->loadFromWarmStart(wit->second);
+        }
+      }
+
+      if (iter_ind >= 0) {
+        std::fill(est.begin(), est.end(), 0.0);
+        engine->fillStats(est);
+        iters = -est[iter_ind];
+      }
+      t = timer_->query();
+      status = engine->solve();
+      t = timer_->query() - t;
+      if (iter_ind >= 0) {
+        std::fill(est.begin(), est.end(), 0.0);
+        engine->fillStats(est);
+        iters += est[iter_ind];
+        stats_.iters += iters;
+      }
+      ++stats_.solves;
+      stats_.time += t;
+      if (ProvenOptimal != status && ProvenLocalOptimal != status &&
+          ProvenInfeasible != status && ProvenLocalInfeasible != status) {
+        ++stats_.failed;
+      }
+      logger_->msgStream(LogInfo) << me_ << "node " << id
+                                  << " time " << std::fixed
+                                  << std::setprecision(6) << t;
+      if (iter_ind >= 0) {
+        logger_->msgStream(LogInfo) << " iters " << std::setprecision(0)
+                                    << iters;
+      }
+      logger_->msgStream(LogInfo) << " status "
+                                  << engine->getStatusString()
+                                  << " obj " << std::setprecision(8)
+                                  << engine->getSolutionValue()
+                                  << std::endl;
+
+      // the children of this node may be solved much later.
+      ws = engine->getWarmStartCopy();
+      if (ws && ws_.count(id) == 0) {
+        ws_[id] = ws;
+        wsOrder_.push_back(id);
+        if (wsOrder_.size() > maxWs_) {
+          delete ws_[wsOrder_.front()];
+          ws_.erase(wsOrder_.front());
+          wsOrder_.pop_front();
+        }
+      } else {
+        delete ws;
+      }
+      break;
+    default:
+      ok = false;
+      break;
+    }
+  }
+  timer_->stop();
+
+  if (!ok) {
+    logger_->errStream() << me_ << "error reading " << fname
+                         << " after " << stats_.solves << " solves"
+                         << std::endl;
+    err = 1;
+  }
+  if (loaded) {
+    engine->clear();
+  }
+  clearWs_();
+  delete p;
+  return err;
+}
+
+
+void NodeReplayer::writeStats(std::ostream &out) const
+{
+  out << me_ << "relaxations solved            = " << stats_.solves
+      << std::endl
+      << me_ << "solves not optimal/infeasible = " << stats_.failed
+      << std::endl
+      << me_ << "time in solves                = " << stats_.time
+      << std::endl;
+  if (stats_.iters > 0) {
+    out << me_ << "iterations                    = " << stats_.iters
+        << std::endl;
+  }
+}
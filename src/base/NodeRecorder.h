@@ -0,0 +1,210 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file NodeRecorder.h
+ * \brief Declare classes NodeRecorder, for writing the relaxations solved at
+ * nodes of branch-and-bound to a file, and NodeReplayer, for solving them
+ * again with any engine.
+ * \author The Minotaur Team
+ */
+
+#ifndef MINOTAURNODERECORDER_H
+#define MINOTAURNODERECORDER_H
+
+#include <deque>
+#include <fstream>
+#include <map>
+#include <vector>
+
+#include "Types.h"
+
+namespace Minotaur {
+
+  class Engine;
+  class Relaxation;
+  class Timer;
+  class WarmStart;
+  typedef Engine* EnginePtr;
+  typedef Relaxation* RelaxationPtr;
+  typedef WarmStart* WarmStartPtr;
+
+  /**
+   * \brief Write the relaxation of each node, just before it is solved, to a
+   * binary file.
+   *
+   * Only changes since the last node are written, so the first node carries
+   * the whole relaxation. A variable is identified by its index and a
+   * constraint by its id in the relaxation. The file has a header, "MNTRNREC"
+   * followed by the version as a UInt, and then records. Each record starts
+   * with a tag character:
+   *
+   *   'V' idx lb ub type    new variable (type as a char)
+   *   'B' idx lb ub         new bounds of a variable
+   *   'C' id n (idx coef)*n lb ub   new linear constraint
+   *   'D' id                constraint deleted
+   *   'E' id lb ub          new bounds of a constraint
+   *   'O' n (idx coef)*n cb linear objective, to be minimized
+   *   'S' id parent ws      solve the relaxation of node id. ws is a char,
+   *                         1 if the node has a warm start from its parent.
+   *
+   * Indices, ids and counts are UInts and the rest are doubles, in the byte
+   * order of the machine that wrote the file. The parent of the root is
+   * written as the largest UInt.
+   *
+   * Only linear relaxations can be recorded. If a nonlinear function is
+   * found, an error is logged and recording stops. Changes to the
+   * coefficients of an existing constraint are not detected.
+   */
+  class NodeRecorder {
+  public:
+    /// Create a recorder. It does nothing until open() is called.
+    NodeRecorder(EnvPtr env);
+
+    /// Close the file and destroy.
+    ~NodeRecorder();
+
+    /// Flush and close the file.
+    void close();
+
+    /**
+     * \brief Open a file for writing and write the header.
+     *
+     * \param [in] fname Name of the file. It is overwritten.
+     * \return 0 if the file could be opened, 1 otherwise.
+     */
+    int open(const std::string &fname);
+
+    /**
+     * \brief Write changes in the relaxation since the last call, and a
+     * record for solving the node.
+     *
+     * \param [in] node Node whose relaxation is about to be solved.
+     * \param [in] rel The relaxation, with all modifications of the node.
+     */
+    void record(NodePtr node, RelaxationPtr rel);
+
+    /// Write number of nodes and changes recorded.
+    void writeStats(std::ostream &out) const;
+
+  private:
+    /// Bounds of constraints of the last recorded relaxation, by id.
+    std::map<UInt, std::pair<double, double> > cons_;
+
+    /// True if records are written.
+    bool enabled_;
+
+    /// Name of the file.
+    std::string fname_;
+
+    /// Lower bounds of variables of the last recorded relaxation.
+    DoubleVector lb_;
+
+    /// For logging.
+    LoggerPtr logger_;
+
+    /// For logging.
+    static const std::string me_;
+
+    /// Number of bound changes of variables and constraints written.
+    size_t nBnds_;
+
+    /// Number of constraints added.
+    size_t nCons_;
+
+    /// Number of constraints deleted.
+    size_t nDels_;
+
+    /// Number of nodes recorded.
+    size_t nNodes_;
+
+    /// The file.
+    std::ofstream out_;
+
+    /// Upper bounds of variables of the last recorded relaxation.
+    DoubleVector ub_;
+
+    /// Write the linear terms of a function. Return false if nonlinear.
+    bool writeLinear_(FunctionPtr f);
+  };
+
+
+  /// Counters of a replay.
+  struct ReplayStats {
+    size_t solves;  ///> Number of relaxations solved.
+    size_t failed;  ///> Number of solves not optimal or infeasible.
+    double iters;   ///> Total iterations of the engine, if known.
+    double time;    ///> Total time in solves.
+  };
+
+
+  /**
+   * \brief Read a file written by NodeRecorder and solve each recorded
+   * relaxation with a given engine.
+   *
+   * The relaxations are built in a problem that is loaded into the engine
+   * before the first solve. Later changes are passed to the engine through
+   * the problem, as in branch-and-bound. If a node had a warm start, the
+   * warm start saved after solving its parent is loaded, if still kept.
+   * For each solve, the node, time, iterations, status and objective value
+   * are written to the logger.
+   */
+  class NodeReplayer {
+  public:
+    /// Create a replayer.
+    NodeReplayer(EnvPtr env);
+
+    /// Destroy.
+    ~NodeReplayer();
+
+    /**
+     * \brief Solve all relaxations recorded in a file.
+     *
+     * \param [in] fname Name of the file.
+     * \param [in] engine Engine used to solve. It must accept linear
+     * problems.
+     * \param [in] num_stats Length of the vector filled by
+     * Engine::fillStats() of this engine, 0 if not known.
+     * \param [in] iter_ind Position of the number of iterations in that
+     * vector, or -1 if not known.
+     * \return 0 if the file was read to the end, 1 otherwise.
+     */
+    int replay(const std::string &fname, EnginePtr engine, UInt num_stats,
+               int iter_ind);
+
+    /// Write number of solves, total time and iterations.
+    void writeStats(std::ostream &out) const;
+
+  private:
+    /// Environment, for creating the problem.
+    EnvPtr env_;
+
+    /// For logging.
+    LoggerPtr logger_;
+
+    /// Maximum number of warm starts kept.
+    static const UInt maxWs_;
+
+    /// For logging.
+    static const std::string me_;
+
+    /// Counters.
+    ReplayStats stats_;
+
+    /// Timer for solves.
+    Timer *timer_;
+
+    /// Warm starts saved after solves, by node id.
+    std::map<UInt, WarmStartPtr> ws_;
+
+    /// Order in which warm starts were saved, to drop the oldest.
+    std::deque<UInt> wsOrder_;
+
+    /// Delete all saved warm starts.
+    void clearWs_();
+  };
+}
+#endif
@@ -11,8 +11,10 @@
  * \author Ashutosh Mahajan, Argonne National Laboratory
  */
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <set>
 
 #include "MinotaurConfig.h"
 #include "Node.h"
@@ -39,6 +41,16 @@ bool NodeStack::isEmpty() const
 
 
 // This function is expensive and must be avoided for large trees.
+void NodeStack::erase(const NodePtrVector &nodes)
+{
+  std::set<NodePtr> del(nodes.begin(), nodes.end());
+
+  nodes_.erase(std::remove_if(nodes_.begin(), nodes_.end(),
+                              [&del](NodePtr n) { return del.count(n) > 0; }),
+               nodes_.end());
+}
+
+
 double NodeStack::getBestLB() const
 {
   NodeStackConstIter iter;
@@ -62,6 +74,12 @@ UInt NodeStack::getDeepestLevel() const
 }
 
 
+void NodeStack::getNodes(NodePtrVector &nodes) const
+{
+  nodes.insert(nodes.end(), nodes_.begin(), nodes_.end());
+}
+
+
 void NodeStack::pop() 
 {
   nodes_.pop_front();
@@ -43,6 +43,9 @@ namespace Minotaur {
      */
     virtual bool isEmpty() const;
 
+    /// Remove given nodes from the stack. Order of others is kept.
+    virtual void erase(const NodePtrVector &nodes);
+
     /**
      * \brief Find the minimum lower bound of all the active nodes in the
      * stack.  This function is expensive and must be avoided for large
@@ -53,6 +56,9 @@ namespace Minotaur {
     /// The maximum depth is the depth of the topmost node in the stack.
     virtual UInt getDeepestLevel() const;
 
+    /// Append all nodes in the stack to nodes.
+    virtual void getNodes(NodePtrVector &nodes) const;
+
     /// Remove the best node from the heap.
     virtual void pop();
 
@@ -729,7 +729,6 @@ void OAHandler::updateUb_(SolutionPoolPtr s_pool, double nlpval,
   if ((bestval - objATol_ > nlpval) ||
         (bestval != 0 && (bestval - fabs(bestval)*objRTol_ > nlpval))) {
     const double *x = nlpe_->getSolution()->getPrimal();
-#pragma omp critical (solPool)
     s_pool->addSolution(x, nlpval);
     *sol_found = true;
   }
@@ -17,6 +17,7 @@
 #include "Engine.h"
 #include "Environment.h"
 #include "Handler.h"
+#include "HeurScheduler.h"
 #include "Heuristic.h"
 #include "Logger.h"
 #include "MinotaurConfig.h"
@@ -24,6 +25,7 @@
 #include "Node.h"
 #include "Option.h"
 #include "PCBProcessor.h"
+#include "Profiler.h"
 #include "Relaxation.h"
 #include "SolutionPool.h"
 #include "WarmStart.h"
@@ -39,6 +41,7 @@ PCBProcessor::PCBProcessor(EnvPtr env, EnginePtr engine, HandlerVector handlers)
     contOnErr_(false),
     cutMan_(0),
     env_(env),
+    heurSched_(0),
     infHand_(0),
     numSolutions_(0),
     ws_(0)
@@ -57,6 +60,7 @@ PCBProcessor::PCBProcessor(EnvPtr env, EnginePtr engine, HandlerVector handlers)
   stats_.proc = 0;
   stats_.ub = 0;
   stats_.tol_err = 0;
+  heurSched_ = new HeurScheduler(env);
 }
 
 PCBProcessor::~PCBProcessor()
@@ -73,12 +77,16 @@ PCBProcessor::~PCBProcessor()
   if(branches_) {
     delete branches_;
   }
+  if(heurSched_) {
+    delete heurSched_;
+  }
   handlers_.clear();
 }
 
 void PCBProcessor::addHeur(HeurPtr h)
 {
   heurs_.push_back(h);
+  heurSched_->addHeur(h);
 }
 
 bool PCBProcessor::foundNewSolution()
@@ -97,6 +105,14 @@ WarmStartPtr PCBProcessor::getWarmStart()
   return ws_;
 }
 
+ConstSolutionPtr PCBProcessor::getRelSolution()
+{
+  if (engineStatus_ == ProvenOptimal || engineStatus_ == ProvenLocalOptimal) {
+    return engine_->getSolution();
+  }
+  return 0;
+}
+
 bool PCBProcessor::isFeasible_(NodePtr node, ConstSolutionPtr sol,
                                SolutionPoolPtr s_pool, bool& should_prune)
 {
@@ -147,6 +163,7 @@ bool PCBProcessor::presolveNode_(NodePtr node, SolutionPoolPtr s_pool)
   if(presFreq_ < 1 || node->getId() % presFreq_ != 0) {
     return false;
   }
+  ProfScope scope(env_->getProfiler(), ZonePresolve);
   // TODO: make this more sophisticated: loop several times until no more
   // changes are possible.
   for(it = 0; it < max_iter && true == cont; ++it) {
@@ -191,6 +208,7 @@ void PCBProcessor::process(NodePtr node, RelaxationPtr rel,
   ModVector mods;
   SeparationStatus sep_status = SepaContinue;
   int iter = 0, error;
+  ProfScope scope(env_->getProfiler(), ZoneNode);
   int parid=(node->getId()==0)?-1:node->getParent()->getId();
 
   ++stats_.proc;
@@ -276,12 +294,13 @@ void PCBProcessor::process(NodePtr node, RelaxationPtr rel,
       break;
     }
 
-    if(iter == 1 && !node->getParent()) {
-      // in root, in first iteration, run a heuristic. XXX: better management.
-      for(HeurVector::iterator it = heurs_.begin(); it != heurs_.end(); ++it) {
-        (*it)->solveNode(sol, node, rel, s_pool);
+    if(iter == 1) {
+      // in first iteration, run heuristics: all of them in root, and at
+      // other nodes only if the scheduler finds them worth it.
+      heurSched_->solveNode(sol, node, rel, s_pool);
+      if(!node->getParent()) {
+        tightenBounds_(node, s_pool, sol, &sep_status);
       }
-      tightenBounds_(node, s_pool, sol, &sep_status);
     }
 
     // the node can not be pruned because of infeasibility or high cost.
@@ -312,8 +331,11 @@ void PCBProcessor::process(NodePtr node, RelaxationPtr rel,
       if(ws_) {
         ws_->incrUseCnt();
       }
-      branches_ = brancher_->findBranches(relaxation_, node, sol, s_pool,
-                                          br_status, mods);
+      {
+        ProfScope bscope(env_->getProfiler(), ZoneBranch);
+        branches_ = brancher_->findBranches(relaxation_, node, sol, s_pool,
+                                            br_status, mods);
+      }
       if(br_status == PrunedByBrancher) {
 
         should_prune = true;
@@ -413,6 +435,8 @@ void PCBProcessor::separate_(ConstSolutionPtr sol, NodePtr node,
   ModVector p_mods; // Mods that are applied to the problem
   ModVector r_mods; // Mods that are applied to the relaxation.
 
+  ProfScope scope(env_->getProfiler(), ZoneSeparate);
+
   *status = SepaContinue;
   sol_found = false;
   for(h = handlers_.begin(); h != handlers_.end(); ++h) {
@@ -445,6 +469,11 @@ void PCBProcessor::setCutManager(CutManager* cutman)
   cutMan_ = cutman;
 }
 
+void PCBProcessor::shareHeurBudget(HeurScheduler *sched)
+{
+  heurSched_->shareBudget(sched);
+}
+
 bool PCBProcessor::shouldPrune_(NodePtr node, double solval,
                                 SolutionPoolPtr s_pool)
 {
@@ -567,6 +596,7 @@ void PCBProcessor::solveRelaxation_()
   logger_->msgStream(LogDebug1) << me_ << "solving relaxation. Time = "
     << env_->getTime() << std::endl;
 #endif
+  ProfScope scope(env_->getProfiler(), ZoneRelax);
   engineStatus_ = EngineError;
   engine_->solve();
   engineStatus_ = engine_->getStatus();
@@ -620,6 +650,7 @@ void PCBProcessor::writeStats(std::ostream& out) const
       << std::endl
       << me_ << "nodes for which fixNodeErr was called = " << stats_.tol_err
       << std::endl;
+  heurSched_->writeStats(out);
 }
 
 void PCBProcessor::writeStats() const
@@ -21,6 +21,7 @@ namespace Minotaur
 {
 
 class CutManager;
+class HeurScheduler;
 //class Problem;
 
 struct NodeStats {
@@ -46,7 +47,7 @@ class PCBProcessor : public NodeProcessor
 
 public:
   /// Default constructor
-  PCBProcessor() { }
+  PCBProcessor() : heurSched_(0) { }
 
   /// Constructor with a given engine.
   PCBProcessor(EnvPtr env, EnginePtr engine, HandlerVector handlers_);
@@ -54,7 +55,8 @@ public:
   /// Destroy
   ~PCBProcessor();
 
-  // Add a heuristic.
+  // Add a heuristic. It is called at the root node, and at other nodes if
+  // the HeurScheduler finds it productive.
   void addHeur(HeurPtr h);
 
   // True if a new solution was found while processing this node.
@@ -66,11 +68,17 @@ public:
   // Get warm-start information.
   WarmStartPtr getWarmStart();
 
+  // Implement NodeProcessor::getRelSolution().
+  ConstSolutionPtr getRelSolution();
+
   // Implement NodeProcessor::process().
   void process(NodePtr node, RelaxationPtr rel, SolutionPoolPtr s_pool);
 
   void setCutManager(CutManager* cutman);
 
+  // Implement NodeProcessor::shareHeurBudget().
+  void shareHeurBudget(HeurScheduler *sched);
+
   // write statistics. Base class method.
   void writeStats(std::ostream& out) const;
 
@@ -108,6 +116,9 @@ private:
   /// Heuristics that can be called at each node.
   HeurVector heurs_;
 
+  /// Decides which of the heurs_ to call at a node.
+  HeurScheduler *heurSched_;
+
   /// The handler which reports the infeasibility of a node.
   HandlerPtr infHand_;
 
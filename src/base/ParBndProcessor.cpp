@@ -22,6 +22,7 @@
 #include "Logger.h"
 #include "Node.h"
 #include "Option.h"
+#include "Profiler.h"
 #include "Modification.h"
 #include "Relaxation.h"
 #include "SolutionPool.h"
@@ -38,6 +39,7 @@ ParBndProcessor::ParBndProcessor()
     engine_(EnginePtr()),
     engineStatus_(EngineUnknownStatus),
     numSolutions_(0),
+    prof_(0),
     relaxation_(RelaxationPtr()),
     ws_(WarmStartPtr())
 {
@@ -57,12 +59,14 @@ ParBndProcessor::ParBndProcessor (EnvPtr env, EnginePtr engine,
     engine_(engine),
     engineStatus_(EngineUnknownStatus),
     numSolutions_(0),
+    prof_(0),
     relaxation_(RelaxationPtr()),
     ws_(WarmStartPtr())
 {
   cutOff_ = env->getOptions()->findDouble("obj_cut_off")->getValue();
   handlers_ = handlers;
   logger_ = env->getLogger();
+  prof_ = env->getProfiler();
   stats_.bra = 0;
   stats_.inf = 0;
   stats_.opt = 0;
@@ -145,6 +149,7 @@ void ParBndProcessor::process(NodePtr node, RelaxationPtr rel,
   ConstSolutionPtr sol;
   ModVector mods;
   int iter = 0;
+  ProfScope scope(prof_, ZoneNode);
 
   ++stats_.proc;
   relaxation_ = rel;
@@ -223,8 +228,11 @@ void ParBndProcessor::process(NodePtr node, RelaxationPtr rel,
 
     //save warm start information before branching. This step is expensive.
     ws_ = engine_->getWarmStartCopy();
-    branches_ = brancher_->findBranches(relaxation_, node, sol, s_pool, 
-                                        br_status, mods);
+    {
+      ProfScope bscope(prof_, ZoneBranch);
+      branches_ = brancher_->findBranches(relaxation_, node, sol, s_pool,
+                                          br_status, mods);
+    }
     if (br_status==PrunedByBrancher) {
 
       should_prune = true;
@@ -367,6 +375,7 @@ bool ParBndProcessor::shouldPrune_(NodePtr node, double solval,
 
 void ParBndProcessor::solveRelaxation_() 
 {
+  ProfScope scope(prof_, ZoneRelax);
   engineStatus_ = EngineError;
   engine_->solve();
   engineStatus_ = engine_->getStatus();
@@ -18,6 +18,7 @@
 
 namespace Minotaur {
 
+  class Profiler;
   class Solution;
   class Engine;
   typedef Engine* EnginePtr;
@@ -114,6 +115,9 @@ namespace Minotaur {
     /// How many new solutions were found by the processor.
     UInt numSolutions_;
 
+    /// Profiler of the environment.
+    Profiler *prof_;
+
     /// Relaxation that is processed by this processor.
     RelaxationPtr relaxation_;
 
@@ -10,6 +10,7 @@
  * \author Prashant Palkar, IIT Bombay
  */
 
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <sstream>
@@ -26,6 +27,7 @@
 #include "Logger.h"
 #include "Node.h"
 #include "NodeProcessor.h"
+#include "NodeRecorder.h"
 #include "NodeRelaxer.h"
 #include "Option.h"
 #include "ParPCBProcessor.h"
@@ -34,6 +36,7 @@
 #include "ParTreeManager.h"
 #include "Problem.h"
 #include "Relaxation.h"
+#include "RingLogger.h"
 #include "Solution.h"
 #include "SolutionPool.h"
 #include "Timer.h"
@@ -51,6 +54,7 @@ const std::string ParBranchAndBound::me_ = "ParBranchAndBound: ";
 
 ParBranchAndBound::ParBranchAndBound()
   : env_(0),
+    ringLog_(0),
     nodePrcssr_(),
     nodeRlxr_(0),
     options_(0),
@@ -77,11 +81,17 @@ ParBranchAndBound::ParBranchAndBound(EnvPtr env, ProblemPtr p)
   tm_ = (ParTreeManagerPtr) new ParTreeManager(env);
   options_ = (ParBabOptionsPtr) new ParBabOptions(env);
   logger_ = env->getLogger();
+  ringLog_ = 0;
 }
 
 
 ParBranchAndBound::~ParBranchAndBound()
 {
+  stopLog_();
+  for (UInt i=0; i<recorders_.size(); ++i) {
+    delete recorders_[i];
+  }
+  recorders_.clear();
   problem_ = 0;
   env_ = 0;
   nodeRlxr_ = 0;
@@ -291,6 +301,9 @@ void ParBranchAndBound::processRoot_(bool *should_prune, bool *should_dive,
   logger_->msgStream(LogDebug) << me_ << "processing root node" << 
     std::endl;
 #endif
+  if (!recorders_.empty()) {
+    recorders_[0]->record(current_node, rel);
+  }
   nodePrcssr0->processRootNode(current_node, rel, solPool_);
   ++stats_->nodesProc;
   if (nodePrcssr0->foundNewSolution()) {
@@ -458,6 +471,53 @@ bool ParBranchAndBound::shouldStopPar_(double WallTimeStart, double treeLb)
 }
 
 
+void ParBranchAndBound::startLog_(UInt nthreads)
+{
+  if (!ringLog_) {
+    ringLog_ = new RingLogger(env_->getLogger(), nthreads);
+    if (options_->logBuffer) {
+      ringLog_->start();
+    }
+    logger_ = ringLog_;
+  }
+}
+
+
+void ParBranchAndBound::startRecord_(UInt nthreads)
+{
+  std::stringstream sstm;
+
+  if (options_->recordFile.empty() || !recorders_.empty()) {
+    return;
+  }
+  for (UInt i=0; i<nthreads; ++i) {
+    sstm.str("");
+    sstm << options_->recordFile << "." << i;
+    recorders_.push_back(new NodeRecorder(env_));
+    recorders_[i]->open(sstm.str());
+  }
+}
+
+
+void ParBranchAndBound::stopRecord_()
+{
+  for (UInt i=0; i<recorders_.size(); ++i) {
+    recorders_[i]->close();
+  }
+}
+
+
+void ParBranchAndBound::stopLog_()
+{
+  if (ringLog_) {
+    ringLog_->stop();
+    delete ringLog_;
+    ringLog_ = 0;
+    logger_ = env_->getLogger();
+  }
+}
+
+
 void ParBranchAndBound::showStatus_(bool current_uncounted)
 {
   UInt off=0;
@@ -619,6 +679,8 @@ void ParBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
 
   // initialize timer
   timer_->start();
+  startLog_(numThreads);
+  startRecord_(numThreads);
 
   logger_->msgStream(LogInfo) << me_ << "starting branch-and-bound ";
   if (numThreads > 1) {
@@ -730,7 +792,6 @@ void ParBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
         if (current_node[i]) {
           nodesProcTh[i]++;
 #if SPEW
-#pragma omp critical (logger)
           logger_->msgStream(LogDebug) << me_ << "get node "
             << current_node[i]->getId() << " thread "
             << omp_get_thread_num() << std::endl;
@@ -740,7 +801,6 @@ void ParBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
       }
       if (current_node[i]) {
 #if SPEW
-#pragma omp critical (logger)
         logger_->msgStream(LogInfo) << me_ << "process node "
           << current_node[i]->getId() << " thread " << omp_get_thread_num() << std::endl;
           //<< me_ << "depth = " << current_node[i]->getDepth() << std::endl
@@ -768,6 +828,9 @@ void ParBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
             }
           }
         }
+        if (!recorders_.empty()) {
+          recorders_[i]->record(current_node[i], rel[i]);
+        }
         nodePrcssr[i]->process(current_node[i], rel[i], solPool_,
                                initialized[i], timesUp, timesDown,
                                pseudoUp, pseudoDown, stats_->nodesProc);
@@ -776,7 +839,6 @@ void ParBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
           ++stats_->nodesProc;
         }
 #if SPEW
-#pragma omp critical (logger)
         logger_->msgStream(LogDebug1) << me_ << "node " 
           << current_node[i]->getId() << " lower bound = "
           << current_node[i]->getLb() << " thread " 
@@ -792,7 +854,6 @@ void ParBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
 
         if (should_prune[i]) {
 #if SPEW
-#pragma omp critical (logger)
           logger_->msgStream(LogInfo) << me_ << "prune node "
             << current_node[i]->getId() << " thread "
             << omp_get_thread_num() << std::endl;
@@ -813,7 +874,6 @@ void ParBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
               tm_->removeActiveNode(new_node[i]);
               nodesProcTh[i]++;
 #if SPEW
-#pragma omp critical (logger)
               logger_->msgStream(LogDebug) << me_ << "get node "
                 << new_node[i]->getId() << " (prune) thread "
                 << omp_get_thread_num() << std::endl;
@@ -824,7 +884,6 @@ void ParBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
         } else {
           initialized[i] = true;
 #if SPEW
-#pragma omp critical (logger)
           logger_->msgStream(LogDebug) << me_ << "branch at node "
             << current_node[i]->getId() << " thread "
             << omp_get_thread_num() << std::endl;
@@ -842,7 +901,6 @@ void ParBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
 #pragma omp critical (current_node)
             new_node[i] = tm_->branch(branches[i], current_node[i], ws[i]);
 #if SPEW
-#pragma omp critical (logger)
             logger_->msgStream(LogDebug) << me_ << "get node "
               << new_node[i]->getId() << " (branch) thread " << omp_get_thread_num()
               << std::endl;
@@ -862,7 +920,6 @@ void ParBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
               if (new_node[i]) {
                 tm_->removeActiveNode(new_node[i]);
 #if SPEW
-#pragma omp critical (logger)
                 logger_->msgStream(LogDebug) << me_ << "get/remove node "
                   << new_node[i]->getId() << " thread "
                   << omp_get_thread_num() << std::endl;
@@ -908,9 +965,11 @@ void ParBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
           }
         }
       }
+      if (timer_->query() - stats_->updateTime > options_->logInterval) {
 #pragma omp critical (logger)
-      {
-        showParStatus_(nodeCountTh[i], treeLbTh[i], wallTimeStart, i);
+        {
+          showParStatus_(nodeCountTh[i], treeLbTh[i], wallTimeStart, i);
+        }
       }
       if (shouldStopPar_(wallTimeStart, treeLbTh[i])) {
 #pragma omp critical (treeManager)
@@ -947,7 +1006,6 @@ void ParBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
         ////shouldRun = false;
       } else {
 #if SPEW
-#pragma omp critical (logger)
         //logger_->msgStream(LogInfo) << "nodesCount " << nodeCountThread << " thread " << i << std::endl;
         logger_->msgStream(LogDebug) << std::setprecision(8)
           << me_ << "lb = " << tm_->updateLb() << std::endl
@@ -978,6 +1036,8 @@ void ParBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
   stats_->timeUsed = timer_->query();
   timer_->stop();
 
+  stopLog_();
+  stopRecord_();
   delete[] should_dive;
   delete[] dived_prev;
   delete[] should_prune;
@@ -1056,6 +1116,8 @@ void ParBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
 
   // initialize timer
   timer_->start();
+  startLog_(numThreads);
+  startRecord_(numThreads);
 
   logger_->msgStream(LogInfo) << me_ << "starting branch-and-bound ";
   if(numThreads > 1) {
@@ -1187,7 +1249,6 @@ void ParBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
         }
         if (current_node[i]) {
 #if SPEW
-#pragma omp critical (logger)
           logger_->msgStream(LogInfo) << me_ << "process node "
             << current_node[i]->getId() << " thread " << omp_get_thread_num() << std::endl
             << me_ << "depth = " << current_node[i]->getDepth() << std::endl
@@ -1215,6 +1276,9 @@ void ParBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
               }
             }
           }
+          if (!recorders_.empty()) {
+            recorders_[i]->record(current_node[i], rel[i]);
+          }
           nodePrcssr[i]->process(current_node[i], rel[i], solPool_,
                                  initialized[i], timesUp, timesDown,
                                  pseudoUp, pseudoDown, stats_->nodesProc);
@@ -1225,7 +1289,6 @@ void ParBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
           }
 
 #if SPEW
-#pragma omp critical (logger)
           logger_->msgStream(LogDebug1) << me_ << "node lower bound = " <<
             current_node[i]->getLb() << current_node[i]->getId() << " thread "
             << omp_get_thread_num()<< std::endl;
@@ -1240,7 +1303,6 @@ void ParBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
 
           if (should_prune[i]) {
 #if SPEW
-#pragma omp critical (logger)
             logger_->msgStream(LogInfo) << me_ << "prune node "
               << current_node[i]->getId() << " thread "
               << omp_get_thread_num() << std::endl;
@@ -1256,7 +1318,6 @@ void ParBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
               new_node[i] = tm_->getCandidate();
               if (new_node[i]) {
 #if SPEW
-#pragma omp critical (logger)
                 logger_->msgStream(LogDebug) << me_ << "get node "
                   << new_node[i]->getId() << " (prune) thread "
                   << omp_get_thread_num() << std::endl;
@@ -1271,7 +1332,6 @@ void ParBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
           } else {
             initialized[i] = true;
 #if SPEW
-#pragma omp critical (logger)
             logger_->msgStream(LogDebug) << me_ << "branch at node "
               << current_node[i]->getId() << " thread "
               << omp_get_thread_num() << std::endl;
@@ -1288,7 +1348,6 @@ void ParBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
             {
               new_node[i] = tm_->branch(branches[i], current_node[i], ws[i]);
 #if SPEW
-#pragma omp critical (logger)
               logger_->msgStream(LogDebug) << me_ << "get node "
                 << new_node[i]->getId() << " (branch) thread " << omp_get_thread_num()
                 << std::endl;
@@ -1308,7 +1367,6 @@ void ParBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
                 if (new_node[i]) {
                   tm_->removeActiveNode(new_node[i]);
 #if SPEW
-#pragma omp critical (logger)
                   logger_->msgStream(LogDebug) << me_ << "get/remove node "
                     << new_node[i]->getId() << " thread "
                     << omp_get_thread_num() << std::endl;
@@ -1350,9 +1408,11 @@ void ParBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
         if (minNodeLbTh[i] < treeLbTh[i]) {
           treeLbTh[i] = minNodeLbTh[i];
         }
+        if (timer_->query() - stats_->updateTime > options_->logInterval) {
 #pragma omp critical (logger)
-        {
-          showParStatus_(nodeCountTh[i], treeLbTh[i], wallTimeStart, i);
+          {
+            showParStatus_(nodeCountTh[i], treeLbTh[i], wallTimeStart, i);
+          }
         }
         if (shouldStopPar_(wallTimeStart, treeLbTh[i])) {
 #pragma omp critical (treeManager)
@@ -1399,7 +1459,6 @@ void ParBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
             status_ = SolvedInfeasible; // TODO: get the right status
           }
 #if SPEW
-#pragma omp critical (logger)
           logger_->msgStream(LogDebug) << me_ << "all nodes have "
             << "been processed" << std::endl;
 #endif
@@ -1409,14 +1468,12 @@ void ParBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
         } else if (notRampedUp && (nodeCount == numThreads)) {
           tm_->updateLb();
           notRampedUp = false;
-#pragma omp critical (logger)
           logger_->msgStream(LogExtraInfo) << me_
             << "ramp-up time = "
             << getWallTime() - wallTimeStart << std::endl;
           //shouldRun = false;
         } else {
 #if SPEW
-#pragma omp critical (logger)
           logger_->msgStream(LogDebug) << std::setprecision(8)
             << me_ << "lb = " << tm_->updateLb() << std::endl 
             << me_ << "ub = " << tm_->getUb() << std::endl;
@@ -1454,6 +1511,8 @@ void ParBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
   stats_->timeUsed = timer_->query();
   timer_->stop();
 
+  stopLog_();
+  stopRecord_();
   delete[] should_dive;
   delete[] dived_prev;
   delete[] should_prune;
@@ -1495,40 +1554,43 @@ void ParBranchAndBound::parsolveSync(ParNodeIncRelaxerPtr parNodeRlxr[],
                                  UInt numThreads)
 {
   double wallTimeStart = getWallTime();
-  bool *should_dive = new bool[numThreads];
   bool *dived_prev = new bool[numThreads];
   bool *should_prune = new bool[numThreads];
   bool *initialized = new bool[numThreads];
+  bool *found_sol = new bool[numThreads];
   NodePtr *current_node = new NodePtr[numThreads]();
-  NodePtr *new_node = new NodePtr[numThreads];
-  Branches *branches = new Branches[numThreads];
   WarmStartPtr *ws = new WarmStartPtr[numThreads]();
   RelaxationPtr *rel = new RelaxationPtr[numThreads];
-  UInt nodeCount;
+  SolutionPoolPtr *thPool = new SolutionPoolPtr[numThreads]();
+  std::vector<std::vector<NodePtr> > work(numThreads);
+  std::vector<std::vector<Branches> > branches(numThreads);
+  std::vector<std::vector<WarmStartPtr> > wsRound(numThreads);
+  std::vector<UIntVector> snapTimesUp(numThreads), snapTimesDown(numThreads);
+  std::vector<DoubleVector> snapPseudoUp(numThreads), 
+    snapPseudoDown(numThreads);
+  UIntVector offset(numThreads, 0);
+  UInt nodeCount, roundNodes, nodesBase;
   double treeLb, nodeLb, minNodeLb;
-  double *treeLbTh = new double[numThreads];
-  double *nodeLbTh = new double[numThreads];
-  double *minNodeLbTh = new double[numThreads];
-  bool *shouldRunTh = new bool[numThreads];
-  UInt *nodeCountTh = new UInt[numThreads];
   UInt iterCount = 1;
-  //bool ubUpdated = false;
+  UInt numVars = 0;
+  bool isParRel = false;
+  ParReliabilityBrancherPtr parRelBr;
 
   omp_set_num_threads(numThreads);
-//#pragma omp parallel for
   for (UInt i = 0; i < numThreads; ++i) {
-    should_dive[i] = false;
     dived_prev[i] = false;
     should_prune[i] = false;
     initialized[i] = false;
-    shouldRunTh[i] = true;
-    nodeCountTh[i] = 1;
+    found_sol[i] = false;
   }
 
   // initialize timer
   timer_->start();
+  startLog_(numThreads);
+  startRecord_(numThreads);
 
-  logger_->msgStream(LogInfo) << me_ << "starting branch-and-bound ";
+  logger_->msgStream(LogInfo) << me_ << "starting deterministic "
+    << "branch-and-bound ";
   if(numThreads > 1) {
   logger_->msgStream(LogInfo) << "using " << numThreads << " out of "
     << omp_get_num_procs() << " processors";
@@ -1589,245 +1651,217 @@ void ParBranchAndBound::parsolveSync(ParNodeIncRelaxerPtr parNodeRlxr[],
     nodeCount = 1;
   }
 
-  // solve root outside the loop. save the useful information.
-  bool shouldRun = true;
+  bool shouldRun = (nodeCount > 0 && SolvedOptimal != status_ &&
+                    SolvedGapLimit != status_ && 
+                    TimeLimitReached != status_);
   initialized[0] = true; //pseudoCosts for thread0 initialized while doing root
+  numVars = rel[0]->getNumVars();
+  if (nodePrcssr[0]->getBrancher()->getName() == "ParReliabilityBrancher") {
+    isParRel = true;
+  }
 
-  // memory leak check: remove later
-  if (numThreads > 1) {
-    for (UInt i=1; i < numThreads; i++) {
-      if (current_node[i]) {
-        assert(!"Memory leak (fake node) with a non-master thread\n");
-      }
-    }
+  // every thread finds solutions in its own pool during a round, so that
+  // pruning in a round does not depend on the timing of other threads.
+  for (UInt i = 0; i < numThreads; ++i) {
+    thPool[i] = (SolutionPoolPtr) new SolutionPool(env_, problem_, 1);
   }
 
+  // Each iteration of the loop is a round. Nodes are assigned to threads in
+  // the order of the tree manager, threads process their nodes without
+  // changing anything shared, and results are merged in the order of
+  // threads at the end of the round.
   while ((nodeCount > 0 || tm_->anyActiveNodesLeft()) && shouldRun) {
-#if SPEW
-    logger_->msgStream(LogDebug1) << me_ << "processing node "
-      << current_node[0]->getId() << std::endl
-      << me_ << "depth = " << current_node[0]->getDepth() << std::endl
-      << me_ << "did we dive = " << dived_prev[0] << std::endl;
-#endif
 
-//#pragma omp parallel
-    //{}
     // NODE ASSIGNMENT
-#pragma omp for
+    // a round is longer when there are more open nodes, so that threads
+    // wait at the barrier less often.
+    roundNodes = (tm_->getActiveNodes() + numThreads - 1) / numThreads;
+    roundNodes = std::max((UInt) 1, std::min(options_->roundNodes,
+                                             roundNodes));
     for (UInt i = 0; i < numThreads; ++i) {
+      work[i].clear();
       if (current_node[i]) {
-#if SPEW
-#pragma omp critical (logger)
-          logger_->msgStream(LogDebug1) << me_ << "process node "
-            << current_node[0]->getId() << std::endl
-            << me_ << "depth = " << current_node[0]->getDepth() << std::endl
-            << me_ << "did we dive = " << dived_prev[0] << std::endl;
-#endif
-      } else {
-#pragma omp critical (treeManager)
-        {
-          current_node[i] = tm_->getCandidate();
-          if (current_node[i]) {
-#if SPEW
-#pragma omp critical (logger)
-            logger_->msgStream(LogDebug1) << "assign node " << current_node[i]->getId() << " score "
-              << (int)current_node[i]->getTbScore() << " lb "
-              << current_node[i]->getLb() << " thread " << omp_get_thread_num() << "\n";
-#endif
-            tm_->removeActiveNode(current_node[i]);
-          }
+        if (tm_->shouldPrune_(current_node[i])) {
+          parNodeRlxr[i]->reset(current_node[i], false);
+          tm_->pruneNode(current_node[i]);
+          dived_prev[i] = false;
+        } else {
+          work[i].push_back(current_node[i]);
         }
+        current_node[i] = NodePtr();
+      } else {
         dived_prev[i] = false;
       }
-    } //for end
-
-    // PARALLEL REGION STARTS
-#pragma omp parallel
-    {
-      // NODE SOLVING
-#pragma omp for
+    }
+    for (UInt r = 0; r < roundNodes; ++r) {
       for (UInt i = 0; i < numThreads; ++i) {
-        UIntVector tmpTimesUp, tmpTimesDown, timesUp, timesDown, lastStrBranched;
-        DoubleVector tmpPseudoUp, tmpPseudoDown, pseudoUp, pseudoDown;
-
-        if (current_node[i]) {
-          should_dive[i] = false;
-          rel[i] = parNodeRlxr[i]->createNodeRelaxation(current_node[i],
-                                                        dived_prev[i],
-                                                        should_prune[i]);
-#if SPEW
-#pragma omp critical (logger)
-          logger_->msgStream(LogInfo) << me_ << "process node "
-            << current_node[i]->getId() << " score "
-            << (int)current_node[i]->getTbScore() << " thread "
-            << omp_get_thread_num() << std::endl;
-#endif
-          nodePrcssr[i]->process(current_node[i], rel[i], solPool_,
-                                   initialized[i], timesUp, timesDown,
-                                   pseudoUp, pseudoDown, stats_->nodesProc);
-#pragma omp critical (stats)
-          ++stats_->nodesProc;
-        } //if current_node[i]
-      } //for ends
+        if (work[i].size() <= r) {
+          NodePtr node = tm_->getCandidate();
+          if (!node) {
+            break;
+          }
+          tm_->removeActiveNode(node);
+          work[i].push_back(node);
+        }
+      }
+    }
+    nodesBase = stats_->nodesProc;
+    for (UInt i = 0; i < numThreads; ++i) {
+      offset[i] = (i > 0) ? offset[i-1] + work[i-1].size() : 0;
+      branches[i].assign(work[i].size(), (Branches) 0);
+      wsRound[i].assign(work[i].size(), (WarmStartPtr) 0);
+      found_sol[i] = false;
+
+      // shared state that threads read in the round.
+      if (thPool[i]->getBestSolutionValue() > 
+          solPool_->getBestSolutionValue()) {
+        thPool[i]->addSolution(solPool_->getBestSolution());
+      }
+      if (isParRel) {
+        parRelBr = dynamic_cast <ParReliabilityBrancher*> 
+          (nodePrcssr[i]->getBrancher());
+        snapTimesUp[i] = parRelBr->getTimesUp();
+        snapTimesDown[i] = parRelBr->getTimesDown();
+        snapPseudoUp[i] = parRelBr->getPCUp();
+        snapPseudoDown[i] = parRelBr->getPCDown();
+      }
+    }
 
-      // UPPER BOUND UPDATE
-#pragma omp single
-      {
-        for (UInt i = 0; i < numThreads; ++i) {
-          if (current_node[i]) {
-            //double oldUb = tm_->getUb();
-            if (nodePrcssr[i]->foundNewSolution()) {
-#if SPEW
-              logger_->msgStream(LogInfo) << me_ << "found sol at "
-                << current_node[i]->getId() << " score "
-                << (int)current_node[i]->getTbScore() << " thread "
-                << omp_get_thread_num() << std::endl;
-#endif
-              tm_->setUb(solPool_->getBestSolutionValue());
-              //ubUpdated = (oldUb > tm_->getUb()) ? 1 : 0;
+    // NODE SOLVING
+#pragma omp parallel for schedule(static, 1)
+    for (UInt i = 0; i < numThreads; ++i) {
+      UIntVector timesUp, timesDown;
+      DoubleVector pseudoUp, pseudoDown;
+      bool prune;
+
+      if (isParRel) {
+        timesUp.resize(numVars,0);
+        timesDown.resize(numVars,0);
+        pseudoUp.resize(numVars,0);
+        pseudoDown.resize(numVars,0);
+        for (UInt j = 0; j < numThreads; ++j) {
+          if (i!=j) {
+            for (UInt l=0; l < snapTimesDown[j].size(); ++l) {
+              timesUp[l] += snapTimesUp[j][l];
+              timesDown[l] += snapTimesDown[j][l];
+              pseudoUp[l] += snapTimesUp[j][l]*snapPseudoUp[j][l];
+              pseudoDown[l] += snapTimesDown[j][l]*snapPseudoDown[j][l];
             }
-            should_prune[i] = shouldPrune_(current_node[i]);
-          } //if current_node[i]
-        } //for ends
+          }
+        }
       }
-      // BRANCHING SYNCHRONIZATION
-#pragma omp for
-      for (UInt i = 0; i < numThreads; ++i) {
-        if (current_node[i]) {
-          //if (!should_prune[i]) {
-            //should_prune[i] = nodePrcssr[i]->shouldPrune_(current_node[i], current_node[i]->getLb(), solPool_);
-          //}
-          if (should_prune[i]) {
-#if SPEW
-#pragma omp critical (logger)
-            logger_->msgStream(LogInfo) << me_ << "prune node "
-              << current_node[i]->getId() << " score "
-              << (int)current_node[i]->getTbScore() << " thread "
-              << omp_get_thread_num() << std::endl;
-#endif
-            parNodeRlxr[i]->reset(current_node[i], false);
-#pragma omp critical (treeManager)
-            {
-              tm_->pruneNode(current_node[i]);
-              new_node[i] = NodePtr();
-            }
-            dived_prev[i] = false;
-          } else {
-            initialized[i] = true;
-#if SPEW
-#pragma omp critical (logger)
-            logger_->msgStream(LogInfo) << me_ << "branch at node "
-              << current_node[i]->getId() << " score "
-              << (int)current_node[i]->getTbScore() << " thread "
-              << omp_get_thread_num() << std::endl;
+      for (UInt j = 0; j < work[i].size(); ++j) {
+        NodePtr node = work[i][j];
+        bool last = (j+1 == work[i].size());
 
-#endif
-            branches[i] = nodePrcssr[i]->getBranches();
-            //if (ubUpdated) {
-//#pragma omp critical (logger)
-              //std::cout << "ub updated\n";
-              //BrCandPtr br_can = (*branches[i]->begin())->getBrCand();
-              //const double* xsol = nodePrcssr[i]->getSolution()->getPrimal();
-              //DoubleVector x;
-              //x.resize(rel[i]->getNumVars());
-              //std::copy(xsol, xsol+rel[i]->getNumVars(), x.begin());
-              //branches[i] = br_can->getHandler()->getBranches(br_can, x, rel[i], solPool_);
-              //for (BranchConstIterator br_iter=branches[i]->begin();
-                  //br_iter!=branches[i]->end(); ++br_iter) {
-                //(*br_iter)->setBrCand(br_can);
-              //}
-            //}
-            ws[i] = nodePrcssr[i]->getWarmStart();
-            should_dive[i] = tm_->shouldDive();
-            assert(branches[i]);
-#pragma omp critical (treeManager)
-            {
-              new_node[i] = tm_->branch(branches[i], current_node[i], ws[i]);
-#if SPEW
-#pragma omp critical (logger)
-              logger_->msgStream(LogInfo) << me_ << "get node "
-                << new_node[i]->getId() << " score "
-                << (int)new_node[i]->getTbScore() << " (branch) thread "
-                << omp_get_thread_num() << std::endl;
-#endif
-            }
-            assert((should_dive[i] && new_node[i])
-                   || (!should_dive[i] && !new_node[i]));
-            if (should_dive[i]) {
-              dived_prev[i] = true;
-            } else {
-              parNodeRlxr[i]->reset(current_node[i], false);
-#pragma omp critical (treeManager)
-              {
-                new_node[i] = tm_->getCandidate(); // Can be NULL. The
-                // branches that were created could have large lb and tm
-                // might have eliminated them.
-                if (new_node[i]) {
-                  tm_->removeActiveNode(new_node[i]);
+        rel[i] = parNodeRlxr[i]->createNodeRelaxation(node,
+                                                      (0 == j && 
+                                                       dived_prev[i]),
+                                                      should_prune[i]);
 #if SPEW
-#pragma omp critical (logger)
-              logger_->msgStream(LogInfo) << me_ << "get node "
-                << new_node[i]->getId() << " score "
-                << (int)new_node[i]->getTbScore() << " (prune) thread "
-                << omp_get_thread_num() << std::endl;
+        logger_->msgStream(LogInfo) << me_ << "process node "
+          << node->getId() << " score " << (int)node->getTbScore() 
+          << " thread " << i << std::endl;
 #endif
-                }
-              }
-              dived_prev[i] = false;
-            }
-          }
-          current_node[i] = new_node[i];
-        } // if (current_node[i]) ends
-      } //parallel for end
-#pragma omp single
-      {
-        //iterCount++;
-        nodeCount = 0;
-        treeLb = tm_->updateLb();
-        minNodeLb = INFINITY;
-        for (UInt j = 0; j < numThreads; ++j) {
-          if (current_node[j]) {
-            nodeCount++;
-            nodeLb = current_node[j]->getLb();
-            if (nodeLb < minNodeLb) {
-              minNodeLb = nodeLb;
-            }
+        if (!recorders_.empty()) {
+          recorders_[i]->record(node, rel[i]);
+        }
+        nodePrcssr[i]->process(node, rel[i], thPool[i], initialized[i],
+                               timesUp, timesDown, pseudoUp, pseudoDown,
+                               nodesBase + offset[i] + j);
+        if (nodePrcssr[i]->foundNewSolution()) {
+          found_sol[i] = true;
+        }
+        prune = shouldPrune_(node);
+        if (!prune) {
+          initialized[i] = true;
+          // the processor reuses its branches and warm start for the
+          // next node, keep copies until the end of the round.
+          branches[i][j] = new BranchPtrVector(*(nodePrcssr[i]->
+                                                 getBranches()));
+          wsRound[i][j] = nodePrcssr[i]->getWarmStart();
+          if (wsRound[i][j]) {
+            wsRound[i][j]->incrUseCnt();
           }
         }
-        if (minNodeLb < treeLb) {
-          treeLb = minNodeLb;
+        if (prune || !last || !tm_->shouldDive()) {
+          parNodeRlxr[i]->reset(node, false);
         }
-        showParStatus_(nodeCount, treeLb, wallTimeStart, 0);
+      }
+    } //parallel for ends
 
-        // update stopping conditions for par
-        if (nodeCount == 0 && !(tm_->anyActiveNodesLeft())) {
-          tm_->updateLb();
-          if (tm_->getUb() <= -INFINITY) {
-            status_ = SolvedUnbounded;
-          } else if (tm_->getUb() < INFINITY) {
-            status_ = SolvedOptimal; // TODO: get the right status
+    // MERGE, in the order of threads and nodes.
+    for (UInt i = 0; i < numThreads; ++i) {
+      if (found_sol[i] && thPool[i]->getBestSolutionValue() < 
+          solPool_->getBestSolutionValue()) {
+        solPool_->addSolution(thPool[i]->getBestSolution());
+      }
+    }
+    tm_->setUb(solPool_->getBestSolutionValue());
+    for (UInt i = 0; i < numThreads; ++i) {
+      dived_prev[i] = false;
+      for (UInt j = 0; j < work[i].size(); ++j) {
+        NodePtr node = work[i][j];
+        ++stats_->nodesProc;
+        if (!branches[i][j]) {
+          tm_->pruneNode(node);
+          continue;
+        }
+        NodePtr child = tm_->branch(branches[i][j], node, wsRound[i][j]);
+        if (j+1 == work[i].size() && tm_->shouldDive()) {
+          if (child) {
+            current_node[i] = child;
+            dived_prev[i] = true;
           } else {
-            status_ = SolvedInfeasible; // TODO: get the right status
+            parNodeRlxr[i]->reset(node, false);
           }
+        }
+        delete branches[i][j];
+        if (wsRound[i][j]) {
+          wsRound[i][j]->decrUseCnt();
+          if (0 == wsRound[i][j]->getUseCnt()) {
+            delete wsRound[i][j];
+          }
+        }
+      }
+    }
+
+    ++iterCount;
+    nodeCount = 0;
+    treeLb = tm_->updateLb();
+    minNodeLb = INFINITY;
+    for (UInt j = 0; j < numThreads; ++j) {
+      if (current_node[j]) {
+        nodeCount++;
+        nodeLb = current_node[j]->getLb();
+        if (nodeLb < minNodeLb) {
+          minNodeLb = nodeLb;
+        }
+      }
+    }
+    if (minNodeLb < treeLb) {
+      treeLb = minNodeLb;
+    }
+    showParStatus_(nodeCount, treeLb, wallTimeStart, 0);
+
+    // update stopping conditions for par
+    if (nodeCount == 0 && !(tm_->anyActiveNodesLeft())) {
+      tm_->updateLb();
+      if (tm_->getUb() <= -INFINITY) {
+        status_ = SolvedUnbounded;
+      } else if (tm_->getUb() < INFINITY) {
+        status_ = SolvedOptimal; // TODO: get the right status
+      } else {
+        status_ = SolvedInfeasible; // TODO: get the right status
+      }
 #if SPEW
-#pragma omp critical (logger)
-          logger_->msgStream(LogDebug) << me_ << "all nodes have "
-            << "been processed" << std::endl;
-#endif
-        } else if (shouldStopPar_(wallTimeStart, treeLb)) {
-          tm_->updateLb();
-          shouldRun = false;
-        } else {
-#if SPEW
-#pragma omp critical (logger)
-          logger_->msgStream(LogDebug) << std::setprecision(8)
-            << me_ << "lb = " << tm_->updateLb() << std::endl
-            << me_ << "ub = " << tm_->getUb() << std::endl;
+      logger_->msgStream(LogDebug) << me_ << "all nodes have "
+        << "been processed" << std::endl;
 #endif
-          iterCount++;
-        }
-      } //omp master/single ended
-    }   //parallel region ends
+    } else if (shouldStopPar_(wallTimeStart, treeLb)) {
+      tm_->updateLb();
+      shouldRun = false;
+    }
   }     //while ends
   logger_->msgStream(LogInfo)
         << "---------------------------------------------------------------------------------------" << std::endl;
@@ -1835,39 +1869,27 @@ void ParBranchAndBound::parsolveSync(ParNodeIncRelaxerPtr parNodeRlxr[],
     << std::endl
     << me_ << "nodes processed = " << stats_->nodesProc << std::endl
     << me_ << "nodes created   = " << tm_->getSize() << std::endl
-    << me_ << "iterations = " << iterCount << std::endl;
+    << me_ << "rounds = " << iterCount << std::endl;
 
   stats_->timeUsed = timer_->query();
   timer_->stop();
 
-  delete[] should_dive;
-  delete[] dived_prev;
-  delete[] should_prune;
-  delete[] initialized;
+  stopLog_();
+  stopRecord_();
   for (UInt i=0; i < numThreads; i++) {
     if (current_node[i]) {
       delete current_node[i]; current_node[i] = 0;
     }
-    if (new_node[i]) {
-      new_node[i] = 0;
-    }
-    if (ws[i]) {
-      ws[i] = 0;
-    }
-    if (branches[i]) {
-      branches[i] = 0;
-    }
+    delete thPool[i];
   }
+  delete[] dived_prev;
+  delete[] should_prune;
+  delete[] initialized;
+  delete[] found_sol;
   delete[] current_node;
-  delete[] new_node;
-  delete[] nodeCountTh;
-  delete[] treeLbTh;
-  delete[] nodeLbTh;
-  delete[] minNodeLbTh;
-  delete[] shouldRunTh;
   delete[] ws;
   delete[] rel;
-  delete[] branches;
+  delete[] thPool;
 }
 
 
@@ -1883,6 +1905,10 @@ void ParBranchAndBound::writeStats(std::ostream &out)
     (*it)->writeStats(out);
   }
   solPool_->writeStats(out);
+  for (UInt i=0; i<recorders_.size(); ++i) {
+    recorders_[i]->writeStats(out);
+  }
+  env_->getProfiler()->writeStats(out);
 }
 
 void ParBranchAndBound::writeParStats(std::ostream &out, ParPCBProcessorPtr nodePrcssr[])
@@ -1898,6 +1924,10 @@ void ParBranchAndBound::writeParStats(std::ostream &out, ParPCBProcessorPtr node
     (*it)->writeStats(out);
   }
   solPool_->writeStats(out);
+  for (UInt i=0; i<recorders_.size(); ++i) {
+    recorders_[i]->writeStats(out);
+  }
+  env_->getProfiler()->writeStats(out);
 }
 
 double ParBranchAndBound::totalTime()
@@ -1921,8 +1951,10 @@ double ParBranchAndBound::totalTime()
 // --------------------------------------------------------------------------
   ParBabOptions::ParBabOptions()
 : createRoot(true),
+  logBuffer(false),
   nodeLimit(0),
   perGapLimit(0.),
+  roundNodes(4),
   solLimit(0),
   timeLimit(0.)
 
@@ -1934,9 +1966,12 @@ ParBabOptions::ParBabOptions(EnvPtr env)
 {
   OptionDBPtr options = env->getOptions();
 
+  logBuffer   = options->findBool("bnbpar_log_buffer")->getValue();
   logInterval = options->findDouble("log_interval")->getValue();
   nodeLimit   = options->findInt("node_limit")->getValue();
   perGapLimit = options->findDouble("obj_gap_percent")->getValue();
+  recordFile  = options->findString("record_file")->getValue();
+  roundNodes  = options->findInt("bnbpar_round_nodes")->getValue();
   solLimit    = options->findInt("sol_limit")->getValue();
   timeLimit   = options->findDouble("time_limit")->getValue();
   createRoot  = true;
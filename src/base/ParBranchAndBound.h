@@ -22,11 +22,13 @@ namespace Minotaur {
   struct  ParBabStats;
   class   Engine;
   class   NodeProcessor;
+  class   NodeRecorder;
   class   NodeRelaxer;
   class   ParNodeIncRelaxer;
   class   ParPCBProcessor;
   class   ParTreeManager;
   class   Problem;
+  class   RingLogger;
   class   Solution;
   class   SolutionPool;
   class   WarmStart;
@@ -191,6 +193,15 @@ namespace Minotaur {
     /**
      * \brief Branch-and-bound solver with reproducibility of results.
      *
+     * The search is done in rounds. At the start of a round, open nodes are
+     * assigned to threads in the order of the tree manager, at most
+     * ParBabOptions::roundNodes to a thread, fewer when few nodes are open.
+     * Threads process their nodes with their own copy of the best solution
+     * and of the pseudocosts of the other threads. At the end of the round,
+     * solutions, prunings and branches are applied to the tree in the order
+     * of threads. The tree, and hence the result, does not depend on the
+     * timing of threads.
+     *
      * \param [in] parNodeRelaxer is the array of node relaxers.
      * \param [in] parPCBProcessor is the array of node processors.
      * \param [in] nThreads is the number of threads being used.
@@ -245,9 +256,17 @@ namespace Minotaur {
     /// Log manager for displaying messages.
     LoggerPtr logger_;
 
+    /// Lock-free logger used by threads in parallel regions. NULL when no
+    /// parallel solve is running.
+    RingLogger *ringLog_;
+
     /// String name used in log messages.
     static const std::string me_;
 
+    /// Recorders of relaxations of nodes, one for each thread. Empty if
+    /// option record_file is not set.
+    std::vector<NodeRecorder *> recorders_;
+
     /// The processor to process each node.
     NodeProcessorPtr nodePrcssr_;
 
@@ -316,6 +335,28 @@ namespace Minotaur {
     /// Return True if a node can be pruned.
     bool shouldPrune_(NodePtr node);
 
+    /**
+     * \brief Make threads write log messages to a RingLogger, which is
+     * flushed by a background thread if option bnbpar_log_buffer is set.
+     *
+     * \param [in] nthreads Number of threads.
+     */
+    void startLog_(UInt nthreads);
+
+    /// Write all buffered log messages and restore the logger.
+    void stopLog_();
+
+    /**
+     * \brief Open a recorder for each thread if option record_file is set.
+     * Thread i writes to the file name followed by "." and i.
+     *
+     * \param [in] nthreads Number of threads.
+     */
+    void startRecord_(UInt nthreads);
+
+    /// Close the files of all recorders.
+    void stopRecord_();
+
     /**
      * \brief Check whether the branch-and-bound can stop because of time
      * limit, or node limit or if solved?
@@ -387,6 +428,10 @@ namespace Minotaur {
      */
     bool createRoot;
 
+    /// If true, buffer log messages of threads and write them from a
+    /// background thread.
+    bool logBuffer;
+
     /// Time in seconds between status updates of the progress.
     double logInterval;
 
@@ -399,6 +444,13 @@ namespace Minotaur {
      */
      double perGapLimit;
 
+    /// Maximum number of nodes processed by a thread in a round of the
+    /// deterministic mode.
+    UInt roundNodes;
+
+    /// File for recording relaxations of nodes. Not recorded if empty.
+    std::string recordFile;
+
     /// Limit on number of nodes processed.
     UInt solLimit;
 
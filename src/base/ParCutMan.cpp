@@ -18,6 +18,7 @@
 #include "Function.h"
 #include "Cut.h"
 #include "ParCutMan.h"
+#include "ParCutStore.h"
 #include "LinearFunction.h"
 #include "Logger.h"
 #include "Problem.h"
@@ -38,7 +39,9 @@ ParCutMan::ParCutMan()
     env_(EnvPtr()),  // NULL
     maxDisCutAge_(3),
     maxInactCutAge_(1),
-    p_(ProblemPtr())  // NULL
+    p_(ProblemPtr()),  // NULL
+    store_(0),
+    thread_(0)
 {
   logger_ = (LoggerPtr) new Logger(LogDebug2);
 }
@@ -49,7 +52,9 @@ ParCutMan::ParCutMan(EnvPtr env, ProblemPtr p)
     env_(env),
     maxDisCutAge_(1),
     maxInactCutAge_(1),
-    p_(p)
+    p_(p),
+    store_(0),
+    thread_(0)
 {
   logger_ = env->getLogger();
 }
@@ -208,6 +213,16 @@ void ParCutMan::addToPool_(CutPtr cut)
 void ParCutMan::addCutToPool(CutPtr cut)
 {
   pool_.push_back(cut);
+  if (store_) {
+    store_->publish(cut, thread_);
+  }
+}
+
+
+void ParCutMan::setCutStore(ParCutStore *store, UInt thread)
+{
+  store_ = store;
+  thread_ = thread;
 }
 
 void ParCutMan::write(std::ostream &out) const
@@ -20,6 +20,8 @@
 
 namespace Minotaur {
 
+  class ParCutStore;
+
   /**
    * \brief Derived class for managing cuts. Add and remove cuts based on
    * priority and violation.
@@ -75,6 +77,15 @@ namespace Minotaur {
     void separate(ProblemPtr p, ConstSolutionPtr sol, bool *separated,
                   size_t *n_added);
 
+    /**
+     * \brief Publish cuts added to the pool in a store shared by all
+     * threads.
+     *
+     * \param [in] store The store, NULL to stop publishing.
+     * \param [in] thread Thread that uses this cut manager.
+     */
+    void setCutStore(ParCutStore *store, UInt thread);
+
     // Base class method.
     void write(std::ostream &out) const;
 
@@ -118,6 +129,12 @@ namespace Minotaur {
     /// The relaxation problem that cuts are added to and deleted from.
     ProblemPtr p_;
 
+    /// Store where cuts added to the pool are published. May be NULL.
+    ParCutStore *store_;
+
+    /// Thread that uses this cut manager, for the store.
+    UInt thread_;
+
     CutList pool_;
 
     void addToRel_(CutPtr cons, bool new_cut);
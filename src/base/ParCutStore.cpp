@@ -0,0 +1,280 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file ParCutStore.cpp
+ * \brief Define class ParCutStore for sharing globally valid cuts between
+ * threads of parallel branch-and-bound.
+ * \author The Minotaur Team
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+#include "MinotaurConfig.h"
+#include "Cut.h"
+#include "Function.h"
+#include "LinearFunction.h"
+#include "ParCutStore.h"
+#include "Relaxation.h"
+#include "Variable.h"
+
+using namespace Minotaur;
+
+namespace Minotaur {
+  /// A published cut, lb <= sum_i val[i] x_{idx[i]} <= ub.
+  struct ParCutRec {
+    UIntVector idx;    ///> Indices of variables, increasing.
+    DoubleVector val;  ///> Coefficients.
+    double lb;         ///> Lower bound.
+    double ub;         ///> Upper bound.
+    UInt owner;        ///> Thread that published it.
+  };
+
+  /// State and counters of a thread.
+  struct ParCutThread {
+    UInt cursor;                               ///> Next slot to pull.
+    std::vector<std::pair<UInt, UInt> > wait;  ///> Slots not added, and age.
+    size_t added;                              ///> Cuts of others added.
+    size_t dropped;                            ///> Cuts not published, full.
+    size_t published;                          ///> Cuts published.
+    size_t rediscovered;                       ///> Cuts found before.
+    char pad[64];                              ///> Keep threads apart.
+  };
+}
+
+const UInt ParCutStore::maxWait_ = 10;
+const std::string ParCutStore::me_ = "ParCutStore: ";
+
+ParCutStore::ParCutStore(UInt nthreads, UInt capacity)
+  : cap_(std::max(capacity, (UInt) 1)),
+    next_(0),
+    nthreads_(nthreads),
+    sigs_(0),
+    sigSize_(1),
+    slots_(0),
+    threads_(0)
+{
+  while (sigSize_ < 2*cap_) {
+    sigSize_ *= 2;
+  }
+  sigs_ = new std::atomic<uint64_t>[sigSize_];
+  for (UInt i=0; i<sigSize_; ++i) {
+    sigs_[i].store(0, std::memory_order_relaxed);
+  }
+  slots_ = new std::atomic<ParCutRec *>[cap_];
+  for (UInt i=0; i<cap_; ++i) {
+    slots_[i].store(0, std::memory_order_relaxed);
+  }
+  threads_ = new ParCutThread*[nthreads_];
+  for (UInt i=0; i<nthreads_; ++i) {
+    threads_[i] = new ParCutThread();
+    threads_[i]->cursor = 0;
+    threads_[i]->added = 0;
+    threads_[i]->dropped = 0;
+    threads_[i]->published = 0;
+    threads_[i]->rediscovered = 0;
+  }
+}
+
+
+ParCutStore::~ParCutStore()
+{
+  for (UInt i=0; i<cap_; ++i) {
+    delete slots_[i].load();
+  }
+  for (UInt i=0; i<nthreads_; ++i) {
+    delete threads_[i];
+  }
+  delete [] slots_;
+  delete [] sigs_;
+  delete [] threads_;
+}
+
+
+bool ParCutStore::insertSig_(uint64_t sig)
+{
+  UInt mask = sigSize_ - 1;
+  UInt pos;
+  uint64_t old;
+
+  // 0 marks an empty slot.
+  if (0 == sig) {
+    sig = 1;
+  }
+  pos = (UInt) (sig & mask);
+  for (UInt i=0; i<sigSize_; ++i) {
+    old = sigs_[pos].load(std::memory_order_acquire);
+    if (old == sig) {
+      return false;
+    }
+    if (0 == old) {
+      if (sigs_[pos].compare_exchange_strong(old, sig,
+                                             std::memory_order_acq_rel)) {
+        return true;
+      } else if (old == sig) {
+        return false;
+      }
+    }
+    pos = (pos + 1) & mask;
+  }
+  return true;
+}
+
+
+bool ParCutStore::isViolated_(const ParCutRec *r, const double *x) const
+{
+  const double tol = 1e-6;
+  double act = 0.0;
+
+  for (UInt i=0; i<r->idx.size(); ++i) {
+    act += r->val[i]*x[r->idx[i]];
+  }
+  return (act > r->ub + tol*(1.0 + fabs(r->ub)) ||
+          act < r->lb - tol*(1.0 + fabs(r->lb)));
+}
+
+
+void ParCutStore::publish(CutPtr cut, UInt t)
+{
+  LinearFunctionPtr lf;
+  ParCutRec *r;
+  ParCutThread *th;
+  std::vector<std::pair<UInt, double> > terms;
+  double scale = 0.0;
+  uint64_t sig = 14695981039346656037ULL;
+  UInt slot;
+
+  if (t >= nthreads_ || !cut->getFunction() ||
+      Linear != cut->getFunction()->getType()) {
+    return;
+  }
+  th = threads_[t];
+  lf = cut->getFunction()->getLinearFunction();
+  if (!lf) {
+    return;
+  }
+  for (VariableGroupConstIterator it=lf->termsBegin(); it!=lf->termsEnd();
+       ++it) {
+    terms.push_back(std::make_pair(it->first->getIndex(), it->second));
+    scale = std::max(scale, fabs(it->second));
+  }
+  if (terms.empty() || scale <= 0.0) {
+    return;
+  }
+  std::sort(terms.begin(), terms.end());
+
+  // signature of the cut scaled so that its largest coefficient is one.
+  for (UInt i=0; i<terms.size(); ++i) {
+    sig = (sig ^ terms[i].first) * 1099511628211ULL;
+    sig = (sig ^ (uint64_t) llround(1e6*terms[i].second/scale)) *
+      1099511628211ULL;
+  }
+  sig = (sig ^ (uint64_t) (cut->getLb() > -INFINITY ?
+                           llround(1e6*cut->getLb()/scale) : 1)) *
+    1099511628211ULL;
+  sig = (sig ^ (uint64_t) (cut->getUb() < INFINITY ?
+                           llround(1e6*cut->getUb()/scale) : 2)) *
+    1099511628211ULL;
+  if (false == insertSig_(sig)) {
+    ++(th->rediscovered);
+    return;
+  }
+
+  slot = next_.fetch_add(1, std::memory_order_relaxed);
+  if (slot >= cap_) {
+    ++(th->dropped);
+    return;
+  }
+  r = new ParCutRec();
+  r->idx.resize(terms.size());
+  r->val.resize(terms.size());
+  for (UInt i=0; i<terms.size(); ++i) {
+    r->idx[i] = terms[i].first;
+    r->val[i] = terms[i].second;
+  }
+  r->lb = cut->getLb();
+  r->ub = cut->getUb();
+  r->owner = t;
+  slots_[slot].store(r, std::memory_order_release);
+  ++(th->published);
+}
+
+
+UInt ParCutStore::pull(RelaxationPtr rel, const double *x, UInt t)
+{
+  ParCutThread *th;
+  ParCutRec *r;
+  LinearFunctionPtr lf;
+  FunctionPtr f;
+  std::stringstream sstm;
+  UInt end, nadded = 0, nvars = rel->getNumVars();
+  UInt k = 0;
+
+  if (t >= nthreads_) {
+    return 0;
+  }
+  th = threads_[t];
+
+  // slots are read in order and reading stops at one not yet ready, so
+  // that no cut is missed.
+  end = std::min(next_.load(std::memory_order_relaxed), cap_);
+  while (th->cursor < end) {
+    r = slots_[th->cursor].load(std::memory_order_acquire);
+    if (!r) {
+      break;
+    }
+    if (r->owner != t && r->idx.back() < nvars) {
+      th->wait.push_back(std::make_pair(th->cursor, 0));
+    }
+    ++(th->cursor);
+  }
+
+  for (UInt i=0; i<th->wait.size(); ++i) {
+    r = slots_[th->wait[i].first].load(std::memory_order_relaxed);
+    if (!x || isViolated_(r, x)) {
+      lf = (LinearFunctionPtr) new LinearFunction();
+      for (UInt j=0; j<r->idx.size(); ++j) {
+        lf->addTerm(rel->getVariable(r->idx[j]), r->val[j]);
+      }
+      f = (FunctionPtr) new Function(lf);
+      sstm << "_parCut_" << r->owner << "_" << th->wait[i].first;
+      rel->newConstraint(f, r->lb, r->ub, sstm.str());
+      sstm.str("");
+      ++nadded;
+    } else if (++(th->wait[i].second) < maxWait_) {
+      th->wait[k++] = th->wait[i];
+    }
+  }
+  th->wait.resize(k);
+  th->added += nadded;
+  return nadded;
+}
+
+
+void ParCutStore::writeStats(std::ostream &out) const
+{
+  size_t published = 0, rediscovered = 0, added = 0, dropped = 0;
+
+  for (UInt i=0; i<nthreads_; ++i) {
+    const ParCutThread *th = threads_[i];
+    out << me_ << "thread " << i
+        << ": cuts published = " << th->published
+        << ", rediscovered = " << th->rediscovered
+        << ", shared cuts added = " << th->added << std::endl;
+    published += th->published;
+    rediscovered += th->rediscovered;
+    added += th->added;
+    dropped += th->dropped;
+  }
+  out << me_ << "cuts published                = " << published << std::endl
+      << me_ << "cuts rediscovered             = " << rediscovered
+      << std::endl
+      << me_ << "shared cuts added             = " << added << std::endl
+      << me_ << "cuts dropped, store full      = " << dropped << std::endl;
+}
@@ -0,0 +1,128 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file ParCutStore.h
+ * \brief Declare class ParCutStore for sharing globally valid cuts between
+ * threads of parallel branch-and-bound.
+ * \author The Minotaur Team
+ */
+
+#ifndef MINOTAURPARCUTSTORE_H
+#define MINOTAURPARCUTSTORE_H
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+
+#include "Types.h"
+
+namespace Minotaur {
+
+  class Relaxation;
+  struct ParCutRec;
+  struct ParCutThread;
+  typedef Relaxation* RelaxationPtr;
+
+  /**
+   * \brief An append-only store of linear cuts that are valid for the whole
+   * tree, shared by all threads without locks.
+   *
+   * A thread publishes a cut when it adds the cut to its own relaxation.
+   * The cut is copied into a record, and the record is put in the next free
+   * slot, reserved by an atomic counter. Records are never changed or
+   * removed once published.
+   *
+   * Before a node is processed, its thread pulls the cuts published by
+   * other threads since its last pull. A cut is added to the relaxation of
+   * the thread only if it is violated at the last LP point of the thread.
+   * Other cuts wait, and are checked again at the next few pulls.
+   *
+   * Every published cut also gets a signature from its scaled and rounded
+   * coefficients, kept in a lock-free hash set. A cut whose signature is
+   * already in the set was found before, possibly by another thread. It is
+   * counted as rediscovered and is not published again.
+   *
+   * Variables are identified by their index, so all threads must have
+   * relaxations with the same variables in the same order.
+   */
+  class ParCutStore {
+  public:
+    /**
+     * \brief Create a store.
+     *
+     * \param [in] nthreads Number of threads.
+     * \param [in] capacity Maximum number of cuts. Cuts published after the
+     * store is full are dropped.
+     */
+    ParCutStore(UInt nthreads, UInt capacity);
+
+    /// Destroy.
+    ~ParCutStore();
+
+    /**
+     * \brief Publish a linear cut found by a thread.
+     *
+     * \param [in] cut The cut. Only its linear function and bounds are
+     * copied.
+     * \param [in] t Thread that found the cut.
+     */
+    void publish(CutPtr cut, UInt t);
+
+    /**
+     * \brief Add cuts published by other threads to a relaxation.
+     *
+     * \param [in] rel Relaxation of thread t.
+     * \param [in] x Last LP point of thread t. If NULL, all new cuts are
+     * added.
+     * \param [in] t Thread that pulls.
+     * \return Number of cuts added to rel.
+     */
+    UInt pull(RelaxationPtr rel, const double *x, UInt t);
+
+    /// Write number of cuts published, rediscovered and added by threads.
+    void writeStats(std::ostream &out) const;
+
+  private:
+    /// Maximum number of records.
+    const UInt cap_;
+
+    /// Number of pulls a cut waits for violation before it is dropped.
+    static const UInt maxWait_;
+
+    /// For logging.
+    static const std::string me_;
+
+    /// Number of slots reserved. May exceed cap_.
+    std::atomic<UInt> next_;
+
+    /// Number of threads.
+    const UInt nthreads_;
+
+    /// Signatures of published cuts. Zero marks an empty slot.
+    std::atomic<uint64_t> *sigs_;
+
+    /// Size of sigs_, a power of two.
+    UInt sigSize_;
+
+    /// Published records. NULL until a record is ready.
+    std::atomic<ParCutRec *> *slots_;
+
+    /// State and counters of each thread.
+    ParCutThread **threads_;
+
+    /**
+     * \brief Insert a signature in the hash set.
+     *
+     * \return False if the signature was already in the set.
+     */
+    bool insertSig_(uint64_t sig);
+
+    /// Return true if the cut in record r is violated at x.
+    bool isViolated_(const ParCutRec *r, const double *x) const;
+  };
+}
+#endif
@@ -20,6 +20,7 @@
 #endif
 
 #include "MinotaurConfig.h"
+#include "BoundTrail.h"
 #include "Constraint.h"
 #include "Engine.h"
 #include "Environment.h"
@@ -116,6 +117,7 @@ void ParMINLPDiving::backtrack_(UInt n_moded, ModVector& lastNodeMods, ProblemPt
   VariablePtr variable;
   double old_bound_val;
 
+  p->beginUpdate();
   //std::cout << "Undoing mods\n"; 
   for (ModVector::reverse_iterator m_iter=lastNodeMods.rbegin(); 
        m_iter!=lastNodeMods.rend(); ++m_iter) {
@@ -150,6 +152,7 @@ void ParMINLPDiving::backtrack_(UInt n_moded, ModVector& lastNodeMods, ProblemPt
     mods.push(temp_varmod);
     temp.pop();
   }
+  p->commitUpdate();
 }
 
 
@@ -367,7 +370,7 @@ void ParMINLPDiving::implementDive_(int i, const double* x, SolutionPoolPtr s_po
     ++(stats_->totalProbs);
     if (EngineError == status) {
       e->clear();  // reset the starting point
-      e->load(p_);
+      e->load(p);
       ++(stats->errors[i/8]);
     }
     if (status == ProvenLocalOptimal || status == ProvenOptimal 
@@ -400,9 +403,6 @@ void ParMINLPDiving::implementDive_(int i, const double* x, SolutionPoolPtr s_po
 //#endif
             } else {
               logger_->msgStream(LogInfo) << me_ << "NLP feasible!" << std::endl;
-#if USE_OPENMP
-#pragma omp critical (solPool)
-#endif
               s_pool->addSolution(nlpe->getSolution());
 #if USE_OPENMP
 #pragma omp critical (stats)
@@ -425,9 +425,6 @@ void ParMINLPDiving::implementDive_(int i, const double* x, SolutionPoolPtr s_po
 #pragma omp critical (stats)
 #endif
           stats_->best_obj_value = sol->getObjValue();
-#if USE_OPENMP
-#pragma omp critical (solPool)
-#endif
           s_pool->addSolution(sol);
           ++(stats->numSol[i/8]);
           ++(stats->totalSol);
@@ -530,6 +527,7 @@ void ParMINLPDiving::fixInts(const double *x,
   double xval;
   VariablePtr v;
   VarBoundMod2 *m = 0;
+  minlp->beginUpdate();
   for (VariableConstIterator vit=minlp->varsBegin(); vit!=minlp->varsEnd();
        ++vit) {
     v = *vit;
@@ -541,6 +539,7 @@ void ParMINLPDiving::fixInts(const double *x,
       (nlpMods).push(m);
     }
   }
+  minlp->commitUpdate();
   return;
 }
 
@@ -548,12 +547,14 @@ void ParMINLPDiving::unfixInts(std::stack<Modification *> &nlpMods,
                                ProblemPtr minlp)
 {
   Modification *m = 0;
+  minlp->beginUpdate();
   while((nlpMods).empty() == false) {
     m = (nlpMods).top();
     m->undoToProblem(minlp);
     (nlpMods).pop();
     delete m;
   }
+  minlp->commitUpdate();
   return;
 }
 
@@ -729,15 +730,6 @@ UInt ParMINLPDiving::ReducedCost_(UInt numfrac, const double* x, Direction d,
 }
 
 
-void ParMINLPDiving::restoreBounds_(double* LB_copy, double* UB_copy, UInt vars, ProblemPtr p)
-{
-  for (UInt i=0; i<vars; ++i, ++LB_copy, ++UB_copy) {
-    p->changeBoundByInd(i, Lower, *LB_copy);
-    p->changeBoundByInd(i, Upper, *UB_copy);
-  }
-}
-
-
 double ParMINLPDiving::rounding_(double value, Direction d)
 {
   switch (d) {
@@ -765,17 +757,6 @@ double ParMINLPDiving::rounding_(double value, Direction d)
 }
 
 
-void ParMINLPDiving::saveBounds_(double* LB_copy, double* UB_copy, UInt vars)
-{
-  VariablePtr variable;
-  for (UInt i=0; i<vars; ++i, ++LB_copy, ++UB_copy) {
-    variable = p_->getVariable(i);
-    *LB_copy = variable->getLb();
-    *UB_copy = variable->getUb();
-  }
-}
-
-
 ParMINLPDiving::FuncPtr ParMINLPDiving::selectHeur_(int i, Direction &d, Order &o)
 {
 #if USE_OPENMP
@@ -860,9 +841,6 @@ void ParMINLPDiving::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
   int num_method         = 32;
   UInt numvars           = p_->getNumVars();
   double* root_x;
-  double* root_copy;
-  double* LB_copy;
-  double* UB_copy;
   logger_->msgStream(LogInfo) << me_ << "Starting" << std::endl;
   logger_->msgStream(LogInfo) << me_ << "Partitioning levels: " << numLevels_ << std::endl;
   //timer_->start();
@@ -872,9 +850,6 @@ void ParMINLPDiving::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
     return;
   }
   root_x             = new double[numvars];
-  root_copy          = new double[numvars];
-  LB_copy            = new double[numvars];
-  UB_copy            = new double[numvars];
   e_->clear();
   e_->load(p_);
   e_->setIterationLimit(7000); // try to run for a loooong time.
@@ -954,7 +929,6 @@ void ParMINLPDiving::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
       << omp_get_num_procs() << " processors" << std::endl;
 #endif
     //lh_ = new LinearHandler(env_, p_);
-    saveBounds_(LB_copy, UB_copy, numvars);
 
     // CREATING OBJECTS EACH TIME BELOW NEEDS CORRECTION ASAP!!
 #if USE_OPENMP
@@ -977,6 +951,20 @@ void ParMINLPDiving::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
       stats->numLocal          = 1;
       stats->best_obj_value    = INFINITY;
       stats->totalTime         = 0; 
+
+      // Thread specific copies of the problem and engine. They are reused
+      // for all dives of this thread. The trail restores the bounds
+      // changed in a dive.
+      EnginePtr e =  e_->emptyCopy();
+      ProblemPtr p = p_->clone(env_);
+      BoundTrail trail(p);
+      LinearHandler *lh;
+      double* gradientObj;
+      e->clear();
+      e->load(p);
+      e->setIterationLimit(200);
+      lh = new LinearHandler(env_, p);
+      gradientObj = new double[p->getNumVars()];
     // loop over the methods starts here
 #if USE_OPENMP
 #pragma omp for
@@ -986,28 +974,16 @@ void ParMINLPDiving::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
       if (getWallTime() - wallTimeStart_ <= wallTimeLimit) {
         logger_->msgStream(LogDebug) << me_<< "diving method "
           << i << std::endl;
-        std::copy(root_x, root_x + numvars, root_copy); 
-        x = root_copy;
-        // Thread specific 
-        EnginePtr e =  e_->emptyCopy();
-        ProblemPtr p = p_->clone(env_);
-        LinearHandler *lh;
-        double* gradientObj;
         DoubleVector score;
         UIntVector violated;
         DoubleVector avgDual = avgDualR;
         //avgDual.resize(numvars, 0);
         ModVector lastNodeMods;
         std::stack<VarBoundModPtr> mods;
-        e->clear();
-        e->load(p);
-        e->setIterationLimit(200);
-        lh = new LinearHandler(env_, p);
-        gradientObj = new double[p->getNumVars()];
-
-        implementDive_(i, x, s_pool, lastNodeMods, e, p, avgDual, violated,
-                       mods, lh, score, gradientObj, stats);
-        restoreBounds_(LB_copy, UB_copy, numvars, p);
+
+        implementDive_(i, root_x, s_pool, lastNodeMods, e, p, avgDual,
+                       violated, mods, lh, score, gradientObj, stats);
+        trail.undo();
         // clear the stack of modification for this heuristic method
         while (!mods.empty()) {
             mods.pop();
@@ -1029,6 +1005,8 @@ void ParMINLPDiving::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
         //lastNodeMods_.clear();
       }
     } // loop over methods ends here
+    delete lh;
+    delete [] gradientObj;
 #if USE_OPENMP
 #pragma omp critical (stats)
 #endif
@@ -1042,15 +1020,6 @@ void ParMINLPDiving::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
   if (root_x){
     delete [] root_x;
   }
-  if (LB_copy){
-    delete [] LB_copy;
-  }
-  if (UB_copy){
-    delete [] UB_copy;
-  }
-  if (root_copy){
-    delete [] root_copy;
-  }
   //timer_->stop();
   exit(1);
 }
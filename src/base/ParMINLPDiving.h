@@ -90,6 +90,12 @@ namespace Minotaur {
     /// call to heuristic
     void solve(NodePtr node, RelaxationPtr rel, SolutionPoolPtr s_pool); 
 
+    /// Return the name of this heuristic.
+    std::string getName() const { return "ParMINLP Diving"; }
+
+    /// Number of problems solved so far.
+    UInt getNumSolves() const { return stats_->totalProbs; }
+
     /// writing the statistics to the logger
     void writeStats(std::ostream &out) const;
 
@@ -323,16 +329,6 @@ namespace Minotaur {
                       std::stack<VarBoundModPtr>& mods, LinearHandler* lh,
                       ModVector& lastNodesMods, DoubleVector& score,
                       DoubleVector& avgDual, double* gradientObj);
-    /**
-     * \brief Restore the bounds for the problem
-     *
-     * \param[in] LB_copy Pointer to saved bounds
-     * \param[in] UB_copt Pointer to saved bounds
-     * \param[in] vars Number of variables in the problem
-     */
-    void restoreBounds_(double* LB_copy, double* UB_copy, UInt vars,
-                        ProblemPtr p);
-
     /**
      * \brief Rounding a value in a given direction
      *
@@ -343,15 +339,6 @@ namespace Minotaur {
      */
     double rounding_(double value, Direction d);
 
-    /** 
-     * \brief Save bounds of the problem
-     *
-     * \param[in] LB_copy Pointer to bounds, space has to be allocated
-     * \param[in] UB_copt Pointer to bounds, space has to be allocated
-     * \param[in] vars Number of variables in the problem
-     */
-    void saveBounds_(double* LB_copy, double* UB_copy, UInt vars);
-
     /**
      * \brief Select the method, ordering and direction.
      *
@@ -99,6 +99,9 @@ RelaxationPtr ParNodeIncRelaxer::createNodeRelaxation(NodePtr node, bool dived,
   WarmStartPtr ws;
   prune = false;
 
+  // the bounds changed at all nodes on the path are given to the engine
+  // in one batch.
+  rel_->beginUpdate();
   if (!dived) {
     // traceback to root and put in all modifications that need to go into the
     // relaxation and the engine.
@@ -137,6 +140,7 @@ RelaxationPtr ParNodeIncRelaxer::createNodeRelaxation(NodePtr node, bool dived,
   } else {
     node->applyRModsTrans(rel_);
   }
+  rel_->commitUpdate();
 
   for (HandlerIterator h = handlers_.begin(); h != handlers_.end() && !prune; 
       ++h) {
@@ -165,6 +169,7 @@ void ParNodeIncRelaxer::reset(NodePtr node, bool diving)
   NodePtr t_node = node;
 
   if (!diving) {
+    rel_->beginUpdate();
     if (modProb_) {
       while (t_node) {
         t_node->undoMods(rel_, p_);
@@ -176,6 +181,7 @@ void ParNodeIncRelaxer::reset(NodePtr node, bool diving)
         t_node = t_node->getParent();
       }
     }
+    rel_->commitUpdate();
   }
 }
 
@@ -27,6 +27,7 @@
 #include "Logger.h"
 #include "Node.h"
 #include "Option.h"
+#include "Profiler.h"
 #include "ParCutMan.h"
 #include "Modification.h"
 #include "Relaxation.h"
@@ -70,6 +71,7 @@ ParPCBProcessor::ParPCBProcessor (EnvPtr env, EnginePtr engine,
   cutMan_(0),
   //engineStatus_(EngineUnknownStatus),
   numSolutions_(0),
+  prof_(0),
   //relaxation_(RelaxationPtr()),
   //ws_(WarmStartPtr())
   ws_(0)
@@ -80,6 +82,7 @@ ParPCBProcessor::ParPCBProcessor (EnvPtr env, EnginePtr engine,
   engine_ = engine;
   handlers_ = handlers;
   logger_ = env->getLogger();
+  prof_ = env->getProfiler();
   presFreq_ = env->getOptions()-> findInt("pres_freq")->getValue();
   stats_.bra = 0;
   stats_.inf = 0;
@@ -160,10 +163,7 @@ bool ParPCBProcessor::isFeasible_(NodePtr node, ConstSolutionPtr sol,
   }
 
   if (is_feas == true && h==handlers_.end()) {
-#pragma omp critical (solPool)
-    {
-      s_pool->addSolution(sol);
-    }
+    s_pool->addSolution(sol);
     ++numSolutions_;
     node->setStatus(NodeOptimal);
     ++stats_.opt;
@@ -191,6 +191,7 @@ bool ParPCBProcessor::presolveNode_(NodePtr node, SolutionPoolPtr s_pool)
   if (presFreq_ < 1 || checkForPresolve) {
     return false;
   } 
+  ProfScope scope(prof_, ZonePresolve);
   // TODO: make this more sophisticated: loop several times until no more
   // changes are possible.
   for (it=0; it<max_iter && true==cont; ++it) {
@@ -246,6 +247,7 @@ void ParPCBProcessor::process(NodePtr node, RelaxationPtr rel,
   ModVector mods;
   SeparationStatus sep_status = SepaContinue;
   int iter = 0;
+  ProfScope scope(prof_, ZoneNode);
 
   ++stats_.proc;
   relaxation_ = rel;
@@ -304,6 +306,7 @@ void ParPCBProcessor::process(NodePtr node, RelaxationPtr rel,
 
     if (iter == 1 && !node->getParent()) {
       // in root, in first iteration, run a heuristic. XXX: better management.
+      ProfScope hscope(prof_, ZoneHeur);
       for (HeurVector::iterator it=heurs_.begin(); it!=heurs_.end(); ++it) {
         (*it)->solve(node, rel, s_pool);
       }
@@ -327,17 +330,21 @@ void ParPCBProcessor::process(NodePtr node, RelaxationPtr rel,
       if (ws_) {
         ws_->incrUseCnt();
       }
-      if (brancher_->getName()=="ParReliabilityBrancher") {
-        ParReliabilityBrancherPtr parRelBr;
-        parRelBr = dynamic_cast <ParReliabilityBrancher*> (brancher_);
+      {
+        ProfScope bscope(prof_, ZoneBranch);
+        if (brancher_->getName()=="ParReliabilityBrancher") {
+          ParReliabilityBrancherPtr parRelBr;
+          parRelBr = dynamic_cast <ParReliabilityBrancher*> (brancher_);
 #pragma omp critical (solPool)
-        branches_ = parRelBr->findBranches(relaxation_, node, sol, s_pool,
-                                            br_status, mods, timesUp, timesDown,
-                                            pseudoUp, pseudoDown, nodesProc);
-      } else {
+          branches_ = parRelBr->findBranches(relaxation_, node, sol, s_pool,
+                                              br_status, mods, timesUp,
+                                              timesDown, pseudoUp, pseudoDown,
+                                              nodesProc);
+        } else {
 #pragma omp critical (solPool)
-        branches_ = brancher_->findBranches(relaxation_, node, sol, s_pool,
-                                            br_status, mods);
+          branches_ = brancher_->findBranches(relaxation_, node, sol, s_pool,
+                                              br_status, mods);
+        }
       }
 
       if (br_status==PrunedByBrancher) {
@@ -387,6 +394,7 @@ void ParPCBProcessor::separate_(ConstSolutionPtr sol, NodePtr node,
   bool sol_found;
   ModVector p_mods;      // Mods that are applied to the problem
   ModVector r_mods;      // Mods that are applied to the relaxation.
+  ProfScope scope(prof_, ZoneSeparate);
 
   *status = SepaContinue;
   sol_found = false;
@@ -557,6 +565,7 @@ bool ParPCBProcessor::shouldPrune_(NodePtr node, double solval,
 
 void ParPCBProcessor::solveRelaxation_() 
 {
+  ProfScope scope(prof_, ZoneRelax);
   engineStatus_ = EngineError;
   engine_->solve();
   engineStatus_ = engine_->getStatus();
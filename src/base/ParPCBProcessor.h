@@ -24,6 +24,7 @@ namespace Minotaur {
 
   //class Engine;
   //class Problem;
+  class Profiler;
   class Solution;
   typedef const Solution* ConstSolutionPtr;
 
@@ -144,6 +145,9 @@ namespace Minotaur {
     /// How many new solutions were found by the processor.
     UInt numSolutions_;
 
+    /// Profiler of the environment.
+    Profiler *prof_;
+
     /// Relaxation that is processed by this processor.
     RelaxationPtr relaxation_;
 
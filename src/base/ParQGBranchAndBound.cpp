@@ -11,6 +11,7 @@
  * \author Prashant Palkar, Meenarli Sharma, IIT Bombay
  */
 
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <sstream>
@@ -34,15 +35,18 @@
 #include "NodeRelaxer.h"
 #include "Option.h"
 #include "ParCutMan.h"
+#include "ParCutStore.h"
 #include "ParPCBProcessor.h"
 #include "ParQGBranchAndBound.h"
 #include "ParNodeIncRelaxer.h"
 #include "ParTreeManager.h"
 #include "Problem.h"
 #include "Relaxation.h"
+#include "RingLogger.h"
 #include "Solution.h"
 #include "SolutionPool.h"
 #include "Timer.h"
+#include "WarmStart.h"
 #include "Branch.h"
 #include "BrCand.h"
 #include "BrVarCand.h"
@@ -55,7 +59,9 @@ using namespace Minotaur;
 const std::string ParQGBranchAndBound::me_ = "ParQGBranchAndBound: ";
 
 ParQGBranchAndBound::ParQGBranchAndBound()
-  : env_(0),
+  : cutStore_(0),
+    env_(0),
+    ringLog_(0),
     nodePrcssr_(),
     nodeRlxr_(0),
     options_(0),
@@ -70,7 +76,8 @@ ParQGBranchAndBound::ParQGBranchAndBound()
 
 
 ParQGBranchAndBound::ParQGBranchAndBound(EnvPtr env, ProblemPtr p)
-  : env_(env),
+  : cutStore_(0),
+    env_(env),
   nodePrcssr_(0),
   nodeRlxr_(0),
   problem_(p),
@@ -82,11 +89,13 @@ ParQGBranchAndBound::ParQGBranchAndBound(EnvPtr env, ProblemPtr p)
   tm_ = (ParTreeManagerPtr) new ParTreeManager(env);
   options_ = (ParQGBabOptionsPtr) new ParQGBabOptions(env);
   logger_ = env->getLogger();
+  ringLog_ = 0;
 }
 
 
 ParQGBranchAndBound::~ParQGBranchAndBound()
 {
+  stopLog_();
   problem_ = 0;
   env_ = 0;
   nodeRlxr_ = 0;
@@ -106,6 +115,9 @@ ParQGBranchAndBound::~ParQGBranchAndBound()
   if (tm_) {
     delete tm_;
   }
+  if (cutStore_) {
+    delete cutStore_;
+  }
 }
 
 
@@ -269,7 +281,6 @@ bool ParQGBranchAndBound::shouldPrune_(NodePtr node)
   case (NodeOptimal):
     should_prune = true;
 #if SPEW
-#pragma omp critical (logger)
             logger_->msgStream(LogInfo) << me_ << "prune node (NodeOptimal) "
               << node->getId() << " score "
               << (long int)node->getTbScore() << " lb " << node->getLb() << " thread "
@@ -279,7 +290,6 @@ bool ParQGBranchAndBound::shouldPrune_(NodePtr node)
   case (NodeHitUb):
     should_prune = true;
 #if SPEW
-#pragma omp critical (logger)
             logger_->msgStream(LogInfo) << me_ << "prune node (NodeHitUb) "
               << node->getId() << " score "
               << (long int)node->getTbScore() << " lb " << node->getLb() << " thread "
@@ -289,7 +299,6 @@ bool ParQGBranchAndBound::shouldPrune_(NodePtr node)
     break;
   case (NodeInfeasible):
 #if SPEW
-#pragma omp critical (logger)
             logger_->msgStream(LogInfo) << me_ << "prune node (NodeInfeasible) "
               << node->getId() << " score "
               << (long int)node->getTbScore() << " lb " << node->getLb() << " thread "
@@ -363,6 +372,29 @@ bool ParQGBranchAndBound::shouldStopPar_(double WallTimeStart, double treeLb)
 }
 
 
+void ParQGBranchAndBound::startLog_(UInt nthreads)
+{
+  if (!ringLog_) {
+    ringLog_ = new RingLogger(env_->getLogger(), nthreads);
+    if (options_->logBuffer) {
+      ringLog_->start();
+    }
+    logger_ = ringLog_;
+  }
+}
+
+
+void ParQGBranchAndBound::stopLog_()
+{
+  if (ringLog_) {
+    ringLog_->stop();
+    delete ringLog_;
+    ringLog_ = 0;
+    logger_ = env_->getLogger();
+  }
+}
+
+
 void ParQGBranchAndBound::showStatus_(bool current_uncounted)
 {
   UInt off=0;
@@ -438,14 +470,21 @@ void ParQGBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
   UInt *nodesProcTh = new UInt[numThreads];
   //UInt iterCount = 1;
   std::vector<ParCutMan*> cutman(numThreads);
-  UInt *cutsIndex = new UInt[numThreads*numThreads]();
   UInt numVars = 0;
   bool shouldRun = true;
 
   omp_set_num_threads(numThreads);
+  if (cutStore_) {
+    delete cutStore_;
+    cutStore_ = 0;
+  }
+  if (numThreads > 1 && options_->shareCuts) {
+    cutStore_ = new ParCutStore(numThreads, options_->cutStoreSize);
+  }
 //#pragma omp parallel for
   for(UInt i = 0; i < numThreads; ++i) {
     cutman[i] = new ParCutMan(env_, problem_);
+    cutman[i]->setCutStore(cutStore_, i);
     nodePrcssr[i]->setCutManager(cutman[i]);
     should_dive[i] = false;
     dived_prev[i] = false;
@@ -457,6 +496,7 @@ void ParQGBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
 
   // initialize timer
   timer_->start();
+  startLog_(numThreads);
 
   logger_->msgStream(LogInfo) << me_ << "starting branch-and-bound ";
   if (numThreads > 1) {
@@ -537,9 +577,6 @@ void ParQGBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
   {
     i = omp_get_thread_num();
     //UInt nodeCountThread = nodeCount;
-    FunctionPtr f;
-    VariablePtr v;
-    LinearFunctionPtr lf, lfnew;
     ParReliabilityBrancherPtr parRelBr;
     UIntVector tmpTimesUp, tmpTimesDown, timesUp, timesDown, lastStrBranched;
     DoubleVector tmpPseudoUp, tmpPseudoDown, pseudoUp, pseudoDown;
@@ -579,7 +616,6 @@ void ParQGBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
         if (current_node[i]) {
           nodesProcTh[i]++;
 #if SPEW
-#pragma omp critical (logger)
           logger_->msgStream(LogDebug) << me_ << "get node "
             << current_node[i]->getId() << " thread "
             << omp_get_thread_num() << std::endl;
@@ -589,7 +625,6 @@ void ParQGBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
       }
       if (current_node[i]) {
 #if SPEW
-#pragma omp critical (logger)
         logger_->msgStream(LogInfo) << me_ << "process node "
           << current_node[i]->getId() << " thread " << omp_get_thread_num() << std::endl;
           //<< me_ << "depth = " << current_node[i]->getDepth() << std::endl
@@ -600,30 +635,14 @@ void ParQGBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
         rel[i] = parNodeRlxr[i]->createNodeRelaxation(current_node[i],
                                                       dived_prev[i],
                                                       should_prune[i]);
-        // CAUTION: if parRel branching is not used, cuts are also not shared.
-        // Sharing pseudocosts must be separated from sharing cuts.
+        // cuts found by other threads, violated at the last LP point of
+        // this thread.
+        if (cutStore_) {
+          ConstSolutionPtr lpsol = nodePrcssr[i]->getSolution();
+          cutStore_->pull(rel[i], lpsol ? lpsol->getPrimal() : 0, i);
+        }
         for(UInt j = 0; j < numThreads; ++j) {
           if (i!=j) {
-            std::vector<ConstraintPtr > consVec = nodePrcssr[j]->getCutManager()->getPoolCons();
-            if (consVec.size() > 0) {
-              for (UInt k=cutsIndex[i*numThreads+j]; k < consVec.size(); ++k) {
-                lf = consVec[k]->getLinearFunction();
-                if (lf) {
-                  lfnew = (LinearFunctionPtr) new LinearFunction();
-                  for (VariableGroupConstIterator it=lf->termsBegin(); it!=lf->termsEnd();++it) {
-                    v = it->first;
-                    //transform the cut
-                    lfnew->addTerm(rel[i]->getRelaxationVar(rel[i]->getOriginalVar(v)),it->second); //rel[j] not needed
-                  }
-                  f = (FunctionPtr) new Function(lfnew);
-                  rel[i]->newConstraint(f, consVec[k]->getLb(),
-                                        consVec[k]->getUb(), consVec[k]->getName());
-                }
-              }
-              cutsIndex[i*numThreads+j] = consVec.size();
-              consVec.clear();
-            }
-        
             if (isParRel) {
               parRelBr = dynamic_cast <ParReliabilityBrancher*> (nodePrcssr[j]->getBrancher());
               tmpTimesUp = parRelBr->getTimesUp();
@@ -648,7 +667,6 @@ void ParQGBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
         }
 
 #if SPEW
-#pragma omp critical (logger)
         logger_->msgStream(LogDebug1) << me_ << "node "
           << current_node[i]->getId() << " lower bound = "
           << current_node[i]->getLb() << " thread "
@@ -664,7 +682,6 @@ void ParQGBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
 
         if (should_prune[i]) {
 #if SPEW
-#pragma omp critical (logger)
           logger_->msgStream(LogInfo) << me_ << "prune node "
             << current_node[i]->getId() << " thread "
             << omp_get_thread_num() << std::endl;
@@ -685,7 +702,6 @@ void ParQGBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
               tm_->removeActiveNode(new_node[i]);
               nodesProcTh[i]++;
 #if SPEW
-#pragma omp critical (logger)
               logger_->msgStream(LogDebug) << me_ << "get node "
                 << new_node[i]->getId() << " (prune) thread "
                 << omp_get_thread_num() << std::endl;
@@ -696,7 +712,6 @@ void ParQGBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
         } else {
           initialized[i] = true;
 #if SPEW
-#pragma omp critical (logger)
           logger_->msgStream(LogDebug) << me_ << "branch at node "
             << current_node[i]->getId() << " thread "
             << omp_get_thread_num() << std::endl;
@@ -714,7 +729,6 @@ void ParQGBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
 #pragma omp critical (current_node)
             new_node[i] = tm_->branch(branches[i], current_node[i], ws[i]);
 #if SPEW
-#pragma omp critical (logger)
             logger_->msgStream(LogDebug) << me_ << "get node "
               << new_node[i]->getId() << " (branch) thread " << omp_get_thread_num()
               << std::endl;
@@ -734,7 +748,6 @@ void ParQGBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
               if (new_node[i]) {
                 tm_->removeActiveNode(new_node[i]);
 #if SPEW
-#pragma omp critical (logger)
                 logger_->msgStream(LogDebug) << me_ << "get/remove node "
                   << new_node[i]->getId() << " thread "
                   << omp_get_thread_num() << std::endl;
@@ -781,9 +794,11 @@ void ParQGBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
           }
         }
       }
+      if (timer_->query() - stats_->updateTime > options_->logInterval) {
 #pragma omp critical (logger)
-      {
-        showParStatus_(nodeCountTh[i], treeLbTh[i], wallTimeStart, i);
+        {
+          showParStatus_(nodeCountTh[i], treeLbTh[i], wallTimeStart, i);
+        }
       }
       if (shouldStopPar_(wallTimeStart, treeLbTh[i])) {
 #pragma omp critical (treeManager)
@@ -819,7 +834,6 @@ void ParQGBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
         ////shouldRun = false;
       } else {
 #if SPEW
-#pragma omp critical (logger)
         //logger_->msgStream(LogInfo) << "nodesCount " << nodeCountThread << " thread " << i << std::endl;
         logger_->msgStream(LogDebug) << std::setprecision(8)
           << me_ << "lb = " << tm_->updateLb() << std::endl
@@ -850,6 +864,7 @@ void ParQGBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
   stats_->timeUsed = timer_->query();
   timer_->stop();
 
+  stopLog_();
   delete[] should_dive;
   delete[] dived_prev;
   delete[] should_prune;
@@ -878,7 +893,6 @@ void ParQGBranchAndBound::parsolveOppor(ParNodeIncRelaxerPtr parNodeRlxr[],
   delete[] ws;
   delete[] rel;
   delete[] branches;
-  delete[] cutsIndex;
 }
 
 
@@ -906,7 +920,6 @@ void ParQGBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
   std::vector<ParCutMan*> cutman(numThreads);
   //bool iterMode = env_->getOptions()->findBool("mcbnb_iter_mode")->getValue();
   UInt iterCount = 1;
-  UInt *cutsIndex = new UInt[numThreads*numThreads]();
   UInt numVars = 0;
 
   //Time taken and nodes solved by each thread
@@ -917,10 +930,18 @@ void ParQGBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
   UInt *nodesProcTh = new UInt[numThreads];
 
   omp_set_num_threads(numThreads);
+  if (cutStore_) {
+    delete cutStore_;
+    cutStore_ = 0;
+  }
+  if (numThreads > 1 && options_->shareCuts) {
+    cutStore_ = new ParCutStore(numThreads, options_->cutStoreSize);
+  }
 //#pragma omp parallel for
   for(UInt i = 0; i < numThreads; ++i) {
     // declare cut manager
     cutman[i] = new ParCutMan(env_, problem_);
+    cutman[i]->setCutStore(cutStore_, i);
     nodePrcssr[i]->setCutManager(cutman[i]);
     should_dive[i] = false;
     dived_prev[i] = false;
@@ -935,6 +956,7 @@ void ParQGBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
 
   // initialize timer
   timer_->start();
+  startLog_(numThreads);
 
   logger_->msgStream(LogInfo) << me_ << "starting branch-and-bound ";
   if(numThreads > 1) {
@@ -1024,9 +1046,6 @@ void ParQGBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
 #pragma omp for
       for(UInt i = 0; i < numThreads; ++i) {
         sTimeTh[i] = omp_get_wtime();
-        FunctionPtr f;
-        VariablePtr v;
-        LinearFunctionPtr lf, lfnew;
         //brancher related
         ParReliabilityBrancherPtr parRelBr;
         UIntVector tmpTimesUp, tmpTimesDown, timesUp, timesDown, lastStrBranched;
@@ -1064,7 +1083,6 @@ void ParQGBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
         }
         if (current_node[i]) {
 #if SPEW
-#pragma omp critical (logger)
           logger_->msgStream(LogInfo) << me_ << "process node "
             << current_node[i]->getId() << " thread " << omp_get_thread_num() << std::endl
             << me_ << "depth = " << current_node[i]->getDepth() << std::endl
@@ -1075,30 +1093,14 @@ void ParQGBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
           rel[i] = parNodeRlxr[i]->createNodeRelaxation(current_node[i],
                                                         dived_prev[i],
                                                         should_prune[i]);
-          // CAUTION: if parRel branching is not used, cuts are also not shared.
-          // Sharing pseudocosts must be separated from sharing cuts.
+          // cuts found by other threads, violated at the last LP point of
+          // this thread.
+          if (cutStore_) {
+            ConstSolutionPtr lpsol = nodePrcssr[i]->getSolution();
+            cutStore_->pull(rel[i], lpsol ? lpsol->getPrimal() : 0, i);
+          }
           for(UInt j = 0; j < numThreads; ++j) {
             if (i!=j) {
-              std::vector<ConstraintPtr > consVec = nodePrcssr[j]->getCutManager()->getPoolCons();
-              if (consVec.size() > 0) {
-                for (UInt k=cutsIndex[i*numThreads+j]; k < consVec.size(); ++k) {
-                  lf = consVec[k]->getLinearFunction();
-                  if (lf) {
-                    lfnew = (LinearFunctionPtr) new LinearFunction();
-                    for (VariableGroupConstIterator it=lf->termsBegin(); it!=lf->termsEnd();++it) {
-                      v = it->first;
-                      //transform the cut
-                      lfnew->addTerm(rel[i]->getRelaxationVar(rel[i]->getOriginalVar(v)),it->second); //rel[j] not needed
-                    }
-                    f = (FunctionPtr) new Function(lfnew);
-                    rel[i]->newConstraint(f, consVec[k]->getLb(),
-                                          consVec[k]->getUb(), consVec[k]->getName());
-                  }
-                }
-                cutsIndex[i*numThreads+j] = consVec.size();
-                consVec.clear();
-              }
-          
               if (isParRel) {
                 parRelBr = dynamic_cast <ParReliabilityBrancher*> (nodePrcssr[j]->getBrancher());
                 tmpTimesUp = parRelBr->getTimesUp();
@@ -1124,7 +1126,6 @@ void ParQGBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
           }
 
 #if SPEW
-#pragma omp critical (logger)
           logger_->msgStream(LogDebug1) << me_ << "node lower bound = " <<
             current_node[i]->getLb() << current_node[i]->getId() << " thread "
             << omp_get_thread_num()<< std::endl;
@@ -1139,7 +1140,6 @@ void ParQGBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
 
           if (should_prune[i]) {
 #if SPEW
-#pragma omp critical (logger)
             logger_->msgStream(LogInfo) << me_ << "prune node "
               << current_node[i]->getId() << " thread "
               << omp_get_thread_num() << std::endl;
@@ -1155,7 +1155,6 @@ void ParQGBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
               new_node[i] = tm_->getCandidate();
               if (new_node[i]) {
 #if SPEW
-#pragma omp critical (logger)
                 logger_->msgStream(LogDebug) << me_ << "get node (prune) "
                   << new_node[i]->getId() << " thread "
                   << omp_get_thread_num() << std::endl;
@@ -1169,7 +1168,6 @@ void ParQGBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
           } else {
             initialized[i] = true;
 #if SPEW
-#pragma omp critical (logger)
             logger_->msgStream(LogDebug) << me_ << "branch at node "
               << current_node[i]->getId() << " thread "
               << omp_get_thread_num() << std::endl;
@@ -1186,7 +1184,6 @@ void ParQGBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
             {
               new_node[i] = tm_->branch(branches[i], current_node[i], ws[i]);
 #if SPEW
-#pragma omp critical (logger)
               logger_->msgStream(LogDebug) << me_ << "get node (branch) "
                 << new_node[i]->getId() << " thread " << omp_get_thread_num()
                 << std::endl;
@@ -1206,7 +1203,6 @@ void ParQGBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
                 if (new_node[i]) {
                   tm_->removeActiveNode(new_node[i]);
 #if SPEW
-#pragma omp critical (logger)
                   logger_->msgStream(LogDebug) << me_ << "get/remove node "
                     << new_node[i]->getId() << " thread "
                     << omp_get_thread_num() << std::endl;
@@ -1248,9 +1244,11 @@ void ParQGBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
         if (minNodeLbTh[i] < treeLbTh[i]) {
           treeLbTh[i] = minNodeLbTh[i];
         }
+        if (timer_->query() - stats_->updateTime > options_->logInterval) {
 #pragma omp critical (logger)
-        {
-          showParStatus_(nodeCountTh[i], treeLbTh[i], wallTimeStart, i);
+          {
+            showParStatus_(nodeCountTh[i], treeLbTh[i], wallTimeStart, i);
+          }
         }
         if (shouldStopPar_(wallTimeStart, treeLbTh[i])) {
 #pragma omp critical (treeManager)
@@ -1298,7 +1296,6 @@ void ParQGBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
             status_ = SolvedInfeasible; // TODO: get the right status
           }
 #if SPEW
-#pragma omp critical (logger)
           logger_->msgStream(LogDebug) << me_ << "all nodes have "
             << "been processed" << std::endl;
 #endif
@@ -1308,14 +1305,12 @@ void ParQGBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
         } else if (notRampedUp && (nodeCount == numThreads)) {
           tm_->updateLb();
           notRampedUp = false;
-#pragma omp critical (logger)
           logger_->msgStream(LogExtraInfo) << me_
             << "ramp-up time = "
             << getWallTime() - wallTimeStart << std::endl;
           //shouldRun = false;
         } else {
 #if SPEW
-#pragma omp critical (logger)
           logger_->msgStream(LogDebug) << std::setprecision(8)
             << me_ << "lb = " << tm_->updateLb() << std::endl 
             << me_ << "ub = " << tm_->getUb() << std::endl;
@@ -1351,6 +1346,7 @@ void ParQGBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
   stats_->timeUsed = timer_->query();
   timer_->stop();
 
+  stopLog_();
   delete[] should_dive;
   delete[] dived_prev;
   delete[] should_prune;
@@ -1370,7 +1366,6 @@ void ParQGBranchAndBound::parsolve(ParNodeIncRelaxerPtr parNodeRlxr[],
   delete[] ws;
   delete[] rel;
   delete[] branches;
-  delete[] cutsIndex;
 }
 
 
@@ -1379,47 +1374,47 @@ void ParQGBranchAndBound::parsolveSync(ParNodeIncRelaxerPtr parNodeRlxr[],
                                  UInt numThreads, bool prune)
 {
   double wallTimeStart = getWallTime();
-  bool *should_dive = new bool[numThreads];
   bool *dived_prev = new bool[numThreads];
   bool *should_prune = new bool[numThreads];
   bool *initialized = new bool[numThreads];
+  bool *found_sol = new bool[numThreads];
   NodePtr *current_node = new NodePtr[numThreads]();
-  NodePtr *new_node = new NodePtr[numThreads];
-  Branches *branches = new Branches[numThreads];
   WarmStartPtr *ws = new WarmStartPtr[numThreads]();
   RelaxationPtr *rel = new RelaxationPtr[numThreads];
-  UInt nodeCount;
+  SolutionPoolPtr *thPool = new SolutionPoolPtr[numThreads]();
+  std::vector<std::vector<NodePtr> > work(numThreads);
+  std::vector<std::vector<Branches> > branches(numThreads);
+  std::vector<std::vector<WarmStartPtr> > wsRound(numThreads);
+  UIntVector offset(numThreads, 0);
+  UInt nodeCount, roundNodes, nodesBase;
   double treeLb, nodeLb, minNodeLb;
-  double *treeLbTh = new double[numThreads];
-  double *nodeLbTh = new double[numThreads];
-  double *minNodeLbTh = new double[numThreads];
-  bool *shouldRunTh = new bool[numThreads];
-  UInt *nodeCountTh = new UInt[numThreads];
   std::vector<ParCutMan*> cutman(numThreads);
-  //bool iterMode = env_->getOptions()->findBool("mcbnb_iter_mode")->getValue();
   UInt iterCount = 1;
-  UInt *cutsIndex = new UInt[numThreads*numThreads]();
   UInt numRelCons=0;
-  //UInt numVars = 0;
 
   omp_set_num_threads(numThreads);
-//#pragma omp parallel for
+  // cuts are not shared: the order in which threads publish them depends
+  // on timing.
+  if (cutStore_) {
+    delete cutStore_;
+    cutStore_ = 0;
+  }
   for(UInt i = 0; i < numThreads; ++i) {
     // declare cut manager
     cutman[i] = new ParCutMan(env_, problem_);
     nodePrcssr[i]->setCutManager(cutman[i]);
-    should_dive[i] = false;
     dived_prev[i] = false;
     should_prune[i] = false;
     initialized[i] = false;
-    shouldRunTh[i] = true;
-    nodeCountTh[i] = 1;
+    found_sol[i] = false;
   }
 
   // initialize timer
   timer_->start();
+  startLog_(numThreads);
 
-  logger_->msgStream(LogInfo) << me_ << "starting branch-and-bound ";
+  logger_->msgStream(LogInfo) << me_ << "starting deterministic "
+    << "branch-and-bound ";
   if(numThreads > 1) {
     logger_->msgStream(LogInfo) << "using " << numThreads << " out of "
       << omp_get_num_procs() << " processors";
@@ -1442,8 +1437,6 @@ void ParQGBranchAndBound::parsolveSync(ParNodeIncRelaxerPtr parNodeRlxr[],
   solPool_ = (SolutionPoolPtr) new SolutionPool(env_, problem_, 1);
 
   rel[0] = parNodeRlxr[0]->getRelaxation();
-  //std::cout << "root relaxation\n";
-  //rel[0]->write(std::cout);
   numRelCons = rel[0]->getNumCons();
   // call heuristics before the root, if needed
   for (HeurVector::iterator it=preHeurs_.begin(); it!=preHeurs_.end(); ++it) {
@@ -1484,283 +1477,223 @@ void ParQGBranchAndBound::parsolveSync(ParNodeIncRelaxerPtr parNodeRlxr[],
     nodeCount = 1;
   }
 
-  // solve root outside the loop. save the useful information.
-  bool shouldRun = true;
+  bool shouldRun = (nodeCount > 0 && SolvedOptimal != status_ &&
+                    SolvedGapLimit != status_ &&
+                    TimeLimitReached != status_);
   initialized[0] = true; //pseudoCosts for thread0 initialized while doing root
-  //numVars = rel[0]->getNumVars();
 
-  // memory leak check: remove later
-  if (numThreads > 1) {
-    for (UInt i=1; i < numThreads; i++) {
-      if (current_node[i]) {
-        assert(!"Memory leak (fake node) non-master thread\n");
-      }
-    }
+  // every thread finds solutions in its own pool during a round, so that
+  // pruning in a round does not depend on the timing of other threads.
+  for (UInt i = 0; i < numThreads; ++i) {
+    thPool[i] = (SolutionPoolPtr) new SolutionPool(env_, problem_, 1);
   }
 
+  // Each iteration of the loop is a round, see ParBranchAndBound. Cuts are
+  // added by each thread to its own relaxation, and removed when the thread
+  // leaves a node.
   while ((nodeCount > 0 || tm_->anyActiveNodesLeft()) && shouldRun) {
 
     // NODE ASSIGNMENT
-#pragma omp for
-      for(UInt i = 0; i < numThreads; ++i) {
-        if (current_node[i]) {
-#pragma omp critical (treeManager)
-          {
-            if (tm_->shouldPrune_(current_node[i])) {
-              parNodeRlxr[i]->reset(current_node[i], false);
-              removeAddedCons(rel[i], numRelCons);
-#if SPEW
-              logger_->msgStream(LogInfo) << me_ << "prune node "
-                << current_node[i]->getId() << " thread "
-                << omp_get_thread_num() << std::endl;
-#endif
-              tm_->pruneNode(current_node[i]);
-              current_node[i] = NodePtr();
-            }
-          }
-        } else {
-#pragma omp critical (treeManager)
-          {
-            current_node[i] = tm_->getCandidate();
-            if (current_node[i]) {
+    roundNodes = (tm_->getActiveNodes() + numThreads - 1) / numThreads;
+    roundNodes = std::max((UInt) 1, std::min(options_->roundNodes,
+                                             roundNodes));
+    for (UInt i = 0; i < numThreads; ++i) {
+      work[i].clear();
+      if (current_node[i]) {
+        if (tm_->shouldPrune_(current_node[i])) {
+          parNodeRlxr[i]->reset(current_node[i], false);
+          removeAddedCons(rel[i], numRelCons);
 #if SPEW
-#pragma omp critical (logger)
-            logger_->msgStream(LogInfo) << "assign node "
-              << current_node[i]->getId() << " score "
-              << (long int)current_node[i]->getTbScore() << " lb "
-              << std::setprecision(9) << current_node[i]->getLb() << " thread "
-              << omp_get_thread_num() << std::endl;
+          logger_->msgStream(LogInfo) << me_ << "prune node "
+            << current_node[i]->getId() << " thread " << i << std::endl;
 #endif
-              tm_->removeActiveNode(current_node[i]);
-
-            }
-          }
+          tm_->pruneNode(current_node[i]);
           dived_prev[i] = false;
+        } else {
+          work[i].push_back(current_node[i]);
         }
-      } //for end
-
-      // PARALLEL REGION STARTS
-#pragma omp parallel
-    {
-      // NODE SOLVING
-#pragma omp for
+        current_node[i] = NodePtr();
+      } else {
+        dived_prev[i] = false;
+      }
+    }
+    for (UInt r = 0; r < roundNodes; ++r) {
       for (UInt i = 0; i < numThreads; ++i) {
-        // this is a bad way, correct the process() function later
-        UIntVector tmpTimesUp, tmpTimesDown, timesUp, timesDown;
-        DoubleVector pseudoUp, pseudoDown;
+        if (work[i].size() <= r) {
+          NodePtr node = tm_->getCandidate();
+          if (!node) {
+            break;
+          }
+          tm_->removeActiveNode(node);
+          work[i].push_back(node);
+        }
+      }
+    }
+    nodesBase = stats_->nodesProc;
+    for (UInt i = 0; i < numThreads; ++i) {
+      offset[i] = (i > 0) ? offset[i-1] + work[i-1].size() : 0;
+      branches[i].assign(work[i].size(), (Branches) 0);
+      wsRound[i].assign(work[i].size(), (WarmStartPtr) 0);
+      found_sol[i] = false;
+      if (thPool[i]->getBestSolutionValue() >
+          solPool_->getBestSolutionValue()) {
+        thPool[i]->addSolution(solPool_->getBestSolution());
+      }
+    }
 
-        if (current_node[i]) {
-          should_dive[i] = false;
+    // NODE SOLVING
+#pragma omp parallel for schedule(static, 1)
+    for (UInt i = 0; i < numThreads; ++i) {
+      UIntVector timesUp, timesDown;
+      DoubleVector pseudoUp, pseudoDown;
+      bool prune_node;
 
-          rel[i] = parNodeRlxr[i]->createNodeRelaxation(current_node[i],
-                                                        dived_prev[i],
-                                                        should_prune[i]);
-#if SPEW
-#pragma omp critical (logger)
-          logger_->msgStream(LogInfo) << me_ << "process node "
-            << current_node[i]->getId() << " score "
-            << (long int)current_node[i]->getTbScore() << " lb "
-            << std::setprecision(9) << current_node[i]->getLb()
-            << " thread " << omp_get_thread_num() << std::endl;
-#endif
-          nodePrcssr[i]->process(current_node[i], rel[i], solPool_,
-                                 initialized[i], timesUp, timesDown,
-                                 pseudoUp, pseudoDown, stats_->nodesProc);
-#pragma omp critical (stats)
-          ++stats_->nodesProc;
-        } //if current_node[i]
-      } //for ends
+      for (UInt j = 0; j < work[i].size(); ++j) {
+        NodePtr node = work[i][j];
+        bool last = (j+1 == work[i].size());
 
-#pragma omp single
-      {
-        for (UInt i = 0; i < numThreads; ++i) {
-          if (current_node[i]) {
-            if (nodePrcssr[i]->foundNewSolution()) {
+        rel[i] = parNodeRlxr[i]->createNodeRelaxation(node,
+                                                      (0 == j &&
+                                                       dived_prev[i]),
+                                                      should_prune[i]);
 #if SPEW
-              logger_->msgStream(LogInfo) << me_ << "found sol at "
-                << current_node[i]->getId() << " score "
-                << (long int)current_node[i]->getTbScore() << " thread "
-                << omp_get_thread_num() << std::endl;
+        logger_->msgStream(LogInfo) << me_ << "process node "
+          << node->getId() << " score "
+          << (long int)node->getTbScore() << " lb "
+          << std::setprecision(9) << node->getLb()
+          << " thread " << i << std::endl;
 #endif
-              tm_->setUb(solPool_->getBestSolutionValue());
-            }
-          } //if current_node[i]
-        } //for ends
-        // Check if node can be pruned after ub update
-        for (UInt i = 0; i < numThreads; ++i) {
-          if (current_node[i]) {
-            should_prune[i] = shouldPrune_(current_node[i]);
-            if (!should_prune[i]) {
-              should_prune[i] = tm_->shouldPrune_(current_node[i]);
-            }
+        nodePrcssr[i]->process(node, rel[i], thPool[i], initialized[i],
+                               timesUp, timesDown, pseudoUp, pseudoDown,
+                               nodesBase + offset[i] + j);
+        if (nodePrcssr[i]->foundNewSolution()) {
+          found_sol[i] = true;
+        }
+        prune_node = shouldPrune_(node);
+        if (!prune_node) {
+          initialized[i] = true;
+          // the processor reuses its branches and warm start for the
+          // next node, keep copies until the end of the round.
+          branches[i][j] = new BranchPtrVector(*(nodePrcssr[i]->
+                                                 getBranches()));
+          wsRound[i][j] = nodePrcssr[i]->getWarmStart();
+          if (wsRound[i][j]) {
+            wsRound[i][j]->incrUseCnt();
           }
         }
+        if (prune_node || !last || !tm_->shouldDive()) {
+          parNodeRlxr[i]->reset(node, false);
+          removeAddedCons(rel[i], numRelCons);
+        }
       }
-      // BRANCHING SYNCHRONIZATION
-#pragma omp for
-      for (UInt i = 0; i < numThreads; ++i) {
-        if (current_node[i]) {
-          if (should_prune[i]) {
-#if SPEW
-#pragma omp critical (logger)
-            logger_->msgStream(LogInfo) << me_ << "prune node "
-              << current_node[i]->getId() << " score "
-              << (long int)current_node[i]->getTbScore() << std::setprecision(9)
-              << " lb " << current_node[i]->getLb() << " thread "
-              << omp_get_thread_num() << std::endl;
-#endif
-            parNodeRlxr[i]->reset(current_node[i], false);
-            removeAddedCons(rel[i], numRelCons);
-
-#pragma omp critical (treeManager)
-            {
-              tm_->pruneNode(current_node[i]);
-              new_node[i] = NodePtr();
-              //current_node[i] = NodePtr();
-            }
-            dived_prev[i] = false;
-//#pragma omp critical (treeManager)
-            //{
-              //new_node[i] = tm_->getCandidate();
-              //if (new_node[i]) {
-                ////getting and removing node must be in the same critical
-                ////block otherwise some other thread might take the same node
-                //tm_->removeActiveNode(new_node[i]);
-              //}
-            //}
-          } else {
-            initialized[i] = true;
-#if SPEW
-#pragma omp critical (logger)
-            logger_->msgStream(LogInfo) << me_ << "branch at node "
-              << current_node[i]->getId() << " score "
-              << (long int)current_node[i]->getTbScore() << std::setprecision(9)
-              << " lb " << current_node[i]->getLb() << " thread "
-              << omp_get_thread_num() << std::endl;
-
-#endif
-            branches[i] = nodePrcssr[i]->getBranches();
+    } //parallel for ends
 
-            ws[i] = nodePrcssr[i]->getWarmStart();
-            should_dive[i] = tm_->shouldDive();
-            assert(branches[i]);
-#pragma omp critical (treeManager)
-            {
-              new_node[i] = tm_->branch(branches[i], current_node[i], ws[i]);
-#if SPEW
-#pragma omp critical (logger)
-              logger_->msgStream(LogInfo) << me_ << "get node "
-                << new_node[i]->getId() << " score "
-                << (long int)new_node[i]->getTbScore() << std::setprecision(9)
-                << " lb " << new_node[i]->getLb() << " (branch) thread "
-                << omp_get_thread_num() << std::endl;
-#endif
-            }
-            assert((should_dive[i] && new_node[i])
-                   || (!should_dive[i] && !new_node[i]));
-            if (should_dive[i]) {
+    // MERGE, in the order of threads and nodes.
+    for (UInt i = 0; i < numThreads; ++i) {
+      if (found_sol[i] && thPool[i]->getBestSolutionValue() <
+          solPool_->getBestSolutionValue()) {
+        solPool_->addSolution(thPool[i]->getBestSolution());
+      }
+    }
+    tm_->setUb(solPool_->getBestSolutionValue());
+    for (UInt i = 0; i < numThreads; ++i) {
+      dived_prev[i] = false;
+      for (UInt j = 0; j < work[i].size(); ++j) {
+        NodePtr node = work[i][j];
+        bool last = (j+1 == work[i].size());
+        ++stats_->nodesProc;
+        if (branches[i][j] && tm_->shouldPrune_(node)) {
+          // a solution of another thread in this round prunes it.
+          delete branches[i][j];
+          branches[i][j] = 0;
+          if (last && tm_->shouldDive()) {
+            parNodeRlxr[i]->reset(node, false);
+            removeAddedCons(rel[i], numRelCons);
+          }
+        }
+        if (!branches[i][j]) {
+          tm_->pruneNode(node);
+        } else {
+          NodePtr child = tm_->branch(branches[i][j], node, wsRound[i][j]);
+          if (last && tm_->shouldDive()) {
+            if (child) {
+              current_node[i] = child;
               dived_prev[i] = true;
             } else {
-              parNodeRlxr[i]->reset(current_node[i], false);
+              parNodeRlxr[i]->reset(node, false);
               removeAddedCons(rel[i], numRelCons);
-#pragma omp critical (treeManager)
-              {
-                new_node[i] = tm_->getCandidate(); // Can be NULL. The
-                // branches that were created could have large lb and tm
-                // might have eliminated them.
-                if (new_node[i]) {
-                  tm_->removeActiveNode(new_node[i]);
-#if SPEW
-#pragma omp critical (logger)
-              logger_->msgStream(LogInfo) << me_ << "get node "
-                << new_node[i]->getId() << " score "
-                << (long int)new_node[i]->getTbScore() << " lb " <<
-                current_node[i]->getLb() << " (prune) thread "
-                << omp_get_thread_num() << std::endl;
-#endif
-                }
-              }
-              dived_prev[i] = false;
-            }
-          }
-          current_node[i] = new_node[i];
-        } // if (current_node[i]) ends
-      } //parallel for end
-
-#pragma omp single
-      {
-        iterCount++;
-        nodeCount = 0;
-        treeLb = tm_->updateLb();
-        minNodeLb = INFINITY;
-        for (UInt j = 0; j < numThreads; ++j) {
-          if (current_node[j]) {
-            nodeCount++;
-            nodeLb = current_node[j]->getLb();
-            if (nodeLb < minNodeLb) {
-              minNodeLb = nodeLb;
             }
           }
+          delete branches[i][j];
         }
-        if (minNodeLb < treeLb) {
-          treeLb = minNodeLb;
+        if (wsRound[i][j]) {
+          wsRound[i][j]->decrUseCnt();
+          if (0 == wsRound[i][j]->getUseCnt()) {
+            delete wsRound[i][j];
+          }
         }
-        showParStatus_(nodeCount, treeLb, wallTimeStart, 0);
+      }
+    }
 
-        // update stopping conditions
-        if (nodeCount == 0 && !(tm_->anyActiveNodesLeft())) {
-          tm_->updateLb();
-          if (tm_->getUb() <= -INFINITY) {
-            status_ = SolvedUnbounded;
-          } else if (tm_->getUb() < INFINITY) {
-            status_ = SolvedOptimal; // TODO: get the right status
-          } else {
-            status_ = SolvedInfeasible; // TODO: get the right status
-          }
-#if SPEW
-#pragma omp critical (logger)
-          logger_->msgStream(LogDebug) << me_ << "all nodes have "
-            << "been processed" << std::endl;
-#endif
-        } else if (shouldStopPar_(wallTimeStart, treeLb)) {
-          tm_->updateLb();
-          shouldRun = false;
-        } else {
+    ++iterCount;
+    nodeCount = 0;
+    treeLb = tm_->updateLb();
+    minNodeLb = INFINITY;
+    for (UInt j = 0; j < numThreads; ++j) {
+      if (current_node[j]) {
+        nodeCount++;
+        nodeLb = current_node[j]->getLb();
+        if (nodeLb < minNodeLb) {
+          minNodeLb = nodeLb;
+        }
+      }
+    }
+    if (minNodeLb < treeLb) {
+      treeLb = minNodeLb;
+    }
+    showParStatus_(nodeCount, treeLb, wallTimeStart, 0);
+
+    // update stopping conditions
+    if (nodeCount == 0 && !(tm_->anyActiveNodesLeft())) {
+      tm_->updateLb();
+      if (tm_->getUb() <= -INFINITY) {
+        status_ = SolvedUnbounded;
+      } else if (tm_->getUb() < INFINITY) {
+        status_ = SolvedOptimal; // TODO: get the right status
+      } else {
+        status_ = SolvedInfeasible; // TODO: get the right status
+      }
 #if SPEW
-#pragma omp critical (logger)
-          logger_->msgStream(LogDebug) << std::setprecision(8)
-            << me_ << "lb = " << tm_->updateLb() << std::endl
-            << me_ << "ub = " << tm_->getUb() << std::endl;
+      logger_->msgStream(LogDebug) << me_ << "all nodes have "
+        << "been processed" << std::endl;
 #endif
-        }
-      } //omp master/single ended
-    }   //parallel region ends
+    } else if (shouldStopPar_(wallTimeStart, treeLb)) {
+      tm_->updateLb();
+      shouldRun = false;
+    }
   }     //while ends
   logger_->msgStream(LogInfo) << me_ << "stopping branch-and-bound"
     << std::endl
     << me_ << "nodes processed = " << stats_->nodesProc << std::endl
     << me_ << "nodes created   = " << tm_->getSize() << std::endl
-    << me_ << "iterations = " << iterCount << std::endl;
+    << me_ << "rounds = " << iterCount << std::endl;
   solPool_->writeStats(logger_->msgStream(LogExtraInfo));
 
   stats_->timeUsed = timer_->query();
   timer_->stop();
 
-  delete[] should_dive;
+  stopLog_();
+  for (UInt i = 0; i < numThreads; ++i) {
+    delete thPool[i];
+  }
   delete[] dived_prev;
   delete[] should_prune;
   delete[] initialized;
+  delete[] found_sol;
   delete[] current_node;
-  delete[] new_node;
-  delete[] nodeCountTh;
-  delete[] treeLbTh;
-  delete[] nodeLbTh;
-  delete[] minNodeLbTh;
-  delete[] shouldRunTh;
   delete[] ws;
   delete[] rel;
-  delete[] branches;
-  delete[] cutsIndex;
+  delete[] thPool;
 }
 
 
@@ -1776,6 +1709,14 @@ void ParQGBranchAndBound::writeStats(std::ostream &out)
     (*it)->writeStats(out);
   }
   solPool_->writeStats(out);
+  env_->getProfiler()->writeStats(out);
+}
+
+void ParQGBranchAndBound::writeCutStats(std::ostream &out) const
+{
+  if (cutStore_) {
+    cutStore_->writeStats(out);
+  }
 }
 
 void ParQGBranchAndBound::writeParStats(std::ostream &out, ParPCBProcessorPtr nodePrcssr[])
@@ -1787,10 +1728,12 @@ void ParQGBranchAndBound::writeParStats(std::ostream &out, ParPCBProcessorPtr no
   //Amend code below when mcqg statistics are finalized: to be done!!!
   nodePrcssr[0]->writeStats(out);
   nodePrcssr[0]->getBrancher()->writeStats(out);
+  writeCutStats(out);
   for (HeurVector::iterator it=preHeurs_.begin(); it!=preHeurs_.end(); ++it) {
     (*it)->writeStats(out);
   }
   solPool_->writeStats(out);
+  env_->getProfiler()->writeStats(out);
 }
 
 double ParQGBranchAndBound::totalTime()
@@ -1814,8 +1757,12 @@ double ParQGBranchAndBound::totalTime()
 // --------------------------------------------------------------------------
   ParQGBabOptions::ParQGBabOptions()
 : createRoot(true),
+  cutStoreSize(100000),
+  logBuffer(false),
   nodeLimit(0),
   perGapLimit(0.),
+  roundNodes(4),
+  shareCuts(true),
   solLimit(0),
   timeLimit(0.)
 
@@ -1827,9 +1774,13 @@ ParQGBabOptions::ParQGBabOptions(EnvPtr env)
 {
   OptionDBPtr options = env->getOptions();
 
+  logBuffer   = options->findBool("bnbpar_log_buffer")->getValue();
   logInterval = options->findDouble("log_interval")->getValue();
   nodeLimit   = options->findInt("node_limit")->getValue();
   perGapLimit = options->findDouble("obj_gap_percent")->getValue();
+  roundNodes  = options->findInt("bnbpar_round_nodes")->getValue();
+  shareCuts   = options->findBool("bnbpar_share_cuts")->getValue();
+  cutStoreSize = options->findInt("bnbpar_cut_store_size")->getValue();
   solLimit    = options->findInt("sol_limit")->getValue();
   timeLimit   = options->findDouble("time_limit")->getValue();
   createRoot  = true;
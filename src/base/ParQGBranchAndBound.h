@@ -23,10 +23,12 @@ namespace Minotaur {
   class   Engine;
   class   NodeProcessor;
   class   NodeRelaxer;
+  class   ParCutStore;
   class   ParNodeIncRelaxer;
   class   ParPCBProcessor;
   class   ParTreeManager;
   class   Problem;
+  class   RingLogger;
   class   Solution;
   class   SolutionPool;
   class   WarmStart;
@@ -176,6 +178,10 @@ namespace Minotaur {
     /**
      * \brief Branch-and-bound solver with reproducibility of results.
      *
+     * Nodes are processed in rounds as in ParBranchAndBound::parsolveSync().
+     * Cuts found by a thread are kept in its relaxation while it processes
+     * a node and are not shared.
+     *
      * \param [in] parNodeRelaxer is the array of node relaxers.
      * \param [in] parPCBProcessor is the array of node processors.
      * \param [in] nThreads is the number of threads being used.
@@ -198,6 +204,10 @@ namespace Minotaur {
     /// Write statistics to the ostream out
     void writeStats(std::ostream & out);
 
+    /// Write number of cuts shared and rediscovered by threads, if cuts
+    /// were shared.
+    void writeCutStats(std::ostream & out) const;
+
     /// Write statistics of parallel algorithm to the ostream out
     void writeParStats(std::ostream & out,
                        ParPCBProcessorPtr parPCBProcessor[]);
@@ -216,12 +226,19 @@ namespace Minotaur {
     }
 
   private:
+    /// Cuts shared by threads. NULL if cuts are not shared.
+    ParCutStore *cutStore_;
+
     /// Pointer to the enviroment.
     EnvPtr env_;
 
     /// Log manager for displaying messages.
     LoggerPtr logger_;
 
+    /// Lock-free logger used by threads in parallel regions. NULL when no
+    /// parallel solve is running.
+    RingLogger *ringLog_;
+
     /// String name used in log messages.
     static const std::string me_;
 
@@ -292,6 +309,17 @@ namespace Minotaur {
     /// Return True if a node can be pruned.
     bool shouldPrune_(NodePtr node);
 
+    /**
+     * \brief Make threads write log messages to a RingLogger, which is
+     * flushed by a background thread if option bnbpar_log_buffer is set.
+     *
+     * \param [in] nthreads Number of threads.
+     */
+    void startLog_(UInt nthreads);
+
+    /// Write all buffered log messages and restore the logger.
+    void stopLog_();
+
     /**
      * \brief Check whether the branch-and-bound can stop because of time
      * limit, or node limit or if solved?
@@ -363,6 +391,13 @@ namespace Minotaur {
      */
     bool createRoot;
 
+    /// Maximum number of cuts in the store shared by threads.
+    UInt cutStoreSize;
+
+    /// If true, buffer log messages of threads and write them from a
+    /// background thread.
+    bool logBuffer;
+
     /// Time in seconds between status updates of the progress.
     double logInterval;
 
@@ -378,6 +413,13 @@ namespace Minotaur {
      */
      double perGapLimit;
 
+    /// Maximum number of nodes processed by a thread in a round of the
+    /// deterministic mode.
+    UInt roundNodes;
+
+    /// If true, threads share globally valid cuts through a ParCutStore.
+    bool shareCuts;
+
     /// Limit on number of nodes processed.
     UInt solLimit;
 
@@ -175,10 +175,7 @@ void ParQGHandler::cutIntSol_(ConstSolutionPtr sol, CutManager *cutMan,
     {
       ++(stats_->nlpF);
       double nlpval = nlpe_->getSolutionValue();
-#pragma omp critical (solPool)
-      {
-       updateUb_(s_pool, nlpval, sol_found);
-      }
+      updateUb_(s_pool, nlpval, sol_found);
       if ((relobj_ >= nlpval-objATol_) ||
           (nlpval != 0 && (relobj_ >= nlpval-fabs(nlpval)*objRTol_))) {
           *status = SepaPrune;
@@ -199,10 +199,7 @@ void ParQGHandlerAdvance::cutIntSol_(const double *lpx, CutManager *cutMan,
     {
       ++(stats_->nlpF);
       double nlpval = nlpe_->getSolutionValue();
-#pragma omp critical (solPool)
-      {
-        updateUb_(s_pool, nlpval, sol_found);
-      }
+      updateUb_(s_pool, nlpval, sol_found);
       if ((relobj_ >= nlpval-objAbsTol_) ||
           (nlpval != 0 && (relobj_ >= nlpval-fabs(nlpval)*objRelTol_))) {
           *status = SepaPrune;
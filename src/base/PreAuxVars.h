@@ -21,6 +21,8 @@ namespace Minotaur {
 
 class PreAuxVars : public PreMod {
 public:
+  friend class ProbSnapshot;
+
   /// Constructor.
   PreAuxVars();
 
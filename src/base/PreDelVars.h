@@ -21,6 +21,8 @@ namespace Minotaur {
 
   class PreDelVars : public PreMod {
     public:
+      friend class ProbSnapshot;
+
       /// Constructor
       PreDelVars();
 
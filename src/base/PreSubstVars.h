@@ -27,6 +27,8 @@ struct PreSubstVarData {
 
 class PreSubstVars : public PreMod {
 public:
+  friend class ProbSnapshot;
+
   /// Constructor.
   PreSubstVars();
 
@@ -12,6 +12,7 @@
 #include <cmath>
 
 #include "MinotaurConfig.h"
+#include "CliqueTable.h"
 #include "Constraint.h"
 #include "Environment.h"
 #include "Function.h"
@@ -24,6 +25,7 @@
 #include "PreMod.h"
 #include "Presolver.h"
 #include "Problem.h"
+#include "Profiler.h"
 #include "Solution.h"
 #include "Variable.h"
 
@@ -107,7 +109,10 @@ SolveStatus Presolver::solve()
     logger_->msgStream(LogDebug) << me_ << "major iteration " << iters << std::endl;
     for (HandlerIterator h = handlers_.begin(); h != handlers_.end(); ++h) {
       changed = false;
-      h_status = (*h)->presolve(&mods_, &changed, &sol_);
+      {
+        ProfScope scope(env_->getProfiler(), ZonePresolve);
+        h_status = (*h)->presolve(&mods_, &changed, &sol_);
+      }
       if (h_status == SolvedOptimal) {
         logger_->msgStream(LogDebug) << me_ << "handler " << (*h)->getName()
                                      << " found an optimal solution "
@@ -181,6 +186,17 @@ SolveStatus Presolver::solve()
   }
 
   problem_->classifyCon();
+
+  if (Finished == status_ &&
+      true == env_->getOptions()->findBool("clique_table")->getValue()) {
+    CliqueTable *cliques = new CliqueTable(env_, problem_);
+    cliques->build();
+    if (cliques->isEmpty()) {
+      delete cliques;
+    } else {
+      problem_->setCliqueTable(cliques);
+    }
+  }
   return status_;
 }
 
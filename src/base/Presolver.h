@@ -38,6 +38,9 @@ namespace Minotaur {
     */
   class Presolver {
   public:
+    /// ProbSnapshot saves and restores the postsolve modifications.
+    friend class ProbSnapshot;
+
     /// Default constructor.
     Presolver ();
 
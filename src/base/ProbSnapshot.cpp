@@ -0,0 +1,827 @@
+//
+//    Minotaur -- It's only 1/2 bull
+//
+//    (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file ProbSnapshot.cpp
+ * \brief Write and read binary snapshots of presolved problems.
+ * \author The Minotaur Team
+ */
+
+#include <cmath>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <stack>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "MinotaurConfig.h"
+#include "CGraph.h"
+#include "CNode.h"
+#include "Constraint.h"
+#include "Environment.h"
+#include "Function.h"
+#include "LinearFunction.h"
+#include "Logger.h"
+#include "Objective.h"
+#include "PreAuxVars.h"
+#include "PreDelVars.h"
+#include "PreSubstVars.h"
+#include "Presolver.h"
+#include "Problem.h"
+#include "ProbSnapshot.h"
+#include "QuadraticFunction.h"
+#include "SOS.h"
+#include "Variable.h"
+
+using namespace Minotaur;
+
+const std::string ProbSnapshot::me_ = "ProbSnapshot: ";
+const std::uint32_t ProbSnapshot::version_ = 1;
+
+namespace {
+  const char snapMagic[8] = {'M', 'N', 'T', 'R', 'S', 'N', 'A', 'P'};
+  const std::uint32_t snapEndian = 0x01020304;
+
+  // Tags for the postsolve modifications.
+  const std::uint32_t snapDelVars = 1;
+  const std::uint32_t snapSubstVars = 2;
+  const std::uint32_t snapAuxVars = 3;
+
+  // Flags for the parts of a function.
+  const std::uint8_t snapLf = 1;
+  const std::uint8_t snapQf = 2;
+  const std::uint8_t snapNlf = 4;
+
+  template <class T> void put(std::ostream &out, T v)
+  {
+    out.write(reinterpret_cast<const char *>(&v), sizeof(T));
+  }
+
+  template <class T> void putArr(std::ostream &out, const std::vector<T> &v)
+  {
+    if (!v.empty()) {
+      out.write(reinterpret_cast<const char *>(&v[0]), sizeof(T)*v.size());
+    }
+  }
+}
+
+
+ProbSnapshot::ProbSnapshot(EnvPtr env)
+: env_(env),
+  objSense_(1.0)
+{
+}
+
+
+ProbSnapshot::~ProbSnapshot()
+{
+  // mods_ are handed over to the presolver in getPresolver(). If that was
+  // never called, free them here.
+  for (std::deque<PreMod *>::iterator it=mods_.begin(); it!=mods_.end();
+       ++it) {
+    delete *it;
+  }
+  for (VarVector::iterator it=origVars_.begin(); it!=origVars_.end(); ++it) {
+    delete *it;
+  }
+  for (VarVector::iterator it=remVars_.begin(); it!=remVars_.end(); ++it) {
+    delete *it;
+  }
+}
+
+
+PresolverPtr ProbSnapshot::getPresolver(ProblemPtr p)
+{
+  PresolverPtr pres = new Presolver(p, env_, HandlerVector());
+  pres->mods_.insert(pres->mods_.end(), mods_.begin(), mods_.end());
+  mods_.clear();
+  return pres;
+}
+
+
+// ----------------------------------------------------------------------
+// Reading
+// ----------------------------------------------------------------------
+
+namespace {
+  template <class T> T get(const char *&b, const char *e, bool &bad)
+  {
+    T v = T();
+    if (bad || b + sizeof(T) > e) {
+      bad = true;
+    } else {
+      std::memcpy(&v, b, sizeof(T));
+      b += sizeof(T);
+    }
+    return v;
+  }
+
+  // Return a pointer to n objects of type T in the mapped file. The file is
+  // not guaranteed to be aligned for T, so values are memcpy-ed on use.
+  template <class T> const char *getArr(const char *&b, const char *e,
+                                        std::uint64_t n, bool &bad)
+  {
+    const char *a = b;
+    if (bad || n > (std::uint64_t)(e - b)/sizeof(T)) {
+      bad = true;
+      return 0;
+    }
+    b += n*sizeof(T);
+    return a;
+  }
+
+  template <class T> T at(const char *a, std::uint64_t i)
+  {
+    T v;
+    std::memcpy(&v, a + i*sizeof(T), sizeof(T));
+    return v;
+  }
+}
+
+
+ProblemPtr ProbSnapshot::read(const std::string fname, int &err)
+{
+  int fd;
+  struct stat st;
+  void *map = MAP_FAILED;
+  char *buf = 0;
+  const char *data = 0;
+  ProblemPtr p = 0;
+  Cursor c;
+
+  err = 0;
+  fd = open(fname.c_str(), O_RDONLY);
+  if (fd < 0 || fstat(fd, &st) != 0) {
+    env_->getLogger()->errStream() << me_ << "could not open file " << fname
+                                   << std::endl;
+    if (fd >= 0) {
+      close(fd);
+    }
+    err = 1;
+    return 0;
+  }
+
+  if (st.st_size > 0) {
+    map = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  if (MAP_FAILED != map) {
+#ifdef MADV_SEQUENTIAL
+    madvise(map, st.st_size, MADV_SEQUENTIAL);
+#endif
+    data = static_cast<const char *>(map);
+  } else if (st.st_size > 0) {
+    // fall back to reading the whole file.
+    std::ifstream in(fname.c_str(), std::ios::binary);
+    buf = new char[st.st_size];
+    in.read(buf, st.st_size);
+    if (in.gcount() == st.st_size) {
+      data = buf;
+    }
+  }
+  close(fd);
+
+  if (!data) {
+    env_->getLogger()->errStream() << me_ << "could not read file " << fname
+                                   << std::endl;
+    err = 1;
+  } else {
+    c.b = data;
+    c.e = data + st.st_size;
+    c.bad = false;
+    p = read_(c, err);
+    if (err) {
+      env_->getLogger()->errStream() << me_ << fname
+                                     << " is not a valid snapshot"
+                                     << std::endl;
+    }
+  }
+
+  if (MAP_FAILED != map) {
+    munmap(map, st.st_size);
+  }
+  if (buf) {
+    delete [] buf;
+  }
+  return p;
+}
+
+
+ProblemPtr ProbSnapshot::read_(Cursor &c, int &err)
+{
+  char magic[8];
+  std::uint64_t n, m;
+  double lb, ub;
+  std::int32_t vt, st;
+  std::string name;
+  ProblemPtr p = 0;
+  FunctionPtr f;
+  ObjectiveType otyp;
+  double cb;
+
+  for (UInt i=0; i<8; ++i) {
+    magic[i] = get<char>(c.b, c.e, c.bad);
+  }
+  if (c.bad || 0 != std::memcmp(magic, snapMagic, 8) ||
+      get<std::uint32_t>(c.b, c.e, c.bad) != snapEndian) {
+    err = 1;
+    return 0;
+  }
+  if (get<std::uint32_t>(c.b, c.e, c.bad) != version_) {
+    env_->getLogger()->errStream() << me_ << "snapshot was written by a "
+                                   << "different version" << std::endl;
+    err = 1;
+    return 0;
+  }
+  objSense_ = get<double>(c.b, c.e, c.bad);
+
+  p = (ProblemPtr) new Problem(env_);
+
+  // variables
+  n = get<std::uint64_t>(c.b, c.e, c.bad);
+  for (std::uint64_t i=0; i<n && !c.bad; ++i) {
+    lb = get<double>(c.b, c.e, c.bad);
+    ub = get<double>(c.b, c.e, c.bad);
+    vt = get<std::int32_t>(c.b, c.e, c.bad);
+    st = get<std::int32_t>(c.b, c.e, c.bad);
+    name = readStr_(c);
+    if (!c.bad) {
+      p->newVariable(lb, ub, (VariableType) vt, name, (VarSrcType) st);
+    }
+  }
+
+  // objective
+  if (!c.bad && 1 == get<std::uint8_t>(c.b, c.e, c.bad)) {
+    otyp = (ObjectiveType) get<std::int32_t>(c.b, c.e, c.bad);
+    cb = get<double>(c.b, c.e, c.bad);
+    name = readStr_(c);
+    f = readFun_(c, p, err);
+    if (!c.bad && 0 == err) {
+      if (f) {
+        p->newObjective(f, cb, otyp, name);
+      } else {
+        p->newObjective(cb, otyp);
+      }
+    }
+  }
+
+  // constraints
+  m = get<std::uint64_t>(c.b, c.e, c.bad);
+  for (std::uint64_t i=0; i<m && !c.bad && 0==err; ++i) {
+    lb = get<double>(c.b, c.e, c.bad);
+    ub = get<double>(c.b, c.e, c.bad);
+    name = readStr_(c);
+    f = readFun_(c, p, err);
+    if (!c.bad && 0 == err) {
+      p->newConstraint(f, lb, ub, name);
+    } else if (f) {
+      delete f;
+    }
+  }
+
+  // SOS
+  m = get<std::uint64_t>(c.b, c.e, c.bad);
+  for (std::uint64_t i=0; i<m && !c.bad; ++i) {
+    std::int32_t typ = get<std::int32_t>(c.b, c.e, c.bad);
+    std::int32_t pri = get<std::int32_t>(c.b, c.e, c.bad);
+    std::uint32_t nz = get<std::uint32_t>(c.b, c.e, c.bad);
+    const char *wts = getArr<double>(c.b, c.e, nz, c.bad);
+    const char *inds = getArr<std::uint32_t>(c.b, c.e, nz, c.bad);
+    name = readStr_(c);
+    if (!c.bad) {
+      DoubleVector w(nz);
+      VarVector vars(nz);
+      for (std::uint32_t j=0; j<nz; ++j) {
+        w[j] = at<double>(wts, j);
+        if (at<std::uint32_t>(inds, j) >= p->getNumVars()) {
+          c.bad = true;
+          break;
+        }
+        vars[j] = p->getVariable(at<std::uint32_t>(inds, j));
+      }
+      if (!c.bad) {
+        p->newSOS(nz, (SOSType) typ, nz ? &w[0] : 0, vars, pri, name);
+      }
+    }
+  }
+
+  if (!c.bad && 0 == err) {
+    err = readMods_(c);
+  }
+  if (!c.bad && 0 == err) {
+    err = readOrigVars_(c);
+  }
+
+  if (c.bad || err) {
+    err = 1;
+    delete p;
+    p = 0;
+  }
+  return p;
+}
+
+
+CGraph *ProbSnapshot::readCGraph_(Cursor &c, ProblemPtr p, int &err)
+{
+  std::uint32_t nnodes, nchild, vind, out;
+  std::int32_t op;
+  double d;
+  CGraph *cg = new CGraph();
+  CNodeVector nodes;
+  CNodeVector child;
+  CNode *node;
+
+  nnodes = get<std::uint32_t>(c.b, c.e, c.bad);
+  nodes.reserve(nnodes);
+  for (std::uint32_t i=0; i<nnodes && !c.bad; ++i) {
+    op = get<std::int32_t>(c.b, c.e, c.bad);
+    if (OpVar == op) {
+      vind = get<std::uint32_t>(c.b, c.e, c.bad);
+      if (c.bad || vind >= p->getNumVars()) {
+        c.bad = true;
+        break;
+      }
+      node = cg->newNode(p->getVariable(vind));
+    } else if (OpNum == op) {
+      d = get<double>(c.b, c.e, c.bad);
+      node = cg->newNode(d);
+    } else if (OpInt == op) {
+      d = get<double>(c.b, c.e, c.bad);
+      node = cg->newNode((int) d);
+    } else {
+      std::uint8_t islist = get<std::uint8_t>(c.b, c.e, c.bad);
+      nchild = get<std::uint32_t>(c.b, c.e, c.bad);
+      const char *inds = getArr<std::uint32_t>(c.b, c.e, nchild, c.bad);
+      if (c.bad) {
+        break;
+      }
+      // children are always written before their parents.
+      child.resize(nchild);
+      for (std::uint32_t j=0; j<nchild; ++j) {
+        if (at<std::uint32_t>(inds, j) >= i) {
+          c.bad = true;
+          break;
+        }
+        child[j] = nodes[at<std::uint32_t>(inds, j)];
+      }
+      if (c.bad) {
+        break;
+      }
+      if (islist && nchild > 0) {
+        node = cg->newNode((OpCode) op, &child[0], nchild);
+      } else {
+        node = cg->newNode((OpCode) op, nchild > 0 ? child[0] : 0,
+                           nchild > 1 ? child[1] : 0);
+      }
+    }
+    nodes.push_back(node);
+  }
+  out = get<std::uint32_t>(c.b, c.e, c.bad);
+  if (c.bad || out >= nodes.size()) {
+    c.bad = true;
+    err = 1;
+    delete cg;
+    return 0;
+  }
+  cg->setOut(nodes[out]);
+  cg->finalize();
+  return cg;
+}
+
+
+FunctionPtr ProbSnapshot::readFun_(Cursor &c, ProblemPtr p, int &err)
+{
+  std::uint8_t parts = get<std::uint8_t>(c.b, c.e, c.bad);
+  std::uint32_t nz;
+  LinearFunctionPtr lf = 0;
+  QuadraticFunctionPtr qf = 0;
+  CGraph *cg = 0;
+  std::uint64_t nvars = p->getNumVars();
+
+  if (c.bad || 0 == parts) {
+    return 0;
+  }
+
+  if (parts & snapLf) {
+    nz = get<std::uint32_t>(c.b, c.e, c.bad);
+    const char *inds = getArr<std::uint32_t>(c.b, c.e, nz, c.bad);
+    const char *vals = getArr<double>(c.b, c.e, nz, c.bad);
+    if (!c.bad) {
+      lf = (LinearFunctionPtr) new LinearFunction();
+      for (std::uint32_t i=0; i<nz; ++i) {
+        if (at<std::uint32_t>(inds, i) >= nvars) {
+          c.bad = true;
+          break;
+        }
+        lf->addTerm(p->getVariable(at<std::uint32_t>(inds, i)),
+                    at<double>(vals, i));
+      }
+    }
+  }
+
+  if (!c.bad && (parts & snapQf)) {
+    nz = get<std::uint32_t>(c.b, c.e, c.bad);
+    const char *irow = getArr<std::uint32_t>(c.b, c.e, nz, c.bad);
+    const char *jcol = getArr<std::uint32_t>(c.b, c.e, nz, c.bad);
+    const char *vals = getArr<double>(c.b, c.e, nz, c.bad);
+    if (!c.bad) {
+      qf = (QuadraticFunctionPtr) new QuadraticFunction();
+      for (std::uint32_t i=0; i<nz; ++i) {
+        if (at<std::uint32_t>(irow, i) >= nvars ||
+            at<std::uint32_t>(jcol, i) >= nvars) {
+          c.bad = true;
+          break;
+        }
+        qf->addTerm(p->getVariable(at<std::uint32_t>(irow, i)),
+                    p->getVariable(at<std::uint32_t>(jcol, i)),
+                    at<double>(vals, i));
+      }
+    }
+  }
+
+  if (!c.bad && (parts & snapNlf)) {
+    cg = readCGraph_(c, p, err);
+  }
+
+  if (c.bad || err) {
+    err = 1;
+    if (lf) {
+      delete lf;
+    }
+    if (qf) {
+      delete qf;
+    }
+    if (cg) {
+      delete cg;
+    }
+    return 0;
+  }
+  return (FunctionPtr) new Function(lf, qf, cg);
+}
+
+
+int ProbSnapshot::readMods_(Cursor &c)
+{
+  std::uint64_t nmods = get<std::uint64_t>(c.b, c.e, c.bad);
+  std::uint32_t tag;
+  std::uint64_t n;
+  VariablePtr v;
+
+  for (std::uint64_t i=0; i<nmods && !c.bad; ++i) {
+    tag = get<std::uint32_t>(c.b, c.e, c.bad);
+    n = get<std::uint64_t>(c.b, c.e, c.bad);
+    if (snapDelVars == tag) {
+      PreDelVarsPtr dmod = new PreDelVars();
+      mods_.push_back(dmod);
+      for (std::uint64_t j=0; j<n && !c.bad; ++j) {
+        UInt ind = get<std::uint32_t>(c.b, c.e, c.bad);
+        double val = get<double>(c.b, c.e, c.bad);
+        v = new Variable(0, ind, val, val, Continuous, "");
+        remVars_.push_back(v);
+        dmod->vars_.push_back(v);
+      }
+    } else if (snapSubstVars == tag) {
+      PreSubstVarsPtr smod = new PreSubstVars();
+      mods_.push_back(smod);
+      for (std::uint64_t j=0; j<n && !c.bad; ++j) {
+        PreSubstVarData *data = new PreSubstVarData();
+        UInt ind = get<std::uint32_t>(c.b, c.e, c.bad);
+        data->vinInd = get<std::uint32_t>(c.b, c.e, c.bad);
+        data->rat = get<double>(c.b, c.e, c.bad);
+        data->vout = new Variable(0, ind, -INFINITY, INFINITY, Continuous,
+                                  "");
+        remVars_.push_back(data->vout);
+        smod->vars_.push_back(data);
+      }
+    } else if (snapAuxVars == tag) {
+      PreAuxVarsPtr amod = new PreAuxVars();
+      mods_.push_back(amod);
+      for (std::uint64_t j=0; j<n && !c.bad; ++j) {
+        UInt ind = get<std::uint32_t>(c.b, c.e, c.bad);
+        v = new Variable(0, ind, -INFINITY, INFINITY, Continuous, "");
+        remVars_.push_back(v);
+        amod->vars_.push_back(v);
+      }
+    } else {
+      c.bad = true;
+    }
+  }
+  return c.bad ? 1 : 0;
+}
+
+
+int ProbSnapshot::readOrigVars_(Cursor &c)
+{
+  std::uint64_t n = get<std::uint64_t>(c.b, c.e, c.bad);
+  std::string name;
+
+  origVars_.reserve(n);
+  for (std::uint64_t i=0; i<n && !c.bad; ++i) {
+    double lb = get<double>(c.b, c.e, c.bad);
+    double ub = get<double>(c.b, c.e, c.bad);
+    std::int32_t vt = get<std::int32_t>(c.b, c.e, c.bad);
+    name = readStr_(c);
+    origVars_.push_back(new Variable(i, i, lb, ub, (VariableType) vt, name));
+  }
+  return c.bad ? 1 : 0;
+}
+
+
+std::string ProbSnapshot::readStr_(Cursor &c)
+{
+  std::uint32_t len = get<std::uint32_t>(c.b, c.e, c.bad);
+  const char *s = getArr<char>(c.b, c.e, len, c.bad);
+  if (c.bad) {
+    return "";
+  }
+  return std::string(s, len);
+}
+
+
+// ----------------------------------------------------------------------
+// Writing
+// ----------------------------------------------------------------------
+
+int ProbSnapshot::write(ProblemPtr p, PresolverPtr pres,
+                        const VarVector *orig_v, double obj_sense,
+                        const std::string fname)
+{
+  std::ofstream of;
+  ObjectivePtr obj = p->getObjective();
+  ConstraintPtr con;
+  SOSPtr sos;
+  VariablePtr v;
+  int err = 0;
+
+  of.open(fname.c_str(), std::ios::binary | std::ios::trunc);
+  if (!of.is_open()) {
+    env_->getLogger()->errStream() << me_ << "could not open file " << fname
+                                   << " for writing" << std::endl;
+    return 1;
+  }
+
+  of.write(snapMagic, 8);
+  put<std::uint32_t>(of, snapEndian);
+  put<std::uint32_t>(of, version_);
+  put<double>(of, obj_sense);
+
+  // variables
+  put<std::uint64_t>(of, p->getNumVars());
+  for (VariableConstIterator it=p->varsBegin(); it!=p->varsEnd(); ++it) {
+    v = *it;
+    put<double>(of, v->getLb());
+    put<double>(of, v->getUb());
+    put<std::int32_t>(of, v->getType());
+    put<std::int32_t>(of, v->getSrcType());
+    writeStr_(of, v->getName());
+  }
+
+  // objective
+  put<std::uint8_t>(of, obj ? 1 : 0);
+  if (obj) {
+    put<std::int32_t>(of, obj->getObjectiveType());
+    put<double>(of, obj->getConstant());
+    writeStr_(of, obj->getName());
+    err = writeFun_(of, obj->getFunction());
+  }
+
+  // constraints
+  put<std::uint64_t>(of, p->getNumCons());
+  for (ConstraintConstIterator it=p->consBegin(); it!=p->consEnd() && 0==err;
+       ++it) {
+    con = *it;
+    put<double>(of, con->getLb());
+    put<double>(of, con->getUb());
+    writeStr_(of, con->getName());
+    err = writeFun_(of, con->getFunction());
+  }
+
+  // SOS
+  put<std::uint64_t>(of, std::distance(p->sos1Begin(), p->sos1End()) +
+                     std::distance(p->sos2Begin(), p->sos2End()));
+  for (int t=0; t<2; ++t) {
+    SOSConstIterator sb = t ? p->sos2Begin() : p->sos1Begin();
+    SOSConstIterator se = t ? p->sos2End() : p->sos1End();
+    for (SOSConstIterator it=sb; it!=se; ++it) {
+      sos = *it;
+      put<std::int32_t>(of, sos->getType());
+      put<std::int32_t>(of, sos->getPriority());
+      put<std::uint32_t>(of, sos->getNz());
+      of.write(reinterpret_cast<const char *>(sos->getWeights()),
+               sizeof(double)*sos->getNz());
+      for (VariableConstIterator vit=sos->varsBegin(); vit!=sos->varsEnd();
+           ++vit) {
+        put<std::uint32_t>(of, (*vit)->getIndex());
+      }
+      writeStr_(of, sos->getName());
+    }
+  }
+
+  if (0 == err) {
+    err = writeMods_(of, pres);
+  }
+
+  // original variables
+  put<std::uint64_t>(of, orig_v ? orig_v->size() : 0);
+  if (orig_v) {
+    for (VarVector::const_iterator it=orig_v->begin(); it!=orig_v->end();
+         ++it) {
+      v = *it;
+      put<double>(of, v->getLb());
+      put<double>(of, v->getUb());
+      put<std::int32_t>(of, v->getType());
+      writeStr_(of, v->getName());
+    }
+  }
+
+  of.close();
+  if (0 == err && of.fail()) {
+    env_->getLogger()->errStream() << me_ << "error in writing file "
+                                   << fname << std::endl;
+    err = 1;
+  }
+  if (err) {
+    std::remove(fname.c_str());
+  }
+  return err;
+}
+
+
+int ProbSnapshot::writeCGraph_(std::ostream &out, const CGraph *cg)
+{
+  std::map<const CNode *, std::uint32_t> ind;
+  std::stack<std::pair<const CNode *, bool> > st;
+  std::vector<const CNode *> order;
+  std::vector<const CNode *> child;
+  const CNode *node;
+
+  // Number the nodes reachable from the output node so that each child
+  // comes before all its parents.
+  st.push(std::make_pair(cg->oNode_, false));
+  while (!st.empty()) {
+    node = st.top().first;
+    if (ind.find(node) != ind.end()) {
+      st.pop();
+    } else if (st.top().second) {
+      st.pop();
+      ind[node] = order.size();
+      order.push_back(node);
+    } else {
+      st.top().second = true;
+      if (node->getListL()) {
+        for (CNode **c=node->getListL(); c!=node->getListR(); ++c) {
+          st.push(std::make_pair(*c, false));
+        }
+      } else {
+        if (node->getR()) {
+          st.push(std::make_pair(node->getR(), false));
+        }
+        if (node->getL()) {
+          st.push(std::make_pair(node->getL(), false));
+        }
+      }
+    }
+  }
+
+  put<std::uint32_t>(out, order.size());
+  for (UInt i=0; i<order.size(); ++i) {
+    node = order[i];
+    put<std::int32_t>(out, node->getOp());
+    if (OpVar == node->getOp()) {
+      put<std::uint32_t>(out, node->getV()->getIndex());
+    } else if (OpNum == node->getOp() || OpInt == node->getOp()) {
+      put<double>(out, node->getVal());
+    } else {
+      child.clear();
+      if (node->getListL()) {
+        child.assign(node->getListL(), node->getListR());
+      } else {
+        if (node->getL()) {
+          child.push_back(node->getL());
+        }
+        if (node->getR()) {
+          child.push_back(node->getR());
+        }
+      }
+      put<std::uint8_t>(out, node->getListL() ? 1 : 0);
+      put<std::uint32_t>(out, child.size());
+      for (UInt j=0; j<child.size(); ++j) {
+        put<std::uint32_t>(out, ind[child[j]]);
+      }
+    }
+  }
+  put<std::uint32_t>(out, ind[cg->oNode_]);
+  return 0;
+}
+
+
+int ProbSnapshot::writeFun_(std::ostream &out, FunctionPtr f)
+{
+  LinearFunctionPtr lf = f ? f->getLinearFunction() : 0;
+  QuadraticFunctionPtr qf = f ? f->getQuadraticFunction() : 0;
+  NonlinearFunctionPtr nlf = f ? f->getNonlinearFunction() : 0;
+  CGraph *cg = dynamic_cast<CGraph *>(nlf);
+  std::uint8_t parts = 0;
+
+  if (nlf && !cg) {
+    env_->getLogger()->errStream() << me_ << "only native computational "
+                                   << "graphs can be saved. Use option "
+                                   << "use_native_cgraph." << std::endl;
+    return 1;
+  }
+  if (cg && !cg->oNode_) {
+    cg = 0;
+  }
+
+  parts = (lf ? snapLf : 0) | (qf ? snapQf : 0) | (cg ? snapNlf : 0);
+  put<std::uint8_t>(out, parts);
+  if (lf) {
+    std::vector<std::uint32_t> inds;
+    std::vector<double> vals;
+    inds.reserve(lf->getNumTerms());
+    vals.reserve(lf->getNumTerms());
+    for (VariableGroupConstIterator it=lf->termsBegin(); it!=lf->termsEnd();
+         ++it) {
+      inds.push_back(it->first->getIndex());
+      vals.push_back(it->second);
+    }
+    put<std::uint32_t>(out, inds.size());
+    putArr(out, inds);
+    putArr(out, vals);
+  }
+  if (qf) {
+    std::vector<std::uint32_t> irow, jcol;
+    std::vector<double> vals;
+    for (VariablePairGroupConstIterator it=qf->begin(); it!=qf->end(); ++it) {
+      irow.push_back(it->first.first->getIndex());
+      jcol.push_back(it->first.second->getIndex());
+      vals.push_back(it->second);
+    }
+    put<std::uint32_t>(out, vals.size());
+    putArr(out, irow);
+    putArr(out, jcol);
+    putArr(out, vals);
+  }
+  if (cg) {
+    writeCGraph_(out, cg);
+  }
+  return 0;
+}
+
+
+int ProbSnapshot::writeMods_(std::ostream &out, PresolverPtr pres)
+{
+  PreDelVarsPtr dmod;
+  PreSubstVarsPtr smod;
+  PreAuxVarsPtr amod;
+
+  put<std::uint64_t>(out, pres ? pres->mods_.size() : 0);
+  if (!pres) {
+    return 0;
+  }
+  for (PreModQIter m=pres->mods_.begin(); m!=pres->mods_.end(); ++m) {
+    if ((dmod = dynamic_cast<PreDelVarsPtr>(*m))) {
+      put<std::uint32_t>(out, snapDelVars);
+      put<std::uint64_t>(out, dmod->vars_.size());
+      for (VarQueueConstIter it=dmod->vars_.begin(); it!=dmod->vars_.end();
+           ++it) {
+        put<std::uint32_t>(out, (*it)->getIndex());
+        put<double>(out, (*it)->getLb());
+      }
+    } else if ((smod = dynamic_cast<PreSubstVarsPtr>(*m))) {
+      put<std::uint32_t>(out, snapSubstVars);
+      put<std::uint64_t>(out, smod->vars_.size());
+      for (std::deque<PreSubstVarData *>::const_iterator
+           it=smod->vars_.begin(); it!=smod->vars_.end(); ++it) {
+        put<std::uint32_t>(out, (*it)->vout->getIndex());
+        put<std::uint32_t>(out, (*it)->vinInd);
+        put<double>(out, (*it)->rat);
+      }
+    } else if ((amod = dynamic_cast<PreAuxVarsPtr>(*m))) {
+      put<std::uint32_t>(out, snapAuxVars);
+      put<std::uint64_t>(out, amod->vars_.size());
+      for (std::deque<VariablePtr>::const_iterator it=amod->vars_.begin();
+           it!=amod->vars_.end(); ++it) {
+        put<std::uint32_t>(out, (*it)->getIndex());
+      }
+    } else {
+      env_->getLogger()->errStream() << me_ << "unknown presolve "
+                                     << "modification cannot be saved"
+                                     << std::endl;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+
+void ProbSnapshot::writeStr_(std::ostream &out, const std::string &s)
+{
+  put<std::uint32_t>(out, s.size());
+  out.write(s.data(), s.size());
+}
+
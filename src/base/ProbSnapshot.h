@@ -0,0 +1,136 @@
+//
+//    Minotaur -- It's only 1/2 bull
+//
+//    (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+
+/**
+ * \file ProbSnapshot.h
+ * \brief Declare class ProbSnapshot for saving and reloading presolved
+ * problems in a binary format.
+ * \author The Minotaur Team
+ */
+
+#ifndef MINOTAURPROBSNAPSHOT_H
+#define MINOTAURPROBSNAPSHOT_H
+
+#include <cstdint>
+#include <ios>
+#include "Types.h"
+
+namespace Minotaur {
+
+class CGraph;
+class PreMod;
+class Presolver;
+typedef Presolver* PresolverPtr;
+
+/**
+ * \brief Write a presolved Problem to a versioned binary file and load it
+ * back.
+ *
+ * The snapshot contains the variables and their bounds, the linear and
+ * quadratic parts of all functions in flat arrays, the computational graphs
+ * of nonlinear functions, the postsolve modifications saved by the
+ * Presolver and the variables of the original problem (for displaying the
+ * solution). Loading memory-maps the file and rebuilds the Problem in one
+ * pass, so the time taken is linear in the size of the file.
+ *
+ * All nonlinear functions must be stored as native CGraphs. The variables
+ * referenced by the postsolve modifications and the original variables are
+ * owned by the ProbSnapshot object, so it must stay alive as long as the
+ * Presolver returned by getPresolver() is used.
+ */
+class ProbSnapshot {
+public:
+  /// Default constructor
+  ProbSnapshot(EnvPtr env);
+
+  /// Destroy
+  ~ProbSnapshot();
+
+  /**
+   * \brief Return a new Presolver for the loaded problem. It has the
+   * postsolve modifications read from the snapshot and is not meant to be
+   * solved again.
+   *
+   * \param [in] p The problem returned by read().
+   */
+  PresolverPtr getPresolver(ProblemPtr p);
+
+  /// Objective sense (1 or -1) of the original problem.
+  double getObjSense() const { return objSense_; };
+
+  /// Variables of the original problem, before presolve.
+  const VarVector *getOrigVars() const { return &origVars_; };
+
+  /**
+   * \brief Load a problem from a snapshot file.
+   *
+   * \param [in] fname The name of the file.
+   * \param [out] err Nonzero if the file could not be read or is not a
+   * valid snapshot of this version.
+   * \return The problem, or NULL on error.
+   */
+  ProblemPtr read(const std::string fname, int &err);
+
+  /**
+   * \brief Write a presolved problem to a snapshot file.
+   *
+   * \param [in] p The presolved problem.
+   * \param [in] pres The Presolver used on p. Its modifications are saved
+   * for postsolve.
+   * \param [in] orig_v Variables of the problem before presolve.
+   * \param [in] obj_sense 1 if the original problem was minimization, -1
+   * otherwise.
+   * \param [in] fname The name of the file.
+   * \return 0 if successful, nonzero otherwise.
+   */
+  int write(ProblemPtr p, PresolverPtr pres, const VarVector *orig_v,
+            double obj_sense, const std::string fname);
+
+private:
+  /// Read cursor over the mapped file.
+  struct Cursor {
+    const char *b;
+    const char *e;
+    bool bad;
+  };
+
+  /// Environment.
+  EnvPtr env_;
+
+  /// Postsolve modifications read from the file.
+  std::deque<PreMod *> mods_;
+
+  /// For logging
+  static const std::string me_;
+
+  /// Objective sense of the original problem.
+  double objSense_;
+
+  /// Original variables read from the file.
+  VarVector origVars_;
+
+  /// Variables that postsolve modifications refer to.
+  VarVector remVars_;
+
+  /// Version of the file format. Increment when the layout changes.
+  static const std::uint32_t version_;
+
+  ProblemPtr read_(Cursor &c, int &err);
+  FunctionPtr readFun_(Cursor &c, ProblemPtr p, int &err);
+  CGraph *readCGraph_(Cursor &c, ProblemPtr p, int &err);
+  int readMods_(Cursor &c);
+  std::string readStr_(Cursor &c);
+  int readOrigVars_(Cursor &c);
+
+  int writeFun_(std::ostream &out, FunctionPtr f);
+  int writeCGraph_(std::ostream &out, const CGraph *cg);
+  int writeMods_(std::ostream &out, PresolverPtr pres);
+  void writeStr_(std::ostream &out, const std::string &s);
+};
+}
+#endif
+
@@ -16,6 +16,8 @@
 #include <sstream>
 #include <string.h> // for memset
 
+#include "BoundTrail.h"
+#include "CliqueTable.h"
 #include "Environment.h"
 #include "MinotaurConfig.h"
 #include "Operations.h"
@@ -37,6 +39,8 @@ Problem::Problem(EnvPtr env)
     numDVars_(0),
     obj_(0),
     size_(0),
+    trail_(0),
+    cliques_(0),
     vars_(0),
     varsModed_(false)
 
@@ -88,6 +92,9 @@ Problem::~Problem()
   if(debugSol_) {
     delete debugSol_;
   }
+  if(cliques_) {
+    delete cliques_;
+  }
   vars_.clear();
   cons_.clear();
   sos1_.clear();
@@ -123,6 +130,13 @@ void Problem::addToCons(ConstraintPtr cons, double c)
   cons->add_(c);
 }
 
+void Problem::beginUpdate()
+{
+  if(engine_) {
+    engine_->beginUpdate();
+  }
+}
+
 void Problem::calculateSize(bool shouldRedo)
 {
   if(!size_) {
@@ -154,6 +168,9 @@ void Problem::changeBoundByInd(UInt ind, BoundType lu, double new_val)
   assert(ind < vars_.size() ||
          !"Problem::changeBound: index of variable exceeds no. of variables.");
 
+  if(trail_) {
+    trail_->record(ind, vars_[ind]->getLb(), vars_[ind]->getUb());
+  }
   if(lu == Lower) {
     vars_[ind]->setLb_(new_val);
   } else {
@@ -170,6 +187,9 @@ void Problem::changeBoundByInd(UInt ind, double new_lb, double new_ub)
   assert(ind < vars_.size() ||
          !"Problem::changeBound: index of variable exceeds no. of variables.");
 
+  if(trail_) {
+    trail_->record(ind, vars_[ind]->getLb(), vars_[ind]->getUb());
+  }
   vars_[ind]->setLb_(new_lb);
   vars_[ind]->setUb_(new_ub);
   if(engine_) {
@@ -183,6 +203,9 @@ void Problem::changeBound(VariablePtr var, BoundType lu, double new_val)
   assert(var == vars_[var->getIndex()] ||
          !"Problem: Bound of variable not in a problem can't be changed.");
 
+  if(trail_) {
+    trail_->record(var->getIndex(), var->getLb(), var->getUb());
+  }
   if(lu == Lower) {
     var->setLb_(new_val);
   } else {
@@ -200,6 +223,9 @@ void Problem::changeBound(VariablePtr var, double new_lb, double new_ub)
       var == vars_[var->getIndex()] ||
       !"Problem: Bound of variable that is not in problem can't be changed.");
 
+  if(trail_) {
+    trail_->record(var->getIndex(), var->getLb(), var->getUb());
+  }
   var->setLb_(new_lb);
   var->setUb_(new_ub);
   if(engine_) {
@@ -880,6 +906,13 @@ void Problem::lockNum_() {
 }
 */
 
+void Problem::commitUpdate()
+{
+  if(engine_) {
+    engine_->commitUpdate();
+  }
+}
+
 // Does not clone Jacobian and Hessian yet.
 ProblemPtr Problem::clone(EnvPtr env) const
 {
@@ -1539,6 +1572,7 @@ void Problem::delMarkedVars(bool keep)
 
     varsModed_ = true;
     numDVars_ = 0;
+    setCliqueTable(0);
   }
 }
 
@@ -1942,11 +1976,8 @@ ConstraintPtr Problem::newConstraint(FunctionPtr funPtr, double lb, double ub)
   name_stream << "cons" << cons_.size();
   name = name_stream.str();
 
-  // make a constraint,
+  // make a constraint. It is passed to the engine there.
   c = (ConstraintPtr)newConstraint(funPtr, lb, ub, name);
-  if(engine_ != 0) {
-    engine_->addConstraint(c);
-  }
   consModed_ = true;
 
   return c;
@@ -2195,6 +2226,14 @@ void Problem::reverseSense(ConstraintPtr cons)
   consModed_ = true;
 }
 
+void Problem::setCliqueTable(CliqueTable* cliques)
+{
+  if(cliques_ && cliques_ != cliques) {
+    delete cliques_;
+  }
+  cliques_ = cliques;
+}
+
 void Problem::setDebugSol(const DoubleVector& x)
 {
   if(debugSol_) {
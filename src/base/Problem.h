@@ -27,6 +27,9 @@
 #include <limits>
 namespace Minotaur {
 
+  class BoundTrail;
+  class CliqueTable;
+
   /**
    * \brief The Problem that needs to be solved.
    *
@@ -86,6 +89,13 @@ namespace Minotaur {
     /// Add a constant term to the objective.
     virtual void addToObj(double cb);
 
+    /**
+     * \brief Start a batch of changes of bounds of variables, see
+     * Engine::beginUpdate(). Bounds in the problem are changed immediately,
+     * only the engine may apply them later.
+     */
+    virtual void beginUpdate();
+
     /// Fill up the statistics about the size of the problem into size_.
     virtual void calculateSize(bool shouldRedo = false);
 
@@ -148,6 +158,9 @@ namespace Minotaur {
     // Classification of Constraints
     virtual void classifyCon();
 
+    /// Commit a batch of changes started by beginUpdate().
+    virtual void commitUpdate();
+
     /**
      * \brief Clone the given Problem class. Jacobian and Hessian in the
      * cloned problem are NULL.
@@ -204,6 +217,15 @@ namespace Minotaur {
      */
     virtual ProblemType findType();
 
+    /// Return the trail recording bound changes of variables. Could be NULL.
+    virtual BoundTrail *getBoundTrail() const { return trail_; }
+
+    /**
+     * \brief Return the table of cliques and implications of binary
+     * variables. Could be NULL.
+     */
+    virtual CliqueTable *getCliqueTable() const { return cliques_; }
+
     /// Return a pointer to the constraint with a given index
     virtual ConstraintPtr getConstraint(UInt index) const;
 
@@ -515,6 +537,23 @@ namespace Minotaur {
      */
     virtual void reverseSense(ConstraintPtr cons);
 
+    /**
+     * \brief Set the trail in which old bounds of variables are recorded
+     * whenever they are changed.
+     *
+     * \param[in] trail The trail. NULL to stop recording.
+     */
+    virtual void setBoundTrail(BoundTrail *trail) { trail_ = trail; }
+
+    /**
+     * \brief Set the table of cliques of binary variables. The problem
+     * frees it when it is destroyed or when variables are deleted, since
+     * the table is indexed by indices of variables.
+     *
+     * \param[in] cliques The table. NULL to remove the old one.
+     */
+    virtual void setCliqueTable(CliqueTable *cliques);
+
     /**
      * \brief Set a solution that can be checked for accidental cutting off by
      * cuts, branching, reformulations etc.
@@ -720,6 +759,12 @@ namespace Minotaur {
     /// SOS2 constraints.
     SOSVector sos2_;
 
+    /// Trail where bound changes of variables are recorded, could be null.
+    BoundTrail *trail_;
+
+    /// Cliques and implications of binary variables, could be null.
+    CliqueTable *cliques_;
+
     /// Vector of variables.
     VarVector vars_;
 
@@ -0,0 +1,256 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file Profiler.cpp
+ * \brief Define classes Profiler and ProfScope for measuring time spent in
+ * parts of the solver by each thread.
+ * \author The Minotaur Team
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+
+#include "MinotaurConfig.h"
+#include "Profiler.h"
+
+#if USE_OPENMP
+#include <omp.h>
+#endif
+
+using namespace Minotaur;
+
+namespace Minotaur {
+  /// A zone that a thread has entered and not yet left.
+  struct ProfOpen {
+    ProfZone z;   ///> The zone.
+    double wall;  ///> Wall clock time when entered.
+    double cpu;   ///> Cpu time of the thread when entered.
+  };
+
+  /// A zone entered and left, saved for the trace.
+  struct ProfEvent {
+    ProfZone z;   ///> The zone.
+    double start; ///> Wall clock time when entered.
+    double dur;   ///> Wall clock time spent.
+  };
+
+  /// Counters of one thread.
+  struct ProfThread {
+    double wall[ZoneNum];           ///> Wall clock time in each zone.
+    double cpu[ZoneNum];            ///> Cpu time of the thread in each zone.
+    UInt calls[ZoneNum];            ///> Number of times each zone entered.
+    std::vector<ProfOpen> open;     ///> Zones entered and not left.
+    std::vector<ProfEvent> events;  ///> Events for the trace.
+    UInt dropped;                   ///> Events not saved.
+    char pad[64];                   ///> Keep counters of threads apart.
+  };
+}
+
+const UInt Profiler::maxEvents_ = 1 << 20;
+const UInt Profiler::maxThreads_ = 256;
+const std::string Profiler::me_ = "Profiler: ";
+
+// Wall clock time in seconds, from a monotonic clock.
+static double wallNow_()
+{
+  using namespace std::chrono;
+  return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Cpu time in seconds used by the calling thread.
+static double cpuNow_()
+{
+#ifdef CLOCK_THREAD_CPUTIME_ID
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return (double) ts.tv_sec + 1e-9 * (double) ts.tv_nsec;
+#else
+  return (double) clock() / (double) CLOCKS_PER_SEC;
+#endif
+}
+
+
+Profiler::Profiler()
+  : enabled_(false),
+    threads_(0)
+{
+  threads_ = new ProfThread*[maxThreads_];
+  std::fill(threads_, threads_ + maxThreads_, (ProfThread *) 0);
+}
+
+
+Profiler::~Profiler()
+{
+  for (UInt i=0; i<maxThreads_; ++i) {
+    delete threads_[i];
+  }
+  delete [] threads_;
+}
+
+
+void Profiler::enable(bool on, const std::string &trace_file)
+{
+  for (UInt i=0; i<maxThreads_; ++i) {
+    delete threads_[i];
+    threads_[i] = 0;
+  }
+  enabled_ = on;
+  traceFile_ = trace_file;
+}
+
+
+void Profiler::enter(ProfZone z)
+{
+  ProfThread *th = getThread_();
+  if (th) {
+    ProfOpen o = {z, wallNow_(), cpuNow_()};
+    th->open.push_back(o);
+  }
+}
+
+
+ProfThread* Profiler::getThread_()
+{
+  UInt t = 0;
+#if USE_OPENMP
+  t = omp_get_thread_num();
+#endif
+  if (t >= maxThreads_) {
+    return 0;
+  }
+  if (!threads_[t]) {
+    // only thread t writes this slot.
+    ProfThread *th = new ProfThread();
+    std::fill(th->wall, th->wall + ZoneNum, 0.0);
+    std::fill(th->cpu, th->cpu + ZoneNum, 0.0);
+    std::fill(th->calls, th->calls + ZoneNum, 0);
+    th->dropped = 0;
+    threads_[t] = th;
+  }
+  return threads_[t];
+}
+
+
+const char* Profiler::getZoneName(ProfZone z)
+{
+  switch (z) {
+  case ZoneNode:     return "node";
+  case ZoneRelax:    return "relax";
+  case ZoneSeparate: return "separate";
+  case ZoneBranch:   return "branch";
+  case ZonePresolve: return "presolve";
+  case ZoneHeur:     return "heuristic";
+  default:           return "unknown";
+  }
+}
+
+
+void Profiler::leave()
+{
+  ProfThread *th = getThread_();
+  if (th && !th->open.empty()) {
+    const ProfOpen &o = th->open.back();
+    double w = wallNow_() - o.wall;
+    th->wall[o.z] += w;
+    th->cpu[o.z] += cpuNow_() - o.cpu;
+    ++(th->calls[o.z]);
+    if (!traceFile_.empty()) {
+      if (th->events.size() < maxEvents_) {
+        ProfEvent e = {o.z, o.wall, w};
+        th->events.push_back(e);
+      } else {
+        ++(th->dropped);
+      }
+    }
+    th->open.pop_back();
+  }
+}
+
+
+void Profiler::writeStats(std::ostream &out) const
+{
+  if (!enabled_) {
+    return;
+  }
+  out << me_ << std::setw(7) << "thread" << std::setw(11) << "zone"
+      << std::setw(12) << "calls" << std::setw(12) << "wall(s)"
+      << std::setw(12) << "cpu(s)" << std::endl;
+  for (UInt t=0; t<maxThreads_; ++t) {
+    const ProfThread *th = threads_[t];
+    if (!th) {
+      continue;
+    }
+    for (UInt z=0; z<ZoneNum; ++z) {
+      if (th->calls[z] > 0) {
+        out << me_ << std::setw(7) << t
+            << std::setw(11) << getZoneName((ProfZone) z)
+            << std::setw(12) << th->calls[z]
+            << std::setw(12) << std::fixed << std::setprecision(3)
+            << th->wall[z]
+            << std::setw(12) << th->cpu[z] << std::endl;
+      }
+    }
+    if (th->dropped > 0) {
+      out << me_ << "thread " << t << " dropped " << th->dropped
+          << " trace events" << std::endl;
+    }
+  }
+}
+
+
+int Profiler::writeTrace() const
+{
+  std::ofstream out;
+  double origin = -1.0;
+  bool first = true;
+
+  if (!enabled_ || traceFile_.empty()) {
+    return 0;
+  }
+  out.open(traceFile_.c_str());
+  if (!out.is_open()) {
+    return 1;
+  }
+
+  // times are written in microseconds from the first event.
+  for (UInt t=0; t<maxThreads_; ++t) {
+    if (threads_[t]) {
+      for (std::vector<ProfEvent>::const_iterator it=threads_[t]->events.begin();
+           it!=threads_[t]->events.end(); ++it) {
+        if (origin < 0 || it->start < origin) {
+          origin = it->start;
+        }
+      }
+    }
+  }
+  out << "{\"traceEvents\":[" << std::endl;
+  out << std::fixed << std::setprecision(3);
+  for (UInt t=0; t<maxThreads_; ++t) {
+    const ProfThread *th = threads_[t];
+    if (!th) {
+      continue;
+    }
+    out << (first ? "" : ",\n")
+        << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << t
+        << ",\"args\":{\"name\":\"thread " << t << "\"}}";
+    first = false;
+    for (std::vector<ProfEvent>::const_iterator it=th->events.begin();
+         it!=th->events.end(); ++it) {
+      out << ",\n{\"name\":\"" << getZoneName(it->z)
+          << "\",\"cat\":\"minotaur\",\"ph\":\"X\",\"pid\":0,\"tid\":" << t
+          << ",\"ts\":" << 1e6 * (it->start - origin)
+          << ",\"dur\":" << 1e6 * it->dur << "}";
+    }
+  }
+  out << std::endl << "],\"displayTimeUnit\":\"ms\"}" << std::endl;
+  out.close();
+  return (out.fail()) ? 1 : 0;
+}
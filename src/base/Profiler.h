@@ -0,0 +1,158 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file Profiler.h
+ * \brief Declare classes Profiler and ProfScope for measuring time spent in
+ * parts of the solver by each thread.
+ * \author The Minotaur Team
+ */
+
+#ifndef MINOTAURPROFILER_H
+#define MINOTAURPROFILER_H
+
+#include <iostream>
+#include <string>
+
+#include "Types.h"
+
+namespace Minotaur {
+
+  /// Parts of the solver that are profiled.
+  typedef enum {
+    ZoneNode,      ///> Processing a node of the tree.
+    ZoneRelax,     ///> Solving a relaxation.
+    ZoneSeparate,  ///> Separation by handlers.
+    ZoneBranch,    ///> Finding branches.
+    ZonePresolve,  ///> Presolve, by a handler or at a node.
+    ZoneHeur,      ///> Heuristics.
+    ZoneNum        ///> Number of zones, not a zone.
+  } ProfZone;
+
+  struct ProfThread;
+
+  /**
+   * \brief Measure time spent by each thread in zones of the solver.
+   *
+   * A zone is entered and left through a ProfScope. Zones may be nested.
+   * For every thread, the profiler adds the wall clock time and the cpu time
+   * of the thread spent in each zone, and counts the number of times the
+   * zone was entered. Threads write only their own counters, so no locks
+   * are needed. The cpu time is measured with the clock of the thread, not
+   * of the process, so that times of threads in parallel solvers can be
+   * compared.
+   *
+   * If a trace file is given, every zone entered is also saved as an event
+   * and written in the Chrome trace format, which can be viewed in
+   * chrome://tracing or Perfetto.
+   *
+   * The profiler is disabled unless option "profile" is set, in which case
+   * a ProfScope costs one test.
+   */
+  class Profiler {
+  public:
+    /// Create a disabled profiler.
+    Profiler();
+
+    /// Destroy.
+    ~Profiler();
+
+    /**
+     * \brief Enable or disable the profiler and clear all counters.
+     *
+     * \param [in] on True to enable.
+     * \param [in] trace_file File where events are written by writeTrace().
+     * If empty, events are not saved.
+     */
+    void enable(bool on, const std::string &trace_file);
+
+    /// Enter a zone. Call through ProfScope.
+    void enter(ProfZone z);
+
+    /// Return the name of a zone.
+    static const char* getZoneName(ProfZone z);
+
+    /// Return true if the profiler is enabled.
+    bool isEnabled() const { return enabled_; }
+
+    /// Leave the zone entered last by this thread. Call through ProfScope.
+    void leave();
+
+    /// Write times of each zone and thread to out.
+    void writeStats(std::ostream &out) const;
+
+    /**
+     * \brief Write the saved events to the trace file.
+     *
+     * \return 0 if successful or if there is no trace file, 1 if the file
+     * could not be written.
+     */
+    int writeTrace() const;
+
+  private:
+    /// True if enabled.
+    bool enabled_;
+
+    /// Maximum number of events saved by a thread.
+    static const UInt maxEvents_;
+
+    /// Maximum number of threads profiled.
+    static const UInt maxThreads_;
+
+    /// For logging.
+    static const std::string me_;
+
+    /// Counters of each thread, allocated by the thread when it first
+    /// enters a zone.
+    ProfThread **threads_;
+
+    /// File where the trace is written. Empty if events are not saved.
+    std::string traceFile_;
+
+    /// Return the counters of the calling thread, NULL if there are too
+    /// many threads.
+    ProfThread* getThread_();
+  };
+
+
+  /**
+   * \brief Enter a zone of a profiler for the lifetime of this object.
+   *
+   * \code
+   * {
+   *   ProfScope scope(env_->getProfiler(), ZoneRelax);
+   *   engine_->solve();
+   * }
+   * \endcode
+   */
+  class ProfScope {
+  public:
+    /// Enter zone z if p is enabled.
+    ProfScope(Profiler *p, ProfZone z)
+      : p_((p && p->isEnabled()) ? p : 0)
+    {
+      if (p_) {
+        p_->enter(z);
+      }
+    }
+
+    /// Leave the zone.
+    ~ProfScope()
+    {
+      if (p_) {
+        p_->leave();
+      }
+    }
+
+  private:
+    /// The profiler, NULL if disabled.
+    Profiler *p_;
+
+    ProfScope(const ProfScope &);
+    ProfScope &operator=(const ProfScope &);
+  };
+}
+#endif
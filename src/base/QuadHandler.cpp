@@ -28,6 +28,7 @@
 #include "Engine.h"
 #include "Environment.h"
 #include "Function.h"
+#include "Interval.h"
 #include "LinBil.h"
 #include "LinMods.h"
 #include "LinearFunction.h"
@@ -294,6 +295,7 @@ void QuadHandler::updateBoundsinOrig_(RelaxationPtr rel, const double* x,
   VariablePtr v, relv;
   double xval;
 
+  orig_->beginUpdate();
   for(VariableConstIterator vit = orig_->varsBegin(); vit != orig_->varsEnd();
       ++vit) {
     v = *vit;
@@ -308,6 +310,7 @@ void QuadHandler::updateBoundsinOrig_(RelaxationPtr rel, const double* x,
       orig_->changeBound(v, relv->getLb(), relv->getUb());
     }
   }
+  orig_->commitUpdate();
 }
 
 void QuadHandler::resetBoundsinOrig_(DoubleVector& varlb, DoubleVector& varub)
@@ -315,6 +318,7 @@ void QuadHandler::resetBoundsinOrig_(DoubleVector& varlb, DoubleVector& varub)
   VariablePtr v;
   DoubleVector::iterator lbit = varlb.begin(), ubit = varub.begin();
 
+  orig_->beginUpdate();
   for(VariableConstIterator vit = orig_->varsBegin(); vit != orig_->varsEnd();
       ++vit) {
     v = *vit;
@@ -322,6 +326,7 @@ void QuadHandler::resetBoundsinOrig_(DoubleVector& varlb, DoubleVector& varub)
     ++lbit;
     ++ubit;
   }
+  orig_->commitUpdate();
 }
 
 void QuadHandler::updateUb_(SolutionPoolPtr s_pool, double nlpval,
@@ -1176,23 +1181,26 @@ void QuadHandler::simplePresolve(ProblemPtr p, SolutionPoolPtr,
 {
   VariablePtr x1, x2, y;
   double lb, ub;
+  Interval iv;
 
   for(LinSqrMapIter it = x2Funs_.begin(); it != x2Funs_.end(); ++it) {
     x1 = p->getVariable(it->first->getIndex()); // x1 and y are variables in p_
     y = p->getVariable(it->second->y->getIndex());
 
-    BoundsOnSquare(x1, lb, ub);
+    iv = IntervalSqr(Interval(x1->getLb(), x1->getUb()));
+    lb = iv.getLb();
+    ub = iv.getUb();
     if(updatePBounds_(p, y, lb, ub, t_mods) < 0) {
       status = SolvedInfeasible;
     }
 
     // other direction.
     if(y->getUb() > bTol_) {
-      ub = sqrt(y->getUb());
+      ub = SqrtUp(y->getUb());
       lb = -ub;
       assert(y->getLb() >= 0.0); // square of a number.
       if(x1->getLb() > -sqrt(y->getLb()) + bTol_) {
-        lb = sqrt(y->getLb());
+        lb = SqrtDown(y->getLb());
       }
       if(updatePBounds_(p, x1, lb, ub, t_mods) < 0) {
         status = SolvedInfeasible;
@@ -1210,18 +1218,27 @@ void QuadHandler::simplePresolve(ProblemPtr p, SolutionPoolPtr,
     x2 = p->getVariable((*it)->getX1()->getIndex());
     y = p->getVariable((*it)->getY()->getIndex());
 
-    BoundsOnProduct(true, x1, x2, lb, ub);
+    iv = IntervalMul(Interval(x1->getLb(), x1->getUb()),
+                     Interval(x2->getLb(), x2->getUb()));
+    lb = iv.getLb();
+    ub = iv.getUb();
     if(updatePBounds_(p, y, lb, ub, t_mods) < 0) {
       status = SolvedInfeasible;
     }
 
     // reverse
-    RevBoundsOnMult(y->getLb(), y->getUb(), x1->getLb(), x1->getUb(), lb, ub);
+    iv = IntervalRevMul(Interval(y->getLb(), y->getUb()),
+                        Interval(x1->getLb(), x1->getUb()));
+    lb = iv.getLb();
+    ub = iv.getUb();
     if(updatePBounds_(p, x2, lb, ub, t_mods) < 0) {
       status = SolvedInfeasible;
     }
 
-    RevBoundsOnMult(y->getLb(), y->getUb(), x2->getLb(), x2->getUb(), lb, ub);
+    iv = IntervalRevMul(Interval(y->getLb(), y->getUb()),
+                        Interval(x2->getLb(), x2->getUb()));
+    lb = iv.getLb();
+    ub = iv.getUb();
     if(updatePBounds_(p, x1, lb, ub, t_mods) < 0) {
       status = SolvedInfeasible;
     }
@@ -1304,8 +1321,12 @@ bool QuadHandler::propBilBnds_(LinBil* lx0x1, RelaxationPtr rel, bool mod_rel,
   VariablePtr x1 = lx0x1->getX1();
   VariablePtr y = lx0x1->getY();
   double lb, ub;
+  Interval iv;
 
-  BoundsOnProduct(true, x0, x1, lb, ub);
+  iv = IntervalMul(Interval(x0->getLb(), x0->getUb()),
+                   Interval(x1->getLb(), x1->getUb()));
+  lb = iv.getLb();
+  ub = iv.getUb();
   // x0->write(std::cout);
   // x1->write(std::cout);
   // y->write(std::cout);
@@ -1315,12 +1336,18 @@ bool QuadHandler::propBilBnds_(LinBil* lx0x1, RelaxationPtr rel, bool mod_rel,
   }
 
   // other direction
-  RevBoundsOnMult(y->getLb(), y->getUb(), x0->getLb(), x0->getUb(), lb, ub);
+  iv = IntervalRevMul(Interval(y->getLb(), y->getUb()),
+                      Interval(x0->getLb(), x0->getUb()));
+  lb = iv.getLb();
+  ub = iv.getUb();
   if(updatePBounds_(x1, lb, ub, rel, mod_rel, changed, p_mods, r_mods) < 0) {
     return true; // infeasible
   }
 
-  RevBoundsOnMult(y->getLb(), y->getUb(), x1->getLb(), x1->getUb(), lb, ub);
+  iv = IntervalRevMul(Interval(y->getLb(), y->getUb()),
+                      Interval(x1->getLb(), x1->getUb()));
+  lb = iv.getLb();
+  ub = iv.getUb();
   if(updatePBounds_(x0, lb, ub, rel, mod_rel, changed, p_mods, r_mods) < 0) {
     return true; // infeasible
   }
@@ -1331,22 +1358,32 @@ bool QuadHandler::propBilBnds_(LinBil* lx0x1, RelaxationPtr rel, bool mod_rel,
 bool QuadHandler::propBilBnds_(LinBil* lx0x1, bool* changed)
 {
   double lb, ub;
+  Interval iv;
   VariablePtr x0 = lx0x1->getX0(); // x0 and x1 are variables in p_
   VariablePtr x1 = lx0x1->getX1();
   VariablePtr y = lx0x1->getY();
 
-  BoundsOnProduct(true, x0, x1, lb, ub);
+  iv = IntervalMul(Interval(x0->getLb(), x0->getUb()),
+                   Interval(x1->getLb(), x1->getUb()));
+  lb = iv.getLb();
+  ub = iv.getUb();
   if(updatePBounds_(y, lb, ub, changed) < 0) {
     return true;
   }
 
   // reverse
-  RevBoundsOnMult(y->getLb(), y->getUb(), x0->getLb(), x0->getUb(), lb, ub);
+  iv = IntervalRevMul(Interval(y->getLb(), y->getUb()),
+                      Interval(x0->getLb(), x0->getUb()));
+  lb = iv.getLb();
+  ub = iv.getUb();
   if(updatePBounds_(x1, lb, ub, changed) < 0) {
     return true;
   }
 
-  RevBoundsOnMult(y->getLb(), y->getUb(), x1->getLb(), x1->getUb(), lb, ub);
+  iv = IntervalRevMul(Interval(y->getLb(), y->getUb()),
+                      Interval(x1->getLb(), x1->getUb()));
+  lb = iv.getLb();
+  ub = iv.getUb();
   if(updatePBounds_(x0, lb, ub, changed) < 0) {
     return true;
   }
@@ -1359,19 +1396,22 @@ bool QuadHandler::propSqrBnds_(LinSqrMapIter lx2, bool* changed)
   VariablePtr x = lx2->first; // x0 and y are variables in p_
   VariablePtr y = lx2->second->y;
   double lb, ub;
+  Interval iv;
 
-  BoundsOnSquare(x, lb, ub);
+  iv = IntervalSqr(Interval(x->getLb(), x->getUb()));
+  lb = iv.getLb();
+  ub = iv.getUb();
   if(updatePBounds_(y, lb, ub, changed) < 0) {
     return true;
   }
 
   // other direction.
   if(y->getUb() > bTol_) {
-    ub = sqrt(y->getUb());
+    ub = SqrtUp(y->getUb());
     lb = -ub;
     assert(y->getLb() >= 0.0); // square of a number.
     if(x->getLb() > -sqrt(y->getLb()) + bTol_) {
-      lb = sqrt(y->getLb());
+      lb = SqrtDown(y->getLb());
     }
     if(updatePBounds_(x, lb, ub, changed) < 0) {
       return true;
@@ -1391,22 +1431,25 @@ bool QuadHandler::propSqrBnds_(LinSqrMapIter lx2, RelaxationPtr rel,
                                ModVector& r_mods)
 {
   double lb, ub;
+  Interval iv;
 
   VariablePtr x = lx2->first; // x and y are variables in p_
   VariablePtr y = lx2->second->y;
 
-  BoundsOnSquare(x, lb, ub);
+  iv = IntervalSqr(Interval(x->getLb(), x->getUb()));
+  lb = iv.getLb();
+  ub = iv.getUb();
   if(updatePBounds_(y, lb, ub, rel, mod_rel, changed, p_mods, r_mods) < 0) {
     return true; // infeasible
   }
 
   // other direction.
   if(y->getUb() > bTol_) {
-    ub = sqrt(y->getUb());
+    ub = SqrtUp(y->getUb());
     lb = -ub;
     assert(y->getLb() >= 0.0);
     if(x->getLb() > -sqrt(y->getLb()) + bTol_) {
-      lb = sqrt(y->getLb());
+      lb = SqrtDown(y->getLb());
     }
     if(updatePBounds_(x, lb, ub, rel, mod_rel, changed, p_mods, r_mods) < 0) {
       return true; // infeasible
@@ -1778,31 +1821,25 @@ double QuadHandler::calcUpperUnivar_(double a, double b, double lx, double ux)
 void QuadHandler::getTermBnds_(VariablePtr v, double coef, double& lb,
                                double& ub)
 {
-  if(coef > 0) {
-    lb = v->getLb() > -INFINITY ? coef * v->getLb() : -INFINITY;
-    ub = v->getUb() < INFINITY ? coef * v->getUb() : INFINITY;
-  } else {
-    lb = v->getUb() < INFINITY ? coef * v->getUb() : -INFINITY;
-    ub = v->getLb() > -INFINITY ? coef * v->getLb() : INFINITY;
-  }
+  Interval iv = IntervalScale(Interval(v->getLb(), v->getUb()), coef);
+
+  lb = iv.getLb();
+  ub = iv.getUb();
 }
 
 void QuadHandler::getTermBnds_(VariablePtr v1, VariablePtr v2, double coef,
                                double& lb, double& ub)
 {
-  double qlb, qub;
+  Interval iv(v1->getLb(), v1->getUb());
+
   if(v1->getIndex() == v2->getIndex()) {
-    BoundsOnSquare(v1, qlb, qub);
+    iv = IntervalSqr(iv);
   } else {
-    BoundsOnProduct(true, v1, v2, qlb, qub);
-  }
-  if(coef > 0) {
-    lb = qlb > -INFINITY ? coef * qlb : -INFINITY;
-    ub = qub < INFINITY ? coef * qub : INFINITY;
-  } else {
-    lb = qub < INFINITY ? coef * qub : -INFINITY;
-    ub = qlb > -INFINITY ? coef * qlb : INFINITY;
+    iv = IntervalMul(iv, Interval(v2->getLb(), v2->getUb()));
   }
+  iv = IntervalScale(iv, coef);
+  lb = iv.getLb();
+  ub = iv.getUb();
 }
 
 void QuadHandler::getTermBnds_(VariablePtr v, double a, double b, double& lb,
@@ -1829,8 +1866,8 @@ bool QuadHandler::calcVarBnd_(VariablePtr v, double coef, double lb, double ub,
                               bool* c1)
 {
   double vlb, vub;
-  vlb = coef > 0 ? lb / coef : ub / coef;
-  vub = coef > 0 ? ub / coef : lb / coef;
+  vlb = coef > 0 ? DivDown(lb, coef) : DivDown(ub, coef);
+  vub = coef > 0 ? DivUp(ub, coef) : DivUp(lb, coef);
 
   if(updatePBounds_(v, vlb, vub, c1) < 0) {
     return true;
@@ -1843,8 +1880,8 @@ bool QuadHandler::calcVarBnd_(RelaxationPtr rel, VariablePtr v, double coef,
                               ModVector& r_mods)
 {
   double vlb, vub;
-  vlb = coef > 0 ? lb / coef : ub / coef;
-  vub = coef > 0 ? ub / coef : lb / coef;
+  vlb = coef > 0 ? DivDown(lb, coef) : DivDown(ub, coef);
+  vub = coef > 0 ? DivUp(ub, coef) : DivUp(lb, coef);
 
   if(updatePBounds_(v, vlb, vub, rel, modRel_, c1, p_mods, r_mods) < 0) {
     return true;
@@ -1856,16 +1893,17 @@ bool QuadHandler::calcVarBnd_(VariablePtr v1, VariablePtr v2, double coef,
                               double lb, double ub, bool* c1, bool* c2)
 {
   double qlb, qub, vlb, vub;
-  qlb = coef > 0 ? lb / coef : ub / coef;
-  qub = coef > 0 ? ub / coef : lb / coef;
+  Interval iv;
+  qlb = coef > 0 ? DivDown(lb, coef) : DivDown(ub, coef);
+  qub = coef > 0 ? DivUp(ub, coef) : DivUp(lb, coef);
   // if term is quadratic
   if(v1->getIndex() == v2->getIndex()) {
     if(qub > bTol_) {
-      vub = sqrt(qub);
+      vub = SqrtUp(qub);
       vlb = -vub;
       qlb = qlb >= 0 ? qlb : 0; // square of a number.
       if(v1->getLb() > -sqrt(qlb) + bTol_) {
-        vlb = sqrt(qlb);
+        vlb = SqrtDown(qlb);
       }
       if(updatePBounds_(v1, vlb, vub, c1) < 0) {
         return true;
@@ -1880,12 +1918,16 @@ bool QuadHandler::calcVarBnd_(VariablePtr v1, VariablePtr v2, double coef,
     return false;
     // if term is bilinear
   } else {
-    RevBoundsOnMult(qlb, qub, v1->getLb(), v1->getUb(), vlb, vub);
+    iv = IntervalRevMul(Interval(qlb, qub), Interval(v1->getLb(), v1->getUb()));
+    vlb = iv.getLb();
+    vub = iv.getUb();
     if(updatePBounds_(v2, vlb, vub, c2) < 0) {
       return true;
     }
 
-    RevBoundsOnMult(qlb, qub, v2->getLb(), v2->getUb(), vlb, vub);
+    iv = IntervalRevMul(Interval(qlb, qub), Interval(v2->getLb(), v2->getUb()));
+    vlb = iv.getLb();
+    vub = iv.getUb();
     if(updatePBounds_(v1, vlb, vub, c1) < 0) {
       return true;
     }
@@ -1898,16 +1940,17 @@ bool QuadHandler::calcVarBnd_(RelaxationPtr rel, VariablePtr v1, VariablePtr v2,
                               bool* c2, ModVector& p_mods, ModVector& r_mods)
 {
   double qlb, qub, vlb, vub;
-  qlb = coef > 0 ? lb / coef : ub / coef;
-  qub = coef > 0 ? ub / coef : lb / coef;
+  Interval iv;
+  qlb = coef > 0 ? DivDown(lb, coef) : DivDown(ub, coef);
+  qub = coef > 0 ? DivUp(ub, coef) : DivUp(lb, coef);
   // if term is quadratic
   if(v1->getIndex() == v2->getIndex()) {
     if(qub > bTol_) {
-      vub = sqrt(qub);
-      vlb = -ub;
+      vub = SqrtUp(qub);
+      vlb = -vub;
       qlb = qlb >= 0 ? qlb : 0; // square of a number.
       if(v1->getLb() > -sqrt(qlb) + bTol_) {
-        vlb = sqrt(qlb);
+        vlb = SqrtDown(qlb);
       }
       if(updatePBounds_(v1, vlb, vub, rel, modRel_, c1, p_mods, r_mods) < 0) {
         return true;
@@ -1922,12 +1965,16 @@ bool QuadHandler::calcVarBnd_(RelaxationPtr rel, VariablePtr v1, VariablePtr v2,
     return false;
     // if term is bilinear
   } else {
-    RevBoundsOnMult(qlb, qub, v1->getLb(), v1->getUb(), vlb, vub);
+    iv = IntervalRevMul(Interval(qlb, qub), Interval(v1->getLb(), v1->getUb()));
+    vlb = iv.getLb();
+    vub = iv.getUb();
     if(updatePBounds_(v2, vlb, vub, rel, modRel_, c2, p_mods, r_mods) < 0) {
       return true;
     }
 
-    RevBoundsOnMult(qlb, qub, v2->getLb(), v2->getUb(), vlb, vub);
+    iv = IntervalRevMul(Interval(qlb, qub), Interval(v2->getLb(), v2->getUb()));
+    vlb = iv.getLb();
+    vub = iv.getUb();
     if(updatePBounds_(v1, vlb, vub, rel, modRel_, c1, p_mods, r_mods) < 0) {
       return true;
     }
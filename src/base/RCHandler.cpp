@@ -26,6 +26,7 @@
 #include "Timer.h"
 
 using namespace Minotaur;
+const UInt RCHandler::maxRecs_ = 10000;
 const std::string RCHandler::me_ = "RCHandler: ";
 
 RCHandler::RCHandler(EnvPtr env)
@@ -36,10 +37,16 @@ RCHandler::RCHandler(EnvPtr env)
   rootX_ = 0;
   rootObj_ = -INFINITY;
   timer_ = env->getTimer();
+  rel_ = 0;
+  treeFix_ = false;
 
   stats_ = new RCStats();
   stats_->nlb = 0;
   stats_->nub = 0;
+  stats_->passes = 0;
+  stats_->pruned = 0;
+  stats_->found = 0;
+  stats_->tight = 0;
   stats_->time = 0;
 }
 
@@ -77,7 +84,11 @@ void RCHandler::separate(ConstSolutionPtr sol, NodePtr node,
     copyRootDetails_(sol, rel);
   }
 
-  if (s_pool->getNumSols() > 0) {
+  if (treeFix_ && recs_.size() < maxRecs_) {
+    saveRec_(sol, node, rel);
+  }
+
+  if (s_pool->hasBest()) {
     bestobj = s_pool->getBestSolutionValue();
   } else {
     stats_->time += (timer_->query() - start);
@@ -107,12 +118,10 @@ void RCHandler::separate(ConstSolutionPtr sol, NodePtr node,
   return;
 }
 
-void RCHandler::rcfix_(RelaxationPtr rel,
-                       ModVector &r_mods, double bestobj,
-                       const double rel_obj, double xval, 
-                       double r, VariablePtr v)
+bool RCHandler::rcBound_(double bestobj, double rel_obj, double xval,
+                         double r, VariableType v_type, double lb, double ub,
+                         BoundType *lu, double *val) const
 {
-
   double ZTOL = 1e-6; // tolerance for checking if the variable is already fixed.
   double MINR = 1e-3; // if abs reduced cost is more than MINR then it is used
                       // for fixing, otherwise it may be error prone.
@@ -122,92 +131,268 @@ void RCHandler::rcfix_(RelaxationPtr rel,
                         // by both MINIMP (abs) and MINREL (rel). bounds of 
                         // integer variable must improve by MINREL (rel) to
                         // be accepted.
-  double new_ub, ub;
-  double new_lb, lb;
-  VarBoundModPtr m;
-  VariableType v_type;
-  lb = v->getLb();
-  ub = v->getUb();
+  double new_ub;
+  double new_lb;
+  bool is_int = (v_type == Binary || v_type == Integer || v_type == ImplBin ||
+                 v_type == ImplInt);
 
   if (ub - lb < ZTOL) {
-    return;
+    return false;
   }
 
-  v_type = v->getType();
-
   if (r > MINR){ //update upper bound
     new_ub = xval + (bestobj - rel_obj) / r;
-    if (v_type == Binary || v_type == Integer || v_type == ImplBin ||
-        v_type == ImplInt){
+    if (is_int) {
       new_ub = floor(new_ub + MINIMP);
       if (new_ub<ub-MINREL*abs(ub)) {
-        m = (VarBoundModPtr) new VarBoundMod(v, Upper, new_ub);
-        m->applyToProblem(rel);
-        r_mods.push_back(m);
-#if SPEW
-        logger_->msgStream(LogDebug1) << me_ << "Variable name = "
-          << v->getName() << " bound type = ub"
-          << " old value = " << ub << " new value = "
-          << new_ub << " (type = Int)" 
-          << " xval = " << xval 
-          << " red cost = " << r <<std::endl;
-#endif
-        ++(stats_->nub);
+        *lu = Upper;
+        *val = new_ub;
+        return true;
       } 
     } else { // a continuous variable
       if (new_ub<ub-MINIMP && new_ub<ub-MINREL*abs(ub)) {
-        m = (VarBoundModPtr) new VarBoundMod(v, Upper, new_ub);
-        m->applyToProblem(rel);
-        r_mods.push_back(m);
-#if SPEW
-        logger_->msgStream(LogDebug1) << me_ << "Variable name = "
-          << v->getName() << " bound type = ub"
-          << " old value = "
-          << ub << " new value = " << new_ub << std::endl;
-#endif
-        ++(stats_->nub);
+        *lu = Upper;
+        *val = new_ub;
+        return true;
       }
     }
   } else if (r < -MINR) { // update lower bound
     new_lb = xval + (bestobj - rel_obj) / r;
-    if (v_type == Binary || v_type == Integer || v_type == ImplBin ||
-        v_type == ImplInt){
+    if (is_int) {
       new_lb = ceil(new_lb - MINIMP);
       if (new_lb > lb+MINREL*abs(lb)) {
-        m = (VarBoundModPtr) new VarBoundMod(v, Lower, new_lb);
-        m->applyToProblem(rel);
-        r_mods.push_back(m);
-#if SPEW
-        logger_->msgStream(LogDebug1) << me_ << "Variable name = "
-          << (v)->getName()
-          << " bound type = lb old value = "
-          << lb << " new value = "
-          << new_lb << " (type =Int)"
-          << " xval = " << xval 
-          << " red cost = " << r 
-          << std::endl;
-#endif
-        ++(stats_->nlb);
+        *lu = Lower;
+        *val = new_lb;
+        return true;
       }
     } else { // continuous variable
       if (new_lb > lb+MINIMP && new_lb > lb+MINREL*abs(lb)) {
-        m = (VarBoundModPtr) new VarBoundMod(v, Lower, new_lb);
-        m->applyToProblem(rel);
-        r_mods.push_back(m);
+        *lu = Lower;
+        *val = new_lb;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+
+void RCHandler::rcfix_(RelaxationPtr rel,
+                       ModVector &r_mods, double bestobj,
+                       const double rel_obj, double xval, 
+                       double r, VariablePtr v)
+{
+  BoundType lu;
+  double val;
+  VarBoundModPtr m;
+
+  if (false == rcBound_(bestobj, rel_obj, xval, r, v->getType(), v->getLb(),
+                        v->getUb(), &lu, &val)) {
+    return;
+  }
 #if SPEW
-        logger_->msgStream(LogDebug1) << me_ << "Variable name = "
-          << (v)->getName()
-          << " bound type = lb, old value = "
-          << lb << " new value = "
-          << new_lb << std::endl;
+  logger_->msgStream(LogDebug1) << me_ << "Variable name = "
+    << v->getName() << " bound type = " << (Lower == lu ? "lb" : "ub")
+    << " old value = " << (Lower == lu ? v->getLb() : v->getUb())
+    << " new value = " << val
+    << " xval = " << xval 
+    << " red cost = " << r << std::endl;
 #endif
-        ++(stats_->nlb);
+  m = (VarBoundModPtr) new VarBoundMod(v, lu, val);
+  m->applyToProblem(rel);
+  r_mods.push_back(m);
+  if (Lower == lu) {
+    ++(stats_->nlb);
+  } else {
+    ++(stats_->nub);
+  }
+  return;
+}
+
+
+void RCHandler::relaxNodeInc(NodePtr node, RelaxationPtr rel, bool *is_inf)
+{
+  std::map<UInt, std::vector<RCBound> >::iterator it;
+  VariablePtr v;
+  VarBoundModPtr m;
+
+  if (pending_.empty()) {
+    return;
+  }
+  it = pending_.find(node->getId());
+  if (it == pending_.end()) {
+    return;
+  }
+  for (std::vector<RCBound>::iterator b=it->second.begin();
+       b!=it->second.end(); ++b) {
+    v = rel->getVariable(b->idx);
+    if (Lower == b->lu) {
+      if (b->val > v->getUb() + 1e-6) {
+        *is_inf = true;
+        break;
+      } else if (b->val <= v->getLb()) {
+        continue;
+      }
+    } else {
+      if (b->val < v->getLb() - 1e-6) {
+        *is_inf = true;
+        break;
+      } else if (b->val >= v->getUb()) {
+        continue;
       }
     }
+    m = (VarBoundModPtr) new VarBoundMod(v, b->lu, b->val);
+    m->applyToProblem(rel);
+    node->addRMod(m);
+    ++(stats_->tight);
   }
-  return;
+  pending_.erase(it);
 }
 
+
+void RCHandler::saveRec_(ConstSolutionPtr sol, NodePtr node,
+                         RelaxationPtr rel)
+{
+  const double MINR = 1e-3; // same as in rcBound_
+  const double *p = sol->getDualOfVars();
+  const double *x = sol->getPrimal();
+  RCNodeRec &rec = recs_[node->getId()];
+  RCVarRec vrec;
+  VariablePtr v;
+  UInt i = 0;
+
+  rel_ = rel;
+  rec.obj = sol->getObjValue();
+  rec.vars.clear();
+  for (VariableConstIterator it=rel->varsBegin(); it!=rel->varsEnd();
+       ++it, ++i) {
+    v = *it;
+    if (v->getUb() - v->getLb() < 1e-6) {
+      continue;
+    }
+    if (fabs(p[i]) > MINR || (rootDuals_ && fabs(rootDuals_[i]) > MINR)) {
+      vrec.idx = i;
+      vrec.x = x[i];
+      vrec.r = p[i];
+      vrec.lb = v->getLb();
+      vrec.ub = v->getUb();
+      rec.vars.push_back(vrec);
+    }
+  }
+}
+
+
+void RCHandler::tightenActiveNodes(const NodePtrVector &nodes, NodePtr cur,
+                                   double bestobj, NodePtrVector &pruned)
+{
+  double start = timer_->query();
+  std::map<UInt, RCNodeRec> keep;
+  std::map<UInt, RCNodeRec>::iterator rit;
+  std::map<UInt, double> lbs, ubs;
+  std::vector<RCBound> bnds;
+  RCBound bnd;
+  VarBoundModPtr m;
+  VarBoundMod2Ptr m2;
+  NodePtr parent;
+  double lb, ub, val;
+  BoundType lu;
+  VariableType v_type;
+  bool found, is_inf;
+  size_t npruned = pruned.size();
+
+  pending_.clear();
+  if (!treeFix_ || !rel_ || bestobj >= INFINITY) {
+    return;
+  }
+  ++(stats_->passes);
+  for (NodePtrVector::const_iterator it=nodes.begin(); it!=nodes.end();
+       ++it) {
+    parent = (*it)->getParent();
+    if (*it == cur || !parent) {
+      continue;
+    }
+    rit = recs_.find(parent->getId());
+    if (rit == recs_.end()) {
+      continue;
+    }
+    const RCNodeRec &rec = rit->second;
+
+    // bounds of the node are those of its parent, changed by branching.
+    lbs.clear();
+    ubs.clear();
+    for (ModificationConstIterator mit=(*it)->modsrBegin();
+         mit!=(*it)->modsrEnd(); ++mit) {
+      m = dynamic_cast<VarBoundMod *>(*mit);
+      m2 = dynamic_cast<VarBoundMod2 *>(*mit);
+      if (m) {
+        if (Lower == m->getLU()) {
+          lbs[m->getVar()->getIndex()] = m->getNewVal();
+        } else {
+          ubs[m->getVar()->getIndex()] = m->getNewVal();
+        }
+      } else if (m2) {
+        lbs[m2->getVar()->getIndex()] = m2->getNewLb();
+        ubs[m2->getVar()->getIndex()] = m2->getNewUb();
+      }
+    }
+
+    is_inf = false;
+    bnds.clear();
+    for (std::vector<RCVarRec>::const_iterator vit=rec.vars.begin();
+         vit!=rec.vars.end() && !is_inf; ++vit) {
+      lb = (lbs.count(vit->idx)) ? lbs[vit->idx] : vit->lb;
+      ub = (ubs.count(vit->idx)) ? ubs[vit->idx] : vit->ub;
+      v_type = rel_->getVariable(vit->idx)->getType();
+      for (UInt k=0; k<2; ++k) {
+        // first the reduced cost at the parent, then at the root.
+        if (0 == k) {
+          found = rcBound_(bestobj, rec.obj, vit->x, vit->r, v_type, lb, ub,
+                           &lu, &val);
+        } else {
+          found = rootDuals_ &&
+            rcBound_(bestobj, rootObj_, rootX_[vit->idx],
+                     rootDuals_[vit->idx], v_type, lb, ub, &lu, &val);
+        }
+        if (!found) {
+          continue;
+        }
+        if (Lower == lu) {
+          lb = val;
+        } else {
+          ub = val;
+        }
+        if (lb > ub + 1e-6) {
+          is_inf = true;
+          break;
+        }
+        bnd.idx = vit->idx;
+        bnd.lu = lu;
+        bnd.val = val;
+        bnds.push_back(bnd);
+      }
+    }
+    if (is_inf) {
+      pruned.push_back(*it);
+    } else if (!bnds.empty()) {
+      stats_->found += bnds.size();
+      pending_[(*it)->getId()].swap(bnds);
+    }
+    keep[parent->getId()] = rec;
+  }
+  stats_->pruned += pruned.size() - npruned;
+
+  // drop records of nodes that have no open children.
+  if (cur) {
+    rit = recs_.find(cur->getId());
+    if (rit != recs_.end()) {
+      keep[cur->getId()] = rit->second;
+    }
+  }
+  recs_.swap(keep);
+  stats_->time += (timer_->query() - start);
+}
+
+
 std::string RCHandler::getName() const
 {
   return "RCHandler (Reduced Cost Strengthening)";
@@ -239,7 +424,15 @@ void RCHandler::writeStats(std::ostream &out) const
   out << me_ << "Number of times lower bound changed = " << stats_->nlb
       << std::endl
       << me_ << "Number of times upper bound changed = " << stats_->nub
-      << std::endl
-      << me_ << "Time used = " << stats_->time << std::endl;
+      << std::endl;
+  if (treeFix_) {
+    out << me_ << "Passes over open nodes = " << stats_->passes << std::endl
+        << me_ << "Open nodes pruned = " << stats_->pruned << std::endl
+        << me_ << "Bounds of open nodes found = " << stats_->found
+        << std::endl
+        << me_ << "Bounds of open nodes tightened = " << stats_->tight
+        << std::endl;
+  }
+  out << me_ << "Time used = " << stats_->time << std::endl;
   return;
 }
@@ -14,7 +14,9 @@
 #ifndef MINOTAURRCHANDLER_H
 #define MINOTAURRCHANDLER_H
 
+#include <map>
 #include <stack>
+#include <vector>
 
 #include "Handler.h"
 #include "Engine.h"
@@ -28,9 +30,35 @@ namespace Minotaur {
 struct RCStats {
   size_t nlb;   /// Number of lower bound changed
   size_t nub;   /// Number of Upper Bound Changed             
+  size_t passes;  /// Number of passes over open nodes
+  size_t pruned;  /// Number of open nodes pruned in passes
+  size_t found;   /// Number of bounds of open nodes found in passes
+  size_t tight;   /// Number of bounds of open nodes applied when loaded
   double time;
 }; 
 
+/// Reduced cost of a variable at a node, with its bounds there.
+struct RCVarRec {
+  UInt idx;   /// Index of the variable in the relaxation
+  double x;   /// Value in the solution of the relaxation
+  double r;   /// Reduced cost
+  double lb;  /// Lower bound at the node
+  double ub;  /// Upper bound at the node
+};
+
+/// Reduced costs saved from the relaxation of a processed node.
+struct RCNodeRec {
+  double obj;                 /// Objective value of the relaxation
+  std::vector<RCVarRec> vars; /// Variables with large reduced costs
+};
+
+/// A bound found for an open node, applied when the node is loaded.
+struct RCBound {
+  UInt idx;       /// Index of the variable in the relaxation
+  BoundType lu;   /// Lower or upper
+  double val;     /// New value of the bound
+};
+
 class CutManager;
 class Timer;
 class SimpleCutMan;
@@ -96,8 +124,16 @@ public:
   // Base class method.
   void relaxNodeFull(NodePtr, RelaxationPtr, bool *) {};
 
-  // Base class method.
-  void relaxNodeInc(NodePtr, RelaxationPtr, bool *) {};
+  /**
+   * \brief Tighten bounds found for the node by the last call to
+   * tightenActiveNodes(), if any.
+   *
+   * A bound is applied only if it is tighter than the bound in rel. The
+   * modifications are added to the node so that they are undone with its
+   * other modifications. If a bound would cross the other bound, it is not
+   * applied and is_inf is set to true.
+   */
+  void relaxNodeInc(NodePtr node, RelaxationPtr rel, bool *is_inf);
 
  
   // Base class method. Used for tightening upper and lower bound of variables.
@@ -105,6 +141,32 @@ public:
                 CutManager *cutman, SolutionPoolPtr s_pool, ModVector &p_mods,
                 ModVector &q_mods, bool *sol_found, SeparationStatus *status);
  
+  /**
+   * \brief Save reduced costs of processed nodes so that open nodes can be
+   * tightened when the incumbent improves.
+   *
+   * \param[in] b True if reduced costs should be saved. Default is false.
+   */
+  void setTreeFix(bool b) { treeFix_ = b; };
+
+  /**
+   * \brief Use the reduced costs at the root and at parents of open nodes
+   * to find bounds of the open nodes, after the incumbent improved.
+   *
+   * The bounds of a node are those saved at its parent, changed by the
+   * branching modifications of the node. Nodes whose bounds cross are
+   * returned in pruned. Bounds that improve are saved and applied by
+   * relaxNodeInc() when the node is loaded. Saved reduced costs of nodes
+   * that are no longer parents of open nodes are dropped.
+   *
+   * \param[in] nodes Open nodes.
+   * \param[in] cur Node being processed. It is not tightened.
+   * \param[in] bestobj Value of the new incumbent.
+   * \param[out] pruned Nodes that can be pruned are appended to it.
+   */
+  void tightenActiveNodes(const NodePtrVector &nodes, NodePtr cur,
+                          double bestobj, NodePtrVector &pruned);
+
   // Show statistics.
   void writeStats(std::ostream &) const;
   
@@ -112,6 +174,21 @@ private:
   /// previous best known objective value (for root-node based Reduced Costs)
   double lastBest_;
 
+  /// Maximum number of nodes whose reduced costs are saved at a time.
+  static const UInt maxRecs_;
+
+  /// Bounds of open nodes, found in the last pass, by node id.
+  std::map<UInt, std::vector<RCBound> > pending_;
+
+  /// Reduced costs saved at processed nodes, by node id.
+  std::map<UInt, RCNodeRec> recs_;
+
+  /// Relaxation whose reduced costs are saved.
+  RelaxationPtr rel_;
+
+  /// If true, reduced costs of processed nodes are saved.
+  bool treeFix_;
+
   /// Pointer to environment's logger
   LoggerPtr logger_;
 
@@ -138,6 +215,21 @@ private:
   // \param[in] relaxation problem pointer  
   void copyRootDetails_(ConstSolutionPtr sol,  RelaxationPtr rel); 
 
+  // brief find a bound of a variable from its reduced cost, if the bound
+  // improves enough. Returns false if no bound is found.
+  // \param[in] incumbent solution value
+  // \param[in] relaxation object value
+  // \param[in] value of variable in the relaxation
+  // \param[in] reduced cost of variable
+  // \param[in] type, lower and upper bound of variable
+  // \param[out] bound type and new value of bound
+  bool rcBound_(double bestobj, double rel_obj, double xval, double r,
+                VariableType v_type, double lb, double ub, BoundType *lu,
+                double *val) const;
+
+  // brief save reduced costs and bounds at a node
+  void saveRec_(ConstSolutionPtr sol, NodePtr node, RelaxationPtr rel);
+
   // brief reduced cost fixing using dual information of node
   // \param[in] solution pointer
   // \param[in] relaxation problem pointer
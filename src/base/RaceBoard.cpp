@@ -0,0 +1,116 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file RaceBoard.cpp
+ * \brief Define class RaceBoard for sharing incumbents among solvers that
+ * run at the same time on copies of one problem.
+ * \author The Minotaur Team
+ */
+
+#include <cmath>
+
+#include "MinotaurConfig.h"
+#include "RaceBoard.h"
+
+using namespace Minotaur;
+
+RaceBoard::RaceBoard(UInt n_runners, UInt n_vars)
+  : bestOwner_(-1),
+    bestVal_(INFINITY),
+    nVars_(n_vars),
+    over_(false),
+    posted_(n_runners, 0),
+    status_(n_runners, NotStarted),
+    winner_(-1)
+{
+}
+
+
+RaceBoard::~RaceBoard()
+{
+  bestX_.clear();
+}
+
+
+void RaceBoard::finish(UInt id, SolveStatus status)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  assert(id < status_.size());
+  status_[id] = status;
+  if (winner_ < 0 && false == over_ &&
+      (SolvedOptimal == status || SolvedInfeasible == status ||
+       SolvedUnbounded == status || SolvedGapLimit == status)) {
+    winner_ = id;
+    over_ = true;
+  }
+}
+
+
+bool RaceBoard::getBest(double val, DoubleVector &x, double &best) const
+{
+  // cheap test first, so that nothing is locked at most nodes.
+  if (bestVal_.load(std::memory_order_relaxed) >= val) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  best = bestVal_;
+  x = bestX_;
+  return (best < val);
+}
+
+
+int RaceBoard::getBestOwner() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return bestOwner_;
+}
+
+
+UInt RaceBoard::getNumPosted(UInt id) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return posted_[id];
+}
+
+
+SolveStatus RaceBoard::getStatus(UInt id) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return status_[id];
+}
+
+
+int RaceBoard::getWinner() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return winner_;
+}
+
+
+bool RaceBoard::post(UInt id, const double *x, double val)
+{
+  if (val >= bestVal_.load(std::memory_order_relaxed)) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (val >= bestVal_) {
+    return false;
+  }
+  bestX_.assign(x, x + nVars_);
+  bestOwner_ = id;
+  ++posted_[id];
+  bestVal_ = val;
+  return true;
+}
+
+
+void RaceBoard::stop()
+{
+  over_ = true;
+}
+
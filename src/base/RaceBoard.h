@@ -0,0 +1,131 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file RaceBoard.h
+ * \brief Declare class RaceBoard for sharing incumbents among solvers that
+ * run at the same time on copies of one problem.
+ * \author The Minotaur Team
+ */
+
+#ifndef MINOTAURRACEBOARD_H
+#define MINOTAURRACEBOARD_H
+
+#include <atomic>
+#include <mutex>
+
+#include "Types.h"
+
+namespace Minotaur {
+
+  /**
+   * \brief A board on which runners of a race post their solutions and
+   * results.
+   *
+   * Each runner is a branch-and-bound with its own copy of the problem. The
+   * copies have the same variables in the same order, although a runner may
+   * append more variables to its copy. Only the first values of a solution,
+   * one for each variable of the original copy, are kept on the board.
+   *
+   * The best value is kept in an atomic, so that a runner can compare it
+   * with its upper bound at every node without locking. The race is over
+   * once a runner finishes with a proof: optimality, infeasibility,
+   * unboundedness or the gap limit. All other runners are then asked to
+   * stop.
+   */
+  class RaceBoard {
+  public:
+    /**
+     * \brief Create an empty board.
+     *
+     * \param [in] n_runners Number of runners.
+     * \param [in] n_vars Number of variables in the copies of the problem.
+     */
+    RaceBoard(UInt n_runners, UInt n_vars);
+
+    /// Destroy.
+    ~RaceBoard();
+
+    /**
+     * \brief Record the final status of a runner. The first runner that
+     * finishes with a proof wins, and the race is over.
+     */
+    void finish(UInt id, SolveStatus status);
+
+    /**
+     * \brief Copy the best solution if it is better than a given value.
+     *
+     * \param [in] val Value of the best solution known to the caller.
+     * \param [out] x The best solution, if better.
+     * \param [out] best Its value, if better.
+     * \return True if a better solution was copied.
+     */
+    bool getBest(double val, DoubleVector &x, double &best) const;
+
+    /// Return the runner that posted the best solution, or -1 if none.
+    int getBestOwner() const;
+
+    /// Return the best value posted so far.
+    double getBestValue() const
+    { return bestVal_.load(std::memory_order_relaxed); }
+
+    /// Return the number of better solutions posted by a runner.
+    UInt getNumPosted(UInt id) const;
+
+    /// Return the final status of a runner, NotStarted if not finished.
+    SolveStatus getStatus(UInt id) const;
+
+    /// Return the runner that won the race, or -1 if none did.
+    int getWinner() const;
+
+    /// Return true if the race is over and runners should stop.
+    bool isOver() const { return over_.load(std::memory_order_relaxed); }
+
+    /**
+     * \brief Post a solution found by a runner.
+     *
+     * \param [in] id The runner.
+     * \param [in] x The solution, with at least as many values as variables
+     * given in the constructor.
+     * \param [in] val Its objective value.
+     * \return True if it is better than the best solution on the board.
+     */
+    bool post(UInt id, const double *x, double val);
+
+    /// Stop the race without a winner.
+    void stop();
+
+  private:
+    /// Best solution posted.
+    DoubleVector bestX_;
+
+    /// Runner that posted bestX_, -1 if none.
+    int bestOwner_;
+
+    /// Value of bestX_.
+    std::atomic<double> bestVal_;
+
+    /// Guards everything except bestVal_ and over_.
+    mutable std::mutex mutex_;
+
+    /// Number of variables in bestX_.
+    UInt nVars_;
+
+    /// True once the race is over.
+    std::atomic<bool> over_;
+
+    /// Number of better solutions posted by each runner.
+    UIntVector posted_;
+
+    /// Final status of each runner.
+    std::vector<SolveStatus> status_;
+
+    /// Runner that won, -1 if none.
+    int winner_;
+  };
+}
+#endif
+
@@ -10,12 +10,24 @@
  * \author Ashutosh Mahajan, IIT Bombay
  */
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
 #include <iomanip>
 #include <sstream>
-#include <fstream>
-#include <cmath>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "MinotaurConfig.h"
+#ifdef MINOTAUR_ZLIB
+#include <zlib.h>
+#endif
 #include "Environment.h"
 #include "Function.h"
 #include "LinearFunction.h"
@@ -27,6 +39,312 @@
 using namespace Minotaur;
 const std::string Reader::me_ = "Reader: ";
 
+namespace {
+
+typedef std::string_view Token;
+
+/// Maximum number of words of a line that are looked at.
+const int MpsMaxTok = 6;
+
+/// Size of the buffer when the file is read in blocks.
+const size_t MpsBufSize = 1 << 20;
+
+/**
+ * Lines of an MPS file. A plain file is memory-mapped and the lines point
+ * into the mapping. A gzip-compressed file, or one that can not be mapped
+ * (e.g. a pipe), is read in large blocks into a buffer that grows if a
+ * line does not fit.
+ */
+class MpsInput {
+public:
+  MpsInput()
+    : bad_(false),
+      bBeg_(0),
+      bEnd_(0),
+      eof_(false),
+      fd_(-1),
+#ifdef MINOTAUR_ZLIB
+      gz_(0),
+#endif
+      map_(0),
+      mapLen_(0),
+      pos_(0)
+  {
+  }
+
+  ~MpsInput()
+  {
+    if (map_) {
+      munmap(const_cast<char *>(map_), mapLen_);
+    }
+#ifdef MINOTAUR_ZLIB
+    if (gz_) {
+      gzclose(gz_);
+    }
+#endif
+    if (fd_ >= 0) {
+      close(fd_);
+    }
+  }
+
+  /// True if reading from the file failed.
+  bool bad() const { return bad_; }
+
+  /**
+   * Get the next line, without the end of line characters. Returns false
+   * if there are no more lines. The line is valid until the next call.
+   */
+  bool getLine(const char *&b, const char *&e)
+  {
+    const char *nl;
+    if (map_) {
+      if (pos_ >= mapLen_) {
+        return false;
+      }
+      b = map_ + pos_;
+      nl = (const char *)memchr(b, '\n', mapLen_ - pos_);
+      e = nl ? nl : map_ + mapLen_;
+      pos_ = e - map_ + 1;
+    } else {
+      for (;;) {
+        nl = (const char *)memchr(buf_.data() + bBeg_, '\n', bEnd_ - bBeg_);
+        if (nl) {
+          b = buf_.data() + bBeg_;
+          e = nl;
+          bBeg_ = nl - buf_.data() + 1;
+          break;
+        } else if (eof_) {
+          if (bBeg_ == bEnd_) {
+            return false;
+          }
+          b = buf_.data() + bBeg_;
+          e = buf_.data() + bEnd_;
+          bBeg_ = bEnd_;
+          break;
+        }
+        fill_();
+      }
+    }
+    if (e > b && '\r' == e[-1]) {
+      --e;
+    }
+    return true;
+  }
+
+  /**
+   * Open the file. Returns 0 if successful, 2 if the file is compressed
+   * and zlib is not available, and 1 on other errors.
+   */
+  int open(const std::string &fname)
+  {
+    unsigned char magic[2];
+    struct stat st;
+    void *m;
+
+    fd_ = ::open(fname.c_str(), O_RDONLY);
+    if (fd_ < 0) {
+      return 1;
+    }
+    if (2 == pread(fd_, magic, 2, 0) && 0x1f == magic[0] &&
+        0x8b == magic[1]) {
+#ifdef MINOTAUR_ZLIB
+      gz_ = gzdopen(fd_, "rb");
+      if (!gz_) {
+        return 1;
+      }
+      fd_ = -1;  // closed by gzclose()
+      gzbuffer(gz_, 1 << 18);
+      buf_.resize(MpsBufSize);
+      return 0;
+#else
+      return 2;
+#endif
+    }
+    if (0 == fstat(fd_, &st) && S_ISREG(st.st_mode) && st.st_size > 0) {
+      m = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd_, 0);
+      if (MAP_FAILED != m) {
+        map_ = (const char *)m;
+        mapLen_ = st.st_size;
+        madvise(m, mapLen_, MADV_SEQUENTIAL);
+        return 0;
+      }
+    }
+    buf_.resize(MpsBufSize);
+    return 0;
+  }
+
+private:
+  bool bad_;
+  size_t bBeg_;  // start of unread data in buf_
+  size_t bEnd_;  // end of data in buf_
+  std::vector<char> buf_;
+  bool eof_;
+  int fd_;
+#ifdef MINOTAUR_ZLIB
+  gzFile gz_;
+#endif
+  const char *map_;
+  size_t mapLen_;
+  size_t pos_;  // start of the next line in map_
+
+  /// Move the partial line to the front of the buffer and read more.
+  void fill_()
+  {
+    long k;
+    if (bBeg_ > 0) {
+      memmove(buf_.data(), buf_.data() + bBeg_, bEnd_ - bBeg_);
+      bEnd_ -= bBeg_;
+      bBeg_ = 0;
+    }
+    if (bEnd_ == buf_.size()) {
+      buf_.resize(2 * buf_.size());
+    }
+#ifdef MINOTAUR_ZLIB
+    if (gz_) {
+      k = gzread(gz_, buf_.data() + bEnd_, (unsigned)(buf_.size() - bEnd_));
+    } else
+#endif
+    {
+      k = read(fd_, buf_.data() + bEnd_, buf_.size() - bEnd_);
+    }
+    if (k > 0) {
+      bEnd_ += k;
+    } else {
+      bad_ = (k < 0);
+      eof_ = true;
+    }
+  }
+};
+
+
+/**
+ * Names of rows or columns. The characters of all names are kept in one
+ * array and indexed by an open-addressing hash table, so a lookup does not
+ * allocate. Names get indices 0, 1, ... in the order they are added.
+ */
+class NameTable {
+public:
+  NameTable()
+    : offs_(1, 0),
+      slots_(1024, -1)
+  {
+  }
+
+  /// Add a name that is not in the table, and return its index.
+  int add(Token s)
+  {
+    int i = (int)hashes_.size();
+    size_t h;
+    if (2 * (hashes_.size() + 1) > slots_.size()) {
+      grow_();
+    }
+    hashes_.push_back(hash_(s));
+    chars_.insert(chars_.end(), s.begin(), s.end());
+    offs_.push_back(chars_.size());
+    for (h = hashes_[i] & (slots_.size() - 1); slots_[h] >= 0;
+         h = (h + 1) & (slots_.size() - 1)) {
+    }
+    slots_[h] = i;
+    return i;
+  }
+
+  /// Index of a name, or -1 if it is not in the table.
+  int find(Token s) const
+  {
+    std::uint64_t hs = hash_(s);
+    for (size_t h = hs & (slots_.size() - 1); slots_[h] >= 0;
+         h = (h + 1) & (slots_.size() - 1)) {
+      if (hashes_[slots_[h]] == hs && name(slots_[h]) == s) {
+        return slots_[h];
+      }
+    }
+    return -1;
+  }
+
+  /// Name with index i. Valid until the next call to add().
+  Token name(int i) const
+  {
+    return Token(chars_.data() + offs_[i], offs_[i + 1] - offs_[i]);
+  }
+
+private:
+  std::vector<char> chars_;
+  std::vector<std::uint64_t> hashes_;
+  std::vector<size_t> offs_;  // name i is chars_[offs_[i], offs_[i+1])
+  std::vector<int> slots_;    // size is a power of two, -1 if empty
+
+  void grow_()
+  {
+    size_t h;
+    slots_.assign(2 * slots_.size(), -1);
+    for (size_t i = 0; i < hashes_.size(); ++i) {
+      for (h = hashes_[i] & (slots_.size() - 1); slots_[h] >= 0;
+           h = (h + 1) & (slots_.size() - 1)) {
+      }
+      slots_[h] = (int)i;
+    }
+  }
+
+  // FNV-1a
+  static std::uint64_t hash_(Token s)
+  {
+    std::uint64_t h = 14695981039346656037ULL;
+    for (char ch : s) {
+      h = (h ^ (unsigned char)ch) * 1099511628211ULL;
+    }
+    return h;
+  }
+};
+
+
+bool compareCol(const std::pair<int, double> &a,
+                const std::pair<int, double> &b)
+{
+  return a.first < b.first;
+}
+
+
+/// Split [b, e) into words separated by white space. At most MpsMaxTok
+/// words are saved in t. Returns the number of words saved.
+int splitLine(const char *b, const char *e, Token *t)
+{
+  const char *s;
+  int n = 0;
+  while (n < MpsMaxTok) {
+    while (b < e && (' ' == *b || '\t' == *b)) {
+      ++b;
+    }
+    if (b == e) {
+      break;
+    }
+    s = b;
+    while (b < e && ' ' != *b && '\t' != *b) {
+      ++b;
+    }
+    t[n++] = Token(s, b - s);
+  }
+  return n;
+}
+
+
+/// Convert a word to a double. Returns false if it is not a number.
+bool toDouble(Token t, double &d)
+{
+  char s[64];
+  char *end;
+  if (t.size() >= sizeof(s)) {
+    std::string str(t);
+    d = strtod(str.c_str(), &end);
+    return (end == str.c_str() + str.size());
+  }
+  memcpy(s, t.data(), t.size());
+  s[t.size()] = '\0';
+  d = strtod(s, &end);
+  return (end == s + t.size() && t.size() > 0);
+}
+}
+
+
 Reader::Reader(EnvPtr env)
   : env_(env)
 {
@@ -41,42 +359,44 @@ Reader::~Reader()
 
 ProblemPtr Reader::readMps(std::string fname, int &err)
 {
-  std::ifstream fs;
-  std::string line, word, word2, word3, word4;
+  MpsInput in;
+  const char *lb_, *le_;      // current line
+  Token t[MpsMaxTok];         // words in the current line
+  int nt;                     // number of words in the current line
   std::string rhsid = "";
   std::string rangeid = "";
   std::string bndid = "";  // second word of all lines in BOUNDS section must
                            // be common across the file.
-  std::string qcname;  //name of the row for QCMatrix
   ProblemPtr p = 0;
-  std::istringstream iss;
-  int lcnt, m, n, r;
-  bool comment;
+  int lcnt, m, n, r, c;
+  int r2 = 0, c2 = 0;
   VariableType vtype = Continuous;
-  std::vector<LinearFunctionPtr> lfs;
-  std::vector<QuadraticFunctionPtr> qfs;
+  NameTable rownames, colnames;
   std::vector<char> rowtypes;
-  std::vector<std::string> rownamesvec;
   std::vector<double> rowrhs, rowranges;
-  std::string objname;
-  std::map<std::string, int> rownames;
-  std::map<std::string, int> colnames;
+  std::vector<QuadraticFunctionPtr> qfs;  // created only for quadratic rows
+  std::vector<int> nzrow, nzcol;          // nonzeros of COLUMNS section
+  std::vector<double> nzval;
+  std::vector<size_t> rbeg;
+  std::vector<std::pair<int, double> > rterms;
+  LinearFunctionPtr lf;
   VariablePtr v, v2;
   FunctionPtr f;
   double dval, lb, ub;
-  std::string::size_type echars;  // size of string
-  QuadraticFunction *qfo = NULL;
-  QuadraticFunction *qfc = 0;  // quadratic function being populated in
-                               // QCMATRIX section
+  double dval2 = 0.0;
+  int objrow = -1;  // first N row, it gets the QUADOBJ terms
+  int qcrow = -1;   // row being populated in QCMATRIX section
   MpsSec section = MpsNone;
   ObjectiveType ot = Minimize;
 
-  err = 0;
-  fs.open(fname.c_str());
-  if (!fs.is_open()) {
+  err = in.open(fname);
+  if (2 == err) {
+    logger_->errStream() << me_ << "file " << fname << " is compressed, "
+                         << "but Minotaur was built without zlib" << std::endl;
+    return 0;
+  } else if (err) {
     logger_->errStream() << me_ << "could not open file " << fname
                          << " for reading" << std::endl;
-    err = 1;
     return 0;
   }
 
@@ -88,80 +408,71 @@ ProblemPtr Reader::readMps(std::string fname, int &err)
   vtype = Continuous;
   m = n = 0;
   lcnt = 0;
-  while (0 == err && MpsEnd != section && std::getline(fs, line)) {
-    iss.clear();    // deletes only flags internal to iss
-    iss.str(line);  // convert line into ifstream
+  while (0 == err && MpsEnd != section && in.getLine(lb_, le_)) {
     ++lcnt;
-
-
-    if (!(iss >> word)) {
+    nt = splitLine(lb_, le_, t);
+    if (0 == nt) {
       continue;  // empty line
     }
 
-    comment = false;
-    if ('*' == word[0]) {
-      comment = true;
+    if ('*' == t[0][0]) {
       continue;  // ignore line, because it is a comment
     }
 
     // check if a new section starts
-    if (line[0] == word[0]) {  // we have no white space in the beginning
-      if (word == "NAME") {
+    if (t[0].data() == lb_) {  // we have no white space in the beginning
+      if (t[0] == "NAME") {
         section = MpsNone;  // back to new unknown section. This should not be
                             // set to MpsName
         continue;
-      } else if (word == "OBJSENSE") {
-        if (!(iss >> word2)) {
+      } else if (t[0] == "OBJSENSE") {
+        if (nt < 2) {
           logger_->errStream() << me_ << "ERROR: Missing value of OBJSENSE "
                                << "in line " << lcnt << std::endl;
           err = 10;
-        } else if (word2 == "MAX") {
+        } else if (t[1] == "MAX") {
           ot = Maximize;
         } else {
           logger_->msgStream(LogError)
-              << me_ << "warning: OBJSENSE " << word2 << " ignored on line "
+              << me_ << "warning: OBJSENSE " << t[1] << " ignored on line "
               << lcnt << std::endl;
         }
         continue;
-      } else if (word == "ROWS") {
+      } else if (t[0] == "ROWS") {
         section = MpsRows;
         continue;
-      } else if (word == "COLUMNS") {
+      } else if (t[0] == "COLUMNS") {
         section = MpsCols;
         continue;
-      } else if (word == "RHS") {
+      } else if (t[0] == "RHS") {
         section = MpsRhs;
         continue;
-      } else if (word == "RANGES") {
+      } else if (t[0] == "RANGES") {
         section = MpsRang;
         continue;
-      } else if (word == "BOUNDS") {
+      } else if (t[0] == "BOUNDS") {
         section = MpsBoun;
         continue;
-      } else if (word == "QUADOBJ") {
+      } else if (t[0] == "QUADOBJ") {
         section = MpsQO;
         continue;
-      } else if (word == "QCMATRIX") {
+      } else if (t[0] == "QCMATRIX") {
         section = MpsQC;
         // read the name of the quad constraint now
-        if (!(iss >> word2)) {
+        if (nt < 2) {
           logger_->errStream() << me_ << "ERROR: Missing row name in line "
                                << lcnt << std::endl;
           err = 10;
-        } else if (rownames.find(word2) == rownames.end()) {
-          rownames[word2] = m;
-          rownamesvec.push_back(word2);
-          lfs.push_back(new LinearFunction());
-          qfc = new QuadraticFunction();
-          qfs.push_back(qfc);
-          ++m;
-        } else {
-          r = rownames[word2];
-          qfc = qfs[r];
+        } else if ((qcrow = rownames.find(t[1])) < 0) {
+          logger_->errStream()
+              << me_ << "ERROR: rowname " << t[1] << " in line " << lcnt
+              << " undeclared " << std::endl;
+          err = 10;
+        } else if (!qfs[qcrow]) {
+          qfs[qcrow] = new QuadraticFunction();
         }
-        qcname = word2;
         continue;
-      } else if (word == "ENDATA") {
+      } else if (t[0] == "ENDATA") {
         section = MpsEnd;
         continue;
       }
@@ -170,66 +481,61 @@ ProblemPtr Reader::readMps(std::string fname, int &err)
     // we are in an existing section
     switch (section) {
     case (MpsNone):
-      if (!comment) {
-        logger_->errStream() << me_ << "error parsing the MPS file in line "
-                             << lcnt << std::endl
-                             << line << std::endl;
-        err = 10;
-      }
+      logger_->errStream() << me_ << "error parsing the MPS file in line "
+                           << lcnt << std::endl
+                           << std::string(lb_, le_) << std::endl;
+      err = 10;
       break;
     case (MpsName):  // NAME can be ignored for now
       break;
     case (MpsRows):  // ROWS
-      if (word[0] == 'N' || word[0] == 'G' || word[0] == 'L' ||
-          word[0] == 'E') {
-        rowtypes.push_back(word[0]);
-        rowrhs.push_back(INFINITY);
-        rowranges.push_back(INFINITY);
-
-        if (!(iss >> word)) {  // read the next word
+      if (t[0][0] == 'N' || t[0][0] == 'G' || t[0][0] == 'L' ||
+          t[0][0] == 'E') {
+        if (nt < 2) {  // read the next word
           logger_->errStream() << me_ << "ERROR: Missing row name in line "
                                << lcnt << std::endl;
           err = 10;
-        } else if (rownames.find(word) == rownames.end()) {
-          rownames[word] = m;
-          rownamesvec.push_back(word);
-          lfs.push_back(new LinearFunction());
-          qfs.push_back(new QuadraticFunction());
-          if ('N' == rowtypes[m] && !qfo) {
-            qfo = qfs[m];
+        } else if (rownames.find(t[1]) < 0) {
+          rownames.add(t[1]);
+          rowtypes.push_back(t[0][0]);
+          rowrhs.push_back(INFINITY);
+          rowranges.push_back(INFINITY);
+          qfs.push_back(0);
+          if ('N' == rowtypes[m] && objrow < 0) {
+            objrow = m;
           }
           ++m;
         } else {
           logger_->errStream()
-              << me_ << "ERROR: Row " << word
+              << me_ << "ERROR: Row " << t[1]
               << " seen more than once in the ROWS section of MPS file "
               << std::endl;
           err = 10;
         }
 
-        if (0 == err && (iss >> word)) {  // check for eol
+        if (0 == err && nt > 2) {  // check for eol
           logger_->errStream()
               << me_ << "ERROR: line " << lcnt << " should have ended before "
-              << word << std::endl;
+              << t[2] << std::endl;
           err = 10;
         }
       } else {
-        logger_->errStream() << me_ << "Unexpected word " << word
+        logger_->errStream() << me_ << "Unexpected word " << t[0]
                              << " in line " << lcnt << std::endl;
         err = 10;
       }
       break;
     case (MpsCols):  // COLUMNS
-      // Read the next two words. Every line must have 3 or 5 words
-      if (!(iss >> word2) || !(iss >> word3)) {
+      // Every line must have 3 or 5 words
+      if (nt < 3) {
         logger_->errStream() << me_ << "ERROR: not enough fields in column "
                              << "line " << lcnt << std::endl;
         err = 10;
         break;
       }
 
-      if (word2 == "'MARKER'") {
-        if (word3 == "'INTORG'") {
+      if (t[1] == "'MARKER'") {
+        if (t[2] == "'INTORG'") {
           if (Integer == vtype) {
             logger_->errStream()
                 << me_ << "ERROR: 'INTORG' seen within "
@@ -238,7 +544,7 @@ ProblemPtr Reader::readMps(std::string fname, int &err)
           } else {
             vtype = Integer;
           }
-        } else if (word3 == "'INTEND'") {
+        } else if (t[2] == "'INTEND'") {
           if (Continuous == vtype) {
             logger_->errStream()
                 << me_ << "ERROR: 'INTEND' seen outside "
@@ -248,153 +554,133 @@ ProblemPtr Reader::readMps(std::string fname, int &err)
             vtype = Continuous;
           }
         } else {
-          logger_->errStream() << me_ << "ERROR: Unknown marker " << word3
+          logger_->errStream() << me_ << "ERROR: Unknown marker " << t[2]
                                << " in line " << lcnt << std::endl;
           err = 10;
         }
-      } else if (rownames.find(word2) == rownames.end()) {
+      } else if ((r = rownames.find(t[1])) < 0) {
         logger_->errStream()
-            << me_ << "ERROR: rowname " << word2 << " in line " << lcnt
+            << me_ << "ERROR: rowname " << t[1] << " in line " << lcnt
             << " undeclared " << std::endl;
         break;
       } else {
-        if (colnames.find(word) == colnames.end()) {
-          v = p->newVariable(0, INFINITY, vtype, word);
-          colnames[word] = n;
+        // we may have two more terms (but not one)
+        if (nt == 4) {
+          logger_->errStream()
+              << me_ << "ERROR: not enough fields in column "
+              << "line " << lcnt << std::endl;
+          err = 10;
+          break;
+        } else if (nt > 4 && (r2 = rownames.find(t[3])) < 0) {
+          logger_->errStream()
+              << me_ << "ERROR: rowname " << t[3] << " in line " << lcnt
+              << " undeclared " << std::endl;
+          err = 10;
+          break;
+        } else if (!toDouble(t[2], dval) || (nt > 4 && !toDouble(t[4], dval2))) {
+          logger_->errStream() << me_ << "ERROR: bad number in line "
+                               << lcnt << std::endl;
+          err = 10;
+          break;
+        }
+        if ((c = colnames.find(t[0])) < 0) {
+          p->newVariable(0, INFINITY, vtype, std::string(t[0]));
+          c = colnames.add(t[0]);
           ++n;
-        } else {
-          v = p->getVariable(colnames[word]);
         }
-        dval = std::stod(word3, &echars);
-        r = rownames[word2];
-        lfs[r]->incTerm(v, dval);
-
-        // we may have two more terms (but not one)
-        if (iss >> word2) {
-          if (!(iss >> word3)) {
-            logger_->errStream()
-                << me_ << "ERROR: not enough fields in column "
-                << "line " << lcnt << std::endl;
-            err = 10;
-            break;
-          } else if (rownames.find(word2) == rownames.end()) {
-            logger_->errStream()
-                << me_ << "ERROR: rowname " << word2 << " in line " << lcnt
-                << " undeclared " << std::endl;
-            err = 10;
-            break;
-          }
-          dval = std::stod(word3, &echars);
-          r = rownames[word2];
-          lfs[r]->incTerm(v, dval);
+        nzrow.push_back(r);
+        nzcol.push_back(c);
+        nzval.push_back(dval);
+        if (nt > 4) {
+          nzrow.push_back(r2);
+          nzcol.push_back(c);
+          nzval.push_back(dval2);
         }
       }
       break;
     case (MpsRhs):  // RHS
       if (rhsid == "") {
-        rhsid = word;
-      } else if (word != rhsid) {
+        rhsid = t[0];
+      } else if (t[0] != rhsid) {
         logger_->msgStream(LogError)
             << me_ << rhsid << " ignored in line " << lcnt << std::endl;
         break;
       }
-      if (!(iss >> word2) || !(iss >> word3)) {
-        logger_->errStream() << me_ << "ERROR: not enough fields in column "
+      if (nt < 3) {
+        logger_->errStream() << me_ << "ERROR: not enough fields in rhs "
                              << "line " << lcnt << std::endl;
         err = 10;
         break;
-      } else if (rownames.find(word2) == rownames.end()) {
-        logger_->errStream()
-            << me_ << "ERROR: rowname " << word2 << " in line " << lcnt
-            << " undeclared " << std::endl;
-        break;
-      } else {
-        dval = std::stod(word3, &echars);
-        r = rownames[word2];
+      }
+      for (int k = 1; k + 1 < nt && k < 5; k += 2) {
+        if ((r = rownames.find(t[k])) < 0) {
+          logger_->errStream()
+              << me_ << "ERROR: rowname " << t[k] << " in line " << lcnt
+              << " undeclared " << std::endl;
+          if (k > 1) {
+            err = 10;
+          }
+          break;
+        } else if (!toDouble(t[k + 1], dval)) {
+          logger_->errStream() << me_ << "ERROR: bad number in line "
+                               << lcnt << std::endl;
+          err = 10;
+          break;
+        }
         if (rowrhs[r] != INFINITY) {  // if previously set, warn
           logger_->msgStream(LogExtraInfo)
-              << me_ << "Warning: overwriting rhs for row " << word2
+              << me_ << "Warning: overwriting rhs for row " << t[k]
               << " in line " << lcnt << std::endl;
         }
         rowrhs[r] = dval;
-
-        // we may have two more terms (but not one)
-        if (iss >> word2) {
-          if (!(iss >> word3)) {
-            logger_->errStream() << me_ << "ERROR: not enough fields in rhs "
-                                 << "line " << lcnt << std::endl;
-            err = 10;
-            break;
-          } else if (rownames.find(word2) == rownames.end()) {
-            logger_->errStream()
-                << me_ << "ERROR: rowname " << word2 << " in line " << lcnt
-                << " undeclared " << std::endl;
-            err = 10;
-            break;
-          }
-          dval = std::stod(word3, &echars);
-          r = rownames[word2];
-          if (rowrhs[r] != INFINITY) {  // if previously set, warn
-            logger_->msgStream(LogExtraInfo)
-                << me_ << "Warning: overwriting rhs for row " << word2
-                << " in line " << lcnt << std::endl;
-          }
-          rowrhs[r] = dval;
-        }
+      }
+      if (0 == err && 4 == nt) {
+        logger_->errStream() << me_ << "ERROR: not enough fields in rhs "
+                             << "line " << lcnt << std::endl;
+        err = 10;
       }
       break;
     case (MpsRang):  // RANGES
       if (rangeid == "") {
-        rangeid = word;
-      } else if (word != rangeid) {
+        rangeid = t[0];
+      } else if (t[0] != rangeid) {
         logger_->msgStream(LogError)
             << me_ << rangeid << " ignored in line " << lcnt << std::endl;
         break;
       }
-      if (!(iss >> word2) || !(iss >> word3)) {
+      if (nt < 3) {
         logger_->errStream() << me_ << "ERROR: not enough fields in ranges "
                              << "line " << lcnt << std::endl;
         err = 10;
         break;
-      } else if (rownames.find(word2) == rownames.end()) {
-        logger_->errStream()
-            << me_ << "ERROR: rowname " << word2 << " in line " << lcnt
-            << " undeclared " << std::endl;
-        break;
-      } else {
-        dval = std::stod(word3, &echars);
-        r = rownames[word2];
-        if (rowranges[r] != INFINITY) {  // warn
-          logger_->msgStream(LogExtraInfo)
-              << me_ << "Warning: overwriting range for row " << word2
-              << " in line " << lcnt << std::endl;
-        }
-        rowranges[r] = dval;
       }
-
-      // we may have two more terms (but not one)
-      if (iss >> word2) {
-        if (!(iss >> word3)) {
-          logger_->errStream() << me_ << "ERROR: not enough fields in ranges "
-                               << "line " << lcnt << std::endl;
-          err = 10;
-          break;
-        } else if (rownames.find(word2) == rownames.end()) {
+      for (int k = 1; k + 1 < nt && k < 5; k += 2) {
+        if ((r = rownames.find(t[k])) < 0) {
           logger_->errStream()
-              << me_ << "ERROR: rowname " << word2 << " in line " << lcnt
+              << me_ << "ERROR: rowname " << t[k] << " in line " << lcnt
               << " undeclared " << std::endl;
+          if (k > 1) {
+            err = 10;
+          }
+          break;
+        } else if (!toDouble(t[k + 1], dval)) {
+          logger_->errStream() << me_ << "ERROR: bad number in line "
+                               << lcnt << std::endl;
           err = 10;
           break;
         }
-        dval = std::stod(word3, &echars);
-        r = rownames[word2];
         if (rowranges[r] != INFINITY) {  // warn
           logger_->msgStream(LogExtraInfo)
-              << me_ << "Warning: overwriting range for row " << word2
+              << me_ << "Warning: overwriting range for row " << t[k]
               << " in line " << lcnt << std::endl;
         }
         rowranges[r] = dval;
       }
+      if (0 == err && 4 == nt) {
+        logger_->errStream() << me_ << "ERROR: not enough fields in ranges "
+                             << "line " << lcnt << std::endl;
+        err = 10;
+      }
       break;
     case (MpsBoun):  // BOUNDS
       // If a bound on a variable is seen more than once, the later bound
@@ -403,40 +689,46 @@ ProblemPtr Reader::readMps(std::string fname, int &err)
       // UP BND x1 40
       // UP BND x1 50
       // then the ub of x1 is set to 50.
-      if (!(iss >> word2) || !(iss >> word3)) {
+      if (nt < 3) {
         logger_->errStream() << me_ << "ERROR: not enough fields in BOUNDS "
                              << "line " << lcnt << std::endl;
         err = 10;
         break;
       } else if (bndid == "") {
-        bndid = word2;
-      } else if (word2 != bndid) {
+        bndid = t[1];
+      } else if (t[1] != bndid) {
         logger_->msgStream(LogError)
             << me_ << "Warning: " << bndid << " ignored in line " << lcnt
             << std::endl;
         break;
-      } else if (colnames.find(word3) == colnames.end()) {
+      }
+      if ((c = colnames.find(t[2])) < 0) {
         logger_->errStream()
-            << me_ << "ERROR: column name " << word2 << " in line " << lcnt
+            << me_ << "ERROR: column name " << t[2] << " in line " << lcnt
             << " undeclared " << std::endl;
         err = 10;
         break;
       }
 
       dval = INFINITY;
-      if (iss >> word4) {
-        dval = std::stod(word4, &echars);
-      } else if (word3 == "LO" || word3 == "UP" || word3 == "FX") {
+      if (nt > 3) {
+        if (!toDouble(t[3], dval)) {
+          logger_->errStream() << me_ << "ERROR: bad number in line "
+                               << lcnt << std::endl;
+          err = 10;
+          break;
+        }
+      } else if (t[0] == "LO" || t[0] == "UP" || t[0] == "FX") {
         logger_->msgStream(LogError)
-            << me_ << "ERROR: " << word3 << " key requires a number in line "
+            << me_ << "ERROR: " << t[0] << " key requires a number in line "
             << lcnt << std::endl;
         err = 10;
         break;
       }
-      v = p->getVariable(colnames[word3]);
-      if (word == "LO") {
+      v = p->getVariable(c);
+      if (t[0] == "LO") {
         p->changeBound(v, Lower, dval);
-      } else if (word == "UP") {
+      } else if (t[0] == "UP") {
         if (dval < 0.0) {
           if (v->getLb() == 0.0) {
             p->changeBound(v, -INFINITY, dval);
@@ -446,53 +738,66 @@ ProblemPtr Reader::readMps(std::string fname, int &err)
         } else {
           p->changeBound(v, Upper, dval);
         }
-      } else if (word == "FX") {
+      } else if (t[0] == "FX") {
         p->changeBound(v, dval, dval);
-      } else if (word == "FR") {
+      } else if (t[0] == "FR") {
         p->changeBound(v, -INFINITY, INFINITY);
-      } else if (word == "MI") {
+      } else if (t[0] == "MI") {
         p->changeBound(v, Lower, -INFINITY);
-      } else if (word == "PL") {
+      } else if (t[0] == "PL") {
         p->changeBound(v, Upper, INFINITY);
-      } else if (word == "BV") {
+      } else if (t[0] == "BV") {
         p->setVarType(v, Binary);
-      } else if (word == "LI") {
+      } else if (t[0] == "LI") {
         p->setVarType(v, Integer);
         p->changeBound(v, Lower, dval);
-      } else if (word == "UI") {
+      } else if (t[0] == "UI") {
         p->setVarType(v, Integer);
         p->changeBound(v, Upper, dval);
       } else {
-        logger_->errStream() << me_ << "ERROR: unknown bound type " << word
+        logger_->errStream() << me_ << "ERROR: unknown bound type " << t[0]
                              << " in line " << lcnt << std::endl;
         err = 10;
         break;
       }
       break;
     case (MpsQO):  // Quadratic Objective
-      if (!(iss >> word2) || !(iss >> word3)) {
-        logger_->errStream() << me_ << "ERROR: not enough fields in QUADOBJ "
-                             << "line " << lcnt << std::endl;
-        err = 10;
-        break;
-      }
-      v = p->getVariable(colnames[word]);
-      v2 = p->getVariable(colnames[word2]);
-      dval = std::stod(word3, &echars);
-      qfo->incTerm(v, v2, dval * 0.5);
-      break;
     case (MpsQC):  // Quadratic Constraint
       // We should have three words in this row (var1 var2 coeff)
-      if (!(iss >> word2) || !(iss >> word3)) {
-        logger_->errStream() << me_ << "ERROR: not enough fields in QCMATRIX "
-                             << "line " << lcnt << std::endl;
+      r = (MpsQO == section) ? objrow : qcrow;
+      if (nt < 3) {
+        logger_->errStream() << me_ << "ERROR: not enough fields in "
+                             << ((MpsQO == section) ? "QUADOBJ" : "QCMATRIX")
+                             << " line " << lcnt << std::endl;
+        err = 10;
+        break;
+      } else if (r < 0) {
+        logger_->errStream() << me_ << "ERROR: no row for quadratic terms "
+                             << "in line " << lcnt << std::endl;
+        err = 10;
+        break;
+      } else if ((c = colnames.find(t[0])) < 0 ||
+                 (c2 = colnames.find(t[1])) < 0) {
+        logger_->errStream()
+            << me_ << "ERROR: column name in line " << lcnt
+            << " undeclared " << std::endl;
         err = 10;
         break;
+      } else if (!toDouble(t[2], dval)) {
+        logger_->errStream() << me_ << "ERROR: bad number in line "
+                             << lcnt << std::endl;
+        err = 10;
+        break;
+      }
+      if (!qfs[r]) {
+        qfs[r] = new QuadraticFunction();
+      }
+      v = p->getVariable(c);
+      v2 = p->getVariable(c2);
+      if (MpsQO == section) {
+        qfs[r]->incTerm(v, v2, dval * 0.5);
       } else {
-        v = p->getVariable(colnames[word]);
-        v2 = p->getVariable(colnames[word2]);
-        dval = std::stod(word3, &echars);
-        qfc->incTerm(v, v2, dval);
+        qfs[r]->incTerm(v, v2, dval);
       }
       break;
     case (MpsEnd):
@@ -505,15 +810,53 @@ ProblemPtr Reader::readMps(std::string fname, int &err)
       break;
     }
   }
-  fs.close();
+  if (0 == err && in.bad()) {
+    logger_->errStream() << me_ << "error reading file " << fname
+                         << " near line " << lcnt << std::endl;
+    err = 10;
+  }
+
+  // sort the nonzeros by rows. Within a row, they are already sorted by
+  // columns unless a column appears in more than one block.
+  rbeg.assign(m + 2, 0);
+  for (size_t k = 0; k < nzrow.size(); ++k) {
+    ++rbeg[nzrow[k] + 2];
+  }
+  for (int i = 2; i < m + 2; ++i) {
+    rbeg[i] += rbeg[i - 1];
+  }
+  rterms.resize(nzrow.size());
+  for (size_t k = 0; k < nzrow.size(); ++k) {
+    rterms[rbeg[nzrow[k] + 1]++] = std::make_pair(nzcol[k], nzval[k]);
+  }
+  logger_->msgStream(LogExtraInfo)
+      << me_ << "read " << m << " rows, " << n << " columns and "
+      << nzrow.size() << " nonzeros in " << lcnt << " lines" << std::endl;
+  std::vector<int>().swap(nzrow);
+  std::vector<int>().swap(nzcol);
+  std::vector<double>().swap(nzval);
 
   // put all cons and obj in p
   for (int i = 0; i < m; ++i) {
+    lf = new LinearFunction();
+    if (!std::is_sorted(rterms.begin() + rbeg[i], rterms.begin() + rbeg[i + 1],
+                        compareCol)) {
+      std::stable_sort(rterms.begin() + rbeg[i],
+                       rterms.begin() + rbeg[i + 1], compareCol);
+    }
+    for (size_t k = rbeg[i]; k < rbeg[i + 1];) {
+      c = rterms[k].first;
+      dval = rterms[k].second;
+      for (++k; k < rbeg[i + 1] && rterms[k].first == c; ++k) {
+        dval += rterms[k].second;
+      }
+      lf->addTerm(p->getVariable(c), dval);
+    }
 
-    if (qfs[i]->getNumTerms() > 0) {
-      f = new Function(lfs[i], qfs[i]);
+    if (qfs[i] && qfs[i]->getNumTerms() > 0) {
+      f = new Function(lf, qfs[i]);
     } else {
-      f = new Function(lfs[i]);
+      f = new Function(lf);
       delete qfs[i];
       qfs[i] = NULL;
     }
@@ -552,15 +895,15 @@ ProblemPtr Reader::readMps(std::string fname, int &err)
       break;
     }
     if (rowtypes[i] != 'N') {
-      p->newConstraint(f, lb, ub, rownamesvec[i]);
+      p->newConstraint(f, lb, ub, std::string(rownames.name(i)));
     } else if (p->getObjective()) {
       logger_->msgStream(LogError) << me_ << "Warning: ignored objective "
-                                   << rownamesvec[i] << std::endl;
+                                   << rownames.name(i) << std::endl;
       delete f;
       f = 0;
     } else {
       lb = (rowrhs[i] == INFINITY) ? 0.0 : -rowrhs[i];
-      p->newObjective(f, lb, ot, rownamesvec[i]);
+      p->newObjective(f, lb, ot, std::string(rownames.name(i)));
     }
   }
 
@@ -27,7 +27,9 @@ namespace Minotaur {
   /**
    * \brief Read an LP or MILP instance from an MPS file
    *
-   * MPS files are read following the CPLEX 12.8 documentation
+   * MPS files are read following the CPLEX 12.8 documentation. The file is
+   * memory-mapped when possible and gzip-compressed files are read as a
+   * stream if Minotaur is built with zlib.
    */
   class Reader {
   public:
@@ -37,7 +39,13 @@ namespace Minotaur {
     /// Destroy
     ~Reader();
 
-    /// Read a file and return the Problem object
+    /**
+     * \brief Read an MPS file and return the Problem object.
+     *
+     * \param [in] fname Name of the file. It may be compressed with gzip.
+     * \param [out] err Nonzero if the file could not be opened or has
+     * errors.
+     */
     ProblemPtr readMps(std::string fname, int &err);
 
     /// Read a solution file and store it in Problem for debugging
@@ -0,0 +1,245 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file RingLogger.cpp
+ * \brief Define class RingLogger for logging from several threads without
+ * locks.
+ * \author The Minotaur Team
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <streambuf>
+#include <string>
+
+#include "MinotaurConfig.h"
+#include "RingLogger.h"
+
+#if USE_OPENMP
+#include <omp.h>
+#endif
+
+using namespace Minotaur;
+
+namespace Minotaur {
+  /// A message written by a thread.
+  struct RingLogRec {
+    double t;          ///> Time when the message was published.
+    UInt th;           ///> Thread that wrote it.
+    LogLevel level;    ///> Level of the message.
+    std::string text;  ///> The message.
+  };
+
+  /// Stream buffer of a thread. Collects text until flushed.
+  class RingLogBuf : public std::streambuf {
+  public:
+    RingLogBuf(RingLogger *log, RingLogThread *th) : log_(log), th_(th) {}
+    std::string line;
+
+  protected:
+    int_type overflow(int_type c)
+    {
+      if (c != traits_type::eof()) {
+        line.push_back((char) c);
+      }
+      return c;
+    }
+
+    std::streamsize xsputn(const char *s, std::streamsize n)
+    {
+      line.append(s, n);
+      return n;
+    }
+
+    int sync()
+    {
+      if (!line.empty()) {
+        log_->publish(th_);
+      }
+      return 0;
+    }
+
+  private:
+    RingLogger *log_;
+    RingLogThread *th_;
+  };
+
+  /// Stream and ring buffer of a thread.
+  struct RingLogThread {
+    RingLogThread(RingLogger *log, UInt i, UInt cap)
+      : buf(log, this), os(&buf), id(i), level(LogInfo), recs(cap),
+        head(0), tail(0) {}
+    RingLogBuf buf;                  ///> Text not yet published.
+    std::ostream os;                 ///> Stream returned by msgStream.
+    UInt id;                         ///> Thread number.
+    LogLevel level;                  ///> Level of the text in buf.
+    std::vector<RingLogRec> recs;    ///> The ring buffer.
+    std::atomic<size_t> head;        ///> Records published, by the thread.
+    char pad1[64];                   ///> Keep head and tail apart.
+    std::atomic<size_t> tail;        ///> Records taken, by the flusher.
+    char pad2[64];                   ///> Keep threads apart.
+  };
+}
+
+// Time in seconds, from a monotonic clock.
+static double ringNow_()
+{
+  using namespace std::chrono;
+  return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+
+RingLogger::RingLogger(LoggerPtr out, UInt nthreads, UInt capacity)
+  : Logger(out->getMaxLevel()),
+    cap_(std::max(capacity, (UInt) 2)),
+    pending_(0),
+    nthreads_(nthreads),
+    out_(out),
+    running_(false),
+    threads_(0)
+{
+  pending_ = new std::vector<RingLogRec>();
+  threads_ = new RingLogThread*[nthreads_];
+  for (UInt i=0; i<nthreads_; ++i) {
+    threads_[i] = new RingLogThread(this, i, cap_);
+  }
+}
+
+
+RingLogger::~RingLogger()
+{
+  stop();
+  for (UInt i=0; i<nthreads_; ++i) {
+    delete threads_[i];
+  }
+  delete [] threads_;
+  delete pending_;
+}
+
+
+void RingLogger::flush_(bool all)
+{
+  const double delay = 0.01;
+  std::vector<RingLogRec> &pend = *pending_;
+  std::ostream *last = 0;
+  double upto;
+  size_t h, t;
+  UInt n;
+
+  for (UInt i=0; i<nthreads_; ++i) {
+    RingLogThread *th = threads_[i];
+    h = th->head.load(std::memory_order_acquire);
+    t = th->tail.load(std::memory_order_relaxed);
+    for (; t<h; ++t) {
+      RingLogRec &r = th->recs[t % cap_];
+      pend.push_back(RingLogRec());
+      pend.back().t = r.t;
+      pend.back().th = r.th;
+      pend.back().level = r.level;
+      pend.back().text.swap(r.text);
+    }
+    th->tail.store(h, std::memory_order_release);
+  }
+  if (pend.empty()) {
+    return;
+  }
+
+  // records of a thread are already in order of time.
+  std::stable_sort(pend.begin(), pend.end(),
+                   [](const RingLogRec &a, const RingLogRec &b)
+                   { return a.t < b.t; });
+  upto = all ? INFINITY : ringNow_() - delay;
+  for (n=0; n<pend.size() && pend[n].t <= upto; ++n) {
+    last = &(out_->msgStream(pend[n].level));
+    *last << pend[n].text;
+  }
+  if (last) {
+    last->flush();
+  }
+  pend.erase(pend.begin(), pend.begin() + n);
+}
+
+
+std::ostream& RingLogger::msgStream(LogLevel level) const
+{
+  UInt t = 0;
+
+  if (level > maxLevel_) {
+    return Logger::msgStream(level);
+  }
+#if USE_OPENMP
+  t = omp_get_thread_num();
+#endif
+  if (t >= nthreads_) {
+    return out_->msgStream(level);
+  }
+  threads_[t]->level = level;
+  return threads_[t]->os;
+}
+
+
+void RingLogger::publish(RingLogThread *th)
+{
+  size_t h = th->head.load(std::memory_order_relaxed);
+
+  if (!running_.load(std::memory_order_acquire)) {
+    std::lock_guard<std::mutex> guard(lock_);
+    out_->msgStream(th->level) << th->buf.line << std::flush;
+    th->buf.line.clear();
+    return;
+  }
+  while (h - th->tail.load(std::memory_order_acquire) >= cap_) {
+    std::this_thread::yield();
+  }
+  RingLogRec &r = th->recs[h % cap_];
+  r.t = ringNow_();
+  r.th = th->id;
+  r.level = th->level;
+  r.text.swap(th->buf.line);
+  th->buf.line.clear();
+  th->head.store(h+1, std::memory_order_release);
+}
+
+
+void RingLogger::run_()
+{
+  while (running_.load(std::memory_order_acquire)) {
+    flush_(false);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+}
+
+
+void RingLogger::start()
+{
+  if (!running_.load()) {
+    running_.store(true, std::memory_order_release);
+    flusher_ = std::thread(&RingLogger::run_, this);
+  }
+}
+
+
+void RingLogger::stop()
+{
+  if (running_.load()) {
+    running_.store(false, std::memory_order_release);
+    flusher_.join();
+  }
+  // flush text of threads that did not end with a newline, then all records.
+  for (UInt i=0; i<nthreads_; ++i) {
+    if (!threads_[i]->buf.line.empty()) {
+      RingLogRec r;
+      r.t = ringNow_();
+      r.th = i;
+      r.level = threads_[i]->level;
+      r.text.swap(threads_[i]->buf.line);
+      pending_->push_back(r);
+    }
+  }
+  flush_(true);
+}
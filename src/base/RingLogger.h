@@ -0,0 +1,119 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file RingLogger.h
+ * \brief Declare class RingLogger for logging from several threads without
+ * locks.
+ * \author The Minotaur Team
+ */
+
+#ifndef MINOTAURRINGLOGGER_H
+#define MINOTAURRINGLOGGER_H
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Logger.h"
+
+namespace Minotaur {
+
+  struct RingLogThread;
+  struct RingLogRec;
+
+  /**
+   * \brief A logger that each thread of a parallel algorithm can write to
+   * without taking a lock.
+   *
+   * Every thread gets its own stream from msgStream(). The level is checked
+   * first: if the message is not to be written, a null stream is returned
+   * on which operator<< does not format anything. Otherwise, characters are
+   * collected in a buffer of the thread. When the stream is flushed, e.g.
+   * by std::endl, the text becomes a record with a time stamp and is put in
+   * a ring buffer of the thread. A ring buffer has one writer (the thread)
+   * and one reader (the flusher), and is synchronized by two atomic
+   * counters.
+   *
+   * A background flusher thread, started by start(), takes the records of
+   * all threads, orders them by time stamp and writes them to the logger
+   * given in the constructor. stop() writes all remaining records. If a
+   * ring buffer is full, the thread waits for the flusher. If the flusher is
+   * not started, each record is written to the output logger when it is
+   * flushed, under a lock.
+   *
+   * Threads are identified by their OpenMP thread number. Threads whose
+   * number is not less than the number given in the constructor write to
+   * the output logger directly.
+   */
+  class RingLogger : public Logger {
+  public:
+    /**
+     * \brief Create a logger for nthreads threads.
+     *
+     * \param [in] out Logger where records are written. Its level is used.
+     * \param [in] nthreads Number of threads.
+     * \param [in] capacity Number of records in the ring buffer of a thread.
+     */
+    RingLogger(LoggerPtr out, UInt nthreads, UInt capacity = 4096);
+
+    /// Stop the flusher and destroy.
+    ~RingLogger();
+
+    /// Get the stream of the calling thread for messages of a level.
+    std::ostream& msgStream(LogLevel level) const;
+
+    /// Start the flusher thread.
+    void start();
+
+    /// Stop the flusher thread and write all records. Must not be called
+    /// while other threads are writing.
+    void stop();
+
+    /// Put the text collected by a thread in its ring buffer. Called by the
+    /// stream buffer of the thread when flushed.
+    void publish(RingLogThread *th);
+
+  private:
+    /// Number of records in each ring buffer.
+    const UInt cap_;
+
+    /// Records taken from ring buffers but not yet written.
+    std::vector<RingLogRec> *pending_;
+
+    /// The flusher thread.
+    std::thread flusher_;
+
+    /// Lock for writing records when the flusher is not running.
+    std::mutex lock_;
+
+    /// Number of threads.
+    const UInt nthreads_;
+
+    /// Logger where records are written.
+    LoggerPtr out_;
+
+    /// True while the flusher thread is running.
+    std::atomic<bool> running_;
+
+    /// Stream and ring buffer of each thread.
+    RingLogThread **threads_;
+
+    /**
+     * \brief Write records in ring buffers to the output logger.
+     *
+     * \param [in] all If false, records newer than a few milliseconds are
+     * kept, since older records of other threads may not have been published
+     * yet. If true, all records are written.
+     */
+    void flush_(bool all);
+
+    /// Loop of the flusher thread.
+    void run_();
+  };
+}
+#endif
@@ -19,6 +19,7 @@
 #endif
 
 #include "MinotaurConfig.h"
+#include "BoundTrail.h"
 #include "Constraint.h"
 #include "Engine.h"
 #include "Environment.h"
@@ -366,7 +367,7 @@ void RoundingHeur::implementDive_(int i, const double* x, SolutionPoolPtr s_pool
     ++(stats_->totalProbs);
     if (EngineError == status) {
       e->clear();  // reset the starting point
-      e->load(p_);
+      e->load(p);
       ++(stats->errors[i/8]);
     }
     if (status == ProvenLocalOptimal || status == ProvenOptimal 
@@ -399,9 +400,6 @@ void RoundingHeur::implementDive_(int i, const double* x, SolutionPoolPtr s_pool
 //#endif
             } else {
               logger_->msgStream(LogInfo) << me_ << "NLP feasible!" << std::endl;
-#if USE_OPENMP
-#pragma omp critical (solPool)
-#endif
               s_pool->addSolution(nlpe->getSolution());
 #if USE_OPENMP
 #pragma omp critical (stats)
@@ -424,9 +422,6 @@ void RoundingHeur::implementDive_(int i, const double* x, SolutionPoolPtr s_pool
 #pragma omp critical (stats)
 #endif
           stats_->best_obj_value = sol->getObjValue();
-#if USE_OPENMP
-#pragma omp critical (solPool)
-#endif
           s_pool->addSolution(sol);
           ++(stats->numSol[i/8]);
           ++(stats->totalSol);
@@ -728,15 +723,6 @@ UInt RoundingHeur::ReducedCost_(UInt numfrac, const double* x, Direction d,
 }
 
 
-void RoundingHeur::restoreBounds_(double* LB_copy, double* UB_copy, UInt vars, ProblemPtr p)
-{
-  for (UInt i=0; i<vars; ++i, ++LB_copy, ++UB_copy) {
-    p->changeBoundByInd(i, Lower, *LB_copy);
-    p->changeBoundByInd(i, Upper, *UB_copy);
-  }
-}
-
-
 double RoundingHeur::rounding_(double value, Direction d)
 {
   switch (d) {
@@ -764,17 +750,6 @@ double RoundingHeur::rounding_(double value, Direction d)
 }
 
 
-void RoundingHeur::saveBounds_(double* LB_copy, double* UB_copy, UInt vars)
-{
-  VariablePtr variable;
-  for (UInt i=0; i<vars; ++i, ++LB_copy, ++UB_copy) {
-    variable = p_->getVariable(i);
-    *LB_copy = variable->getLb();
-    *UB_copy = variable->getUb();
-  }
-}
-
-
 RoundingHeur::FuncPtr RoundingHeur::selectHeur_(int i, Direction &d, Order &o)
 {
 #if USE_OPENMP
@@ -859,9 +834,6 @@ void RoundingHeur::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
   int num_method         = 32;
   UInt numvars           = p_->getNumVars();
   double* root_x;
-  double* root_copy;
-  double* LB_copy;
-  double* UB_copy;
   logger_->msgStream(LogInfo) << me_ << "Starting" << std::endl;
   logger_->msgStream(LogInfo) << me_ << "Partitioning levels: " << numLevels_ << std::endl;
   //timer_->start();
@@ -871,9 +843,6 @@ void RoundingHeur::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
     return;
   }
   root_x             = new double[numvars];
-  root_copy          = new double[numvars];
-  LB_copy            = new double[numvars];
-  UB_copy            = new double[numvars];
   e_->clear();
   e_->load(p_);
   e_->setIterationLimit(7000); // try to run for a loooong time.
@@ -953,7 +922,6 @@ void RoundingHeur::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
       << omp_get_num_procs() << " processors" << std::endl;
 #endif
     //lh_ = new LinearHandler(env_, p_);
-    saveBounds_(LB_copy, UB_copy, numvars);
 
     // CREATING OBJECTS EACH TIME BELOW NEEDS CORRECTION ASAP!!
 #if USE_OPENMP
@@ -976,6 +944,20 @@ void RoundingHeur::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
       stats->numLocal          = 1;
       stats->best_obj_value    = INFINITY;
       stats->totalTime         = 0; 
+
+      // Thread specific copies of the problem and engine. They are reused
+      // for all dives of this thread. The trail restores the bounds
+      // changed in a dive.
+      EnginePtr e =  e_->emptyCopy();
+      ProblemPtr p = p_->clone(env_);
+      BoundTrail trail(p);
+      LinearHandler *lh;
+      double* gradientObj;
+      e->clear();
+      e->load(p);
+      e->setIterationLimit(200);
+      lh = new LinearHandler(env_, p);
+      gradientObj = new double[p->getNumVars()];
     // loop over the methods starts here
 #if USE_OPENMP
 #pragma omp for
@@ -985,28 +967,16 @@ void RoundingHeur::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
       if (getWallTime() - wallTimeStart_ <= wallTimeLimit) {
         logger_->msgStream(LogDebug) << me_<< "diving method "
           << i << std::endl;
-        std::copy(root_x, root_x + numvars, root_copy); 
-        x = root_copy;
-        // Thread specific 
-        EnginePtr e =  e_->emptyCopy();
-        ProblemPtr p = p_->clone(env_);
-        LinearHandler *lh;
-        double* gradientObj;
         DoubleVector score;
         UIntVector violated;
         DoubleVector avgDual = avgDualR;
         //avgDual.resize(numvars, 0);
         ModVector lastNodeMods;
         std::stack<VarBoundModPtr> mods;
-        e->clear();
-        e->load(p);
-        e->setIterationLimit(200);
-        lh = new LinearHandler(env_, p);
-        gradientObj = new double[p->getNumVars()];
-
-        implementDive_(i, x, s_pool, lastNodeMods, e, p, avgDual, violated,
-                       mods, lh, score, gradientObj, stats);
-        restoreBounds_(LB_copy, UB_copy, numvars, p);
+
+        implementDive_(i, root_x, s_pool, lastNodeMods, e, p, avgDual,
+                       violated, mods, lh, score, gradientObj, stats);
+        trail.undo();
         // clear the stack of modification for this heuristic method
         while (!mods.empty()) {
             mods.pop();
@@ -1028,6 +998,8 @@ void RoundingHeur::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
         //lastNodeMods_.clear();
       }
     } // loop over methods ends here
+    delete lh;
+    delete [] gradientObj;
 #if USE_OPENMP
 #pragma omp critical (stats)
 #endif
@@ -1041,15 +1013,6 @@ void RoundingHeur::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
   if (root_x){
     delete [] root_x;
   }
-  if (LB_copy){
-    delete [] LB_copy;
-  }
-  if (UB_copy){
-    delete [] UB_copy;
-  }
-  if (root_copy){
-    delete [] root_copy;
-  }
   //timer_->stop();
   exit(1);
 }
@@ -42,6 +42,12 @@ public:
   /// call to heuristic
   void solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool);
 
+  /// Return the name of this heuristic.
+  std::string getName() const { return "Sampling"; }
+
+  /// Return the number of points checked for feasibility.
+  UInt getNumSolves() const { return stats_->checked; }
+
   /// writing the statistics to the logger
   void writeStats(std::ostream& out) const;
 
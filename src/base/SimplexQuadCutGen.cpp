@@ -13,8 +13,6 @@
 
 #include "SimplexQuadCutGen.h"
 
-#include <string.h>
-
 #include <algorithm>
 #include <array>
 #include <cmath>
@@ -121,6 +119,7 @@ int SimplexQuadCutGen::generateCuts(RelaxationPtr rel, ConstSolutionPtr sol,
                                     ConstraintVector& added)
 {
   SimplexCutVector cuts;
+  ConstraintVector viol;
   ConstraintPtr c;
   FunctionType ftype;
   double act;
@@ -163,11 +162,20 @@ int SimplexQuadCutGen::generateCuts(RelaxationPtr rel, ConstSolutionPtr sol,
             << " is not defined at this point." << std::endl;
 #endif
       }
+      viol.push_back(c);
+    }
+
+    // rows of all basic variables needed are fetched together.
+    getTableauRows_(rel, viol);
+    for(ConstraintVector::iterator cit = viol.begin(); cit != viol.end();
+        ++cit) {
+      c = *cit;
       env_->getLogger()->msgStream(LogDebug2)
           << me_ << " : Generating cuts for the constraint " << c->getName()
           << std::endl;
       relaxConsBNB_(cuts, c, sol->getPrimal(), rel);
     }
+    tabRows_.clear();
     iter_cuts = cuts.size();
     disableFactorization();
     stats_.gencuts += iter_cuts;
@@ -233,8 +241,11 @@ void SimplexQuadCutGen::addCutsToRel_(SimplexCutVector cuts, RelaxationPtr rel,
       delete cut;
       continue;
     }
-    lf = (LinearFunctionPtr) new LinearFunction(cut->coef, rel->varsBegin(),
-                                                rel->varsEnd(), 1e-9);
+    lf = (LinearFunctionPtr) new LinearFunction(1e-9);
+    for(std::map<int, double>::iterator cit = cut->coef.begin();
+        cit != cut->coef.end(); ++cit) {
+      lf->addTerm(rel->getVariable(cit->first), cit->second);
+    }
     if(lf->getNumTerms() > maxTerms_ ||
        lf->getNumTerms() > factor * avgSparsity_) {
 #if SPEW
@@ -292,19 +303,24 @@ void SimplexQuadCutGen::delTabInfo_()
 
 void SimplexQuadCutGen::calcDepth_(SimplexCutVector cuts, const double* x)
 {
-  double norm = 0;
+  double norm, act;
   SimplexCutPtr cut;
 
   for(SimplexCutVector::iterator vit = cuts.begin(); vit != cuts.end(); ++vit) {
     cut = (*vit);
-    norm = sqrt(InnerProduct(cut->coef, cut->coef, tabInfo_->ncol));
+    norm = 0.0;
+    act = 0.0;
+    for(std::map<int, double>::iterator cit = cut->coef.begin();
+        cit != cut->coef.end(); ++cit) {
+      norm += cit->second * cit->second;
+      act += cit->second * x[cit->first];
+    }
+    norm = sqrt(norm);
 
     if(cut->lb > -INFINITY) {
-      cut->depth =
-          (cut->lb - InnerProduct(x, cut->coef, tabInfo_->ncol)) / norm;
+      cut->depth = (cut->lb - act) / norm;
     } else {
-      cut->depth =
-          (InnerProduct(x, cut->coef, tabInfo_->ncol) - cut->ub) / norm;
+      cut->depth = (act - cut->ub) / norm;
     }
   }
 }
@@ -333,9 +349,10 @@ void SimplexQuadCutGen::getBasicInfo_()
 double SimplexQuadCutGen::getMin_(SimplexCutPtr cut, double rhs)
 {
   double minelem = INFINITY;
-  for(int i = 0; i < tabInfo_->ncol; ++i) {
-    if(fabs(cut->coef[i]) > eTol_ && fabs(cut->coef[i]) < minelem) {
-      minelem = fabs(cut->coef[i]);
+  for(std::map<int, double>::iterator it = cut->coef.begin();
+      it != cut->coef.end(); ++it) {
+    if(fabs(it->second) > eTol_ && fabs(it->second) < minelem) {
+      minelem = fabs(it->second);
     }
   }
   if(rhs < minelem) {
@@ -344,6 +361,43 @@ double SimplexQuadCutGen::getMin_(SimplexCutPtr cut, double rhs)
   return minelem;
 }
 
+void SimplexQuadCutGen::getTableauRows_(RelaxationPtr rel,
+                                        const ConstraintVector& cons)
+{
+  QuadraticFunctionPtr qf;
+  std::map<int, int>::iterator bit;
+  std::vector<int> vars, rows;
+  std::vector<TableauRow> tab;
+  int ind[2];
+
+  tabRows_.clear();
+  for(ConstraintVector::const_iterator it = cons.begin(); it != cons.end();
+      ++it) {
+    qf = (*it)->getFunction()->getQuadraticFunction();
+    ind[0] = rel->getRelaxationVar(qf->begin()->first.first)->getIndex();
+    ind[1] = rel->getRelaxationVar(qf->begin()->first.second)->getIndex();
+    for(int k = 0; k < 2; ++k) {
+      bit = basicInd_.find(ind[k]);
+      if(bit != basicInd_.end() && tabRows_.count(ind[k]) == 0) {
+        tabRows_[ind[k]] = TableauRow();
+        vars.push_back(ind[k]);
+        rows.push_back(bit->second);
+      }
+    }
+  }
+  if(rows.empty()) {
+    return;
+  }
+
+  lpe_->getBInvARows(rows, eTol_, tab);
+  for(UInt i = 0; i < vars.size() && i < tab.size(); ++i) {
+    tabRows_[vars[i]].ind.swap(tab[i].ind);
+    tabRows_[vars[i]].val.swap(tab[i].val);
+    tabRows_[vars[i]].slackInd.swap(tab[i].slackInd);
+    tabRows_[vars[i]].slackVal.swap(tab[i].slackVal);
+  }
+}
+
 void SimplexQuadCutGen::getSlackBounds_()
 {
   double lb, ub, rhs;
@@ -390,58 +444,67 @@ void SimplexQuadCutGen::getTermBounds_(double coef, double vlb, double vub,
   }
 }
 
-void SimplexQuadCutGen::substituteAndRelax_(RelaxationPtr rel, const double* x,
+bool SimplexQuadCutGen::substituteAndRelax_(RelaxationPtr rel, const double* x,
                                             VariablePtr bkeep,
                                             VariablePtr bsubst, double beta,
-                                            double* coefs, double& cutConst,
-                                            bool under)
+                                            std::map<int, double>& coefs,
+                                            double& cutConst, bool under)
 {
-  double* origRow = new double[tabInfo_->ncol];
-  double* slackRow = new double[tabInfo_->nrow];
+  std::map<int, TableauRow>::iterator tit;
   std::map<int, double> row;
   double rhs = 0.0;
   VariablePtr nb;
   bool lower;
   double elem;
   double cb = 0., cn = 0., cnst = 0.;
+  int col;
 
-  lpe_->getBInvARow(basicInd_[bsubst->getIndex()], origRow, slackRow);
-  for(int i = 0; i < nnbOrig_; ++i) {
-    elem = origRow[nbOrig_[i]];
-    if(fabs(elem) > eTol_) {
-      beta += elem * x[nbOrig_[i]];
-      nb = rel->getVariable(nbOrig_[i]);
-      lower = fabs(x[nb->getIndex()] - nb->getLb()) < eTol_ ? true : false;
-      relaxTermBNB_(elem, lower, bkeep->getLb(), bkeep->getUb(), nb->getLb(),
-                    nb->getUb(), cb, cn, cnst, under);
-      coefs[bkeep->getIndex()] += cb;
-      coefs[nbOrig_[i]] += cn;
-      cutConst += cnst;
+  tit = tabRows_.find(bsubst->getIndex());
+  if(tit == tabRows_.end()) {
+    return false;
+  }
+  const TableauRow& tr = tit->second;
+
+  // only nonzeros of the row are visited, and of those only nonbasic ones
+  // are used.
+  for(UInt i = 0; i < tr.ind.size(); ++i) {
+    col = tr.ind[i];
+    if(basicInd_.count(col) > 0) {
+      continue;
     }
+    elem = tr.val[i];
+    beta += elem * x[col];
+    nb = rel->getVariable(col);
+    lower = fabs(x[nb->getIndex()] - nb->getLb()) < eTol_ ? true : false;
+    relaxTermBNB_(elem, lower, bkeep->getLb(), bkeep->getUb(), nb->getLb(),
+                  nb->getUb(), cb, cn, cnst, under);
+    coefs[bkeep->getIndex()] += cb;
+    coefs[col] += cn;
+    cutConst += cnst;
   }
 
-  for(int i = 0; i < nnbSlack_; ++i) {
-    elem = slackRow[nbSlack_[i]];
-    if(fabs(elem) > eTol_) {
-      lower = sb_[nbSlack_[i]].second > eTol_ ? true : false;
-      relaxTermBNB_(elem, lower, bkeep->getLb(), bkeep->getUb(),
-                    sb_[nbSlack_[i]].first, sb_[nbSlack_[i]].second, cb, cn,
-                    cnst, under);
-      coefs[bkeep->getIndex()] += cb;
-      slackSubstitute_(nbSlack_[i], cn, row, rhs);
-      for(std::map<int, double>::iterator itrow = row.begin();
-          itrow != row.end(); ++itrow) {
-        coefs[itrow->first] -= itrow->second;
-      }
-      cutConst += cnst + rhs;
+  for(UInt i = 0; i < tr.slackInd.size(); ++i) {
+    col = tr.slackInd[i];
+    if(sb_.count(col) == 0) {
+      // basic slack
+      continue;
     }
+    elem = tr.slackVal[i];
+    lower = sb_[col].second > eTol_ ? true : false;
+    relaxTermBNB_(elem, lower, bkeep->getLb(), bkeep->getUb(), sb_[col].first,
+                  sb_[col].second, cb, cn, cnst, under);
+    coefs[bkeep->getIndex()] += cb;
+    slackSubstitute_(col, cn, row, rhs);
+    for(std::map<int, double>::iterator itrow = row.begin();
+        itrow != row.end(); ++itrow) {
+      coefs[itrow->first] -= itrow->second;
+    }
+    cutConst += cnst + rhs;
   }
 
   coefs[bkeep->getIndex()] -= beta;
-
-  delete[] origRow;
-  delete[] slackRow;
   row.clear();
+  return true;
 }
 
 void SimplexQuadCutGen::relaxConsBNB_(SimplexCutVector& cuts, ConstraintPtr c,
@@ -480,10 +543,12 @@ void SimplexQuadCutGen::relaxConsBNB_(SimplexCutVector& cuts, ConstraintPtr c,
     }
     cut = (SimplexCutPtr) new SimplexCut();
     cutConst = 0;
-    cut->coef = new double[rel->getNumVars()];
-    memset(cut->coef, 0, rel->getNumVars() * sizeof(double));
     cut->coef[y->getIndex()] += 1.0;
-    substituteAndRelax_(rel, x, v1, v1, x1val, cut->coef, cutConst, true);
+    if(!substituteAndRelax_(rel, x, v1, v1, x1val, cut->coef, cutConst,
+                            true)) {
+      delete cut;
+      return;
+    }
     cut->lb = -INFINITY;
     cut->ub = -cutConst;
     cuts.push_back(cut);
@@ -505,47 +570,55 @@ void SimplexQuadCutGen::relaxConsBNB_(SimplexCutVector& cuts, ConstraintPtr c,
       // v1 is kept basic and v2 is substituted
       cut = (SimplexCutPtr) new SimplexCut();
       cutConst = 0;
-      cut->coef = new double[rel->getNumVars()];
-      memset(cut->coef, 0, rel->getNumVars() * sizeof(double));
       cut->coef[y->getIndex()] += 1.0;
-      substituteAndRelax_(rel, x, v1, v2, x2val, cut->coef, cutConst, false);
-      cut->lb = -cutConst;
-      cut->ub = INFINITY;
-      cuts.push_back(cut);
+      if(substituteAndRelax_(rel, x, v1, v2, x2val, cut->coef, cutConst,
+                             false)) {
+        cut->lb = -cutConst;
+        cut->ub = INFINITY;
+        cuts.push_back(cut);
+      } else {
+        delete cut;
+      }
 
       // v2 is kept basic and v1 is substituted
       cut = (SimplexCutPtr) new SimplexCut();
       cutConst = 0;
-      cut->coef = new double[rel->getNumVars()];
-      memset(cut->coef, 0, rel->getNumVars() * sizeof(double));
       cut->coef[y->getIndex()] += 1.0;
-      substituteAndRelax_(rel, x, v2, v1, x1val, cut->coef, cutConst, false);
-      cut->lb = -cutConst;
-      cut->ub = INFINITY;
-      cuts.push_back(cut);
+      if(substituteAndRelax_(rel, x, v2, v1, x1val, cut->coef, cutConst,
+                             false)) {
+        cut->lb = -cutConst;
+        cut->ub = INFINITY;
+        cuts.push_back(cut);
+      } else {
+        delete cut;
+      }
     } else {
       // Violated constraint y - x1x2 <= 0
       // v1 is kept basic and v2 is substituted
       cut = (SimplexCutPtr) new SimplexCut();
       cutConst = 0;
-      cut->coef = new double[rel->getNumVars()];
-      memset(cut->coef, 0, rel->getNumVars() * sizeof(double));
       cut->coef[y->getIndex()] += 1.0;
-      substituteAndRelax_(rel, x, v1, v2, x2val, cut->coef, cutConst, true);
-      cut->lb = -INFINITY;
-      cut->ub = -cutConst;
-      cuts.push_back(cut);
+      if(substituteAndRelax_(rel, x, v1, v2, x2val, cut->coef, cutConst,
+                             true)) {
+        cut->lb = -INFINITY;
+        cut->ub = -cutConst;
+        cuts.push_back(cut);
+      } else {
+        delete cut;
+      }
 
       // v2 is kept basic and v1 is substituted
       cut = (SimplexCutPtr) new SimplexCut();
       cutConst = 0;
-      cut->coef = new double[rel->getNumVars()];
-      memset(cut->coef, 0, rel->getNumVars() * sizeof(double));
       cut->coef[y->getIndex()] += 1.0;
-      substituteAndRelax_(rel, x, v2, v1, x1val, cut->coef, cutConst, true);
-      cut->lb = -INFINITY;
-      cut->ub = -cutConst;
-      cuts.push_back(cut);
+      if(substituteAndRelax_(rel, x, v2, v1, x1val, cut->coef, cutConst,
+                             true)) {
+        cut->lb = -INFINITY;
+        cut->ub = -cutConst;
+        cuts.push_back(cut);
+      } else {
+        delete cut;
+      }
     }
   }
 }
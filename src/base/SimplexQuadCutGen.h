@@ -14,6 +14,8 @@
 #ifndef MINOTAURSIMPLEXQUADCUTGEN_H
 #define MINOTAURSIMPLEXQUADCUTGEN_H
 
+#include <map>
+
 #include "Constraint.h"
 #include "Environment.h"
 #include "LPEngine.h"
@@ -49,17 +51,11 @@ struct CutStats {
 };
 
 struct SimplexCut {
-  double* coef; // The linear function of the cut
-  double lb;    // Lower Bound
-  double ub;    // Upper Bound
-  double depth; // Depth of cut
+  std::map<int, double> coef; // The linear function of the cut, by index
+  double lb;                  // Lower Bound
+  double ub;                  // Upper Bound
+  double depth;               // Depth of cut
   SimplexCut() { }
-  ~SimplexCut()
-  {
-    if(coef) {
-      delete[] coef;
-    }
-  }
   bool operator<(const SimplexCut& cut) const
   {
     return depth < cut.depth;
@@ -174,6 +170,11 @@ private:
   // Lower and Upper bounds of the slack variables
   SlackBound sb_;
 
+  // Sparse tableau rows of the basic variables needed in this round
+  // Key - index of the original variable which is basic
+  // Value - Its row of the tableau
+  std::map<int, TableauRow> tabRows_;
+
   // Upper bound at the current node
   double ub_;
 
@@ -198,6 +199,10 @@ private:
 
   double getMin_(SimplexCutPtr cut, double rhs);
 
+  // get, in one call to the engine, the tableau rows of the basic variables
+  // in the quadratic terms of the given constraints
+  void getTableauRows_(RelaxationPtr rel, const ConstraintVector& cons);
+
   // get the bounds on the slack variables
   void getSlackBounds_();
 
@@ -215,9 +220,11 @@ private:
   void slackSubstitute_(int slackInd, double coef, std::map<int, double>& row,
                         double& rhs);
 
-  void substituteAndRelax_(RelaxationPtr rel, const double* x,
+  // Returns false if bsubst is not basic, and then no cut is generated
+  bool substituteAndRelax_(RelaxationPtr rel, const double* x,
                            VariablePtr bkeep, VariablePtr bsubst, double beta,
-                           double* coefs, double& cutConst, bool under);
+                           std::map<int, double>& coefs, double& cutConst,
+                           bool under);
 
   void sortVariables_();
 };
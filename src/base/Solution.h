@@ -64,6 +64,9 @@ namespace Minotaur {
     /// Return the 2nd norm of constraint violations.
     virtual double getConstraintViolation() {return consViol_;};
 
+    /// Return the number of values of variables.
+    virtual UInt getNumVars() const {return n_;};
+
     /// Return a pointer to the solution.
     virtual const double * getPrimal() const {return x_;};
 
@@ -17,6 +17,7 @@
 #include "Environment.h"
 #include "SolutionPool.h"
 #include "Timer.h"
+#include "Variable.h"
 
 using namespace Minotaur;
 
@@ -24,6 +25,10 @@ const std::string SolutionPool::me_ = "SolutionPool: ";
 
 SolutionPool::SolutionPool (EnvPtr env, ProblemPtr problem, UInt limit)
 : bestSolution_(SolutionPtr()), // NULL
+  bestVal_(INFINITY),
+  n_(0),
+  worstVal_(INFINITY),
+  numDups_(0),
   numSolsFound_(0),
   problem_(problem),
   sizeLimit_(limit),
@@ -31,36 +36,109 @@ SolutionPool::SolutionPool (EnvPtr env, ProblemPtr problem, UInt limit)
   timeFirst_(-1)
 {
   timer_ = env->getTimer(); // should not be deleted.
+  if (problem_) {
+    n_ = problem_->getNumVars();
+    for (VariableConstIterator it=problem_->varsBegin();
+         it!=problem_->varsEnd(); ++it) {
+      if (Binary == (*it)->getType() || Integer == (*it)->getType()) {
+        ints_.push_back((*it)->getIndex());
+      }
+    }
+  }
 }
 
 
 SolutionPool::~SolutionPool()
 {
-  for (std::vector<SolutionPtr>::iterator it=sols_.begin(); it!=sols_.end(); 
-       ++it) {
-    delete *it;
+  if (bestSolution_) {
+    delete bestSolution_;
+  }
+  for (UInt i=0; i<oldBest_.size(); ++i) {
+    delete oldBest_[i];
   }
 }
 
 
+void SolutionPool::addPoint_(const double *x, double obj, Key key)
+{
+  std::unordered_map<Key, UInt>::iterator it = index_.find(key);
+  UInt pos;
+
+  if (it != index_.end() && isSame_(x, getPrimal(it->second))) {
+    ++numDups_;
+    pos = it->second;
+    if (obj >= objs_[pos]) {
+      return;
+    }
+  } else if (objs_.size() < sizeLimit_) {
+    pos = objs_.size();
+    objs_.push_back(obj);
+    keys_.push_back(key);
+    x_.resize(x_.size() + n_);
+  } else {
+    // replace the closest of the points worse than x.
+    UInt d, dmin = n_+1;
+    pos = objs_.size();
+    for (UInt i=0; i<objs_.size(); ++i) {
+      if (objs_[i] > obj) {
+        d = distance_(x, getPrimal(i));
+        if (d < dmin || (d == dmin && objs_[i] > objs_[pos])) {
+          dmin = d;
+          pos = i;
+        }
+      }
+    }
+    if (pos == objs_.size()) {
+      return;
+    }
+    it = index_.find(keys_[pos]);
+    if (it != index_.end() && it->second == pos) {
+      index_.erase(it);
+    }
+    keys_[pos] = key;
+  }
+  objs_[pos] = obj;
+  std::copy(x, x+n_, x_.begin() + pos*n_);
+  if (index_.find(key) == index_.end()) {
+    index_[key] = pos;
+  }
+  updateWorst_();
+}
+
+
 void SolutionPool::addSolution(ConstSolutionPtr solution)
 {
-  SolutionPtr newsol = new Solution(solution);
+  double obj = solution->getObjValue();
+  const double *x = solution->getPrimal();
+  Key key = 0;
+
   ++numSolsFound_;
-  if (sols_.size() > 0) {
-    if (sols_[0]->getObjValue() > solution->getObjValue()) {
-      delete sols_[0];
-      sols_[0] = newsol;
-      bestSolution_ = newsol;
-      timeBest_ = timer_->query();
+
+  // the hash is found before locking. Points that can neither be the best
+  // nor enter a full pool are rejected without locking.
+  if (0 == x || solution->getNumVars() < n_) {
+    x = 0;
+  }
+  if (x && obj < worstVal_) {
+    key = getKey_(x);
+  } else if (obj >= getBestSolutionValue()) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(lock_);
+  if (obj < bestVal_) {
+    if (bestSolution_) {
+      // other threads may still read it.
+      oldBest_.push_back(bestSolution_);
     } else {
-      delete newsol;
+      timeFirst_ = timer_->query();
     }
-  } else {
-    sols_.push_back(newsol);
-    bestSolution_ = newsol;
-    timeFirst_ = timer_->query();
-    timeBest_ = timeFirst_;
+    bestSolution_ = new Solution(solution);
+    timeBest_ = timer_->query();
+    bestVal_ = obj;
+  }
+  if (x && sizeLimit_ > 0) {
+    addPoint_(x, obj, (key ? key : getKey_(x)));
   }
 }
 
@@ -73,25 +151,75 @@ void SolutionPool::addSolution(const double *x, double obj_value)
 }
 
 
+UInt SolutionPool::distance_(const double *x, const double *y) const
+{
+  UInt d = 0;
+  if (ints_.empty()) {
+    for (UInt i=0; i<n_; ++i) {
+      d += (fabs(x[i]-y[i]) > 1e-6) ? 1 : 0;
+    }
+  } else {
+    for (UIntVector::const_iterator it=ints_.begin(); it!=ints_.end(); ++it) {
+      d += (fabs(x[*it]-y[*it]) > 0.5) ? 1 : 0;
+    }
+  }
+  return d;
+}
+
+
+SolutionPtr SolutionPool::copyBestSolution() const
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  return (bestSolution_) ? new Solution(bestSolution_) : SolutionPtr();
+}
+
+
 SolutionPtr SolutionPool::getBestSolution()
 {
+  std::lock_guard<std::mutex> lock(lock_);
   return bestSolution_;
 }
 
 
 double SolutionPool::getBestSolutionValue() const
 {
-  if (bestSolution_) {
-    return bestSolution_->getObjValue();
+  return bestVal_;
+}
+
+
+SolutionPool::Key SolutionPool::getKey_(const double *x) const
+{
+  Key h = 0;
+  Key v;
+
+  // values of integer variables are rounded, others are compared up to a
+  // tolerance.
+  if (ints_.empty()) {
+    for (UInt i=0; i<n_; ++i) {
+      v = (Key) llround(x[i]*1e6);
+      h ^= v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+    }
   } else {
-    return INFINITY;
+    for (UIntVector::const_iterator it=ints_.begin(); it!=ints_.end(); ++it) {
+      v = (Key) llround(x[*it]);
+      h ^= v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+    }
   }
+  // zero is used for "not computed".
+  return (0 == h) ? 1 : h;
+}
+
+
+UInt SolutionPool::getNumPoints() const
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  return objs_.size();
 }
 
 
 UInt SolutionPool::getNumSols() const
 {
-  return sols_.size();
+  return (hasBest()) ? 1 : 0;
 }
 
 
@@ -101,11 +229,87 @@ UInt SolutionPool::getNumSolsFound() const
 }
 
 
+UInt SolutionPool::getSizeLimit() const
+{
+  return sizeLimit_;
+}
+
+
+bool SolutionPool::hasBest() const
+{
+  return bestVal_ < INFINITY;
+}
+
+
+bool SolutionPool::isSame_(const double *x, const double *y) const
+{
+  return (0 == distance_(x, y));
+}
+
+
+void SolutionPool::removePoint_(UInt i)
+{
+  UInt last = objs_.size()-1;
+  std::unordered_map<Key, UInt>::iterator it = index_.find(keys_[i]);
+
+  if (it != index_.end() && it->second == i) {
+    index_.erase(it);
+  }
+  if (i != last) {
+    it = index_.find(keys_[last]);
+    if (it != index_.end() && it->second == last) {
+      it->second = i;
+    }
+    objs_[i] = objs_[last];
+    keys_[i] = keys_[last];
+    std::copy(x_.begin() + last*n_, x_.end(), x_.begin() + i*n_);
+  }
+  objs_.pop_back();
+  keys_.pop_back();
+  x_.resize(last*n_);
+}
+
+
+void SolutionPool::setSizeLimit(UInt limit)
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  sizeLimit_ = limit;
+  while (objs_.size() > sizeLimit_) {
+    UInt w = 0;
+    for (UInt i=1; i<objs_.size(); ++i) {
+      if (objs_[i] > objs_[w]) {
+        w = i;
+      }
+    }
+    removePoint_(w);
+  }
+  updateWorst_();
+}
+
+
+void SolutionPool::updateWorst_()
+{
+  double worst = -INFINITY;
+  // only a full pool rejects points by value.
+  if (objs_.size() >= sizeLimit_) {
+    for (DoubleVector::const_iterator it=objs_.begin(); it!=objs_.end();
+         ++it) {
+      worst = std::max(worst, *it);
+    }
+  } else {
+    worst = INFINITY;
+  }
+  worstVal_ = worst;
+}
+
+
 void SolutionPool::writeStats(std::ostream &out) const
 {
+  std::lock_guard<std::mutex> lock(lock_);
   out << me_ << "Number of solutions found = " << numSolsFound_ << std::endl
+      << me_ << "Number of duplicates      = " << numDups_      << std::endl
+      << me_ << "Solutions in pool         = " << objs_.size()  << std::endl
       << me_ << "Time first solution found = " << timeFirst_    << std::endl
       << me_ << "Time best solution found  = " << timeBest_     << std::endl
       ;
 }
-
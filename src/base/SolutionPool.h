@@ -15,6 +15,11 @@
 #ifndef MINOTAURSOLUTIONPOOL_H
 #define MINOTAURSOLUTIONPOOL_H
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
 #include "Problem.h"
 #include "Solution.h"
 #include "Types.h"
@@ -25,6 +30,24 @@ namespace Minotaur {
   class Environment;
   class Timer;
 
+  /**
+   * \brief A pool of the best solutions found, and the best one.
+   *
+   * The best solution is always saved as a Solution. Besides, the pool
+   * keeps up to getSizeLimit() good and diverse points. Their values are
+   * stored in one contiguous buffer, one row per point. A point is
+   * identified by a hash of the values of its integer variables (of all
+   * variables if there are none). A point whose integer part is already in
+   * the pool replaces the old one only if it is better, and is rejected
+   * otherwise. When the pool is full, a new point replaces the one closest
+   * to it, in the values of integer variables, among those worse than it.
+   *
+   * Solutions may be added by several threads at once. The pool has its own
+   * lock, and points that cannot enter it are rejected without locking.
+   * A solution returned by getBestSolution() is not freed when a better one
+   * is added, but only when the pool is destroyed, so that other threads
+   * may keep reading it.
+   */
   class SolutionPool {
   public:
     /// Default constructor.
@@ -42,9 +65,15 @@ namespace Minotaur {
     /// Save the root relaxation solution
     //void setRootSolution(ConstSolutionPtr);
 
-    /// Get number of solutions in the pool
+    /// Get number of best solutions saved, 1 if there is one, 0 otherwise.
     UInt getNumSols() const;
 
+    /// Return true if a solution has been found.
+    bool hasBest() const;
+
+    /// Get number of points in the pool.
+    UInt getNumPoints() const;
+
     /// Get number of solutions in the pool
     UInt getNumSolsFound() const;
 
@@ -64,21 +93,33 @@ namespace Minotaur {
     /// Put a limit on the number of solutions in the pool
     void setSizeLimit(UInt limit);
 
-    /// Get iterator for the first solution ...
-    SolutionIterator solsBegin() { return sols_.begin(); }
+    /**
+     * \brief Return values of variables of the i-th point in the pool,
+     * 0 <= i < getNumPoints(), or NULL if there is no such point. Points are
+     * not sorted. The array is valid until the next solution is added.
+     */
+    const double* getPrimal(UInt i) const
+    { return (i < objs_.size()) ? x_.data() + i*n_ : 0; }
 
-    /// ... and the end.
-    SolutionIterator solsEnd() { return sols_.end(); }
+    /// Objective value of the i-th point in the pool, 0 <= i < getNumPoints().
+    double getObjValue(UInt i) const { return objs_[i]; }
 
     /// Create a solution from a double array and add Solution to the pool.
     void addSolution(const double *x, double obj_value);
 
     /**
      * Get a solution with the best objective function value. Return NULL if
-     * the pool is empty.
+     * the pool is empty. The solution belongs to the pool and stays valid
+     * until the pool is destroyed.
      */
     SolutionPtr getBestSolution();
 
+    /**
+     * Get a copy of the solution with the best objective function value, or
+     * NULL if the pool is empty. The caller must free it.
+     */
+    SolutionPtr copyBestSolution() const;
+
     /**
      * Get a solution with the best objective function value. Return NULL if
      * the pool is empty.
@@ -95,8 +136,7 @@ namespace Minotaur {
     void writeStats(std::ostream &out) const; 
 
   private:
-    /// The solutions are stored in a vector. 
-    std::vector<SolutionPtr> sols_;
+    typedef std::uint64_t Key;
 
     /**
      * The best solution in terms of objective function value. In case of tie,
@@ -104,6 +144,12 @@ namespace Minotaur {
      */
     SolutionPtr bestSolution_;
 
+    /// Best solutions replaced by better ones, freed with the pool.
+    std::vector<SolutionPtr> oldBest_;
+
+    /// Value of bestSolution_, INFINITY if there is none.
+    std::atomic<double> bestVal_;
+
     /**
      * The best solution in terms of objective function value. In case of tie,
      * the most recently found one.
@@ -113,8 +159,32 @@ namespace Minotaur {
     /// For logging.
     const static std::string me_;
 
+    /// Number of variables of the problem, the length of a row of x_.
+    UInt n_;
+
+    /// Indices of integer variables of the problem.
+    UIntVector ints_;
+
+    /// Values of the points in the pool, n_ per point.
+    DoubleVector x_;
+
+    /// Objective values of the points in the pool.
+    DoubleVector objs_;
+
+    /// Hash keys of the points in the pool.
+    std::vector<Key> keys_;
+
+    /// Position of the point with a given key.
+    std::unordered_map<Key, UInt> index_;
+
+    /// Largest objective value of a point in a full pool, INFINITY if not full.
+    std::atomic<double> worstVal_;
+
+    /// Number of points rejected because they were in the pool already.
+    UInt numDups_;
+
     /// The number of solutions added to the pool.
-    UInt numSolsFound_;
+    std::atomic<UInt> numSolsFound_;
 
     /// Problem for which we are saving solutions
     ProblemPtr problem_;
@@ -131,12 +201,31 @@ namespace Minotaur {
     /// Global timer.
     const Timer* timer_;
 
+    /// Lock for changing the pool and reading bestSolution_.
+    mutable std::mutex lock_;
+
     /// Wall clock start time.
     //double wallTimeStart_;
 
+    /// Add a point, if it is good and new. Called with the lock held.
+    void addPoint_(const double *x, double obj, Key key);
+
+    /// Number of integer variables (of all if none) differing in x and y.
+    UInt distance_(const double *x, const double *y) const;
+
+    /// Hash of the integer part of x.
+    Key getKey_(const double *x) const;
+
+    /// Return true if x and y have the same integer part.
+    bool isSame_(const double *x, const double *y) const;
+
+    /// Remove the i-th point, moving the last point in its place.
+    void removePoint_(UInt i);
+
+    /// Recompute worstVal_.
+    void updateWorst_();
   };
 
   typedef SolutionPool* SolutionPoolPtr;
 }
 #endif
-
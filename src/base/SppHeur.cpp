@@ -111,7 +111,7 @@ void SppHeur::solveNode(ConstSolutionPtr sol, NodePtr , RelaxationPtr ,
   const double *x = sol->getPrimal();
   double start = env_->getTime();
   stats_.calls += 1;
-  if (!x || spool->getNumSols()==0|| !isSpp_()) {
+  if (!x || !spool->hasBest() || !isSpp_()) {
     return;
   }
 
@@ -353,7 +353,7 @@ void SppHeur::varWise_(NodePtr, RelaxationPtr, SolutionPoolPtr spool)
   logger_->msgStream(LogDebug1) << me_ << " running in Variable Wise mode" 
     << " round " << stats_.runs << " Time = " << env_->getTime() << std::endl;
 
-  if (spool->getNumSols()>0) {
+  if (spool->hasBest()) {
     xx = spool->getBestSolution()->getPrimal();
   }
 
@@ -595,7 +595,7 @@ void SppHeur::conWise_(NodePtr, RelaxationPtr, SolutionPoolPtr spool)
   feas=true;
   cv.clear();
 
-  if (0<spool->getNumSols()) {
+  if (spool->hasBest()) {
     // Fix some of the variables to zero. Choose some randomly from the
     // variables that have value one in an existing solution.
     j=0;
@@ -738,7 +738,7 @@ void SppHeur::conWise2_(NodePtr, RelaxationPtr, SolutionPoolPtr spool)
   std::sort(cv.begin(), cv.end(), CompareLen);
   feas=true;
 
-  if (0<spool->getNumSols()) {
+  if (spool->hasBest()) {
     // Fix some of the variables to zero. Choose some randomly from the
     // variables that have value one in an existing solution.
     j=0;
@@ -51,6 +51,12 @@ public:
   void solveNode(ConstSolutionPtr sol, NodePtr node, RelaxationPtr rel, 
              SolutionPoolPtr s_pool);
   
+  /// Return the name of this heuristic.
+  std::string getName() const { return "SppHeur"; }
+
+  /// Return the number of rounds of fixing and propagation done.
+  UInt getNumSolves() const { return stats_.runs; }
+
   /// writing the statistics to the logger
   void writeStats(std::ostream& out) const;
 
@@ -151,6 +151,12 @@ void TreeManager::clearAll()
 }
 
 
+void TreeManager::copyActiveNodes(NodePtrVector &nodes) const
+{
+  activeNodes_->getNodes(nodes);
+}
+
+
 UInt TreeManager::getActiveNodes() const
 {
   return activeNodes_->getSize();
@@ -275,6 +281,16 @@ void TreeManager::pruneNode(NodePtr node)
 }
 
 
+void TreeManager::pruneActiveNodes(const NodePtrVector &nodes)
+{
+  activeNodes_->erase(nodes);
+  for (NodePtrVector::const_iterator it=nodes.begin(); it!=nodes.end(); ++it) {
+    (*it)->setStatus(NodeInfeasible);
+    pruneNode(*it);
+  }
+}
+
+
 void TreeManager::removeActiveNode(NodePtr node)
 {
   if (doVbc_) {
@@ -56,6 +56,14 @@ namespace Minotaur {
      */
     UInt getActiveNodes() const;
 
+    /**
+     * \brief Get all active nodes, in no particular order.
+     *
+     * \param[out] nodes The active nodes are appended to it. A node that is
+     * being processed after diving is not included.
+     */
+    void copyActiveNodes(NodePtrVector &nodes) const;
+
     /// Return the cut off value. It is INFINITY if it is not set.
     double getCutOff();
 
@@ -110,6 +118,14 @@ namespace Minotaur {
      */
     void pruneNode(NodePtr node);
 
+    /**
+     * \brief Prune active nodes that are known to be infeasible, without
+     * processing them.
+     *
+     * \param[in] nodes Nodes to be pruned. Each must be active.
+     */
+    void pruneActiveNodes(const NodePtrVector &nodes);
+
     /**
      * \brief Remove a given active node from storage.
      *
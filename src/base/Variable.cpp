@@ -96,7 +96,8 @@ UInt Variable::getItmp() const
 
 void Variable::inConstraint_(ConstraintPtr cPtr)
 {
-  cons_.insert(cPtr);
+  // new constraints are usually allocated after the existing ones
+  cons_.insert(cons_.end(), cPtr);
 }
 
 
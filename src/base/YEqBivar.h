@@ -13,6 +13,7 @@
 #define MINOTAURYEQBIVAR_H
 
 #include "Types.h"
+#include "YEqRegistry.h"
 
 namespace Minotaur {
 
@@ -29,6 +30,7 @@ private:
   std::vector<VariablePtr> v1_;
   std::vector<VariablePtr> v2_;
   VarVector y_;
+  YEqRegistry reg_;
 };
 }
 
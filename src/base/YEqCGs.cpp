@@ -61,10 +61,38 @@ double YEqCGs::evalHash_(const CNode* node, UInt rank)
 }
 
 
+YEqRegistry::Key YEqCGs::evalKey_(const CNode* node)
+{
+  // same traversal as evalHash_, but only operators and variables are used.
+  // Constants are compared with a tolerance by CGraph::isIdenticalTo.
+  OpCode op = node->getOp();
+  YEqRegistry::Key key = op;
+  if (OpVar==op) {
+    key = YEqRegistry::mix(key, node->getV()->getId());
+  } else if (1==node->numChild()) {
+    key = YEqRegistry::mix(key, evalKey_(node->getL()));
+  } else if (2==node->numChild()) {
+    key = YEqRegistry::mix(key, evalKey_(node->getL()));
+    key = YEqRegistry::mix(key, evalKey_(node->getR()));
+  } else if (2<node->numChild()) {
+    CNode** c1 = node->getListL();
+    CNode** c2 = node->getListR();
+    while (c1<c2) {
+      key = YEqRegistry::mix(key, evalKey_(*c1));
+      ++c1;
+    }
+  }
+  return key;
+}
+
+
 VariablePtr YEqCGs::findY(CGraphPtr cg)
 {
   double hash = evalHash_(cg->getOut(), 1);
-  for (UInt i=0; i<y_.size(); ++i) {
+  YEqRegistry::Key key = evalKey_(cg->getOut());
+  UInt pos = reg_.begin(key);
+  UInt i;
+  while (reg_.next(key, &pos, &i)) {
     if (fabs(hash-hash_[i])<1e-10 &&
         cg->isIdenticalTo(cg_[i])) {
       return y_[i];
@@ -77,6 +105,7 @@ VariablePtr YEqCGs::findY(CGraphPtr cg)
 void YEqCGs::insert(VariablePtr auxvar, CGraphPtr cg)
 {
   assert(auxvar && cg);
+  reg_.insert(evalKey_(cg->getOut()), y_.size());
   hash_.push_back(evalHash_(cg->getOut(), 1));
   y_.push_back(auxvar);
   cg_.push_back(cg);
@@ -16,9 +16,11 @@
 
 #include "Types.h"
 #include "OpCode.h"
+#include "YEqRegistry.h"
 
 namespace Minotaur {
 class CGraph;
+class CNode;
 typedef CGraph* CGraphPtr;
 
 class YEqCGs {
@@ -32,7 +34,9 @@ private:
   DoubleVector rand_;
   VarVector y_;
   std::vector<CGraphPtr> cg_;
+  YEqRegistry reg_;
   double evalHash_(const CNode* node, UInt rank);
+  YEqRegistry::Key evalKey_(const CNode* node);
 };
 }
 #endif
@@ -45,12 +45,27 @@ double YEqLFs::evalHash_(LinearFunctionPtr lf)
 }
 
 
+YEqRegistry::Key YEqLFs::evalKey_(LinearFunctionPtr lf)
+{
+  // coefficients are left out, they are compared with a tolerance.
+  YEqRegistry::Key key = lf->getNumTerms();
+  for (VariableGroupConstIterator it=lf->termsBegin(); it!=lf->termsEnd();
+       ++it) {
+    key = YEqRegistry::mix(key, it->first->getId());
+  }
+  return key;
+}
+
+
 VariablePtr YEqLFs::findY(LinearFunctionPtr lf, double k)
 {
   bool found;
   VariableGroupConstIterator it, it2;
   double hash = evalHash_(lf);
-  for (UInt i=0; i<y_.size(); ++i) {
+  YEqRegistry::Key key = evalKey_(lf);
+  UInt pos = reg_.begin(key);
+  UInt i;
+  while (reg_.next(key, &pos, &i)) {
     if (fabs(k-k_[i])<1e-12 && lf->getNumTerms()==lf_[i]->getNumTerms() && 
         fabs(hash-hash_[i])<1e-12) {
       found = true;
@@ -73,6 +88,7 @@ VariablePtr YEqLFs::findY(LinearFunctionPtr lf, double k)
 
 void YEqLFs::insert(VariablePtr auxvar, LinearFunctionPtr lf, double k)
 {
+  reg_.insert(evalKey_(lf), y_.size());
   hash_.push_back(evalHash_(lf));
   lf_.push_back(lf);
   y_.push_back(auxvar);
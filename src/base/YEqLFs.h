@@ -15,6 +15,7 @@
 #define MINOTAURYEQLFS_H
 
 #include "Types.h"
+#include "YEqRegistry.h"
 
 namespace Minotaur {
 class LinearFunction;
@@ -34,7 +35,9 @@ private:
   DoubleVector rand_;
   DoubleVector hash_;
   VarVector y_;
+  YEqRegistry reg_;
   double evalHash_(LinearFunctionPtr lf);
+  YEqRegistry::Key evalKey_(LinearFunctionPtr lf);
 };
 }
 #endif
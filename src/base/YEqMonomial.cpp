@@ -40,13 +40,27 @@ double YEqMonomial::evalHash_(MonomialFunPtr mf)
 }
 
 
+YEqRegistry::Key YEqMonomial::evalKey_(MonomialFunPtr mf)
+{
+  YEqRegistry::Key key = mf->getDegree();
+  for (VarIntMapConstIterator it=mf->termsBegin(); it!=mf->termsEnd(); ++it) {
+    key = YEqRegistry::mix(key, it->first->getId());
+    key = YEqRegistry::mix(key, it->second);
+  }
+  return key;
+}
+
+
 VariablePtr YEqMonomial::findY(MonomialFunPtr mf)
 {
   double hash = evalHash_(mf);
   VarIntMapConstIterator it, it2;
   bool found;
+  YEqRegistry::Key key = evalKey_(mf);
+  UInt pos = reg_.begin(key);
+  UInt i;
 
-  for (UInt i=0; i<y_.size(); ++i) {
+  while (reg_.next(key, &pos, &i)) {
     if (fabs(hash-hash_[i])<1e-12 
         && mf->getDegree()==mf_[i]->getDegree()
         && fabs(mf->getCoeff()-mf_[i]->getCoeff())<1e-12) {
@@ -70,6 +84,7 @@ VariablePtr YEqMonomial::findY(MonomialFunPtr mf)
 
 void YEqMonomial::insert(VariablePtr auxvar, MonomialFunPtr mf)
 {
+  reg_.insert(evalKey_(mf), y_.size());
   hash_.push_back(evalHash_(mf));
   y_.push_back(auxvar);
   mf_.push_back(mf);
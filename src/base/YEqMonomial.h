@@ -15,6 +15,7 @@
 #define MINOTAURYEQMONOMIAL_H
 
 #include "Types.h"
+#include "YEqRegistry.h"
 
 namespace Minotaur {
 
@@ -37,7 +38,9 @@ private:
   UInt n_;
   DoubleVector rand_;
   VarVector y_;
+  YEqRegistry reg_;
   double evalHash_(MonomialFunPtr mf_);
+  YEqRegistry::Key evalKey_(MonomialFunPtr mf);
 };
 }
 
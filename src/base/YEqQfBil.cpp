@@ -30,7 +30,10 @@ VariablePtr YEqQfBil::findY(VariablePtr v1, VariablePtr v2)
 {
   UInt key1 = v1->getId();
   UInt key2 = v2->getId();
-  for (UInt i=0; i<v1_.size(); ++i) {
+  YEqRegistry::Key key = YEqRegistry::mix(key1, key2);
+  UInt pos = reg_.begin(key);
+  UInt i;
+  while (reg_.next(key, &pos, &i)) {
     if (hash1_[i] == key1 && hash2_[i] == key2 &&
          v1 == v1_[i] && v2 == v2_[i]) {
       return y_[i];
@@ -41,6 +44,7 @@ VariablePtr YEqQfBil::findY(VariablePtr v1, VariablePtr v2)
 
 void YEqQfBil::insert(VariablePtr auxvar, VariablePtr v1, VariablePtr v2)
 {
+  reg_.insert(YEqRegistry::mix(v1->getId(), v2->getId()), y_.size());
   v1_.push_back(v1);
   v2_.push_back(v2);
   hash1_.push_back(v1->getId());
@@ -14,6 +14,7 @@
 #define MINOTAURYEQQFBIL_H
 
 #include "Types.h"
+#include "YEqRegistry.h"
 
 namespace Minotaur {
 
@@ -30,6 +31,7 @@ private:
   std::vector<VariablePtr> v1_;
   std::vector<VariablePtr> v2_;
   VarVector y_;
+  YEqRegistry reg_;
 };
 }
 
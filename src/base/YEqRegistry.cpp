@@ -0,0 +1,92 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file YEqRegistry.cpp
+ * \brief Define a hash table used by the YEq* classes to find auxiliary
+ * variables that have already been added for a function.
+ * \author The Minotaur Team
+ */
+
+#include <cassert>
+#include <climits>
+
+#include "MinotaurConfig.h"
+#include "YEqRegistry.h"
+
+using namespace Minotaur;
+
+const UInt YEqRegistry::empty_ = UINT_MAX;
+
+
+YEqRegistry::YEqRegistry()
+  : mask_(63),
+    slots_(64, std::make_pair(0, empty_))
+{
+}
+
+
+void YEqRegistry::grow_()
+{
+  mask_ = 2*mask_+1;
+  slots_.assign(mask_+1, std::make_pair(0, empty_));
+  // reinsert in the order of positions, so that entries with equal keys
+  // are still probed in the order they were inserted.
+  for (UInt i=0; i<keys_.size(); ++i) {
+    place_(keys_[i], i);
+  }
+}
+
+
+UInt YEqRegistry::home_(Key key) const
+{
+  // finalizer of splitmix64, so that close keys land in different slots.
+  key ^= key >> 30;
+  key *= 0xbf58476d1ce4e5b9ULL;
+  key ^= key >> 27;
+  key *= 0x94d049bb133111ebULL;
+  key ^= key >> 31;
+  return (UInt) (key & mask_);
+}
+
+
+void YEqRegistry::insert(Key key, UInt ind)
+{
+  // entries are always inserted at the end of the YEq* vectors.
+  assert(ind == keys_.size());
+  keys_.push_back(key);
+  if (2*keys_.size() > mask_+1) {
+    grow_();
+  } else {
+    place_(key, ind);
+  }
+}
+
+
+bool YEqRegistry::next(Key key, UInt *pos, UInt *ind) const
+{
+  UInt p = *pos;
+  while (slots_[p].second != empty_) {
+    if (slots_[p].first == key) {
+      *ind = slots_[p].second;
+      *pos = (p+1) & mask_;
+      return true;
+    }
+    p = (p+1) & mask_;
+  }
+  *pos = p;
+  return false;
+}
+
+
+void YEqRegistry::place_(Key key, UInt ind)
+{
+  UInt p = home_(key);
+  while (slots_[p].second != empty_) {
+    p = (p+1) & mask_;
+  }
+  slots_[p] = std::make_pair(key, ind);
+}
@@ -0,0 +1,90 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file YEqRegistry.h
+ * \brief Declare a hash table used by the YEq* classes to find auxiliary
+ * variables that have already been added for a function.
+ * \author The Minotaur Team
+ */
+
+#ifndef MINOTAURYEQREGISTRY_H
+#define MINOTAURYEQREGISTRY_H
+
+#include <cstdint>
+
+#include "Types.h"
+
+namespace Minotaur {
+
+/**
+ * \brief Map structural keys to positions of entries in a YEq* class.
+ *
+ * A YEq* class stores its auxiliary variables and the functions they are
+ * equal to in vectors. It computes a key for each function from its
+ * structure (variables, operators, exponents), and registers the position
+ * of the entry under the key. findY() then compares only the entries with
+ * the same key, instead of all entries. Several entries may have the same
+ * key. They are returned in the order in which they were inserted.
+ *
+ * The table uses open addressing with linear probing and is doubled when
+ * it is half full.
+ */
+class YEqRegistry {
+public:
+  typedef std::uint64_t Key;
+
+  /// Default constructor.
+  YEqRegistry();
+
+  /// Add entry at position ind with the given key.
+  void insert(Key key, UInt ind);
+
+  /**
+   * \brief Return the next entry with a given key.
+   *
+   * \param [in] key The key.
+   * \param [in,out] pos Probe position. Set it to begin(key) before the
+   * first call.
+   * \param [out] ind Position of the entry, if found.
+   * \return True if an entry was found, false if there are no more.
+   */
+  bool next(Key key, UInt *pos, UInt *ind) const;
+
+  /// Return the position where probing for a key starts.
+  UInt begin(Key key) const { return home_(key); }
+
+  /// Combine a key with a value. Used to build keys from structures.
+  static Key mix(Key h, Key v)
+  {
+    h ^= v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+    return h;
+  }
+
+private:
+  /// Empty slots have this index.
+  static const UInt empty_;
+
+  /// Keys of the entries, by position. Used when the table grows.
+  std::vector<Key> keys_;
+
+  /// mask_+1 is the size of the table, a power of two.
+  UInt mask_;
+
+  /// The table: key and position of the entry in each slot.
+  std::vector<std::pair<Key, UInt> > slots_;
+
+  /// Double the size of the table and reinsert all entries.
+  void grow_();
+
+  /// Slot where a key is first looked for.
+  UInt home_(Key key) const;
+
+  /// Put an entry in the first empty slot from home_(key).
+  void place_(Key key, UInt ind);
+};
+}
+#endif
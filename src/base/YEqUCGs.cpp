@@ -72,12 +72,40 @@ double YEqUCGs::evalHash_(const CNode* node, UInt rank)
 }
 
 
+YEqRegistry::Key YEqUCGs::evalKey_(const CNode* node)
+{
+  // same traversal as evalHash_, but only operators and variables are used.
+  // Constants are compared with a tolerance by CGraph::isIdenticalTo.
+  OpCode op = node->getOp();
+  YEqRegistry::Key key = op;
+  if (OpVar==op) {
+    key = YEqRegistry::mix(key, node->getV()->getId());
+  } else if (1==node->numChild()) {
+    key = YEqRegistry::mix(key, evalKey_(node->getL()));
+  } else if (2==node->numChild()) {
+    key = YEqRegistry::mix(key, evalKey_(node->getL()));
+    key = YEqRegistry::mix(key, evalKey_(node->getR()));
+  } else if (2<node->numChild()) {
+    CNode** c1 = node->getListL();
+    CNode** c2 = node->getListR();
+    while (c1<c2) {
+      key = YEqRegistry::mix(key, evalKey_(*c1));
+      ++c1;
+    }
+  }
+  return key;
+}
+
+
 VariablePtr YEqUCGs::findY(CGraphPtr cg)
 {
   double hash = evalHash_(cg->getOut(), 1);
   OpCode op = cg->getOut()->getOp();
   VariablePtr x = *(cg->varsBegin());
-  for (UInt i=0; i<y_.size(); ++i) {
+  YEqRegistry::Key key = evalKey_(cg->getOut());
+  UInt pos = reg_.begin(key);
+  UInt i;
+  while (reg_.next(key, &pos, &i)) {
     if (fabs(hash-hash_[i])<1e-10
         && op == op_[i]
         && x == x_[i]
@@ -96,6 +124,7 @@ void YEqUCGs::insert(VariablePtr auxvar, CGraphPtr cg)
   assert(auxvar && cg);
 
   x = *(cg->varsBegin());
+  reg_.insert(evalKey_(cg->getOut()), y_.size());
   op_.push_back(cg->getOut()->getOp());
   hash_.push_back(evalHash_(cg->getOut(), 1));
   y_.push_back(auxvar);
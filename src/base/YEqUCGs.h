@@ -16,6 +16,7 @@
 
 #include "Types.h"
 #include "OpCode.h"
+#include "YEqRegistry.h"
 
 namespace Minotaur {
 class CGraph;
@@ -36,7 +37,9 @@ private:
   DoubleVector rand_;
   VarVector x_;
   VarVector y_;
+  YEqRegistry reg_;
   double evalHash_(const CNode* node, UInt rank);
+  YEqRegistry::Key evalKey_(const CNode* node);
 };
 }
 #endif
@@ -34,7 +34,9 @@ VariablePtr YEqUnivar::findY(VariablePtr v, double a, double b)
 {
   UInt key = v->getId();
   double etol = 1e-8;
-  for (UInt i=0; i<v_.size(); ++i) {
+  UInt pos = reg_.begin(key);
+  UInt i;
+  while (reg_.next(key, &pos, &i)) {
     if (hash_[i] == evalHash_(key, a, b) && v == v_[i]
         && fabs(a - a_[i]) < etol && fabs(b - b_[i]) < etol) {
       return y_[i];
@@ -45,6 +47,7 @@ VariablePtr YEqUnivar::findY(VariablePtr v, double a, double b)
 
 void YEqUnivar::insert(VariablePtr auxvar, VariablePtr v, double a, double b)
 {
+  reg_.insert(v->getId(), y_.size());
   v_.push_back(v);
   hash_.push_back(evalHash_(v->getId(), a, b));
   a_.push_back(a);
@@ -13,6 +13,7 @@
 #define MINOTAURYEQUNIVAR_H
 
 #include "Types.h"
+#include "YEqRegistry.h"
 
 namespace Minotaur {
 
@@ -31,6 +32,7 @@ private:
   DoubleVector b_;
   VarVector v_;
   VarVector y_;
+  YEqRegistry reg_;
 
   double evalHash_(UInt key, double a, double b);
 };
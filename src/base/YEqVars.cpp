@@ -35,7 +35,9 @@ YEqVars::YEqVars(UInt n)
 VariablePtr YEqVars::findY(VariablePtr x, double k)
 {
   UInt key = x->getId();
-  for (UInt i=0; i<x_.size(); ++i){
+  UInt pos = reg_.begin(key);
+  UInt i;
+  while (reg_.next(key, &pos, &i)) {
     if (hash_[i] == key && fabs(k-k_[i])<1e-12 && x==x_[i]) {
       return y_[i];
     }
@@ -47,6 +49,7 @@ VariablePtr YEqVars::findY(VariablePtr x, double k)
 void YEqVars::insert(VariablePtr auxvar, VariablePtr x, double k)
 {
   UInt ind = x->getId()%n_;
+  reg_.insert(x->getId(), y_.size());
   k_.push_back(k);
   x_.push_back(x);
   y_.push_back(auxvar);
@@ -15,6 +15,7 @@
 #define MINOTAURYEQVARS_H
 
 #include "Types.h"
+#include "YEqRegistry.h"
 #include "OpCode.h"
 
 namespace Minotaur {
@@ -33,6 +34,7 @@ private:
   UInt n_;
   std::vector<VariablePtr> x_;
   VarVector y_;
+  YEqRegistry reg_;
 };
 }
 
@@ -0,0 +1,184 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file Bench.cpp
+ * \brief Define class BenchRunner for timing small kernels of Minotaur.
+ * \author The Minotaur Team
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+
+#include "MinotaurConfig.h"
+#include "Bench.h"
+#include "Version.h"
+
+using namespace Minotaur;
+
+const double BenchRunner::minTime_ = 0.01;
+
+namespace {
+  double now()
+  {
+    return std::chrono::duration<double>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+}
+
+
+BenchRunner::BenchRunner(UInt reps, const std::string &filter)
+  : filter_(filter),
+    reps_(std::max(reps, (UInt) 1))
+{
+}
+
+
+BenchRunner::~BenchRunner()
+{
+  results_.clear();
+}
+
+
+void BenchRunner::addResult_(BenchResult &res, std::vector<double> &times)
+{
+  double sum = 0.0;
+
+  for (UInt i=0; i<times.size(); ++i) {
+    times[i] /= res.inner;
+    sum += times[i];
+  }
+  std::sort(times.begin(), times.end());
+  res.reps = times.size();
+  res.min = times.front();
+  res.median = (times.size() % 2) ? times[times.size()/2] :
+    0.5*(times[times.size()/2 - 1] + times[times.size()/2]);
+  res.mean = sum/times.size();
+  results_.push_back(res);
+  std::cerr << "minotaur-bench: " << std::setw(28) << std::left << res.name
+            << " " << std::scientific << std::setprecision(3) << res.median
+            << " s" << std::endl;
+}
+
+
+void BenchRunner::run(const std::string &name, UInt size,
+                      std::function<double ()> kernel)
+{
+  BenchResult res;
+  std::vector<double> times;
+  double t;
+
+  if (false == wants(name)) {
+    return;
+  }
+  res.name = name;
+  res.size = size;
+  res.inner = 1;
+  res.check = kernel();
+
+  // calibrate the number of calls in a sample.
+  for (;;) {
+    t = now();
+    for (UInt j=0; j<res.inner; ++j) {
+      kernel();
+    }
+    t = now() - t;
+    if (t >= minTime_ || res.inner >= (1U << 24)) {
+      break;
+    }
+    res.inner *= 2;
+  }
+
+  for (UInt i=0; i<reps_; ++i) {
+    t = now();
+    for (UInt j=0; j<res.inner; ++j) {
+      kernel();
+    }
+    times.push_back(now() - t);
+  }
+  addResult_(res, times);
+}
+
+
+void BenchRunner::run(const std::string &name, UInt size,
+                      std::function<void ()> setup,
+                      std::function<double ()> kernel)
+{
+  BenchResult res;
+  std::vector<double> times;
+  double t;
+
+  if (false == wants(name)) {
+    return;
+  }
+  res.name = name;
+  res.size = size;
+  res.inner = 1;
+  setup();
+  res.check = kernel();
+
+  for (UInt i=0; i<reps_; ++i) {
+    setup();
+    t = now();
+    kernel();
+    times.push_back(now() - t);
+  }
+  addResult_(res, times);
+}
+
+
+bool BenchRunner::wants(const std::string &name) const
+{
+  return (filter_.empty() || name.find(filter_) != std::string::npos);
+}
+
+
+void BenchRunner::writeJson(std::ostream &out, UInt scale) const
+{
+  out << "{" << std::endl
+      << "  \"minotaur_version\": \"" << MINOTAUR_MAJOR_VERSION << "."
+      << MINOTAUR_MINOR_VERSION << "." << MINOTAUR_PATCH_VERSION << "\","
+      << std::endl
+#if defined(MINOTAUR_GIT_VERSION)
+      << "  \"git_version\": \"" << MINOTAUR_GIT_VERSION << "\"," << std::endl
+#endif
+      << "  \"scale\": " << scale << "," << std::endl
+      << "  \"unit\": \"seconds per call\"," << std::endl
+      << "  \"benchmarks\": [" << std::endl;
+  out << std::setprecision(6) << std::scientific;
+  for (UInt i=0; i<results_.size(); ++i) {
+    const BenchResult &r = results_[i];
+    out << "    {\"name\": \"" << r.name << "\", \"size\": " << r.size
+        << ", \"inner\": " << r.inner << ", \"reps\": " << r.reps
+        << ", \"min\": " << r.min << ", \"median\": " << r.median
+        << ", \"mean\": " << r.mean << ", \"check\": ";
+    // JSON has no inf or nan.
+    if (std::isfinite(r.check)) {
+      out << r.check;
+    } else {
+      out << "null";
+    }
+    out << "}" << (i+1 < results_.size() ? "," : "") << std::endl;
+  }
+  out << "  ]" << std::endl << "}" << std::endl;
+}
+
+
+void BenchRunner::writeTable(std::ostream &out) const
+{
+  out << std::setw(28) << std::left << "name" << std::right
+      << std::setw(10) << "size" << std::setw(14) << "min"
+      << std::setw(14) << "median" << std::setw(14) << "mean" << std::endl;
+  out << std::setprecision(4) << std::scientific;
+  for (UInt i=0; i<results_.size(); ++i) {
+    const BenchResult &r = results_[i];
+    out << std::setw(28) << std::left << r.name << std::right
+        << std::setw(10) << r.size << std::setw(14) << r.min
+        << std::setw(14) << r.median << std::setw(14) << r.mean << std::endl;
+  }
+}
@@ -0,0 +1,135 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file Bench.h
+ * \brief Declare class BenchRunner for timing small kernels of Minotaur, and
+ * the functions that register the benchmarks.
+ * \author The Minotaur Team
+ */
+
+#ifndef MINOTAURBENCH_H
+#define MINOTAURBENCH_H
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Types.h"
+
+namespace Minotaur {
+
+  /// Timings of one benchmark. All times are in seconds per call.
+  struct BenchResult {
+    std::string name;  ///> Name, e.g. "cgraph.eval".
+    UInt size;         ///> Size of the instance, e.g. number of variables.
+    UInt inner;        ///> Calls in each sample.
+    UInt reps;         ///> Number of samples.
+    double min;        ///> Fastest sample.
+    double median;     ///> Median sample.
+    double mean;       ///> Mean of samples.
+    double check;      ///> Sum of values returned by the kernel.
+  };
+
+
+  /**
+   * \brief Run kernels a number of times and collect their timings.
+   *
+   * A kernel is a function returning a double. The values it returns are
+   * added up and reported, so that the compiler cannot drop the work, and
+   * so that a change in the results shows up along with a change in time.
+   *
+   * Each benchmark is run once to warm up. If it has no setup, the number of
+   * calls in a sample is then doubled until a sample takes at least minTime_
+   * seconds. Otherwise, the setup is called before each sample, untimed, and
+   * each sample has exactly one call.
+   */
+  class BenchRunner {
+  public:
+    /**
+     * \brief Create a runner.
+     *
+     * \param [in] reps Number of samples of each benchmark.
+     * \param [in] filter Only benchmarks whose name contains this string are
+     * run. Empty to run all.
+     */
+    BenchRunner(UInt reps, const std::string &filter);
+
+    /// Destroy.
+    ~BenchRunner();
+
+    /// Return true if the benchmark with this name should be run.
+    bool wants(const std::string &name) const;
+
+    /**
+     * \brief Time a kernel.
+     *
+     * \param [in] name Name of the benchmark.
+     * \param [in] size Size of the instance, written to the output.
+     * \param [in] kernel The function timed.
+     */
+    void run(const std::string &name, UInt size,
+             std::function<double ()> kernel);
+
+    /**
+     * \brief Time a kernel that changes its data, and must be given fresh
+     * data by a setup function before each call.
+     *
+     * \param [in] name Name of the benchmark.
+     * \param [in] size Size of the instance, written to the output.
+     * \param [in] setup Called before each sample, not timed.
+     * \param [in] kernel The function timed.
+     */
+    void run(const std::string &name, UInt size,
+             std::function<void ()> setup, std::function<double ()> kernel);
+
+    /// Write the results as a JSON object.
+    void writeJson(std::ostream &out, UInt scale) const;
+
+    /// Write the results as a table, one benchmark on a line.
+    void writeTable(std::ostream &out) const;
+
+  private:
+    /// Only benchmarks whose name contains this string are run.
+    std::string filter_;
+
+    /// Minimum time of a sample without setup, in seconds.
+    static const double minTime_;
+
+    /// Number of samples.
+    UInt reps_;
+
+    /// Results, in the order of runs.
+    std::vector<BenchResult> results_;
+
+    /// Fill the statistics of a result from the times of samples.
+    void addResult_(BenchResult &res, std::vector<double> &times);
+  };
+
+
+  /// Time CGraph, LinearFunction and QuadraticFunction evaluations.
+  void benchFunctions(BenchRunner &runner, UInt scale);
+
+  /// Time Jacobian and HessianOfLag fills.
+  void benchDerivatives(BenchRunner &runner, UInt scale);
+
+  /// Time presolve of LinearHandler on a synthetic integer program.
+  void benchPresolve(BenchRunner &runner, UInt scale);
+
+  /// Time NodeHeap and scans of a pool of cuts.
+  void benchTree(BenchRunner &runner, UInt scale);
+
+  /**
+   * \brief Time reading the bundled .nl instances into a Problem. Does
+   * nothing if Minotaur is built without AMPL.
+   *
+   * \param [in] runner The runner.
+   * \param [in] dir Directory with the instances.
+   */
+  void benchInstances(BenchRunner &runner, const std::string &dir);
+}
+#endif
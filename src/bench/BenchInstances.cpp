@@ -0,0 +1,58 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file BenchInstances.cpp
+ * \brief Benchmarks of reading the instances bundled with the unit tests.
+ * \author The Minotaur Team
+ */
+
+#include "MinotaurConfig.h"
+#include "Bench.h"
+#include "Environment.h"
+#include "Option.h"
+#include "Problem.h"
+
+#if defined(USE_MINOTAUR_AMPL_INTERFACE)
+#include "AMPLInterface.h"
+#endif
+
+using namespace Minotaur;
+
+#if defined(USE_MINOTAUR_AMPL_INTERFACE)
+void Minotaur::benchInstances(BenchRunner &runner, const std::string &dir)
+{
+  // a fixed list, so that results of different versions can be compared.
+  const char *names[] = {"3pk", "allfuns", "hess", "hs021", "lp0", "lp_eg0",
+                         "luedtke-1", "milp", "minlp_eg0", "poly", "qp", 0};
+  EnvPtr env = (EnvPtr) new Environment();
+  MINOTAUR_AMPL::AMPLInterfacePtr iface;
+  std::string name;
+
+  env->setLogLevel(LogNone);
+  env->getOptions()->findBool("expand_poly")->setValue(true);
+  for (UInt i=0; names[i]; ++i) {
+    name = std::string("nl.read.") + names[i];
+    if (false == runner.wants(name)) {
+      continue;
+    }
+    iface = (MINOTAUR_AMPL::AMPLInterfacePtr)
+      new MINOTAUR_AMPL::AMPLInterface(env);
+    runner.run(name, 0, [&]() {
+      ProblemPtr p = iface->readInstance(dir + "/" + names[i]);
+      double nvars = p->getNumVars();
+      delete p;
+      iface->freeASL();
+      return nvars; });
+    delete iface;
+  }
+  delete env;
+}
+#else
+void Minotaur::benchInstances(BenchRunner &, const std::string &)
+{
+}
+#endif
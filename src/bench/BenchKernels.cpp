@@ -0,0 +1,409 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file BenchKernels.cpp
+ * \brief Benchmarks of kernels on synthetic instances whose size grows
+ * linearly with the scale.
+ * \author The Minotaur Team
+ */
+
+#include <cmath>
+#include <random>
+
+#include "MinotaurConfig.h"
+#include "Bench.h"
+#include "CGraph.h"
+#include "CNode.h"
+#include "Cut.h"
+#include "Environment.h"
+#include "Function.h"
+#include "HessianOfLag.h"
+#include "Jacobian.h"
+#include "LinearFunction.h"
+#include "LinearHandler.h"
+#include "Node.h"
+#include "NodeHeap.h"
+#include "PreMod.h"
+#include "Problem.h"
+#include "QuadraticFunction.h"
+#include "Solution.h"
+#include "Variable.h"
+
+using namespace Minotaur;
+
+namespace {
+  // Number of variables of the synthetic instances at scale 1.
+  const UInt baseVars = 1000;
+
+  // Random numbers that do not depend on the standard library used, so
+  // that instances are the same on all machines.
+  class BenchRand {
+  public:
+    BenchRand() : gen_(20250101) {};
+    double unif(double lo, double hi)
+    { return lo + (hi - lo)*(gen_()/4294967296.0); };
+    UInt index(UInt n) { return gen_() % n; };
+  private:
+    std::mt19937 gen_;
+  };
+
+  EnvPtr newEnv()
+  {
+    EnvPtr env = (EnvPtr) new Environment();
+    env->setLogLevel(LogNone);
+    return env;
+  }
+
+  DoubleVector newPoint(UInt n, BenchRand &rnd)
+  {
+    DoubleVector x(n);
+    for (UInt i=0; i<n; ++i) {
+      x[i] = rnd.unif(0.5, 1.5);
+    }
+    return x;
+  }
+
+  // f = sum_i x_i x_{i+1} + x_i^2 + log(1 + x_i^2), over cnt variables
+  // starting at first.
+  CGraphPtr newCGraph(ProblemPtr p, UInt first, UInt cnt)
+  {
+    CGraphPtr cg = (CGraphPtr) new CGraph();
+    CNode *sum = 0, *xi, *xj, *t;
+
+    for (UInt i=first; i+1<first+cnt; ++i) {
+      xi = cg->newNode(p->getVariable(i));
+      xj = cg->newNode(p->getVariable(i+1));
+      t = cg->newNode(OpMult, xi, xj);
+      sum = sum ? cg->newNode(OpPlus, sum, t) : t;
+      t = cg->newNode(OpSqr, xi, 0);
+      sum = cg->newNode(OpPlus, sum, t);
+      t = cg->newNode(OpPlus, cg->newNode(1.0), t);
+      t = cg->newNode(OpLog, t, 0);
+      sum = cg->newNode(OpPlus, sum, t);
+    }
+    cg->setOut(sum);
+    cg->finalize();
+    return cg;
+  }
+
+  // diagonal, band and random off-band terms, about 3n in all.
+  QuadraticFunctionPtr newQuad(ProblemPtr p, BenchRand &rnd)
+  {
+    QuadraticFunctionPtr qf = (QuadraticFunctionPtr) new QuadraticFunction();
+    UInt n = p->getNumVars();
+
+    for (UInt i=0; i<n; ++i) {
+      qf->incTerm(p->getVariable(i), p->getVariable(i), rnd.unif(1, 2));
+      qf->incTerm(p->getVariable(i), p->getVariable((i+1) % n),
+                  rnd.unif(-1, 1));
+      qf->incTerm(p->getVariable(i), p->getVariable(rnd.index(n)),
+                  rnd.unif(-1, 1));
+    }
+    return qf;
+  }
+
+  ProblemPtr newVarProblem(EnvPtr env, UInt n, VariableType type, double ub)
+  {
+    ProblemPtr p = (ProblemPtr) new Problem(env);
+    for (UInt i=0; i<n; ++i) {
+      p->newVariable(0.0, ub, type);
+    }
+    return p;
+  }
+
+  // An integer program with rows of a few random terms. Some rows are
+  // duplicates of earlier rows, some are singletons and some variables are
+  // fixed, so that every pass of the presolve has work.
+  ProblemPtr newPresolveProblem(EnvPtr env, UInt n)
+  {
+    BenchRand rnd;
+    ProblemPtr p = newVarProblem(env, n, Integer, 10.0);
+    LinearFunctionPtr lf;
+    VariablePtr v;
+    double act;
+
+    for (UInt i=0; i<n; i+=50) {
+      v = p->getVariable(i);
+      p->changeBound(v, 3.0, 3.0);
+    }
+    for (UInt i=0; i<n; ++i) {
+      lf = (LinearFunctionPtr) new LinearFunction();
+      act = 0.0;
+      if (i % 20 == 1) {
+        v = p->getVariable(rnd.index(n));
+        lf->addTerm(v, 2.0);
+        act = 12.0;
+      } else if (i % 20 == 2) {
+        // twice the previous row, with a looser bound.
+        ConstraintPtr c = p->getConstraint(p->getNumCons()-1);
+        lf->add(c->getLinearFunction());
+        lf->multiply(2.0);
+        act = 2.0*c->getUb() + 1.0;
+      } else {
+        for (UInt j=0; j<4; ++j) {
+          double a = floor(rnd.unif(-5, 6));
+          v = p->getVariable(rnd.index(n));
+          if (0.0 != a && lf->getWeight(v) == 0.0) {
+            lf->addTerm(v, a);
+            act += (a > 0) ? 5.0*a : 0.0;
+          }
+        }
+      }
+      if (lf->getNumTerms() > 0) {
+        p->newConstraint((FunctionPtr) new Function(lf), -INFINITY, act);
+      } else {
+        delete lf;
+      }
+    }
+    lf = (LinearFunctionPtr) new LinearFunction();
+    for (UInt i=0; i<n; ++i) {
+      lf->addTerm(p->getVariable(i), rnd.unif(-1, 1));
+    }
+    p->newObjective((FunctionPtr) new Function(lf), 0.0, Minimize);
+    p->calculateSize(true);
+    return p;
+  }
+}
+
+
+void Minotaur::benchFunctions(BenchRunner &runner, UInt scale)
+{
+  BenchRand rnd;
+  EnvPtr env = newEnv();
+  UInt n = baseVars*scale;
+  ProblemPtr p = newVarProblem(env, n, Continuous, 10.0);
+  DoubleVector x = newPoint(n, rnd);
+  DoubleVector g(n, 0.0);
+  LinearFunctionPtr lf = (LinearFunctionPtr) new LinearFunction();
+  QuadraticFunctionPtr qf = newQuad(p, rnd);
+  CGraphPtr cg = newCGraph(p, 0, n);
+  const double *xp = &x[0];
+
+  for (UInt i=0; i<n; ++i) {
+    lf->addTerm(p->getVariable(i), rnd.unif(-1, 1));
+  }
+
+  runner.run("linear.eval", n, [&]() { return lf->eval(xp); });
+  runner.run("linear.evalGradient", n, [&]() {
+    std::fill(g.begin(), g.end(), 0.0);
+    lf->evalGradient(&g[0]);
+    return g[0]; });
+  runner.run("quadratic.eval", qf->getNumTerms(),
+             [&]() { return qf->eval(xp); });
+  runner.run("quadratic.evalGradient", qf->getNumTerms(), [&]() {
+    std::fill(g.begin(), g.end(), 0.0);
+    qf->evalGradient(xp, &g[0]);
+    return g[0]; });
+  runner.run("cgraph.eval", cg->getNumNodes(), [&]() {
+    int err = 0;
+    return cg->eval(xp, &err); });
+  runner.run("cgraph.evalGradient", cg->getNumNodes(), [&]() {
+    int err = 0;
+    std::fill(g.begin(), g.end(), 0.0);
+    cg->evalGradient(xp, &g[0], &err);
+    return g[0]; });
+
+  // the hessian storage of a cgraph is set up by HessianOfLag, so time the
+  // fill of a problem whose only nonlinear function is the cgraph.
+  if (runner.wants("cgraph.evalHessian")) {
+    HessianOfLagPtr hess;
+    DoubleVector vals;
+
+    p->newObjective((FunctionPtr) new Function((NonlinearFunctionPtr) cg),
+                    0.0, Minimize);
+    cg = 0;
+    p->setNativeDer();
+    hess = p->getHessian();
+    vals.resize(std::max(hess->getNumNz(), (UInt) 1));
+    runner.run("cgraph.evalHessian", hess->getNumNz(), [&]() {
+      int err = 0;
+      hess->fillRowColValues(xp, 1.0, 0, &vals[0], &err);
+      return vals[0]; });
+  }
+
+  if (cg) {
+    delete cg;
+  }
+  delete qf;
+  delete lf;
+  delete p;
+  delete env;
+}
+
+
+void Minotaur::benchDerivatives(BenchRunner &runner, UInt scale)
+{
+  BenchRand rnd;
+  EnvPtr env = newEnv();
+  UInt n = baseVars*scale;
+  const UInt width = 10;
+  ProblemPtr p = newVarProblem(env, n, Continuous, 10.0);
+  DoubleVector x = newPoint(n, rnd);
+  DoubleVector mult(n/width + 1, 1.0);
+  DoubleVector vals;
+  UIntVector irow, jcol;
+  LinearFunctionPtr lf;
+  JacobianPtr jac;
+  HessianOfLagPtr hess;
+  const double *xp = &x[0];
+
+  if (false == runner.wants("jacobian.fill") &&
+      false == runner.wants("hessianoflag.fill")) {
+    delete p;
+    delete env;
+    return;
+  }
+
+  // overlapping blocks of width variables, each with a cgraph and a few
+  // linear terms, and a quadratic objective.
+  for (UInt i=0; i+width<=n; i+=width-1) {
+    lf = (LinearFunctionPtr) new LinearFunction();
+    for (UInt j=0; j<3; ++j) {
+      lf->incTerm(p->getVariable(rnd.index(n)), rnd.unif(-1, 1));
+    }
+    p->newConstraint((FunctionPtr) new Function(lf, (NonlinearFunctionPtr)
+                                                newCGraph(p, i, width)),
+                     -INFINITY, 100.0);
+  }
+  p->newObjective((FunctionPtr) new Function(LinearFunctionPtr(),
+                                             newQuad(p, rnd)),
+                  0.0, Minimize);
+  mult.resize(p->getNumCons(), 1.0);
+  p->setNativeDer();
+
+  jac = p->getJacobian();
+  vals.resize(std::max(jac->getNumNz(), (UInt) 1));
+  irow.resize(vals.size());
+  jcol.resize(vals.size());
+  jac->fillRowColIndices(&irow[0], &jcol[0]);
+  runner.run("jacobian.fill", jac->getNumNz(), [&]() {
+    int err = 0;
+    jac->fillRowColValues(xp, &vals[0], &err);
+    return vals[0]; });
+
+  hess = p->getHessian();
+  vals.resize(std::max(hess->getNumNz(), (UInt) 1));
+  irow.resize(vals.size());
+  jcol.resize(vals.size());
+  hess->fillRowColIndices(&irow[0], &jcol[0]);
+  runner.run("hessianoflag.fill", hess->getNumNz(), [&]() {
+    int err = 0;
+    hess->fillRowColValues(xp, 1.0, &mult[0], &vals[0], &err);
+    return vals[0]; });
+
+  delete p;
+  delete env;
+}
+
+
+void Minotaur::benchPresolve(BenchRunner &runner, UInt scale)
+{
+  EnvPtr env = newEnv();
+  UInt n = 2*baseVars*scale;
+  ProblemPtr p = 0;
+
+  runner.run("linearhandler.presolve", n,
+    [&]() {
+      if (p) {
+        delete p;
+      }
+      p = newPresolveProblem(env, n); },
+    [&]() {
+      LinearHandler lh(env, p);
+      PreModQ mods;
+      Solution *sol = 0;
+      bool changed = false;
+
+      lh.presolve(&mods, &changed, &sol);
+      for (PreModQIter it=mods.begin(); it!=mods.end(); ++it) {
+        delete *it;
+      }
+      if (sol) {
+        delete sol;
+      }
+      return (double) p->getNumCons(); });
+
+  if (p) {
+    delete p;
+  }
+  delete env;
+}
+
+
+void Minotaur::benchTree(BenchRunner &runner, UInt scale)
+{
+  BenchRand rnd;
+  EnvPtr env = newEnv();
+  UInt nnodes = 10*baseVars*scale;
+  UInt n = baseVars*scale;
+  const UInt ncuts = 5*baseVars*scale;
+  std::vector<NodePtr> nodes(nnodes);
+  std::vector<CutPtr> cuts;
+  ProblemPtr p = newVarProblem(env, n, Continuous, 1.0);
+  DoubleVector x = newPoint(n, rnd);
+  const double *xp = &x[0];
+  LinearFunctionPtr lf;
+
+  for (UInt i=0; i<nnodes; ++i) {
+    nodes[i] = (NodePtr) new Node();
+    nodes[i]->setId(i);
+    nodes[i]->setDepth(rnd.index(50));
+    nodes[i]->setLb(rnd.unif(0, 100));
+  }
+  runner.run("nodeheap.value", nnodes, [&]() {
+    NodeHeap heap(NodeHeap::Value);
+    double sum = 0.0;
+    for (UInt i=0; i<nnodes; ++i) {
+      heap.push(nodes[i]);
+    }
+    while (false == heap.isEmpty()) {
+      sum += heap.top()->getLb();
+      heap.pop();
+    }
+    return sum; });
+  runner.run("nodeheap.depth", nnodes, [&]() {
+    NodeHeap heap(NodeHeap::Depth);
+    double sum = 0.0;
+    for (UInt i=0; i<nnodes; ++i) {
+      heap.push(nodes[i]);
+    }
+    while (false == heap.isEmpty()) {
+      sum += heap.top()->getDepth();
+      heap.pop();
+    }
+    return sum; });
+
+  // a pool of sparse cuts, scanned for violation as in CutMan1::separate().
+  for (UInt i=0; i<ncuts; ++i) {
+    lf = (LinearFunctionPtr) new LinearFunction();
+    for (UInt j=0; j<10; ++j) {
+      lf->incTerm(p->getVariable(rnd.index(n)), rnd.unif(-1, 1));
+    }
+    cuts.push_back((CutPtr) new Cut(n, (FunctionPtr) new Function(lf),
+                                    -INFINITY, rnd.unif(-1, 1), false,
+                                    false));
+  }
+  runner.run("cutpool.scan", ncuts, [&]() {
+    double nviol = 0.0;
+    int err = 0;
+    for (UInt i=0; i<cuts.size(); ++i) {
+      if (cuts[i]->eval(xp, &err) > cuts[i]->getUb() + 1e-6) {
+        nviol += 1.0;
+      }
+    }
+    return nviol; });
+
+  for (UInt i=0; i<cuts.size(); ++i) {
+    delete cuts[i]->getFunction();
+    delete cuts[i];
+  }
+  for (UInt i=0; i<nnodes; ++i) {
+    delete nodes[i];
+  }
+  delete p;
+  delete env;
+}
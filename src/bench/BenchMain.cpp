@@ -0,0 +1,115 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file BenchMain.cpp
+ * \brief The main function for timing kernels of Minotaur and writing the
+ * timings as JSON, so that they can be compared across versions.
+ * \author The Minotaur Team
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "MinotaurConfig.h"
+#include "Bench.h"
+
+using namespace Minotaur;
+
+#if !defined(MNTR_BENCH_INSTANCES)
+#define MNTR_BENCH_INSTANCES "instances"
+#endif
+
+
+void usage()
+{
+  std::cerr << "Time kernels of Minotaur and write the timings as JSON."
+            << std::endl
+            << "Usage:" << std::endl
+            << "minotaur-bench [-f filter] [-i dir] [-o file] [-r reps] "
+            << "[-s scale] [-t]" << std::endl
+            << "  -f filter  run benchmarks whose name contains filter"
+            << std::endl
+            << "  -i dir     directory with the .nl instances (default "
+            << MNTR_BENCH_INSTANCES << ")" << std::endl
+            << "  -o file    write JSON to file instead of stdout" << std::endl
+            << "  -r reps    number of samples of each benchmark (default 5)"
+            << std::endl
+            << "  -s scale   multiply sizes of synthetic instances (default 1)"
+            << std::endl
+            << "  -t         also write a table to stderr" << std::endl;
+}
+
+
+int main(int argc, char** argv)
+{
+  std::string filter, dir = MNTR_BENCH_INSTANCES, fname;
+  int reps = 5, scale = 1;
+  bool table = false;
+  BenchRunner *runner;
+
+  for (int i=1; i<argc; ++i) {
+    if (0 == strcmp(argv[i], "-t")) {
+      table = true;
+    } else if (i+1 < argc && 0 == strcmp(argv[i], "-f")) {
+      filter = argv[++i];
+    } else if (i+1 < argc && 0 == strcmp(argv[i], "-i")) {
+      dir = argv[++i];
+    } else if (i+1 < argc && 0 == strcmp(argv[i], "-o")) {
+      fname = argv[++i];
+    } else if (i+1 < argc && 0 == strcmp(argv[i], "-r")) {
+      reps = atoi(argv[++i]);
+    } else if (i+1 < argc && 0 == strcmp(argv[i], "-s")) {
+      scale = atoi(argv[++i]);
+    } else {
+      usage();
+      return 1;
+    }
+  }
+  // UInt would wrap negative values to huge counts.
+  if (reps < 1 || scale < 1) {
+    usage();
+    return 1;
+  }
+
+  runner = new BenchRunner((UInt) reps, filter);
+  benchFunctions(*runner, scale);
+  benchDerivatives(*runner, scale);
+  benchPresolve(*runner, scale);
+  benchTree(*runner, scale);
+  benchInstances(*runner, dir);
+
+  if (fname.empty()) {
+    runner->writeJson(std::cout, scale);
+  } else {
+    std::ofstream out(fname.c_str());
+    if (!out.is_open()) {
+      std::cerr << "minotaur-bench: cannot open " << fname << std::endl;
+      delete runner;
+      return 1;
+    }
+    runner->writeJson(out, scale);
+  }
+  if (table) {
+    runner->writeTable(std::cerr);
+  }
+  delete runner;
+  return 0;
+}
+
+
+// Local Variables:
+// mode: c++
+// eval: (c-set-style "k&r")
+// eval: (c-set-offset 'innamespace 0)
+// eval: (setq c-basic-offset 2)
+// eval: (setq fill-column 78)
+// eval: (auto-fill-mode 1)
+// eval: (setq column-number-mode 1)
+// eval: (setq indent-tabs-mode nil)
+// End:
@@ -10,9 +10,12 @@
  * \author Ashutosh Mahajan, Argonne National Laboratory
  */
 
+#include <algorithm>
+#include <iomanip>
 #include <sstream>
 #include <stdint.h>
 #include <iostream>
+#include <omp.h>
 #include "opcode.hd"
 
 #include "MinotaurConfig.h"
@@ -624,14 +627,16 @@ Minotaur::ProblemPtr AMPLInterface::copyInstanceFromASL2_()
   Minotaur::LinearFunctionPtr lf = Minotaur::LinearFunctionPtr();  //NULL
   Minotaur::QuadraticFunctionPtr qf = Minotaur::QuadraticFunctionPtr();  //NULL
   Minotaur::FunctionPtr f = Minotaur::FunctionPtr();  //NULL
-  cde *constraint_cde = 0, *obj_cde = 0;
+  cde *obj_cde = 0;
   ASL_fg *asl_fg = (ASL_fg *)myAsl_;
   Minotaur::CGraphPtr cgraph;
   Minotaur::CNode *cnode = 0;
   std::string name;
   Minotaur::ObjectiveType obj_sense = Minotaur::Minimize;
-  double *x = 0, *grad = 0;
-  int err = 0;
+  std::vector<Minotaur::FunctionPtr> funs;
+  int nthreads = std::min(env_->getOptions()->findInt("threads")->getValue(),
+                          omp_get_max_threads());
+  double wtime;
 
   // new instance
   Minotaur::ProblemPtr instance = (Minotaur::ProblemPtr) 
@@ -639,50 +644,45 @@ Minotaur::ProblemPtr AMPLInterface::copyInstanceFromASL2_()
   addVariablesFromASL_(instance);
   addDefinedVars_(instance);
 
-  x = new double[instance->getNumVars()];
-  grad = new double[instance->getNumVars()];
-  memset(x, 0, instance->getNumVars()*sizeof(double));
-  memset(grad, 0, instance->getNumVars()*sizeof(double));
-
-  // visit each constraint and copy the linear parts and nonlinear parts.
+  // Phase 1: visit each nonlinear constraint and copy the linear and
+  // nonlinear parts into a new function. Each function owns its own graph,
+  // and ASL and the instance are only read here, so constraints are
+  // converted in parallel.
   start_index = 0;
   stop_index = myAsl_->i.nlc_ - myAsl_->i.nlnc_;
-  for (Minotaur::UInt i=start_index; i<stop_index; ++i) {
-    cgraph = new Minotaur::CGraph();
-    lf = new Minotaur::LinearFunction();
-    addLinearTermsFromConstr_(lf, i);
-    constraint_cde = asl_fg->I.con_de_+i;
-    cnode = getCGraph_(constraint_cde->e, cgraph, instance);
-    cgraph->setOut(cnode);
-    cgraph->finalize();
-    assert(Minotaur::Constant!=cgraph->getType());
-
-    // If a constraint has a 'defined variable (AMPL specific)' then even if
-    // the constraint is linear, AMPL may still give a cgraph. We convert such
-    // a cgraph into a linear function, and add a linear constraint. The
-    // 'defined variable' is separately added as a nonlinear constraint later
-    // on.
-    if (Minotaur::Linear==cgraph->getType()) {
-      if (!lf) {
-        lf = (Minotaur::LinearFunctionPtr) new Minotaur::LinearFunction();
-      }
-      cgraph->evalGradient(x, grad, &err);
-      assert(0==err);
-      for (Minotaur::UInt j=0; j<instance->getNumVars(); ++j) {
-        if (fabs(grad[j])>1e-10) {
-          lf->incTerm(instance->getVariable(j), grad[j]);
-        }
-      }
-      memset(grad, 0, instance->getNumVars()*sizeof(double));
-      //cgraph.reset();
-      cgraph = 0;
+  funs.resize(stop_index, 0);
+  wtime = omp_get_wtime();
+#pragma omp parallel num_threads(nthreads)
+  {
+    double *x = new double[instance->getNumVars()];
+    double *grad = new double[instance->getNumVars()];
+    memset(x, 0, instance->getNumVars()*sizeof(double));
+    memset(grad, 0, instance->getNumVars()*sizeof(double));
+#pragma omp for schedule(dynamic, 64)
+    for (int i=start_index; i<(int) stop_index; ++i) {
+      funs[i] = getNlConsFun_(i, instance, x, grad);
     }
+    delete [] grad;
+    delete [] x;
+  }
+  logger_->msgStream(Minotaur::LogExtraInfo) << me_ 
+    << "time used in converting " << stop_index 
+    << " nonlinear constraints using " << nthreads << " threads = "
+    << std::fixed << std::setprecision(2) << omp_get_wtime() - wtime 
+    << std::endl;
 
-    f = (Minotaur::FunctionPtr) new Minotaur::Function(lf, qf, cgraph);
+  // Phase 2: add the constraints to the instance in the same order as ASL
+  // so that indices do not depend on the number of threads.
+  wtime = omp_get_wtime();
+  for (Minotaur::UInt i=start_index; i<stop_index; ++i) {
     name = std::string(con_name_ASL(myAsl_, i));
-    instance->newConstraint(f, myAsl_->i.LUrhs_[2*i], myAsl_->i.LUrhs_[2*i+1],
-                            name); 
+    instance->newConstraint(funs[i], myAsl_->i.LUrhs_[2*i],
+                            myAsl_->i.LUrhs_[2*i+1], name); 
   }
+  logger_->msgStream(Minotaur::LogExtraInfo) << me_ 
+    << "time used in adding nonlinear constraints = "
+    << std::fixed << std::setprecision(2) << omp_get_wtime() - wtime 
+    << std::endl;
 
   // add constraints that are used to define 'defined variables'
   addQuadraticDefCons2_(instance);
@@ -719,10 +719,6 @@ Minotaur::ProblemPtr AMPLInterface::copyInstanceFromASL2_()
   }
 
   addSOS_(instance);
-
-  delete [] grad;
-  delete [] x;
-
   return instance;
 }
 
@@ -936,7 +932,9 @@ Minotaur::CNode *AMPLInterface::getCGraph_(expr *e_ptr,
   Minotaur::CNode *rchild = 0;
   Minotaur::CNode **childr = 0;
   Minotaur::CNode *n = 0;
-  int opcode = functionMap_[e_ptr->op];
+  // find() instead of [] so that concurrent calls do not modify the map.
+  std::map<efunc*, int>::const_iterator fit = functionMap_.find(e_ptr->op);
+  int opcode = (fit==functionMap_.end()) ? -1 : fit->second;
   switch (opcode) {
   case (OPPLUS):   // expr1 + expr2
     lchild = getCGraph_(e_ptr->L.e, cgraph, instance);
@@ -1466,6 +1464,48 @@ Minotaur::FunctionType AMPLInterface::getMultExpressionType_(expr *e_ptr)
 }
 
 
+Minotaur::FunctionPtr AMPLInterface::getNlConsFun_(int i,
+                                                   Minotaur::ProblemPtr instance,
+                                                   double *x, double *grad)
+{
+  ASL_fg *asl_fg = (ASL_fg *)myAsl_;
+  Minotaur::LinearFunctionPtr lf = Minotaur::LinearFunctionPtr();  //NULL
+  Minotaur::QuadraticFunctionPtr qf = Minotaur::QuadraticFunctionPtr(); //NULL
+  Minotaur::CGraphPtr cgraph = new Minotaur::CGraph();
+  Minotaur::CNode *cnode;
+  int err = 0;
+
+  addLinearTermsFromConstr_(lf, i);
+  cnode = getCGraph_((asl_fg->I.con_de_+i)->e, cgraph, instance);
+  cgraph->setOut(cnode);
+  cgraph->finalize();
+  assert(Minotaur::Constant!=cgraph->getType());
+
+  // If a constraint has a 'defined variable (AMPL specific)' then even if
+  // the constraint is linear, AMPL may still give a cgraph. We convert such
+  // a cgraph into a linear function, and add a linear constraint. The
+  // 'defined variable' is separately added as a nonlinear constraint later
+  // on.
+  if (Minotaur::Linear==cgraph->getType()) {
+    if (!lf) {
+      lf = (Minotaur::LinearFunctionPtr) new Minotaur::LinearFunction();
+    }
+    cgraph->evalGradient(x, grad, &err);
+    assert(0==err);
+    for (Minotaur::UInt j=0; j<instance->getNumVars(); ++j) {
+      if (fabs(grad[j])>1e-10) {
+        lf->incTerm(instance->getVariable(j), grad[j]);
+      }
+    }
+    memset(grad, 0, instance->getNumVars()*sizeof(double));
+    delete cgraph;
+    cgraph = 0;
+  }
+
+  return (Minotaur::FunctionPtr) new Minotaur::Function(lf, qf, cgraph);
+}
+
+
 Minotaur::UInt AMPLInterface::getNumDefs() const
 {
   return nDefVars_;
@@ -204,6 +204,12 @@ private:
    * ASL is not needed once the instance is constructed.
    */
   Minotaur::ProblemPtr copyInstanceFromASL_();
+  /**
+   * Same as copyInstanceFromASL_() but nonlinear functions are stored as
+   * computational graphs. The graphs of nonlinear constraints are built in
+   * parallel (using option "threads") and then added to the instance in
+   * order.
+   */
   Minotaur::ProblemPtr copyInstanceFromASL2_();
 
   /**
@@ -233,6 +239,20 @@ private:
   Minotaur::CNode* getCGraph_(expr *e_ptr, Minotaur::CGraphPtr cgraph, 
                               Minotaur::ProblemPtr instance);
 
+  /**
+   * \brief Get the function of the i-th nonlinear constraint. Safe to call
+   * concurrently for different constraints.
+   *
+   * \param [in] i Index of the constraint in ASL.
+   * \param [in] instance The instance whose variables are used.
+   * \param [in] x Array of size equal to number of variables, all zeros.
+   * \param [in] grad Array of size equal to number of variables, all
+   * zeros. It is used for converting linear graphs into linear functions
+   * and is reset to zeros before returning.
+   */
+  Minotaur::FunctionPtr getNlConsFun_(int i, Minotaur::ProblemPtr instance,
+                                      double *x, double *grad);
+
   /// Get the most general function type that describes all constraints.
   Minotaur::FunctionType getConstraintsType_();
 
@@ -49,6 +49,9 @@ BqpdEngine::BqpdEngine(EnvPtr env)
     bTol_(1e-9),
     chkPt_(0),
     consModed_(false),
+    jacCons_(0),
+    jacNz_(0),
+    jacVars_(0),
     dualCons_(0),
     dualX_(0),
     env_(env),
@@ -124,6 +127,7 @@ void BqpdEngine::load(ProblemPtr problem)
 {
   problem_ = problem;
   consModed_ = true;
+  jacCons_ = 0;
   bndRelaxed_ = true;
   bndChanges_ = 0;
   problem->setEngine(this);
@@ -140,6 +144,7 @@ void BqpdEngine::clear() {
     delete fStart_;
     fStart_=0;
   }
+  jacCons_ = 0;
 }
 
 // kmax is the Maximum value of k. kmax = max(n - (Number of
@@ -182,6 +187,9 @@ void BqpdEngine::load_()
   mxiwk   = 13*n + 4*m + mlp + lh1 + kmax + 113 + mxiwk0;
   setwsc(&mxwk, &mxiwk, &kk0, &ll0);
 
+  if (sol_) {
+    delete sol_;
+  }
   sol_ = (SolutionPtr) new Solution(INFINITY, 0, problem_);
   if (dualX_) {
     delete [] dualX_;
@@ -189,7 +197,12 @@ void BqpdEngine::load_()
   }
   dualX_ = new double[n];
   dualCons_ = new double[m];
-  fStart_ = new BqpdData(n, m, kmax, maxa, lh1, problem_->getNumJacNnzs());
+  // reuse the arrays of the last solve if they are large enough.
+  if (fStart_) {
+    fStart_->resize(n, m, kmax, maxa, lh1, problem_->getNumJacNnzs());
+  } else {
+    fStart_ = new BqpdData(n, m, kmax, maxa, lh1, problem_->getNumJacNnzs());
+  }
 
 #if SPEW
   logger_->msgStream(LogDebug2) << me_ << "maxa = " << maxa << std::endl;
@@ -200,6 +213,7 @@ void BqpdEngine::load_()
 void BqpdEngine::removeCons(std::vector<ConstraintPtr> &)
 {
   consModed_ = true;
+  jacCons_ = 0;
   if (true==strBr_ && chkPt_) {
     delete chkPt_;
     chkPt_ = 0;
@@ -223,6 +237,48 @@ void BqpdEngine::setGradient_()
   ObjectivePtr oPtr = problem_->getObjective();
   assert(oPtr);
   LinearFunctionPtr lf;
+
+  if (jacCons_ > 0 && jacCons_ <= m && jacVars_ == n) {
+    // only constraints were appended. The gradient of the objective and of
+    // the first jacCons_ constraints are already in a and la. The row
+    // pointers are after the column indices, so they are written again.
+    la[0] = maxa+1;
+    la[ptr_pos] = 1;
+    ++ptr_pos;
+    cnt = n+1;
+    la[ptr_pos] = cnt;
+    ++ptr_pos;
+    for (ConstraintConstIterator it2=problem_->consBegin(); 
+        it2!=problem_->consBegin()+jacCons_; ++it2) {
+      lf = (*it2)->getLinearFunction();
+      if (lf) {
+        cnt += lf->getNumTerms();
+      }
+      la[ptr_pos] = cnt;
+      ++ptr_pos;
+    }
+    assert(cnt==jacNz_+1);
+    for (ConstraintConstIterator it2=problem_->consBegin()+jacCons_; 
+        it2!=problem_->consEnd(); ++it2) {
+      lf = (*it2)->getLinearFunction();
+      if (lf) {
+        for (VariableGroupConstIterator it=lf->termsBegin(); 
+            it!=lf->termsEnd(); ++it) {
+          a[cnt-1] = it->second;
+          la[cnt] = it->first->getIndex()+1; // offset by 1 
+          ++cnt;
+        }
+      } 
+      la[ptr_pos] = cnt;
+      ++ptr_pos;
+    }
+    assert(cnt==maxa+1);
+    assert(ptr_pos==maxa+m+3);
+    jacCons_ = m;
+    jacNz_ = cnt-1;
+    return;
+  }
+
   memset(la, 0, (maxa+m+3)*sizeof(fint));
   la[0] = maxa+1;
   la[ptr_pos] = 1;
@@ -266,6 +322,9 @@ void BqpdEngine::setGradient_()
   delete [] x;
   assert(cnt==maxa+1);
   assert(ptr_pos==maxa+m+3);
+  jacCons_ = m;
+  jacNz_ = cnt-1;
+  jacVars_ = n;
 }
 
 
@@ -363,10 +422,7 @@ EngineStatus BqpdEngine::solve()
   int mode      = 0;
 
   if (consModed_ == true) {
-    // redo from scratch
-    if (fStart_) {
-      delete fStart_;
-    }
+    // redo from scratch, but in the arrays of the last solve.
     timer_->start();
     load_();
     stats_->cTime += timer_->query();
@@ -378,8 +434,6 @@ EngineStatus BqpdEngine::solve()
     setHessian_();
     // set initial point
     setInitialPoint_();
-    // set bounds on constraints.
-    setConsBounds_();
   } else if (chkPt_) {
     mode = wsMode_;
   } else if (false == bndRelaxed_ && bndChanges_ < 3) {
@@ -393,8 +447,9 @@ EngineStatus BqpdEngine::solve()
   bndRelaxed_ = false;
   bndChanges_ = 0;
 
-  // set bounds on variables
+  // set bounds on variables and constraints
   setVarBounds_();
+  setConsBounds_();
 
   solve_(mode, f);
   if (EngineError == status_ && resolveError_) {
@@ -668,9 +723,19 @@ EngineStatus BqpdEngine::getStatus()
 }
   
 
-void BqpdEngine::changeBound(ConstraintPtr, BoundType, double)
+void BqpdEngine::changeBound(ConstraintPtr cons, BoundType lu, double val)
 {
-  consModed_ = true;
+  // the bounds are set again in solve, only the warm start mode changes.
+  if (fStart_ && !consModed_) {
+    UInt i = fStart_->n + cons->getIndex();
+    if ((lu == Lower && val<fStart_->bl[i]) || 
+        (lu == Upper && val>fStart_->bu[i])) {
+      if (!chkPt_) {
+        bndRelaxed_ = true;
+      }
+    }
+  }
+  ++bndChanges_;
 }
 
 
@@ -714,6 +779,7 @@ void BqpdEngine::changeBound(VariablePtr var, double new_lb,
 void BqpdEngine::changeObj(FunctionPtr, double)
 {
   consModed_ = true;
+  jacCons_ = 0;
   if (true==strBr_ && chkPt_) {
     delete chkPt_;
     chkPt_ = 0;
@@ -724,6 +790,7 @@ void BqpdEngine::changeObj(FunctionPtr, double)
 void BqpdEngine::negateObj()
 {
   consModed_ = true;
+  jacCons_ = 0;
   if (true==strBr_ && chkPt_) {
     delete chkPt_;
     chkPt_ = 0;
@@ -735,6 +802,7 @@ void BqpdEngine::changeConstraint(ConstraintPtr, LinearFunctionPtr,
                                   double , double)
 {
   consModed_ = true;
+  jacCons_ = 0;
   if (true==strBr_ && chkPt_) {
     delete chkPt_;
     chkPt_ = 0;
@@ -817,43 +885,120 @@ std::string BqpdEngine::getName() const
 // ----------------------------------------------------------------------- //
 BqpdData::BqpdData(UInt n_t, UInt m_t, int kmax_t, UInt maxa_t, UInt lh1_t, 
                    UInt nJac_t, bool zero)
- : n(n_t),
-   m(m_t),
-   kmax(kmax_t),
-   lh1(lh1_t),
-   nJac(nJac_t),
-   maxa(maxa_t),
+ : n(0),
+   m(0),
+   kmax(0),
+   lh1(0),
+   nJac(0),
+   maxa(0),
+   x(0),
+   r(0),
+   e(0),
+   w(0),
+   g(0),
+   ls(0),
+   alp(0),
+   lp(0),
+   info(0),
+   bl(0),
+   bu(0),
+   a(0),
+   la(0),
+   ws(0),
+   lws(0),
    peq(0),
-   k(0)
+   k(0),
+   aCap_(0),
+   laCap_(0),
+   lwsCap_(0),
+   nCap_(0),
+   nmCap_(0),
+   wsCap_(0)
 {
-  UInt nm     = n+m;
   UInt mlp    = 1000;      // Max level of degeneracy. 
-  UInt mxwk0  = 50000+10*(nJac+n+m);
-  UInt mxiwk0 = 500000;    // Initial workspace
-  UInt mxwk   = 21*n + 8*m + mlp + lh1 + kmax*(kmax+9)/2 + mxwk0;
-  UInt mxiwk  = 13*n + 4*m + mlp + lh1 + kmax + 113 + mxiwk0;
-  //std::cout << "mxwk2 = " << mxwk << std::endl;
-
 
-  x     = new real[n];   // primal solution.
-  r     = new real[nm];  // residuals/multipliers
-  e     = new real[nm];  // steepest-edge normalization coefficients 
-  w     = new real[nm];  // denominators for ratio tests
-  g     = new real[n];   // gradient vector of f(x)
-  ls    = new fint[nm];  // indices of the active constraints 
   alp   = new real[mlp]; // workspace associated with recursion
   lp    = new fint[mlp]; // workspace associated with recursion
   info  = new fint[100]; // information on return from bqpd
-  bl    = new real[nm];  // lower bounds for variables and constraints
-  bu    = new real[nm];  // upper bounds for variables and constraints
+  resize(n_t, m_t, kmax_t, maxa_t, lh1_t, nJac_t, zero);
+}
+
 
-  // allocate storage for Hessian etc, and zero them out
-  ws    = new real[mxwk];  // workspace
-  lws   = new fint[mxiwk]; // workspace
+// Return a capacity of at least size. Capacities grow by half, so that a
+// sequence of small increases causes few reallocations.
+static UInt growCap_(UInt cap, UInt size)
+{
+  return (size > cap + cap/2) ? size : cap + cap/2;
+}
+
+
+// Reallocate arr with cap entries, keeping its first keep entries.
+template <class T> static void realloc_(T *&arr, UInt cap, UInt keep)
+{
+  T *narr = new T[cap];
+  if (arr && keep > 0) {
+    std::copy(arr, arr+keep, narr);
+  }
+  delete [] arr;
+  arr = narr;
+}
+
+
+void BqpdData::resize(UInt n_t, UInt m_t, int kmax_t, UInt maxa_t,
+                      UInt lh1_t, UInt nJac_t, bool zero)
+{
+  UInt mlp, mxwk0, mxiwk0, mxwk, mxiwk, nm;
+  UInt old_a = (a) ? maxa+1 : 0;
+  UInt old_la = (la) ? maxa+m+3 : 0;
+
+  n      = n_t;
+  m      = m_t;
+  kmax   = kmax_t;
+  lh1    = lh1_t;
+  nJac   = nJac_t;
+  maxa   = maxa_t;
+  nm     = n+m;
+  mlp    = 1000;      // Max level of degeneracy. 
+  mxwk0  = 50000+10*(nJac+n+m);
+  mxiwk0 = 500000;    // Initial workspace
+  mxwk   = 21*n + 8*m + mlp + lh1 + kmax*(kmax+9)/2 + mxwk0;
+  mxiwk  = 13*n + 4*m + mlp + lh1 + kmax + 113 + mxiwk0;
+  //std::cout << "mxwk2 = " << mxwk << std::endl;
+
+  if (!x || n > nCap_) {
+    nCap_ = growCap_(nCap_, n);
+    realloc_(x, nCap_, 0);     // primal solution.
+    realloc_(g, nCap_, 0);     // gradient vector of f(x)
+  }
+  if (!r || nm > nmCap_) {
+    nmCap_ = growCap_(nmCap_, nm);
+    realloc_(r, nmCap_, 0);    // residuals/multipliers
+    realloc_(e, nmCap_, 0);    // steepest-edge normalization coefficients 
+    realloc_(w, nmCap_, 0);    // denominators for ratio tests
+    realloc_(ls, nmCap_, 0);   // indices of the active constraints 
+    realloc_(bl, nmCap_, 0);   // lower bounds for variables and constraints
+    realloc_(bu, nmCap_, 0);   // upper bounds for variables and constraints
+  }
+
+  // allocate storage for Hessian etc.
+  if (!ws || mxwk > wsCap_) {
+    wsCap_ = growCap_(wsCap_, mxwk);
+    realloc_(ws, wsCap_, 0);   // workspace
+  }
+  if (!lws || mxiwk > lwsCap_) {
+    lwsCap_ = growCap_(lwsCap_, mxiwk);
+    realloc_(lws, lwsCap_, 0); // workspace
+  }
 
   // storage for gradient and jacobian
-  a     = new real[maxa+1];    // linear part of objective & Jacobian
-  la    = new fint[maxa+m+3];
+  if (!a || maxa+1 > aCap_) {
+    aCap_ = growCap_(aCap_, maxa+1);
+    realloc_(a, aCap_, old_a);     // linear part of objective & Jacobian
+  }
+  if (!la || maxa+m+3 > laCap_) {
+    laCap_ = growCap_(laCap_, maxa+m+3);
+    realloc_(la, laCap_, old_la);
+  }
 
   if (true==zero) {
     memset(info, 0, 100 * sizeof(int));
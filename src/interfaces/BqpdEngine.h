@@ -157,6 +157,19 @@ namespace Minotaur {
     /// If a constraint is modified, this is set to true. 
     bool consModed_;
 
+    /**
+     * Number of constraints whose linear terms are in fStart_->a and
+     * fStart_->la. Constraints appended later are added without filling
+     * the others again. If 0, the gradients are filled from scratch.
+     */
+    UInt jacCons_;
+
+    /// Number of nonzeros in the first jacCons_ rows of the Jacobian.
+    UInt jacNz_;
+
+    /// Number of variables when gradients were filled.
+    UInt jacVars_;
+
     /// Array to calculate dual solution for constraints.
     double *dualCons_;
 
@@ -260,6 +273,16 @@ namespace Minotaur {
     /// Only copy. No space allocation.
     void copyFrom(const BqpdData* rhs);
 
+    /**
+     * \brief Change the sizes. Arrays are reallocated only if they are too
+     * small, and then grown geometrically. Entries of a and la are kept,
+     * others are not.
+     *
+     * \param [in] zero If true, zero out info and the workspaces ws and lws.
+     */
+    void resize(UInt n_t, UInt m_t, int kmax_t, UInt maxa_t, UInt lh1_t,
+                UInt nJac_t, bool zero=true);
+
     /// Display all data.
     void write(std::ostream &out) const;
 
@@ -331,6 +354,25 @@ namespace Minotaur {
 
     // Dimension of reduced-space, set only when mode>=0.
     int k;
+
+  private:
+    /// Number of entries allocated in a.
+    UInt aCap_;
+
+    /// Number of entries allocated in la.
+    UInt laCap_;
+
+    /// Number of entries allocated in lws.
+    UInt lwsCap_;
+
+    /// Number of entries allocated in x and g.
+    UInt nCap_;
+
+    /// Number of entries allocated in r, e, w, ls, bl and bu.
+    UInt nmCap_;
+
+    /// Number of entries allocated in ws.
+    UInt wsCap_;
   };
 
   
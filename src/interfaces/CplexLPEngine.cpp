@@ -296,7 +296,7 @@ void CplexLPEngine::fillStats(std::vector<double> &lpStats)
     lpStats[1] += stats_->strCalls;
     lpStats[2] += stats_->time;
     lpStats[3] += stats_->strTime;
-    lpStats[4] += stats_->iters;
+    lpStats[itersStat] += stats_->iters;
     lpStats[5] += stats_->strIters;
   }
 }
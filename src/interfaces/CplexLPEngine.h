@@ -167,6 +167,12 @@ namespace Minotaur {
     // Implement Engine::fillStats()
     void fillStats(std::vector<double> &);
 
+    /// Length of the vector filled by fillStats().
+    static const UInt numStats = 6;
+
+    /// Position of the number of iterations in the vector of fillStats().
+    static const UInt itersStat = 4;
+
     /// Return the solution value of the objective after solving the LP.
     double getSolutionValue();
 
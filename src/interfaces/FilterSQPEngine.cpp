@@ -13,6 +13,7 @@
  * capability.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <iomanip>
@@ -22,6 +23,7 @@
 #include "Environment.h"
 #include "FilterSQPEngine.h"
 #include "FilterSQPEngineTypes.h"
+#include "Function.h"
 #include "HessianOfLag.h"
 #include "Jacobian.h"
 #include "Logger.h"
@@ -38,6 +40,26 @@ using namespace Minotaur;
 
 const std::string FilterSQPEngine::me_ = "FilterSQPEngine: ";
 
+// Return a capacity of at least size. Capacities grow by half, so that a
+// sequence of small increases causes few reallocations.
+static UInt growCap_(UInt cap, UInt size)
+{
+  return (size > cap + cap/2) ? size : cap + cap/2;
+}
+
+
+// Reallocate arr with cap entries, keeping its first keep entries.
+template <class T> static void realloc_(T *&arr, UInt cap, UInt keep)
+{
+  T *narr = new T[cap];
+  if (arr && keep > 0) {
+    std::copy(arr, arr+keep, narr);
+  }
+  delete [] arr;
+  arr = narr;
+}
+
+
 int * convertPtrToInt(uintptr_t u)
 {
   const int MAX_SIZE_PER_INT=4;
@@ -194,6 +216,7 @@ void FilterSQPWarmStart::write(std::ostream &out) const
 
 FilterSQPEngine::FilterSQPEngine(EnvPtr env)
 : a_(0),
+  aCap_(0),
   bl_(0),
   bTol_(1e-9),
   bu_(0),
@@ -202,20 +225,30 @@ FilterSQPEngine::FilterSQPEngine(EnvPtr env)
   cstype_(0),
   env_(env),
   feasTol_(1e-6),
+  hessChanged_(true),
   istat_(0),
+  jacCons_(0),
+  jacVars_(0),
+  jacNz_(0),
   la_(0),
+  laCap_(0),
   lam_(0),
   lws_(0),
+  lwsCap_(0),
   lws2_(0),
+  mCap_(0),
   maxIterLimit_(1000),
   mlam_(0),
   rstat_(0),
   s_(0),
   saveSol_(true),
   sol_(SolutionPtr()),
+  nCap_(0),
+  nmCap_(0),
   strBr_(false),
   warmSt_(0),
   ws_(0),
+  wsCap_(0),
   x_(0)
 {
   problem_ = ProblemPtr(); // NULL
@@ -244,10 +277,7 @@ FilterSQPEngine::FilterSQPEngine(EnvPtr env)
 
 FilterSQPEngine::~FilterSQPEngine()
 {
-  if (c_) {
-    freeStorage_();
-    c_ = 0;
-  }
+  freeStorage_();
   if (timer_) {
     delete timer_;
   }
@@ -267,8 +297,14 @@ FilterSQPEngine::~FilterSQPEngine()
 }
 
 
-void FilterSQPEngine::addConstraint(ConstraintPtr)
+void FilterSQPEngine::addConstraint(ConstraintPtr c)
 {
+  // the new row is appended to the Jacobian. Linear constraints do not
+  // change the Hessian of the Lagrangian.
+  FunctionType ftype = c->getFunctionType();
+  if (ftype!=Linear && ftype!=Constant) {
+    hessChanged_ = true;
+  }
   consChanged_ = true;
 }
 
@@ -313,27 +349,28 @@ void FilterSQPEngine::changeConstraint(ConstraintPtr, LinearFunctionPtr,
   // no need to do anything because the 'solve' function reloads constraints
   // from problem.
   consChanged_ = true;
+  jacCons_ = 0;
 }
 
 
 void FilterSQPEngine::changeConstraint(ConstraintPtr, NonlinearFunctionPtr)
 {
   consChanged_ = true;
+  hessChanged_ = true;
+  jacCons_ = 0;
 }
 
 
 void FilterSQPEngine::changeObj(FunctionPtr, double)
 {
   consChanged_ = true;
+  hessChanged_ = true;
 }
 
 
 void FilterSQPEngine::clear() 
 {
-  if (c_) {
-    freeStorage_();
-    c_ = 0;
-  }
+  freeStorage_();
   if (problem_) {
     problem_->unsetEngine();
     problem_ = 0;
@@ -536,6 +573,12 @@ void FilterSQPEngine::freeStorage_()
   delete [] cstype_;
   delete [] lws_;
   delete [] la_;
+  c_ = ws_ = s_ = x_ = lam_ = mlam_ = a_ = rstat_ = bl_ = bu_ = 0;
+  lws2_ = istat_ = lws_ = la_ = 0;
+  cstype_ = 0;
+  aCap_ = laCap_ = lwsCap_ = mCap_ = nCap_ = nmCap_ = wsCap_ = 0;
+  jacCons_ = 0;
+  hessChanged_ = true;
 }
 
 
@@ -620,6 +663,8 @@ void FilterSQPEngine::negateObj()
 void FilterSQPEngine::removeCons(std::vector<ConstraintPtr> &)
 {
   consChanged_ = true;
+  hessChanged_ = true;
+  jacCons_ = 0;
 }
 
 
@@ -673,59 +718,70 @@ void FilterSQPEngine::setStorage_(int mxwk, int maxa)
   UInt cnt;
   FunctionType ftype;
 
-  if (consChanged_) {
-    if (sol_) {
-      delete sol_;
-    }
-    sol_ = (SolutionPtr) new Solution(1E20, 0, problem_);
-    if (prepareWs_) {
-      if (warmSt_) {
-        delete warmSt_;
-      }
-      warmSt_ = (FilterWSPtr) new FilterSQPWarmStart();
-      warmSt_->setPoint(sol_);
-    }
-    if (c_) {
-      freeStorage_();
-      c_ = 0;
-    }
-  }
-  if (!c_) {
-    c_     = new real[m];     // values of the constraint functions.
-    ws_    = new real[mxwk];  // workspace.
-    lws2_  = new fint[mxwk];  // workspace.
-    s_     = new real[n+m];   // scale.
-    x_     = new real[n];     // primal solution.
-    lam_   = new real[n+m];   // lagrange mults.
-    mlam_  = new real[m];   // lagrange mults.
-    a_     = new real[maxa];
-    rstat_ = new real[7];     // statistics.
-    istat_ = new fint[14];    // statistics.
-    bl_    = new real[n+m]; // lower bounds for variables and constraints.
-    bu_    = new real[n+m]; // upper bounds for variables and constraints.
-    cstype_= new char[m];   // is constraint ('L')linear or ('N')nonlinear
-    lws_   = new fint[n+problem_->getHessian()->getNumNz()+3];
-    la_    = new int[n + problem_->getJacobian()->getNumNz() + m + 3];
-    std::fill(c_, c_+m, 0.);
-    std::fill(ws_, ws_+mxwk, 0.);
-    std::fill(lws2_, lws2_+mxwk, 0);
-    std::fill(lam_, lam_+n+m, 0.);
-    std::fill(a_, a_+maxa, 0.);
+  if (!consChanged_) {
+    return;
   }
 
-  if (consChanged_) {
-    for (UInt i=0; i<n+m; ++i) {
-      s_[i] = 1.;
+  if (sol_) {
+    delete sol_;
+  }
+  sol_ = (SolutionPtr) new Solution(1E20, 0, problem_);
+  if (prepareWs_) {
+    if (warmSt_) {
+      delete warmSt_;
     }
-    cnt = 0;
-    for (ConstraintConstIterator cIter=problem_->consBegin(); 
-         cIter!=problem_->consEnd(); ++cIter, ++cnt) {
-      ftype = (*cIter)->getFunctionType();
-      if (ftype==Linear || ftype==Constant) {
-        cstype_[cnt] = 'L';     // mark constraints linear
-      } else {
-        cstype_[cnt] = 'N';     // mark constraints nonlinear
-      }
+    warmSt_ = (FilterWSPtr) new FilterSQPWarmStart();
+    warmSt_->setPoint(sol_);
+  }
+
+  // arrays are reallocated only if they are too small.
+  if (!c_ || m > mCap_) {
+    mCap_ = growCap_(mCap_, m);
+    realloc_(c_, mCap_, 0);      // values of the constraint functions.
+    realloc_(mlam_, mCap_, 0);   // lagrange mults.
+    realloc_(cstype_, mCap_, 0); // is constraint ('L')linear or ('N')nonlinear
+  }
+  if (!x_ || n > nCap_) {
+    nCap_ = growCap_(nCap_, n);
+    realloc_(x_, nCap_, 0);      // primal solution.
+  }
+  if (!s_ || n+m > nmCap_) {
+    nmCap_ = growCap_(nmCap_, n+m);
+    realloc_(s_, nmCap_, 0);     // scale.
+    realloc_(lam_, nmCap_, 0);   // lagrange mults.
+    realloc_(bl_, nmCap_, 0);    // lower bounds for variables and constraints.
+    realloc_(bu_, nmCap_, 0);    // upper bounds for variables and constraints.
+  }
+  if (!ws_ || (UInt) mxwk > wsCap_) {
+    wsCap_ = growCap_(wsCap_, mxwk);
+    realloc_(ws_, wsCap_, 0);    // workspace.
+    realloc_(lws2_, wsCap_, 0);  // workspace.
+  }
+  if (!a_ || (UInt) maxa > aCap_) {
+    aCap_ = growCap_(aCap_, maxa);
+    realloc_(a_, aCap_, 0);
+  }
+  if (!rstat_) {
+    rstat_ = new real[7];        // statistics.
+    istat_ = new fint[14];       // statistics.
+  }
+  std::fill(c_, c_+m, 0.);
+  std::fill(ws_, ws_+mxwk, 0.);
+  std::fill(lws2_, lws2_+mxwk, 0);
+  std::fill(lam_, lam_+n+m, 0.);
+  std::fill(a_, a_+maxa, 0.);
+
+  for (UInt i=0; i<n+m; ++i) {
+    s_[i] = 1.;
+  }
+  cnt = 0;
+  for (ConstraintConstIterator cIter=problem_->consBegin(); 
+       cIter!=problem_->consEnd(); ++cIter, ++cnt) {
+    ftype = (*cIter)->getFunctionType();
+    if (ftype==Linear || ftype==Constant) {
+      cstype_[cnt] = 'L';     // mark constraints linear
+    } else {
+      cstype_[cnt] = 'N';     // mark constraints nonlinear
     }
   }
 }
@@ -734,76 +790,86 @@ void FilterSQPEngine::setStorage_(int mxwk, int maxa)
 void FilterSQPEngine::setStructure_()
 {
   UInt n        = 0,           // number of variables in problem.
+       m        = 0,           // number of constraints in problem.
        jac_nnzs = 0,           // number of enteries in Jacobian.
-       cons_pos = 0;           // The position where non-zeros of current 
+       cons_pos = 0,           // The position where non-zeros of current 
                                // constraint start getting filled up.
+       fill_pos = 0;
   UInt *iRow, *jCol;
+  FunctionPtr f;
+  ConstraintConstIterator c_iter;
 
   n = problem_->getNumVars();
+  m = problem_->getNumCons();
   jac_nnzs = problem_->getJacobian()->getNumNz();
+  if (jacVars_ != n || jacCons_ > m) {
+    jacCons_ = 0;
+    hessChanged_ = true;
+  }
+  if (0 == jacCons_) {
+    jacNz_ = 0;
+  }
 
   // la[0] = no. of spaces in 'a' that are reserved for jacobian values.
   //         If not warm-starting, this is n + (nonzeros in Jac) + 1. The
   //         first 'n' is for gradient of objective. Next (nonzeros in Jac)
   //         store the Jacobian of constraints. The last space ...
   //        
-  cons_pos = n + jac_nnzs + 1; // position where we start filling pointers.
-  la_[0] = cons_pos;
-
-  // values in la_ need to filled only once.
-  for(UInt j = 1; j <= n; ++j) {
-    la_[j] = j; // objective gradient is assumed dense
-  }
-  la_[cons_pos] = 1; // where the obj gradient entries begin in la_.
-  ++cons_pos;
-  // now, la_[0,1, ..., n] are set
-
   // Column 'i' of 'A' matrix denotes the gradient of i-th constraint. These
   // have to be stored in sparse format: values in 'a' and variable-index in 
-  // 'la'.
-  iRow = new UInt[jac_nnzs];
-  jCol = new UInt[jac_nnzs];
-  problem_->getJacobian()->fillRowColIndices(iRow, jCol);
-  // for (UInt i=0; i<jac_nnzs; ++i) {
-  //   std::cout << "irow[" << i << "] = " << iRow[i] << " jcol[" << i << "] = " 
-  //     << jCol[i] << std::endl;
-  // }
-
-  // check if iRow is non-decreasing. Complain otherwise and stop.
-#if MDBUG
-  if (jac_nnzs>0) {
-    for (UInt i=0; i<jac_nnzs-1; ++i) {
-      assert(iRow[i] <= iRow[i+1]);
+  // 'la'. Rows already in la_ are kept.
+  if (!la_ || n+jac_nnzs+m+3 > laCap_) {
+    laCap_ = growCap_(laCap_, n+jac_nnzs+m+3);
+    realloc_(la_, laCap_, (jacCons_>0) ? 1+n+jacNz_ : 0);
+  }
+  if (0 == jacCons_) {
+    for(UInt j = 1; j <= n; ++j) {
+      la_[j] = j; // objective gradient is assumed dense
     }
   }
-#endif
 
-  // fill up la_
-  // assumption: all rows are non-empty. If there is a row that does not have
-  // any variables, this setup will fail.
-  UInt fill_pos = 1+n;
-  UInt old_cons = -1;
-  for (UInt i=0; i<jac_nnzs; ++i) {
-    la_[fill_pos] = jCol[i] + 1; // fortran expects off by 1?
-    if (old_cons == iRow[i]) {
-    } else {
-       old_cons = iRow[i];
-       la_[cons_pos] = fill_pos;
-       ++cons_pos;
+  // column indices of new rows, in the same order as the values are filled
+  // by Jacobian::fillRowColValues().
+  fill_pos = 1+n+jacNz_;
+  for (c_iter=problem_->consBegin()+jacCons_; c_iter!=problem_->consEnd();
+       ++c_iter) {
+    f = (*c_iter)->getFunction();
+    for (VarSetConstIter it=f->varsBegin(); it!=f->varsEnd(); ++it) {
+      la_[fill_pos] = (*it)->getIndex() + 1; // fortran expects off by 1
+      ++fill_pos;
     }
-    ++fill_pos;
   }
-  la_[cons_pos] = fill_pos;
   assert(fill_pos==1+n+jac_nnzs);
-  delete [] iRow;
-  delete [] jCol;
+
+  // pointers to the start of each row, after the column indices.
+  cons_pos = n + jac_nnzs + 1; // position where we start filling pointers.
+  la_[0] = cons_pos;
+  la_[cons_pos] = 1; // where the obj gradient entries begin in la_.
+  ++cons_pos;
+  fill_pos = 1+n;
+  for (c_iter=problem_->consBegin(); c_iter!=problem_->consEnd(); ++c_iter) {
+    la_[cons_pos] = fill_pos;
+    ++cons_pos;
+    fill_pos += (*c_iter)->getFunction()->getNumVars();
+  }
+  la_[cons_pos] = fill_pos;
+  jacCons_ = m;
+  jacVars_ = n;
+  jacNz_ = jac_nnzs;
   // la_ is all done.
-  
+
+  if (!hessChanged_) {
+    return;
+  }
 
   // fill up lws_
   // phl = 0;
   UInt hess_nnzs = 0;
   hess_nnzs = problem_->getHessian()->getNumNz();
+  if (!lws_ || n+hess_nnzs+3 > lwsCap_) {
+    lwsCap_ = growCap_(lwsCap_, n+hess_nnzs+3);
+    realloc_(lws_, lwsCap_, 0);
+  }
   lws_[0] = 1+hess_nnzs;
   //std::cout << "\nhess_nnz = " << hess_nnzs << std::endl;
   iRow = new UInt[hess_nnzs];
@@ -816,12 +882,8 @@ void FilterSQPEngine::setStructure_()
   problem_->getHessian()->fillRowColIndices(jCol, iRow) ;
 
   for (UInt i=0; i<hess_nnzs; ++i) {
-    //std::cout << "irow[" << i << "] = " << iRow[i] << " jcol[" << i << "] = " 
-    //  << jCol[i] << " " << problem_->getVariable(iRow[i])->getName() << " " << 
-    //  problem_->getVariable(jCol[i])->getName() << std::endl;
     ++iRow[i];
     ++jCol[i];
-    //std::cout << iRow[i] << ", " << jCol[i] << std::endl;
   }
 #if MDBUG
   if (hess_nnzs>0) {
@@ -831,10 +893,6 @@ void FilterSQPEngine::setStructure_()
   }
 #endif
 
-  //std::copy(iRow, iRow + hess_nnzs, lws_+1);
-  //std::copy(jCol, jCol + hess_nnzs, lws_+1+hess_nnzs);
-
-
   UInt curr_col = 1;
   fill_pos = 1;
   lws_[hess_nnzs+curr_col] = fill_pos;
@@ -853,16 +911,9 @@ void FilterSQPEngine::setStructure_()
   ++curr_col;
   lws_[hess_nnzs+curr_col] = fill_pos;
 
-  //for (UInt i=0; i<3+hess_nnzs+n; ++i) {
-    //std::cout << "lws_[" << i << "] = " << lws_[i] << std::endl;
-  //}
-
   delete [] iRow;
   delete [] jCol;
-
-  //std::cout << "n = " << n << std::endl;
-  //std::cout << "m = " << m << std::endl;
-  //std::cout << "non-zeros in Jacobian = " << jac_nnzs << std::endl;
+  hessChanged_ = false;
 }
 
 
@@ -905,7 +956,9 @@ EngineStatus FilterSQPEngine::solve()
   const double *initial_point = 0;
 
   setStorage_(mxwk, maxa);
-  setStructure_();
+  if (consChanged_) {
+    setStructure_();
+  }
 
   if (useWs_ && warmSt_ && warmSt_->hasInfo()) {
     // load warm start.
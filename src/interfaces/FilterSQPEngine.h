@@ -194,6 +194,9 @@ namespace Minotaur {
     /// Jacobian storage.
     double *a_;
 
+    /// Number of entries allocated in a_.
+    UInt aCap_;
+
     /// Lower bounds.
     double *bl_;
 
@@ -221,18 +224,38 @@ namespace Minotaur {
     /// if rstat_[4]<feasTol_, then the solution is considered feasible.
     const double feasTol_;
 
+    /// True if the sparsity pattern of the Hessian in lws_ must be filled
+    /// again.
+    bool hessChanged_;
+
     /// Statistics.
     int *istat_;
 
     /// Number of iterations that can be performed during solve
     int iterLimit_; 
 
+    /**
+     * Number of constraints whose rows of the Jacobian are in la_. Rows of
+     * constraints appended later are added to la_ without filling the
+     * others again. If 0, all of la_ is filled in the next solve.
+     */
+    UInt jacCons_;
+
+    /// Number of variables when la_ and lws_ were filled.
+    UInt jacVars_;
+
+    /// Number of nonzeros in the first jacCons_ rows of the Jacobian.
+    UInt jacNz_;
+
     /**
      * la_ stores the sparsity pattern of jacobian. It needs to be
      * evaluated only once.
      */
     int *la_;
 
+    /// Number of entries allocated in la_.
+    UInt laCap_;
+
     /// Lagrange multipliers.
     double *lam_;
 
@@ -254,9 +277,15 @@ namespace Minotaur {
      */
     int *lws_;
 
+    /// Number of entries allocated in lws_.
+    UInt lwsCap_;
+
     /// Copy of lws_;
     int *lws2_;
 
+    /// Number of entries allocated in c_, mlam_ and cstype_.
+    UInt mCap_;
+
     /// Max value of iterLimit_, when solving a relaxation
     const int maxIterLimit_;
 
@@ -295,6 +324,12 @@ namespace Minotaur {
     /// Statistics.
     FilterSQPStats *stats_;
 
+    /// Number of entries allocated in x_.
+    UInt nCap_;
+
+    /// Number of entries allocated in s_, lam_, bl_ and bu_.
+    UInt nmCap_;
+
     /// If true, we are currently in strong-branching mode. False otherwise.
     bool strBr_;
 
@@ -312,6 +347,9 @@ namespace Minotaur {
 
     double *ws_;
 
+    /// Number of entries allocated in ws_ and lws2_.
+    UInt wsCap_;
+
     /// Solution.
     double *x_;
 
@@ -321,10 +359,19 @@ namespace Minotaur {
     /// Copy bounds from problem into filter-sqp's arrays.
     void setBounds_();
 
-    /// Allocate storage space for filter-sqp.
+    /**
+     * Allocate storage space for filter-sqp. Arrays are reused if they are
+     * large enough, and grown geometrically otherwise.
+     */
     void setStorage_(int mxwk, int maxa);
 
-    /// Allocate space and fill sparsity pattern of the Jacobian and Hessian.
+    /**
+     * Fill sparsity pattern of the Jacobian and Hessian. Only rows of
+     * constraints appended since the last call are added to the Jacobian,
+     * and the Hessian is filled only if it may have changed. Called only
+     * when constraints have changed: bound changes do not alter the
+     * structure.
+     */
     void setStructure_();
 
   };
@@ -790,7 +790,7 @@ void IpoptEngine::fillStats(std::vector<double>& nlpStats)
     nlpStats[4] += stats_->time;
     nlpStats[5] += stats_->ptime;
     nlpStats[6] += stats_->strTime;
-    nlpStats[7] += stats_->iters;
+    nlpStats[itersStat] += stats_->iters;
     nlpStats[8] += stats_->strIters;
   }
 }
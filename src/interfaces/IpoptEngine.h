@@ -198,6 +198,12 @@ namespace Minotaur {
     // Implement Engine::fillStats()
     void fillStats(std::vector<double> &);
 
+    /// Length of the vector filled by fillStats().
+    static const UInt numStats = 9;
+
+    /// Position of the number of iterations in the vector of fillStats().
+    static const UInt itersStat = 7;
+
     // get name.
     std::string getName() const;
 
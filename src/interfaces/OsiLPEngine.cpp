@@ -10,9 +10,11 @@
  * \author Ashutosh Mahajan, Argonne National Laboratory
  */
 
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <unordered_map>
 
 #if MNTROSICLP
 #include "coin/OsiClpSolverInterface.hpp"
@@ -23,6 +25,7 @@
 #endif
 #include "coin/CoinPackedMatrix.hpp"
 #include "coin/CoinWarmStart.hpp"
+#include "coin/CoinWarmStartBasis.hpp"
 #include "coin/CoinWarmStartDual.hpp"
 
 #undef F77_FUNC_
@@ -80,6 +83,11 @@ CoinWarmStart *OsiLPWarmStart::getCoinWarmStart() const
   return coinWs_;
 }
 
+const std::vector<UInt> &OsiLPWarmStart::getRowIds() const
+{
+  return rowIds_;
+}
+
 void OsiLPWarmStart::setCoinWarmStart(CoinWarmStart *coin_ws,
                                       bool must_delete)
 {
@@ -98,6 +106,11 @@ void OsiLPWarmStart::setDualWarmStart(int size, const double *dual)
   setCoinWarmStart(coin_ws, true);
 }
 
+void OsiLPWarmStart::setRowIds(const std::vector<UInt> &ids)
+{
+  rowIds_ = ids;
+}
+
 void OsiLPWarmStart::write(std::ostream &) const
 {
   assert(!"implement me!");
@@ -110,12 +123,16 @@ OsiLPEngine::OsiLPEngine(EnvPtr env)
   : bndChanged_(true),
     consChanged_(true),
     env_(env),
+    maxAge_(0),
     maxIterLimit_(10000),
     objChanged_(true),
     pickLPMeth_(true),
+    numLoaded_(0),
+    numAged_(0),
     problem_(0),
     sol_(0),
-    strBr_(false)
+    strBr_(false),
+    updDepth_(0)
 {
 #if USE_OSILP
 #else
@@ -125,6 +142,7 @@ OsiLPEngine::OsiLPEngine(EnvPtr env)
 
   logger_ = env_->getLogger();
   pickLPMeth_ = env_->getOptions()->findBool("set_lp_method")->getValue();
+  maxAge_ = std::max(0, env_->getOptions()->findInt("lp_row_age")->getValue());
   eName_ = OsiUndefEngine;
   if (etype == "OsiClp") {
     eName_ = OsiClpEngine;
@@ -140,6 +158,13 @@ OsiLPEngine::OsiLPEngine(EnvPtr env)
   stats_->strTime = 0;
   stats_->iters = 0;
   stats_->strIters = 0;
+  stats_->flushes = 0;
+  stats_->rowsAdded = 0;
+  stats_->rowsDel = 0;
+  stats_->rowsAged = 0;
+  stats_->rowsRev = 0;
+  stats_->reSolves = 0;
+  stats_->reIters = 0;
 
   timer_ = env->getNewTimer();
 
@@ -169,32 +194,61 @@ OsiLPEngine::~OsiLPEngine()
 
 void OsiLPEngine::addConstraint(ConstraintPtr con)
 {
-  LinearFunctionPtr lf = con->getLinearFunction();
-  int nz = static_cast<int>(lf->getNumTerms());
-  int *cols = new int[nz];
-  double *elems = new double[nz];
-  VariableGroupConstIterator it;
-  int i = 0;
+  // the row is built from the constraint when it is flushed, so later
+  // changes to the constraint are picked up as well.
+  assert(con->getIndex() == rowOf_.size());
+  rowOf_.push_back(-1);
+  pending_.push_back(con->getIndex());
+  consChanged_ = true;
+}
+
+void OsiLPEngine::ageRows_()
+{
+  std::vector<int> rows;
 
-  for (it = lf->termsBegin(); it != lf->termsEnd(); ++it, ++i) {
-    cols[i] = it->first->getIndex();
-    elems[i] = it->second;
+  for (UInt r = 0; r < age_.size(); ++r) {
+    if (age_[r] >= maxAge_) {
+      rows.push_back(r);
+      rowOf_[conOf_[r]] = -2;
+    }
   }
+  if (false == rows.empty()) {
+    deleteRows_(rows);
+    numAged_ += rows.size();
+    stats_->rowsAged += rows.size();
+  }
+}
 
-  osilp_->addRow(nz, cols, elems, con->getLb(), con->getUb());
-  // assert(!"implement me!");
-  delete[] cols;
-  delete[] elems;
-  consChanged_ = true;
+void OsiLPEngine::applyUpdate_()
+{
+  if (false == updCols_.empty()) {
+    osilp_->setColSetBounds(&updCols_[0], &updCols_[0] + updCols_.size(),
+                            &updBnds_[0]);
+    for (UInt i = 0; i < updCols_.size(); ++i) {
+      updPos_[updCols_[i]] = -1;
+    }
+    updCols_.clear();
+    updBnds_.clear();
+  }
+}
+
+void OsiLPEngine::beginUpdate()
+{
+  ++updDepth_;
 }
 
 void OsiLPEngine::changeBound(ConstraintPtr cons, BoundType lu,
                               double new_val)
 {
-  if (Upper == lu) {
-    osilp_->setRowUpper(cons->getIndex(), new_val);
-  } else {
-    osilp_->setRowLower(cons->getIndex(), new_val);
+  int row = rowOf_[cons->getIndex()];
+
+  // pending and aged rows take their bounds from the constraint.
+  if (row >= 0) {
+    if (Upper == lu) {
+      osilp_->setRowUpper(row, new_val);
+    } else {
+      osilp_->setRowLower(row, new_val);
+    }
   }
   bndChanged_ = true;
 }
@@ -204,6 +258,15 @@ void OsiLPEngine::changeBound(VariablePtr var, BoundType lu, double new_val)
   // XXX: need a better map than the following for mapping variables to
   // indices and vice versa
   int col = var->getIndex();
+  if (updDepth_ > 0) {
+    if (Lower == lu) {
+      saveBounds_(col, new_val, var->getUb());
+    } else {
+      saveBounds_(col, var->getLb(), new_val);
+    }
+    bndChanged_ = true;
+    return;
+  }
   switch (lu) {
   case Lower:
     osilp_->setColLower(col, new_val);
@@ -220,7 +283,11 @@ void OsiLPEngine::changeBound(VariablePtr var, BoundType lu, double new_val)
 void OsiLPEngine::changeBound(VariablePtr var, double new_lb, double new_ub)
 {
   int col = var->getIndex();
-  osilp_->setColBounds(col, new_lb, new_ub);
+  if (updDepth_ > 0) {
+    saveBounds_(col, new_lb, new_ub);
+  } else {
+    osilp_->setColBounds(col, new_lb, new_ub);
+  }
   bndChanged_ = true;
 }
 
@@ -241,9 +308,15 @@ void OsiLPEngine::changeConstraint(ConstraintPtr, LinearFunctionPtr, double,
     OsiClpSolverInterface *osiclp =
         (OsiClpSolverInterface *)(dynamic_cast<OsiClpSolverInterface *>(
             osilp_));
-    int row = c->getIndex();
+    int row = rowOf_[c->getIndex()];
     ConstLinearFunctionPtr clf = c->getFunction()->getLinearFunction();
 
+    // pending and aged rows are built from the changed constraint later.
+    if (row < 0) {
+      consChanged_ = true;
+      return;
+    }
+
     // first zero out all the existing coefficients in the row.
     for (VariableGroupConstIterator it = clf->termsBegin();
          it != clf->termsEnd(); ++it) {
@@ -287,6 +360,15 @@ void OsiLPEngine::changeObj(FunctionPtr f, double)
 
 void OsiLPEngine::clear()
 {
+  age_.clear();
+  conOf_.clear();
+  pending_.clear();
+  rowOf_.clear();
+  numAged_ = 0;
+  numLoaded_ = 0;
+  updCols_.clear();
+  updBnds_.clear();
+  updPos_.clear();
   if (osilp_) {
     osilp_->reset();
     osilp_->setHintParam(OsiDoReducePrint);
@@ -299,10 +381,45 @@ void OsiLPEngine::clear()
   }
 }
 
+void OsiLPEngine::commitUpdate()
+{
+  assert(updDepth_ > 0);
+  if (updDepth_ > 0) {
+    --updDepth_;
+  }
+  if (0 == updDepth_) {
+    applyUpdate_();
+  }
+}
+
 // void OsiLPEngine::disableFactorization() {
 //  osilp_->disableFactorization();
 //}
 
+void OsiLPEngine::deleteRows_(std::vector<int> &rows)
+{
+  UInt k = 0;
+  UInt j = 0;
+
+  std::sort(rows.begin(), rows.end());
+  osilp_->deleteRows(static_cast<int>(rows.size()), &rows[0]);
+
+  // the solver keeps the remaining rows in the same order.
+  for (UInt r = 0; r < conOf_.size(); ++r) {
+    if (j < rows.size() && rows[j] == static_cast<int>(r)) {
+      ++j;
+      continue;
+    }
+    conOf_[k] = conOf_[r];
+    age_[k] = age_[r];
+    rowOf_[conOf_[k]] = k;
+    ++k;
+  }
+  conOf_.resize(k);
+  age_.resize(k);
+  consChanged_ = true;
+}
+
 void OsiLPEngine::disableStrBrSetup()
 {
 #if SPEW
@@ -338,7 +455,7 @@ void OsiLPEngine::fillStats(std::vector<double> &lpStats)
     lpStats[1] += stats_->strCalls;
     lpStats[2] += stats_->time;
     lpStats[3] += stats_->strTime;
-    lpStats[4] += stats_->iters;
+    lpStats[itersStat] += stats_->iters;
     lpStats[5] += stats_->strIters;
   }
 }
@@ -353,6 +470,52 @@ void OsiLPEngine::enableFactorization()
   osilp_->enableFactorization();
 }
 
+void OsiLPEngine::flushRows_()
+{
+  std::vector<CoinBigIndex> starts;
+  std::vector<int> cols;
+  std::vector<double> elems;
+  std::vector<double> lbs;
+  std::vector<double> ubs;
+  int nrows;
+  ConstraintPtr c;
+  LinearFunctionPtr lf;
+  VariableGroupConstIterator it;
+
+  if (pending_.empty()) {
+    return;
+  }
+  applyUpdate_();
+  nrows = osilp_->getNumRows();
+  starts.reserve(pending_.size() + 1);
+  lbs.reserve(pending_.size());
+  ubs.reserve(pending_.size());
+  starts.push_back(0);
+  for (UInt i = 0; i < pending_.size(); ++i) {
+    c = problem_->getConstraint(pending_[i]);
+    lf = c->getLinearFunction();
+    if (lf) {
+      for (it = lf->termsBegin(); it != lf->termsEnd(); ++it) {
+        cols.push_back(it->first->getIndex());
+        elems.push_back(it->second);
+      }
+    }
+    starts.push_back(static_cast<CoinBigIndex>(cols.size()));
+    lbs.push_back(c->getLb());
+    ubs.push_back(c->getUb());
+    rowOf_[pending_[i]] = nrows + i;
+    conOf_.push_back(pending_[i]);
+    age_.push_back(0);
+  }
+  osilp_->addRows(static_cast<int>(pending_.size()), &starts[0],
+                  cols.empty() ? 0 : &cols[0],
+                  elems.empty() ? 0 : &elems[0], &lbs[0], &ubs[0]);
+  ++(stats_->flushes);
+  stats_->rowsAdded += pending_.size();
+  pending_.clear();
+  consChanged_ = true;
+}
+
 void OsiLPEngine::getBasics(int *index)
 {
   osilp_->getBasics(index);
@@ -363,6 +526,39 @@ void OsiLPEngine::getBInvARow(int row, double *z, double *slack)
   osilp_->getBInvARow(row, z, slack);
 }
 
+void OsiLPEngine::getBInvARows(const std::vector<int> &rows, double tol,
+                               std::vector<TableauRow> &tab)
+{
+  int ncol = osilp_->getNumCols();
+  int nrow = osilp_->getNumRows();
+  std::vector<double> z(ncol);
+  std::vector<double> slack(nrow);
+
+  // Osi gives dense rows only. The work arrays are shared by all rows and
+  // only nonzeros are kept, so callers can work on the sparse rows.
+  tab.resize(rows.size());
+  for (UInt i = 0; i < rows.size(); ++i) {
+    TableauRow &r = tab[i];
+    osilp_->getBInvARow(rows[i], z.data(), slack.data());
+    r.ind.clear();
+    r.val.clear();
+    r.slackInd.clear();
+    r.slackVal.clear();
+    for (int j = 0; j < ncol; ++j) {
+      if (fabs(z[j]) > tol) {
+        r.ind.push_back(j);
+        r.val.push_back(z[j]);
+      }
+    }
+    for (int j = 0; j < nrow; ++j) {
+      if (fabs(slack[j]) > tol) {
+        r.slackInd.push_back(j);
+        r.slackVal.push_back(slack[j]);
+      }
+    }
+  }
+}
+
 void OsiLPEngine::getBasisStatus(int *cstat, int *rstat)
 {
   osilp_->getBasisStatus(cstat, rstat);
@@ -370,11 +566,13 @@ void OsiLPEngine::getBasisStatus(int *cstat, int *rstat)
 
 const double *OsiLPEngine::getColLower()
 {
+  applyUpdate_();
   return osilp_->getColLower();
 }
 
 const double *OsiLPEngine::getColUpper()
 {
+  applyUpdate_();
   return osilp_->getColUpper();
 }
 
@@ -459,8 +657,14 @@ WarmStartPtr OsiLPEngine::getWarmStartCopy()
   CoinWarmStart *coin_copy = osilp_->getWarmStart();
 
   OsiLPWarmStartPtr ws = new OsiLPWarmStart();
+  std::vector<UInt> ids(conOf_.size());
+
   // save it. It is our responsibility to free it.
   ws->setCoinWarmStart(coin_copy, true);
+  for (UInt r = 0; r < conOf_.size(); ++r) {
+    ids[r] = problem_->getConstraint(conOf_[r])->getId();
+  }
+  ws->setRowIds(ids);
 
   return ws;
 }
@@ -472,9 +676,25 @@ bool OsiLPEngine::IsOptimalBasisAvailable()
 
 void OsiLPEngine::load(ProblemPtr problem)
 {
+  // bounds saved in a batch are loaded from the problem below.
+  updCols_.clear();
+  updBnds_.clear();
+  updPos_.clear();
   problem_ = problem;
   int numvars = static_cast<int>(problem->getNumVars());
   int numcons = static_cast<int>(problem->getNumCons());
+
+  // all constraints are loaded now; none of them ages.
+  age_.assign(numcons, 0);
+  conOf_.resize(numcons);
+  rowOf_.resize(numcons);
+  for (int k = 0; k < numcons; ++k) {
+    conOf_[k] = k;
+    rowOf_[k] = k;
+  }
+  pending_.clear();
+  numAged_ = 0;
+  numLoaded_ = numcons;
   int i, j;
   double obj_sense = 1.;
   CoinPackedMatrix *r_mat;
@@ -589,7 +809,22 @@ void OsiLPEngine::loadFromWarmStart(const WarmStartPtr ws)
   ConstOsiLPWarmStartPtr ws2 = dynamic_cast<const OsiLPWarmStart *>(ws);
   assert(ws2);
   CoinWarmStart *coin_ws = ws2->getCoinWarmStart();
-  osilp_->setWarmStart(coin_ws);
+  const CoinWarmStartBasis *basis =
+      dynamic_cast<const CoinWarmStartBasis *>(coin_ws);
+  CoinWarmStartBasis *mapped = 0;
+
+  // rows may have been deleted, aged or added back since the basis was
+  // saved.
+  if (basis && problem_ && false == ws2->getRowIds().empty()) {
+    flushRows_();
+    mapped = mapBasis_(basis, ws2->getRowIds());
+  }
+  if (mapped) {
+    osilp_->setWarmStart(mapped);
+    delete mapped;
+  } else {
+    osilp_->setWarmStart(coin_ws);
+  }
 }
 
 void OsiLPEngine::loadDualWarmStart(int size, double *dualVec)
@@ -611,6 +846,78 @@ void OsiLPEngine::negateObj()
   delete[] obj;
 }
 
+CoinWarmStartBasis *OsiLPEngine::mapBasis_(const CoinWarmStartBasis *basis,
+                                           const std::vector<UInt> &ids)
+{
+  const int nrows = static_cast<int>(conOf_.size());
+  const int ncols = basis->getNumStructural();
+  std::unordered_map<UInt, int> old_row;
+  std::unordered_map<UInt, int>::const_iterator it;
+  std::vector<bool> is_new(nrows, false);
+  CoinWarmStartBasis *mapped;
+  CoinWarmStartBasis::Status st;
+  ConstraintPtr c;
+  int nbasic = 0;
+  bool same = (static_cast<int>(ids.size()) == nrows &&
+               basis->getNumArtificial() == nrows);
+
+  if (ncols != osilp_->getNumCols()) {
+    return 0;
+  }
+  for (int r = 0; r < nrows && true == same; ++r) {
+    same = (ids[r] == problem_->getConstraint(conOf_[r])->getId());
+  }
+  if (true == same) {
+    return 0;
+  }
+
+  for (int r = 0; r < basis->getNumArtificial() &&
+       r < static_cast<int>(ids.size()); ++r) {
+    old_row[ids[r]] = r;
+  }
+  mapped = new CoinWarmStartBasis();
+  mapped->setSize(ncols, nrows);
+  for (int j = 0; j < ncols; ++j) {
+    st = basis->getStructStatus(j);
+    mapped->setStructStatus(j, st);
+    nbasic += (CoinWarmStartBasis::basic == st) ? 1 : 0;
+  }
+  for (int r = 0; r < nrows; ++r) {
+    it = old_row.find(problem_->getConstraint(conOf_[r])->getId());
+    if (it == old_row.end()) {
+      st = CoinWarmStartBasis::basic;
+      is_new[r] = true;
+    } else {
+      st = basis->getArtifStatus(it->second);
+    }
+    mapped->setArtifStatus(r, st);
+    nbasic += (CoinWarmStartBasis::basic == st) ? 1 : 0;
+  }
+
+  // a new row is most likely a cut binding at the solution. The status of
+  // an artificial is that of the negated row activity.
+  for (int pass = 0; pass < 2 && nbasic > nrows; ++pass) {
+    for (int r = nrows - 1; r >= 0 && nbasic > nrows; --r) {
+      if ((0 == pass && false == is_new[r]) ||
+          CoinWarmStartBasis::basic != mapped->getArtifStatus(r)) {
+        continue;
+      }
+      c = problem_->getConstraint(conOf_[r]);
+      mapped->setArtifStatus(r, (c->getUb() < INFINITY) ?
+                                CoinWarmStartBasis::atLowerBound :
+                                CoinWarmStartBasis::atUpperBound);
+      --nbasic;
+    }
+  }
+  for (int r = nrows - 1; r >= 0 && nbasic < nrows; --r) {
+    if (CoinWarmStartBasis::basic != mapped->getArtifStatus(r)) {
+      mapped->setArtifStatus(r, CoinWarmStartBasis::basic);
+      ++nbasic;
+    }
+  }
+  return mapped;
+}
+
 OsiSolverInterface *OsiLPEngine::newSolver_(OsiLPEngineName ename)
 {
   OsiSolverInterface *si = 0;
@@ -641,15 +948,102 @@ OsiSolverInterface *OsiLPEngine::newSolver_(OsiLPEngineName ename)
 
 void OsiLPEngine::removeCons(std::vector<ConstraintPtr> &delcons)
 {
-  int num = static_cast<int>(delcons.size());
-  int *inds = new int[num];
-  for (int i = 0; i < num; ++i) {
-    inds[i] = delcons[i]->getIndex();
+  std::vector<int> rows;
+  std::vector<int> new_ind(rowOf_.size(), 0);
+  UInt n = 0;
+  UInt nloaded = 0;
+  UInt npending = 0;
+  int i;
+
+  applyUpdate_();
+  for (UInt k = 0; k < delcons.size(); ++k) {
+    i = delcons[k]->getIndex();
+    new_ind[i] = -1;
+    if (rowOf_[i] >= 0) {
+      rows.push_back(rowOf_[i]);
+    } else if (-2 == rowOf_[i]) {
+      --numAged_;
+    }
+  }
+  if (false == rows.empty()) {
+    deleteRows_(rows);
+  }
+
+  // renumber the constraints as Problem::delMarkedCons() does.
+  for (UInt k = 0; k < rowOf_.size(); ++k) {
+    if (new_ind[k] < 0) {
+      continue;
+    }
+    new_ind[k] = n;
+    rowOf_[n] = rowOf_[k];
+    if (k < numLoaded_) {
+      ++nloaded;
+    }
+    ++n;
+  }
+  rowOf_.resize(n);
+  numLoaded_ = nloaded;
+  for (UInt r = 0; r < conOf_.size(); ++r) {
+    conOf_[r] = new_ind[conOf_[r]];
   }
-  osilp_->deleteRows(num, inds);
+  for (UInt k = 0; k < pending_.size(); ++k) {
+    if (new_ind[pending_[k]] >= 0) {
+      pending_[npending] = new_ind[pending_[k]];
+      ++npending;
+    }
+  }
+  pending_.resize(npending);
+  stats_->rowsDel += rows.size();
   consChanged_ = true;
 }
 
+bool OsiLPEngine::reviveRows_(bool all)
+{
+  const double *x = osilp_->getColSolution();
+  const double tol = 1e-6;
+  ConstraintPtr c;
+  LinearFunctionPtr lf;
+  double act;
+  bool revived = false;
+
+  for (UInt k = 0; k < rowOf_.size() && numAged_ > 0; ++k) {
+    if (-2 != rowOf_[k]) {
+      continue;
+    }
+    c = problem_->getConstraint(k);
+    if (false == all) {
+      lf = c->getLinearFunction();
+      act = (lf) ? lf->eval(x) : 0.0;
+      if (act >= c->getLb() - tol * std::max(1.0, fabs(c->getLb())) &&
+          act <= c->getUb() + tol * std::max(1.0, fabs(c->getUb()))) {
+        continue;
+      }
+    }
+    rowOf_[k] = -1;
+    pending_.push_back(k);
+    --numAged_;
+    ++(stats_->rowsRev);
+    revived = true;
+  }
+  return revived;
+}
+
+void OsiLPEngine::saveBounds_(int col, double lb, double ub)
+{
+  if (updPos_.size() <= (UInt) col) {
+    updPos_.resize(osilp_->getNumCols(), -1);
+  }
+  if (updPos_[col] < 0) {
+    updPos_[col] = static_cast<int>(updCols_.size());
+    updCols_.push_back(col);
+    updBnds_.push_back(lb);
+    updBnds_.push_back(ub);
+  } else {
+    updBnds_[2*updPos_[col]] = lb;
+    updBnds_[2*updPos_[col]+1] = ub;
+  }
+}
+
 void OsiLPEngine::resetIterationLimit()
 {
   OsiIntParam key = OsiMaxNumIteration;
@@ -665,7 +1059,15 @@ void OsiLPEngine::setIterationLimit(int limit)
 EngineStatus OsiLPEngine::solve()
 {
   double off = 0;
+  int iters;
+  UInt added = stats_->rowsAdded;
+  UInt removed = stats_->rowsDel + stats_->rowsAged;
 
+  if (maxAge_ > 0 && false == strBr_) {
+    ageRows_();
+  }
+  flushRows_();
+  applyUpdate_();
   if (problem_->getObjective()) {
     off = problem_->getObjective()->getConstant();
   }
@@ -695,28 +1097,57 @@ EngineStatus OsiLPEngine::solve()
     load(p);
     osilp_->initialSolve();
   }
+  iters = osilp_->getIterationCount();
+
+  // rows removed by aging must hold at the solution, and can not be
+  // missing if the LP looks unbounded.
+  while (numAged_ > 0 &&
+         ((osilp_->isProvenOptimal() && reviveRows_(false)) ||
+          (osilp_->isProvenDualInfeasible() && reviveRows_(true)))) {
+    flushRows_();
+    osilp_->resolve();
+    ++(stats_->reSolves);
+    stats_->reIters += osilp_->getIterationCount();
+    iters += osilp_->getIterationCount();
+  }
+  stats_->iters += iters;
+
+  // duals of the rows, in the order of constraints of the problem.
+  duals_.assign(rowOf_.size(), 0.0);
+  if (osilp_->isProvenOptimal() || osilp_->isProvenPrimalInfeasible() ||
+      osilp_->isProvenDualInfeasible() ||
+      osilp_->isIterationLimitReached() ||
+      osilp_->isPrimalObjectiveLimitReached() ||
+      osilp_->isDualObjectiveLimitReached()) {
+    const double *price = osilp_->getRowPrice();
+    for (UInt k = 0; k < rowOf_.size(); ++k) {
+      if (rowOf_[k] >= 0) {
+        duals_[k] = price[rowOf_[k]];
+      }
+    }
+  }
 
   if (osilp_->isProvenOptimal()) {
     status_ = ProvenOptimal;
     sol_->setPrimal(osilp_->getStrictColSolution());
     sol_->setObjValue(osilp_->getObjValue() + off);
-    sol_->setDualOfCons(osilp_->getRowPrice());
+    sol_->setDualOfCons(duals_.data());
     sol_->setDualOfVars(osilp_->getReducedCost());
   } else if (osilp_->isProvenPrimalInfeasible()) {
     status_ = ProvenInfeasible;
     sol_->setObjValue(INFINITY);
-    sol_->setDualOfCons(osilp_->getRowPrice());
+    sol_->setDualOfCons(duals_.data());
     sol_->setDualOfVars(osilp_->getReducedCost());
   } else if (osilp_->isProvenDualInfeasible()) {
     status_ = ProvenUnbounded;  // primal is not infeasible but dual is.
     sol_->setObjValue(-INFINITY);
-    sol_->setDualOfCons(osilp_->getRowPrice());
+    sol_->setDualOfCons(duals_.data());
     sol_->setDualOfVars(osilp_->getReducedCost());
   } else if (osilp_->isIterationLimitReached()) {
     status_ = EngineIterationLimit;
     sol_->setPrimal(osilp_->getStrictColSolution());
     sol_->setObjValue(osilp_->getObjValue() + off);
-    sol_->setDualOfCons(osilp_->getRowPrice());
+    sol_->setDualOfCons(duals_.data());
     sol_->setDualOfVars(osilp_->getReducedCost());
   } else if (osilp_->isAbandoned()) {
     status_ = EngineError;
@@ -726,18 +1157,17 @@ EngineStatus OsiLPEngine::solve()
     status_ = ProvenObjectiveCutOff;
     sol_->setPrimal(osilp_->getStrictColSolution());
     sol_->setObjValue(osilp_->getObjValue() + off);
-    sol_->setDualOfCons(osilp_->getRowPrice());
+    sol_->setDualOfCons(duals_.data());
     sol_->setDualOfVars(osilp_->getReducedCost());
   } else {
     status_ = EngineUnknownStatus;
     sol_->setObjValue(INFINITY);
   }
 
-  stats_->iters += osilp_->getIterationCount();
   stats_->time += timer_->query();
   if (strBr_) {
     ++(stats_->strCalls);
-    stats_->strIters += osilp_->getIterationCount();
+    stats_->strIters += iters;
     stats_->strTime += timer_->query();
   }
 
@@ -745,8 +1175,17 @@ EngineStatus OsiLPEngine::solve()
   logger_->msgStream(LogDebug2)
       << me_ << "status = " << status_ << std::endl
       << me_ << "solution value = " << sol_->getObjValue() << std::endl
-      << me_ << "iterations = " << osilp_->getIterationCount() << std::endl;
+      << me_ << "iterations = " << osilp_->getIterationCount() << std::endl
+      << me_ << "rows added = " << stats_->rowsAdded - added << std::endl
+      << me_ << "rows removed = "
+      << stats_->rowsDel + stats_->rowsAged - removed << std::endl;
+#else
+  (void) added;
+  (void) removed;
 #endif
+  if (maxAge_ > 0 && false == strBr_ && ProvenOptimal == status_) {
+    updateAges_();
+  }
   timer_->stop();
   if (true == pickLPMeth_ && true == objChanged_ && false == bndChanged_ &&
       false == consChanged_) {
@@ -759,6 +1198,27 @@ EngineStatus OsiLPEngine::solve()
   return status_;
 }
 
+void OsiLPEngine::updateAges_()
+{
+  const double *act = osilp_->getRowActivity();
+  const double *price = osilp_->getRowPrice();
+  const double *lo = osilp_->getRowLower();
+  const double *up = osilp_->getRowUpper();
+  const double tol = 1e-6;
+
+  for (UInt r = 0; r < age_.size(); ++r) {
+    if (conOf_[r] < static_cast<int>(numLoaded_)) {
+      continue;
+    }
+    if (fabs(price[r]) < 1e-9 && act[r] > lo[r] + tol &&
+        act[r] < up[r] - tol) {
+      ++age_[r];
+    } else {
+      age_[r] = 0;
+    }
+  }
+}
+
 void OsiLPEngine::writeLP(const char *filename) const
 {
   osilp_->writeLp(filename);
@@ -773,6 +1233,22 @@ void OsiLPEngine::writeStats(std::ostream &out) const
         << me << "total time in solving  = " << stats_->time << std::endl
         << me << "time in str branching  = " << stats_->strTime << std::endl
         << me << "total iterations       = " << stats_->iters << std::endl
-        << me << "strong br iterations   = " << stats_->strIters << std::endl;
+        << me << "strong br iterations   = " << stats_->strIters << std::endl
+        << me << "rows added             = " << stats_->rowsAdded << std::endl
+        << me << "rows removed           = " << stats_->rowsDel << std::endl
+        << me << "calls to addRows       = " << stats_->flushes << std::endl;
+    if (stats_->calls > 0) {
+      out << me << "rows added per solve   = "
+          << (double) stats_->rowsAdded / stats_->calls << std::endl
+          << me << "rows removed per solve = "
+          << (double) (stats_->rowsDel + stats_->rowsAged) / stats_->calls
+          << std::endl;
+    }
+    if (maxAge_ > 0) {
+      out << me << "rows aged out          = " << stats_->rowsAged << std::endl
+          << me << "aged rows added back   = " << stats_->rowsRev << std::endl
+          << me << "solves to add back     = " << stats_->reSolves << std::endl
+          << me << "iterations to add back = " << stats_->reIters << std::endl;
+    }
   }
 }
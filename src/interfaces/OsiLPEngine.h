@@ -17,6 +17,7 @@
 #include "WarmStart.h"
 
 class CoinWarmStart;
+class CoinWarmStartBasis;
 class OsiSolverInterface;
 
 namespace Minotaur {
@@ -39,6 +40,13 @@ struct OsiLPStats {
   double strTime;  /// time taken in strong branching alone.
   UInt iters;      /// Sum of number of iterations in all calls.
   UInt strIters;   /// Number of iterations in strong branching alone.
+  UInt flushes;    /// Calls to addRows of the solver.
+  UInt rowsAdded;  /// Rows added to the solver, including revived ones.
+  UInt rowsDel;    /// Rows of deleted constraints removed from the solver.
+  UInt rowsAged;   /// Rows removed because they were not binding for long.
+  UInt rowsRev;    /// Aged rows added back because a solution violated them.
+  UInt reSolves;   /// Extra solves after adding back aged rows.
+  UInt reIters;    /// Iterations in the extra solves.
 };
 
 typedef enum {
@@ -65,6 +73,9 @@ class OsiLPWarmStart : public WarmStart {
   /// Get the warm-start description.
   CoinWarmStart *getCoinWarmStart() const;
 
+  /// Ids of the constraints of the rows of the basis, in their order.
+  const std::vector<UInt> &getRowIds() const;
+
   // Implement Engine::hasInfo().
   bool hasInfo();
 
@@ -79,6 +90,9 @@ class OsiLPWarmStart : public WarmStart {
    */
   void setDualWarmStart(int size, const double *dual);
 
+  /// Save the ids of the constraints of the rows of the basis.
+  void setRowIds(const std::vector<UInt> &ids);
+
   // Implement Engine::write().
   void write(std::ostream &out) const;
 
@@ -94,6 +108,13 @@ class OsiLPWarmStart : public WarmStart {
    * we should never delete it.
    */
   bool mustDelete_;
+
+  /**
+   * Id of the constraint of each row of the basis. Rows of the solver are
+   * removed and added back in a different order, so the basis is matched
+   * to the rows by these ids when it is loaded. Empty if not known.
+   */
+  std::vector<UInt> rowIds_;
 };
 typedef OsiLPWarmStart *OsiLPWarmStartPtr;
 typedef const OsiLPWarmStart *ConstOsiLPWarmStartPtr;
@@ -107,9 +128,16 @@ class OsiLPEngine : public LPEngine {
   /// Destroy.
   ~OsiLPEngine();
 
-  // Implement Engine::addConstraint().
+  /**
+   * Implement Engine::addConstraint(). The row is not added to the solver
+   * right away. Rows are kept pending until the next solve, and are then
+   * added with one call to addRows of the solver.
+   */
   void addConstraint(ConstraintPtr);
 
+  // Implement Engine::beginUpdate().
+  void beginUpdate();
+
   // Change bounds on a constraint.
   void changeBound(ConstraintPtr cons, BoundType lu, double new_val);
 
@@ -132,6 +160,10 @@ class OsiLPEngine : public LPEngine {
   /// Clear the problem.
   void clear();
 
+  // Implement Engine::commitUpdate(). Bounds saved in the batch are set
+  // with one call to setColSetBounds of the solver.
+  void commitUpdate();
+
   // Implement Engine::disableStrBrSetup()
   void disableStrBrSetup();
 
@@ -148,6 +180,12 @@ class OsiLPEngine : public LPEngine {
   // Implement Engine::fillStats()
   void fillStats(std::vector<double> &);
 
+  /// Length of the vector filled by fillStats().
+  static const UInt numStats = 6;
+
+  /// Position of the number of iterations in the vector of fillStats().
+  static const UInt itersStat = 4;
+
   // Get the indices of the basic variables from the tableau
   void getBasics(int *index);
 
@@ -158,6 +196,15 @@ class OsiLPEngine : public LPEngine {
    */
   void getBInvARow(int row, double *z, double *slack);
 
+  /* Get several rows of the optimal tableau in one call, keeping only
+   * entries larger than tol in absolute value.
+   * param[in] rows - Row indices for which the tableau rows are required
+   * param[in] tol - Entries with absolute value at most tol are dropped
+   * param[out] tab - Sparse rows, in the same order as rows
+   */
+  void getBInvARows(const std::vector<int> &rows, double tol,
+                    std::vector<TableauRow> &tab);
+
   /* \brief Get basic status of the variables in the sovler
    * param[out] cstat - A vector for column status (Variables of the problem)
    * param[in] rstat - A vector for row status (Constraints of the problem)
@@ -246,7 +293,12 @@ class OsiLPEngine : public LPEngine {
    */
   void load(ProblemPtr problem);
 
-  // Implement Engine::loadFromWarmStart().
+  /**
+   * Implement Engine::loadFromWarmStart(). Pending rows are added to the
+   * solver first. The statuses of rows in a saved basis are then moved to
+   * the rows of the same constraints. Rows not in the basis get basic
+   * slacks.
+   */
   void loadFromWarmStart(const WarmStartPtr ws);
 
   // Load dual warm start info in the solver
@@ -255,7 +307,11 @@ class OsiLPEngine : public LPEngine {
   // Convert 'min f' to 'min -f'.
   void negateObj();
 
-  // base class method.
+  /**
+   * Remove the rows of constraints that are about to be deleted from the
+   * problem, with one call to deleteRows of the solver. Rows that are
+   * pending or aged are only forgotten.
+   */
   void removeCons(std::vector<ConstraintPtr> &delcons);
 
   // Implement Engine::resetIterationLimit().
@@ -271,6 +327,12 @@ class OsiLPEngine : public LPEngine {
    * Solve the problem that was loaded. Calls resolve() function of Osi.
    * The resolve() function ``smartly'' decides what method of clp should
    * be called.
+   *
+   * If option lp_row_age is positive, rows of constraints added after
+   * load() are removed from the solver before the solve once they have
+   * not been binding in that many solves in a row. The constraints stay in
+   * the problem. If the solution violates one of them, it is added back
+   * and the LP is solved again, so aging never changes the solution.
    */
   EngineStatus solve();
 
@@ -285,15 +347,28 @@ class OsiLPEngine : public LPEngine {
   /// previous solve.
   bool bndChanged_;
 
+  /// Age of each row of the solver: solves in a row in which it was not
+  /// binding.
+  std::vector<UInt> age_;
+
+  /// Index in problem_ of the constraint of each row of the solver.
+  std::vector<int> conOf_;
+
   /// True if a constraint (not it bound) was changed after previous solve.
   bool consChanged_;
 
+  /// Duals of the constraints of problem_, in their order.
+  std::vector<double> duals_;
+
   /// Environment.
   EnvPtr env_;
 
   /// Name of the engine: OsiGrb, OsiClp etc.
   OsiLPEngineName eName_;
 
+  /// Rows not binding in this many solves are removed. 0: never.
+  UInt maxAge_;
+
   /// The maximum limit that can be set on Osi solver.
   int maxIterLimit_;
 
@@ -309,12 +384,26 @@ class OsiLPEngine : public LPEngine {
    */
   OsiSolverInterface *osilp_;
 
+  /// Constraints whose rows are not in the solver yet.
+  std::vector<int> pending_;
+
   /// True: tell CLP to stick to dual or primal simplex. False: CLP decides.
   bool pickLPMeth_;
 
+  /// Number of constraints that were in the problem when it was loaded.
+  /// Their rows never age. They are always the first ones.
+  UInt numLoaded_;
+
+  /// Number of constraints whose rows were removed by aging.
+  UInt numAged_;
+
   /// Problem that is loaded, if any.
   ProblemPtr problem_;
 
+  /// Row of the solver for each constraint of problem_. It is -1 if the row
+  /// is pending and -2 if it was removed by aging.
+  std::vector<int> rowOf_;
+
   /// Solution.
   SolutionPtr sol_;
 
@@ -327,8 +416,59 @@ class OsiLPEngine : public LPEngine {
   /// Timer for OsiLP solves. Includes time spent in strong branching.
   Timer *timer_;
 
+  /// New lower and upper bound of each column in updCols_.
+  std::vector<double> updBnds_;
+
+  /// Columns whose bounds were changed in the current batch.
+  std::vector<int> updCols_;
+
+  /// Number of batches started and not yet committed.
+  UInt updDepth_;
+
+  /// Position of each column in updCols_, -1 if not there.
+  std::vector<int> updPos_;
+
+  /// Remove rows that have not been binding in maxAge_ solves.
+  void ageRows_();
+
+  /// Set the bounds saved in the current batch in the solver.
+  void applyUpdate_();
+
+  /**
+   * Delete rows from the solver with one call, and renumber the remaining
+   * rows in conOf_, age_ and rowOf_. Entries of rowOf_ for the deleted rows
+   * are left to the caller.
+   */
+  void deleteRows_(std::vector<int> &rows);
+
+  /// Add all pending rows to the solver with one call.
+  void flushRows_();
+
+  /**
+   * Return a copy of a basis with the statuses of rows moved to the
+   * current rows of the solver, or NULL if it is already in their order.
+   * Rows are matched by the ids of their constraints. If rows of nonbasic
+   * slacks are gone, slacks of new rows, and then of the last rows, are
+   * made nonbasic until the number of basic variables is right.
+   */
+  CoinWarmStartBasis *mapBasis_(const CoinWarmStartBasis *basis,
+                                const std::vector<UInt> &ids);
+
   // Create a new solver (cplex, or clp or ..)
   OsiSolverInterface *newSolver_(OsiLPEngineName ename);
+
+  /**
+   * Make aged rows pending again: all of them if all is true, and only
+   * those violated by the solution of the solver otherwise.
+   * Return true if any row was made pending.
+   */
+  bool reviveRows_(bool all);
+
+  /// Save a change of bounds of a column in the current batch.
+  void saveBounds_(int col, double lb, double ub);
+
+  /// Update age_ from the solution of the solver.
+  void updateAges_();
 };
 
 typedef OsiLPEngine *OsiLPEnginePtr;
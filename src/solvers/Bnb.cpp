@@ -26,6 +26,7 @@
 #include "Bnb.h"
 #include "BndProcessor.h"
 #include "BranchAndBound.h"
+#include "HeurWorker.h"
 #include "LexicoBrancher.h"
 #include "LinFeasPump.h"
 #include "MINLPDiving.h"
@@ -78,6 +79,7 @@ BranchAndBound* Bnb::getBab_(Engine* engine, HandlerVector& handlers)
   OptionDBPtr options = env_->getOptions();
   SOS2HandlerPtr s2_hand;
   RCHandlerPtr rc_hand;
+  HeurWorker* worker = 0;
   SppHeur* sp = 0;
 
   SOS1HandlerPtr s_hand = (SOS1HandlerPtr) new SOS1Handler(env_, oinst_);
@@ -94,6 +96,10 @@ BranchAndBound* Bnb::getBab_(Engine* engine, HandlerVector& handlers)
     rc_hand->setModFlags(false, true);
     handlers.push_back(rc_hand);
     assert(rc_hand);
+    if (options->findBool("rc_tree_fix")->getValue()) {
+      rc_hand->setTreeFix(true);
+      bab->setRCHandler(rc_hand);
+    }
   }
 
   // add SOS2 handler here.
@@ -147,18 +153,30 @@ BranchAndBound* Bnb::getBab_(Engine* engine, HandlerVector& handlers)
   nr->setEngine(engine);
   bab->setNodeRelaxer(nr);
   bab->shouldCreateRoot(false);
+  if(raceBoard_) {
+    bab->setRaceBoard(raceBoard_, raceId_);
+  }
   // NlWriter wr(env_);
   // wr.write(rel, "test1234.nl");
 
+  worker = getHeurWorker_(engine,
+                          options->findBool("use_native_cgraph")->getValue() ||
+                          rel->isQP() || rel->isQuadratic());
   if(0 <= options->findInt("divheur")->getValue()) {
     MINLPDivingPtr div_heur;
     EnginePtr e2 = engine->emptyCopy();
-    if(true == options->findBool("use_native_cgraph")->getValue() ||
-       rel->isQP() || rel->isQuadratic()) {
-      oinst_->setNativeDer();
+    if(worker) {
+      div_heur = (MINLPDivingPtr) new MINLPDiving(env_, worker->getProblem(),
+                                                  e2);
+      worker->addHeur(div_heur);
+    } else {
+      if(true == options->findBool("use_native_cgraph")->getValue() ||
+         rel->isQP() || rel->isQuadratic()) {
+        oinst_->setNativeDer();
+      }
+      div_heur = (MINLPDivingPtr) new MINLPDiving(env_, oinst_, e2);
+      bab->addPreRootHeur(div_heur);
     }
-    div_heur = (MINLPDivingPtr) new MINLPDiving(env_, oinst_, e2);
-    bab->addPreRootHeur(div_heur);
   }
 
   if(options->findBool("prerootheur")->getValue() == true) {
@@ -182,13 +200,47 @@ BranchAndBound* Bnb::getBab_(Engine* engine, HandlerVector& handlers)
     EngineFactory efac(env_);
     EnginePtr lpe = efac.getLPEngine();
     EnginePtr nlpe = engine->emptyCopy();
-    LinFeasPumpPtr lin_feas_pump =
-        (LinFeasPumpPtr) new LinFeasPump(env_, oinst_, nlpe, lpe);
-    bab->addPreRootHeur(lin_feas_pump);
+    LinFeasPumpPtr lin_feas_pump;
+    if(worker) {
+      lin_feas_pump = (LinFeasPumpPtr) new LinFeasPump(env_,
+                                                       worker->getProblem(),
+                                                       nlpe, lpe);
+      worker->addHeur(lin_feas_pump);
+    } else {
+      lin_feas_pump = (LinFeasPumpPtr) new LinFeasPump(env_, oinst_, nlpe,
+                                                       lpe);
+      bab->addPreRootHeur(lin_feas_pump);
+    }
+  }
+
+  if(worker && worker->getNumHeurs() > 0) {
+    bab->setHeurWorker(worker);
+  } else if(worker) {
+    delete worker;
   }
   return bab;
 }
 
+HeurWorker* Bnb::getHeurWorker_(EnginePtr engine, bool native_der)
+{
+  ProblemPtr p;
+
+  if(false == env_->getOptions()->findBool("heur_worker")->getValue()) {
+    return 0;
+  }
+  // the worker evaluates functions and solves NLPs at the same time as the
+  // tree. AMPL derivatives and filter-sqp keep global state.
+  if(false == native_der || "filter-sqp" == engine->getName()) {
+    env_->getLogger()->msgStream(LogInfo)
+        << me_ << "heur_worker needs native derivatives and a thread-safe "
+        << "NLP engine. Heuristics are run before the root." << std::endl;
+    return 0;
+  }
+  p = oinst_->clone(env_);
+  p->setNativeDer();
+  return new HeurWorker(env_, p);
+}
+
 BrancherPtr Bnb::getBrancher_(HandlerVector handlers, EnginePtr e)
 {
   BrancherPtr br = 0;
@@ -509,7 +561,10 @@ int Bnb::solve(ProblemPtr p)
   // First store all original variables in a vector, then presolve.
   // Keep a pointer to presolver for postsolving after the main solve.
   orig_v = new VarVector(oinst_->varsBegin(), oinst_->varsEnd());
-  pres = presolve_(handlers);
+  pres = loadPresolved_(oinst_, orig_v, &objSense_);
+  if (!pres) {
+    pres = presolve_(handlers);
+  }
   for(HandlerVector::iterator it = handlers.begin(); it != handlers.end();
       ++it) {
     delete(*it);
@@ -525,6 +580,9 @@ int Bnb::solve(ProblemPtr p)
               iface_);
     goto CLEANUP;
   }
+  if(savePresolved_(oinst_, pres, orig_v, objSense_)) {
+    goto CLEANUP;
+  }
   if(options->findBool("solve")->getValue() == false) {
     env_->getLogger()->msgStream(LogInfo)
         << me_ << "Solve option is set to 0, Stopping further processing."
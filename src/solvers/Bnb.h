@@ -22,6 +22,8 @@
 #include "Solver.h"
 
 namespace Minotaur {
+class HeurWorker;
+
 /**
  * The Bnb class sets up methods for solving a convex MINLP instance using
  * the NLP based Branch-and-Bound
@@ -67,6 +69,7 @@ private:
 
   BranchAndBound* getBab_(Engine *engine, HandlerVector &handlers);
   BrancherPtr getBrancher_(HandlerVector handlers, Engine *e);
+  HeurWorker* getHeurWorker_(Engine *engine, bool native_der);
   int getEngine_(Engine **e);
   PresolverPtr presolve_(HandlerVector &handlers);
   void writeBnbStatus_(BranchAndBound *bab);
@@ -37,7 +37,8 @@ int main(int argc, char** argv)
 
   dname = env->getOptions()->findString("debug_sol")->getValue();
   fname = env->getOptions()->findString("problem_file")->getValue();
-  if (""==fname) {
+  if (""==fname &&
+      ""==env->getOptions()->findString("load_presolved")->getValue()) {
     bnb.showHelp();
     goto CLEANUP;
   }
@@ -12,6 +12,7 @@
 
 #include "Glob.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <iostream>
@@ -19,6 +20,7 @@
 #include "AMPLInterface.h"
 #include "Bnb.h"
 #include "BranchAndBound.h"
+#include "HeurWorker.h"
 #include "Engine.h"
 #include "EngineFactory.h"
 #include "Environment.h"
@@ -37,6 +39,8 @@
 #include "Objective.h"
 #include "Option.h"
 #include "PCBProcessor.h"
+#include "ParNodeIncRelaxer.h"
+#include "ParPCBProcessor.h"
 #include "Presolver.h"
 #include "Problem.h"
 #include "ProblemSize.h"
@@ -53,6 +57,10 @@
 #include "TreeManager.h"
 #include "WeakBrancher.h"
 
+#if USE_OPENMP
+#include <omp.h>
+#endif
+
 using namespace Minotaur;
 const std::string Glob::me_ = "mntr-glob: ";
 
@@ -101,38 +109,9 @@ NLPEnginePtr Glob::getNLPEngine_()
   return e;
 }
 
-int Glob::transform_(ProblemPtr& newp, HandlerVector& handlers,
-                     LPEnginePtr engine)
-{
-  TransformerPtr trans;
-  int status = 0;
-  std::string tr = env_->getOptions()->findString("transformer")->getValue();
-
-  handlers.clear();
-  if(tr == "simp") {
-    trans = (SimpTranPtr) new SimpleTransformer(env_, inst_, getEngine_(),
-                                                engine, getNLPEngine_());
-  } else { // if (tr == "quad") {
-    trans = (QuadTranPtr) new QuadTransformer(env_, inst_);
-  }
-  trans->reformulate(newp, handlers, status);
-
-  env_->getLogger()->msgStream(LogInfo)
-      << me_ << "handlers used in transformer: " << std::endl;
-  for(HandlerVector::iterator it = handlers.begin(); it != handlers.end();
-      ++it) {
-    env_->getLogger()->msgStream(LogInfo)
-        << "  " << (*it)->getName() << std::endl;
-  }
-  delete trans;
-  return status;
-}
-
-BranchAndBound* Glob::createBab_(EnginePtr e, HandlerVector& handlers)
+BrancherPtr Glob::getBrancher_(HandlerVector& handlers, EnginePtr e,
+                               ProblemPtr p)
 {
-  BranchAndBound* bab = new BranchAndBound(env_, newp_);
-  PCBProcessorPtr nproc;
-  NodeIncRelaxerPtr nr;
   BrancherPtr br = 0;
   std::string brancher = env_->getOptions()->findString("brancher")->getValue();
 
@@ -141,13 +120,13 @@ BranchAndBound* Glob::createBab_(EnginePtr e, HandlerVector& handlers)
     ReliabilityBrancherPtr rel_br;
     rel_br = (ReliabilityBrancherPtr) new ReliabilityBrancher(env_, handlers);
     rel_br->setEngine(e);
-    t = (newp_->getSize()->ints + newp_->getSize()->bins) / 10;
+    t = (p->getSize()->ints + p->getSize()->bins) / 10;
     t = std::max(t, (UInt)2);
     t = std::min(t, (UInt)4);
     rel_br->setThresh(t);
     env_->getLogger()->msgStream(LogExtraInfo)
         << me_ << "setting reliability threshhold to " << t << std::endl;
-    t = (UInt)newp_->getSize()->ints + newp_->getSize()->bins / 20 + 2;
+    t = (UInt)p->getSize()->ints + p->getSize()->bins / 20 + 2;
     t = std::min(t, (UInt)10);
     rel_br->setMaxDepth(t);
     env_->getLogger()->msgStream(LogExtraInfo)
@@ -175,52 +154,214 @@ BranchAndBound* Glob::createBab_(EnginePtr e, HandlerVector& handlers)
         (HybridBrancherPtr) new HybridBrancher(env_, handlers);
     hyb_br->setEngine(e);
     hyb_br->doStronger();
-    hyb_br->setProblem(newp_);
+    hyb_br->setProblem(p);
     br = hyb_br;
   } else if(brancher == "hybrid") {
     HybridBrancherPtr hyb_br =
         (HybridBrancherPtr) new HybridBrancher(env_, handlers);
     hyb_br->setEngine(e);
     hyb_br->reliabilitySetup(20, 50, 5);
-    hyb_br->setProblem(newp_);
+    hyb_br->setProblem(p);
     br = hyb_br;
   } else if(brancher == "weak") {
     WeakBrancherPtr wbr = (WeakBrancherPtr) new WeakBrancher(env_, handlers);
-    wbr->setProblem(newp_);
+    wbr->setProblem(p);
     br = wbr;
   }
   env_->getLogger()->msgStream(LogExtraInfo)
       << me_ << "brancher used = " << br->getName() << std::endl;
-  nproc = (PCBProcessorPtr) new PCBProcessor(env_, e, handlers);
-  nproc->setBrancher(br);
-  bab->setNodeProcessor(nproc);
+  return br;
+}
 
-  nr = (NodeIncRelaxerPtr) new NodeIncRelaxer(env_, handlers);
-  nr->setProblem(newp_);
-  nr->setEngine(e);
-  bab->setNodeRelaxer(nr);
-  bab->shouldCreateRoot(true);
+UInt Glob::getNumThreads_()
+{
+  UInt n = 1;
+#if USE_OPENMP
+  int t = env_->getOptions()->findInt("threads")->getValue();
+
+  if(t > 1) {
+    n = std::min(t, omp_get_max_threads());
+  }
+#endif
+  return n;
+}
+
+HeurVector Glob::getPreRootHeurs_(HeurWorker* worker)
+{
+  HeurVector heurs;
 
   if(env_->getOptions()->findBool("prerootheur")->getValue() == true) {
     if(env_->getOptions()->findBool("msheur")->getValue() == true &&
        (newp_->getSize()->bins == 0 && newp_->getSize()->ints == 0)) {
       EnginePtr nlp_e = getNLPEngine_();
-      newp_->setNativeDer();
-      NLPMSPtr ms_heur = (NLPMSPtr) new NLPMultiStart(env_, newp_, nlp_e);
-      bab->addPreRootHeur(ms_heur);
+      NLPMSPtr ms_heur;
+      // filter-sqp keeps global state and cannot run next to the tree.
+      if(worker && nlp_e && "filter-sqp" != nlp_e->getName()) {
+        worker->getProblem()->setNativeDer();
+        ms_heur = (NLPMSPtr) new NLPMultiStart(env_, worker->getProblem(),
+                                               nlp_e);
+        worker->addHeur(ms_heur);
+      } else {
+        newp_->setNativeDer();
+        ms_heur = (NLPMSPtr) new NLPMultiStart(env_, newp_, nlp_e);
+        heurs.push_back(ms_heur);
+      }
     }
 
     if(env_->getOptions()->findBool("samplingheur")->getValue() == true) {
       SamplingHeurPtr s_heur = (SamplingHeurPtr) new SamplingHeur(env_, inst_);
-      bab->addPreRootHeur(s_heur);
+      heurs.push_back(s_heur);
     }
 
     if(env_->getOptions()->findBool("fixvarsheur")->getValue() == true) {
       FixVarsHeurPtr f_heur = (FixVarsHeurPtr) new FixVarsHeur(env_, inst_);
-      bab->addPreRootHeur(f_heur);
+      heurs.push_back(f_heur);
+    }
+  }
+
+  return heurs;
+}
+
+int Glob::transform_(ProblemPtr& newp, HandlerVector& handlers,
+                     LPEnginePtr engine)
+{
+  TransformerPtr trans;
+  int status = 0;
+  std::string tr = env_->getOptions()->findString("transformer")->getValue();
+  double tstart = env_->getTime();
+
+  handlers.clear();
+  if(tr == "simp") {
+    trans = (SimpTranPtr) new SimpleTransformer(env_, inst_, getEngine_(),
+                                                engine, getNLPEngine_());
+  } else { // if (tr == "quad") {
+    trans = (QuadTranPtr) new QuadTransformer(env_, inst_);
+  }
+  trans->reformulate(newp, handlers, status);
+  env_->getLogger()->msgStream(LogInfo)
+      << me_ << "time used in reformulating = " << std::fixed
+      << std::setprecision(2) << env_->getTime() - tstart << std::endl;
+
+  env_->getLogger()->msgStream(LogInfo)
+      << me_ << "handlers used in transformer: " << std::endl;
+  for(HandlerVector::iterator it = handlers.begin(); it != handlers.end();
+      ++it) {
+    env_->getLogger()->msgStream(LogInfo)
+        << "  " << (*it)->getName() << std::endl;
+  }
+  delete trans;
+  return status;
+}
+
+int Glob::copyTransformed_(UInt numThreads, ProblemPtr pCopy[],
+                           HandlerVector handlersCopy[], LPEnginePtr eCopy[])
+{
+  TransformerPtr trans;
+  PresolverPtr pres;
+  int status = 0;
+  std::string tr = env_->getOptions()->findString("transformer")->getValue();
+  double tstart = env_->getTime();
+
+  for(UInt i = 1; i < numThreads && 0 == status; ++i) {
+    eCopy[i] = getEngine_();
+    if(tr == "simp") {
+      trans = (SimpTranPtr) new SimpleTransformer(env_, inst_, getEngine_(),
+                                                  eCopy[i], getNLPEngine_());
+    } else {
+      trans = (QuadTranPtr) new QuadTransformer(env_, inst_);
+    }
+    trans->reformulate(pCopy[i], handlersCopy[i], status);
+    delete trans;
+    if(0 != status || !pCopy[i]) {
+      status = 1;
+      break;
+    }
+    pres = (PresolverPtr) new Presolver(pCopy[i], env_, handlersCopy[i]);
+    pres->solve();
+    delete pres;
+    if(pCopy[i]->getNumVars() != newp_->getNumVars() ||
+       pCopy[i]->getNumCons() != newp_->getNumCons()) {
+      status = 1;
+    }
+  }
+  env_->getLogger()->msgStream(LogExtraInfo)
+      << me_ << "time used in copying transformed problem = " << std::fixed
+      << std::setprecision(2) << env_->getTime() - tstart << std::endl;
+  return status;
+}
+
+BranchAndBound* Glob::createBab_(EnginePtr e, HandlerVector& handlers)
+{
+  BranchAndBound* bab = new BranchAndBound(env_, newp_);
+  PCBProcessorPtr nproc;
+  NodeIncRelaxerPtr nr;
+  BrancherPtr br = getBrancher_(handlers, e, newp_);
+  HeurVector heurs;
+  HeurWorker* worker = 0;
+
+  nproc = (PCBProcessorPtr) new PCBProcessor(env_, e, handlers);
+  nproc->setBrancher(br);
+  bab->setNodeProcessor(nproc);
+
+  nr = (NodeIncRelaxerPtr) new NodeIncRelaxer(env_, handlers);
+  nr->setProblem(newp_);
+  nr->setEngine(e);
+  bab->setNodeRelaxer(nr);
+  bab->shouldCreateRoot(true);
+
+  if(env_->getOptions()->findBool("heur_worker")->getValue() == true) {
+    worker = new HeurWorker(env_, newp_->clone(env_));
+  }
+  heurs = getPreRootHeurs_(worker);
+  for(HeurVector::iterator it = heurs.begin(); it != heurs.end(); ++it) {
+    bab->addPreRootHeur(*it);
+  }
+  if(worker && worker->getNumHeurs() > 0) {
+    bab->setHeurWorker(worker);
+  } else if(worker) {
+    delete worker;
+  }
+  return bab;
+}
+
+ParBranchAndBound* Glob::createParBab_(UInt numThreads, LPEnginePtr eCopy[],
+                                       ProblemPtr pCopy[],
+                                       HandlerVector handlersCopy[],
+                                       ParPCBProcessorPtr nodePrcssr[],
+                                       ParNodeIncRelaxerPtr parNodeRlxr[])
+{
+  ParBranchAndBound* bab = new ParBranchAndBound(env_, newp_);
+  RelaxationPtr rel;
+  BrancherPtr br;
+  HeurVector heurs;
+  bool prune = false;
+
+  for(UInt i = 0; i < numThreads; ++i) {
+    // a thread changes bounds only in its own relaxation. Changes made at
+    // nodes by other threads are applied to it using indices.
+    for(HandlerIterator h = handlersCopy[i].begin();
+        h != handlersCopy[i].end(); ++h) {
+      (*h)->setModFlags(false, true);
     }
+    br = getBrancher_(handlersCopy[i], eCopy[i], pCopy[i]);
+    nodePrcssr[i] = (ParPCBProcessorPtr) new ParPCBProcessor(env_, eCopy[i],
+                                                             handlersCopy[i]);
+    nodePrcssr[i]->setBrancher(br);
+
+    parNodeRlxr[i] =
+        (ParNodeIncRelaxerPtr) new ParNodeIncRelaxer(env_, handlersCopy[i]);
+    parNodeRlxr[i]->setModFlag(false);
+    parNodeRlxr[i]->setProblem(pCopy[i]);
+    rel = parNodeRlxr[i]->createRootRelaxation(0, 0, prune);
+    rel->setProblem(pCopy[i]);
+    parNodeRlxr[i]->setEngine(eCopy[i]);
   }
+  bab->shouldCreateRoot(false);
 
+  heurs = getPreRootHeurs_();
+  for(HeurVector::iterator it = heurs.begin(); it != heurs.end(); ++it) {
+    bab->addPreRootHeur(*it);
+  }
   return bab;
 }
 
@@ -323,6 +464,99 @@ void Glob::setInitialOptions_()
   options->findBool("simplex_cut")->setValue(true);
 }
 
+int Glob::solvePar_(UInt numThreads, LPEnginePtr engine,
+                    HandlerVector& handlers, VarVector* orig_v,
+                    PresolverPtr pres)
+{
+  ProblemPtr* pCopy = new ProblemPtr[numThreads];
+  HandlerVector* handlersCopy = new HandlerVector[numThreads];
+  LPEnginePtr* eCopy = new LPEnginePtr[numThreads];
+  ParPCBProcessorPtr* nodePrcssr = new ParPCBProcessorPtr[numThreads];
+  ParNodeIncRelaxerPtr* parNodeRlxr = new ParNodeIncRelaxerPtr[numThreads];
+  ParBranchAndBound* parbab = 0;
+  OptionDBPtr options = env_->getOptions();
+  double wall_start;
+  int err = 0;
+
+  std::fill(pCopy, pCopy + numThreads, (ProblemPtr)0);
+  std::fill(eCopy, eCopy + numThreads, (LPEnginePtr)0);
+  std::fill(nodePrcssr, nodePrcssr + numThreads, (ParPCBProcessorPtr)0);
+  std::fill(parNodeRlxr, parNodeRlxr + numThreads, (ParNodeIncRelaxerPtr)0);
+
+  // thread 0 uses the transformed problem, its handlers and engine.
+  pCopy[0] = newp_;
+  handlersCopy[0] = handlers;
+  eCopy[0] = engine;
+  err = copyTransformed_(numThreads, pCopy, handlersCopy, eCopy);
+  if(err) {
+    env_->getLogger()->msgStream(LogInfo)
+        << me_ << "transformed problem could not be copied for threads"
+        << std::endl;
+    goto CLEANUP;
+  }
+
+  env_->getLogger()->msgStream(LogInfo)
+      << me_ << "number of threads = " << numThreads << std::endl;
+  parbab = createParBab_(numThreads, eCopy, pCopy, handlersCopy, nodePrcssr,
+                         parNodeRlxr);
+  if(false == options->findBool("solve")->getValue()) {
+    goto CLEANUP;
+  }
+
+  wall_start = env_->getWTime();
+  if(true == options->findBool("bnbpar_deter_mode")->getValue()) {
+    parbab->parsolveSync(parNodeRlxr, nodePrcssr, numThreads);
+  } else if(true == options->findBool("bnbpar_oppor_mode")->getValue()) {
+    parbab->parsolveOppor(parNodeRlxr, nodePrcssr, numThreads);
+  } else {
+    parbab->parsolve(parNodeRlxr, nodePrcssr, numThreads);
+  }
+  parbab->writeStats(env_->getLogger()->msgStream(LogExtraInfo));
+  for(UInt i = 0; i < numThreads; ++i) {
+    eCopy[i]->writeStats(env_->getLogger()->msgStream(LogExtraInfo));
+    for(HandlerVector::iterator it = handlersCopy[i].begin();
+        it != handlersCopy[i].end(); ++it) {
+      (*it)->writeStats(env_->getLogger()->msgStream(LogExtraInfo));
+    }
+  }
+
+  writeSol_(env_, orig_v, pres, parbab->getSolution(), parbab->getStatus(),
+            iface_);
+  writeStatus_(parbab, wall_start);
+
+CLEANUP:
+  // objects of thread 0 are freed by solve().
+  for(UInt i = 0; i < numThreads; ++i) {
+    if(parNodeRlxr[i]) {
+      delete parNodeRlxr[i];
+    }
+    if(nodePrcssr[i]) {
+      delete nodePrcssr[i];
+    }
+    if(i > 0) {
+      for(HandlerVector::iterator it = handlersCopy[i].begin();
+          it != handlersCopy[i].end(); ++it) {
+        delete(*it);
+      }
+      if(eCopy[i]) {
+        delete eCopy[i];
+      }
+      if(pCopy[i]) {
+        delete pCopy[i];
+      }
+    }
+  }
+  if(parbab) {
+    delete parbab;
+  }
+  delete[] parNodeRlxr;
+  delete[] nodePrcssr;
+  delete[] eCopy;
+  delete[] handlersCopy;
+  delete[] pCopy;
+  return err;
+}
+
 int Glob::solve(ProblemPtr inst)
 {
   LPEnginePtr engine = 0;
@@ -333,6 +567,7 @@ int Glob::solve(ProblemPtr inst)
   ProblemPtr newp = 0;
   BranchAndBound* bab = 0;
   OptionDBPtr options = env_->getOptions();
+  UInt numThreads = 0;
 
   env_->initRand();
 
@@ -382,9 +617,12 @@ int Glob::solve(ProblemPtr inst)
   // get presolver.
   handlers.clear();
   orig_v = new VarVector(inst_->varsBegin(), inst_->varsEnd());
-  pres = createPres_(handlers);
-  if(env_->getOptions()->findBool("presolve")->getValue() == true) {
-    pres->solve();
+  pres = loadPresolved_(inst_, orig_v, &objSense_);
+  if(!pres) {
+    pres = createPres_(handlers);
+    if(env_->getOptions()->findBool("presolve")->getValue() == true) {
+      pres->solve();
+    }
   }
   for(HandlerVector::iterator it = handlers.begin(); it != handlers.end();
       ++it) {
@@ -401,6 +639,9 @@ int Glob::solve(ProblemPtr inst)
               iface_);
     goto CLEANUP;
   }
+  if(savePresolved_(inst_, pres, orig_v, objSense_)) {
+    goto CLEANUP;
+  }
 
   inst_->setNativeDer();
   err = transform_(newp, handlers, engine);
@@ -437,6 +678,15 @@ int Glob::solve(ProblemPtr inst)
   env_->getLogger()->msgStream(LogExtraInfo)
       << me_ << "Finished presolving transformed problem" << std::endl;
 
+  numThreads = getNumThreads_();
+  if(numThreads > 1) {
+    if(0 == solvePar_(numThreads, engine, handlers, orig_v, pres)) {
+      goto CLEANUP;
+    }
+    env_->getLogger()->msgStream(LogInfo)
+        << me_ << "solving with one thread" << std::endl;
+  }
+
   // get branch-and-bound
   bab = createBab_(engine, handlers);
 
@@ -576,6 +826,27 @@ void Glob::writeStatus_(BranchAndBound* bab)
   }
 }
 
+void Glob::writeStatus_(ParBranchAndBound* parbab, double wall_start)
+{
+  status_ = parbab->getStatus();
+  env_->getLogger()->msgStream(LogInfo)
+      << me_ << std::fixed << std::setprecision(4)
+      << "best solution value = " << objSense_ * parbab->getUb() << std::endl
+      << me_ << std::fixed << std::setprecision(4)
+      << "best bound estimate from remaining nodes = "
+      << objSense_ * parbab->getLb() << std::endl
+      << me_ << "gap = " << std::max(0.0, parbab->getUb() - parbab->getLb())
+      << std::endl
+      << me_ << "gap percentage = " << parbab->getPerGap() << std::endl
+      << me_ << "wall time used = " << std::fixed << std::setprecision(2)
+      << env_->getWTime() - wall_start << std::endl
+      << me_ << "time used = " << std::fixed << std::setprecision(2)
+      << env_->getTime() << std::endl
+      << me_
+      << "status of branch-and-bound: " << getSolveStatusString(status_)
+      << std::endl;
+}
+
 
 // ProblemPtr Glob::loadProblem()
 //{
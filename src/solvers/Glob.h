@@ -17,12 +17,15 @@
 #include "BranchAndBound.h"
 #include "Brancher.h"
 #include "NLPEngine.h"
+#include "ParBranchAndBound.h"
 #include "Presolver.h"
 #include "Solver.h"
 #include "Types.h"
 
 namespace Minotaur
 {
+class HeurWorker;
+
 /**
  * The Glob class sets up methods for solving an MIQCQP instance to
  * global optimality
@@ -67,16 +70,58 @@ private:
   ProblemPtr newp_;
   SolveStatus status_;
 
+  /**
+   * \brief Create transformed problems, handlers and LP engines for threads
+   * 1 to numThreads-1.
+   *
+   * The original instance is transformed and presolved again for each
+   * thread, so that no handler is shared between threads. Entries for
+   * thread 0 are not changed.
+   * \return 0 if the copies have the same variables and constraints as
+   * the transformed problem, nonzero otherwise.
+   */
+  int copyTransformed_(UInt numThreads, ProblemPtr pCopy[],
+                       HandlerVector handlersCopy[], LPEnginePtr eCopy[]);
   BranchAndBound* createBab_(EnginePtr e, HandlerVector& handlers);
+
+  /// Create parallel branch-and-bound with a relaxation for each thread.
+  ParBranchAndBound* createParBab_(UInt numThreads, LPEnginePtr eCopy[],
+                                   ProblemPtr pCopy[],
+                                   HandlerVector handlersCopy[],
+                                   ParPCBProcessorPtr nodePrcssr[],
+                                   ParNodeIncRelaxerPtr parNodeRlxr[]);
   PresolverPtr createPres_(HandlerVector& handlers);
   void fwd2Bnb_();
   void fwd2QG_();
-  BrancherPtr getBrancher_(HandlerVector handlers, Engine* e);
+  BrancherPtr getBrancher_(HandlerVector& handlers, EnginePtr e,
+                           ProblemPtr p);
   LPEnginePtr getEngine_();
   NLPEnginePtr getNLPEngine_();
+
+  /// Number of threads for branch-and-bound, from option "threads".
+  UInt getNumThreads_();
+
+  /**
+   * \brief Create heuristics called before the root.
+   *
+   * \param [in] worker If not NULL, the multi-start heuristic is created
+   * with the problem of the worker and added to it, unless the NLP engine
+   * is not thread-safe.
+   */
+  HeurVector getPreRootHeurs_(HeurWorker* worker = 0);
   void setInitialOptions_();
+
+  /**
+   * \brief Solve the transformed problem by parallel branch-and-bound.
+   *
+   * \return 0 if solved, nonzero if the problem could not be copied for
+   * the threads, in which case nothing is solved.
+   */
+  int solvePar_(UInt numThreads, LPEnginePtr engine, HandlerVector& handlers,
+                VarVector* orig_v, PresolverPtr pres);
   int transform_(ProblemPtr& newp, HandlerVector& handlers, LPEnginePtr engine);
   void writeStatus_(BranchAndBound* bab);
+  void writeStatus_(ParBranchAndBound* parbab, double wall_start);
 };
 } // namespace Minotaur
 #endif
@@ -42,7 +42,8 @@ int main(int argc, char** argv)
 
   dname = env->getOptions()->findString("debug_sol")->getValue();
   fname = env->getOptions()->findString("problem_file")->getValue();
-  if("" == fname) {
+  if("" == fname &&
+     "" == env->getOptions()->findString("load_presolved")->getValue()) {
     glob.showHelp();
     goto CLEANUP;
   }
@@ -302,7 +302,10 @@ int QG::solve(ProblemPtr p)
 
   // get presolver.
   orig_v = new VarVector(oinst_->varsBegin(), oinst_->varsEnd());
-  pres = presolve_(handlers);
+  pres = loadPresolved_(oinst_, orig_v, &objSense_);
+  if(!pres) {
+    pres = presolve_(handlers);
+  }
   for(HandlerVector::iterator it = handlers.begin(); it != handlers.end();
       ++it) {
     delete(*it);
@@ -316,6 +319,9 @@ int QG::solve(ProblemPtr p)
     writeSol_(env_, orig_v, pres, pres->getSolution(), status_, iface_);
     goto CLEANUP;
   }
+  if(savePresolved_(oinst_, pres, orig_v, objSense_)) {
+    goto CLEANUP;
+  }
 
   // transform to exploit separability
   sepDetection();
@@ -405,6 +411,9 @@ int QG::solve(ProblemPtr p)
   bab->setNodeRelaxer(nr);
   bab->setNodeProcessor(nproc);
   bab->shouldCreateRoot(true);
+  if(raceBoard_) {
+    bab->setRaceBoard(raceBoard_, raceId_);
+  }
 
   if(env_->getOptions()->findBool("prerootheur")->getValue() == true) {
     if(env_->getOptions()->findBool("samplingheur")->getValue() == true) {
@@ -552,7 +552,11 @@ int QGPar::solve(ProblemPtr p)
   parbab = createParBab_(numThreads, node, relCopy, pCopy, nodePrcssr,
                         parNodeRlxr, solPool, handlersCopy, lpeCopy, eCopy, prune);
 
-  parbab->parsolveOppor(parNodeRlxr, nodePrcssr, numThreads, prune);
+  if (true==env_->getOptions()->findBool("bnbpar_deter_mode")->getValue()) {
+    parbab->parsolveSync(parNodeRlxr, nodePrcssr, numThreads, prune);
+  } else {
+    parbab->parsolveOppor(parNodeRlxr, nodePrcssr, numThreads, prune);
+  }
   
   
   status_ = parbab->getStatus();
@@ -709,6 +713,10 @@ void QGPar::writeParQGStats_(ParQGBranchAndBound *parbab, UInt numThreads,
       for (HandlerVector::iterator it=handlersCopy[i].begin(); it!=handlersCopy[i].end(); ++it) {
         if ((*it)->getName() == "ParQGHandlerAdvance (Quesada-Grossmann)") {
           ParQGHandlerAdvancePtr parqgHand = dynamic_cast <ParQGHandlerAdvance*> (*it);
+          env_->getLogger()->msgStream(LogExtraInfo)
+            << me_ << "thread " << i << ": nlps solved = "
+            << parqgHand->getStats()->nlpS << ", cuts added = "
+            << parqgHand->getStats()->cuts << std::endl;
           nlpSolved += parqgHand->getStats()->nlpS;
           nlpInf += parqgHand->getStats()->nlpI;
           nlpFeas += parqgHand->getStats()->nlpF;
@@ -737,6 +745,7 @@ void QGPar::writeParQGStats_(ParQGBranchAndBound *parbab, UInt numThreads,
       << numFracCuts << std::endl
       << me_ << "number of cuts added                        = "
       << numCuts << std::endl;
+    parbab->writeCutStats(env_->getLogger()->msgStream(LogInfo));
   }
 }
 
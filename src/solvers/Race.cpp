@@ -0,0 +1,484 @@
+//
+//    Minotaur -- It's only 1/2 bull
+//
+//    (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file Race.cpp
+ * \brief The Race class for solving instances in ampl format (.nl) by
+ * running several solvers at the same time.
+ * \author The Minotaur Team
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "MinotaurConfig.h"
+#include "Bnb.h"
+#include "Environment.h"
+#include "LinearHandler.h"
+#include "Logger.h"
+#include "NlPresHandler.h"
+#include "Objective.h"
+#include "Option.h"
+#include "Presolver.h"
+#include "QG.h"
+#include "Race.h"
+#include "RaceBoard.h"
+#include "Solution.h"
+
+using namespace Minotaur;
+const std::string Race::me_ = "mrace: ";
+
+// Copy options whose value in from differs from their default value.
+template <class T, class I>
+static void copyChanged(I it, I end, OptionDBPtr defaults, OptionDBPtr to,
+                        Option<T>* (OptionDB::*find)(const std::string &))
+{
+  Option<T> *d, *o;
+
+  for(; it != end; ++it) {
+    d = (defaults->*find)((*it)->getName());
+    o = (to->*find)((*it)->getName());
+    if(d && o && d->getValue() != (*it)->getValue()) {
+      o->setValue((*it)->getValue());
+    }
+  }
+}
+
+Race::Race(EnvPtr env)
+  : objSense_(1.0),
+    oinst_(0),
+    status_(NotStarted)
+{
+  env_ = env;
+  iface_ = 0;
+}
+
+Race::~Race() { }
+
+void Race::doSetup()
+{
+  setInitialOptions_();
+}
+
+std::string Race::getAbout()
+{
+  std::ostringstream ostr;
+
+  ostr << me_
+       << "Minotaur version " << env_->getVersion()
+       << std::endl
+       << me_ << "Race of solvers for convex MINLP"
+       << std::endl
+       << me_ << "Visit https://minotaur-solver.github.io/ for details"
+       << std::endl
+       << std::endl;
+  return ostr.str();
+}
+
+int Race::getRunners_(std::vector<RaceRunner*> &runners)
+{
+  std::string configs =
+      env_->getOptions()->findString("race_solvers")->getValue();
+  std::string config, name;
+  size_t start = 0, end, pos;
+  RaceRunner* r;
+  UInt n_filter = 0;
+
+  while(start < configs.size()) {
+    end = configs.find(',', start);
+    if(std::string::npos == end) {
+      end = configs.size();
+    }
+    config = configs.substr(start, end - start);
+    start = end + 1;
+    if(config.empty()) {
+      continue;
+    }
+    pos = config.find(':');
+    name = config.substr(0, pos);
+
+    r = new RaceRunner();
+    r->config = config;
+    r->env = (EnvPtr) new Environment();
+    r->p = 0;
+    r->solver = 0;
+    runners.push_back(r);
+    if("bnb" == name) {
+      Bnb* bnb = new Bnb(r->env);
+      bnb->doSetup();
+      r->solver = bnb;
+    } else if("qg" == name) {
+      QG* qg = new QG(r->env);
+      qg->doSetup();
+      r->solver = qg;
+    } else {
+      env_->getLogger()->errStream()
+          << me_ << "unknown solver \"" << name << "\" in race_solvers. "
+          << "Use bnb or qg." << std::endl;
+      return 1;
+    }
+    setRunnerOptions_(r, (std::string::npos == pos) ? "" :
+                      config.substr(pos + 1));
+
+    // filter-sqp keeps global state and can be used by one runner only.
+    if("filter-sqp" ==
+       r->env->getOptions()->findString("nlp_engine")->getValue()) {
+      if(n_filter > 0) {
+        r->env->getOptions()->findString("nlp_engine")->setValue("ipopt");
+        env_->getLogger()->msgStream(LogInfo)
+            << me_ << "using ipopt instead of filter-sqp in " << config
+            << std::endl;
+      }
+      ++n_filter;
+    }
+  }
+  if(runners.empty()) {
+    env_->getLogger()->errStream()
+        << me_ << "no solvers given in race_solvers." << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+SolveStatus Race::getStatus()
+{
+  return status_;
+}
+
+PresolverPtr Race::presolve_(HandlerVector& handlers)
+{
+  PresolverPtr pres = 0;
+
+  oinst_->calculateSize();
+  if(env_->getOptions()->findBool("presolve")->getValue() == true) {
+    LinearHandlerPtr lhandler =
+        (LinearHandlerPtr) new LinearHandler(env_, oinst_);
+    handlers.push_back(lhandler);
+    lhandler->setPreOptPurgeVars(true);
+    lhandler->setPreOptPurgeCons(true);
+    lhandler->setPreOptCoeffImp(true);
+    if(iface_ && iface_->getNumDefs() > 0) {
+      lhandler->setPreOptDualFix(false);
+    } else {
+      lhandler->setPreOptDualFix(true);
+    }
+
+    if(!oinst_->isLinear() &&
+       true == env_->getOptions()->findBool("nl_presolve")->getValue()) {
+      NlPresHandlerPtr nlhand =
+          (NlPresHandlerPtr) new NlPresHandler(env_, oinst_);
+      handlers.push_back(nlhand);
+    }
+
+    // write the names.
+    env_->getLogger()->msgStream(LogExtraInfo)
+        << me_ << "handlers used in presolve:" << std::endl;
+    for(HandlerIterator h = handlers.begin(); h != handlers.end(); ++h) {
+      env_->getLogger()->msgStream(LogExtraInfo)
+          << me_ << (*h)->getName() << std::endl;
+    }
+  }
+
+  pres = (PresolverPtr) new Presolver(oinst_, env_, handlers);
+  pres->standardize();
+  if(env_->getOptions()->findBool("presolve")->getValue() == true) {
+    pres->solve();
+  }
+
+  return pres;
+}
+
+ProblemPtr Race::readProblem(std::string fname, std::string dname,
+                             std::string sname, int &err)
+{
+  OptionDBPtr options = env_->getOptions();
+
+  if(false == options->findBool("use_native_cgraph")->getValue()) {
+    env_->getLogger()->msgStream(LogInfo)
+        << me_ << "solvers run in threads, setting use_native_cgraph to 1"
+        << std::endl;
+    options->findBool("use_native_cgraph")->setValue(true);
+  }
+  return Solver::readProblem(fname, dname, sname, err);
+}
+
+void Race::setInitialOptions_()
+{
+  OptionDBPtr options = env_->getOptions();
+  options->findString("interface_type")->setValue("ampl");
+  options->findBool("use_native_cgraph")->setValue(true);
+}
+
+void Race::setRunnerOptions_(RaceRunner* r, const std::string &opts)
+{
+  OptionDBPtr options = env_->getOptions();
+  OptionDBPtr r_options = r->env->getOptions();
+  Environment def_env;
+  OptionDBPtr defaults = def_env.getOptions();
+  std::string str;
+  double t_limit;
+
+  // options set by the user apply to all runners. The others keep the
+  // defaults of the solver of the runner.
+  copyChanged(options->boolBegin(), options->boolEnd(), defaults, r_options,
+              &OptionDB::findBool);
+  copyChanged(options->intBegin(), options->intEnd(), defaults, r_options,
+              &OptionDB::findInt);
+  copyChanged(options->dblBegin(), options->dblEnd(), defaults, r_options,
+              &OptionDB::findDouble);
+  copyChanged(options->strBegin(), options->strEnd(), defaults, r_options,
+              &OptionDB::findString);
+
+  // the race presolves, reports and writes the solution.
+  r_options->findInt("log_level")
+      ->setValue(options->findInt("race_log_level")->getValue());
+  r_options->findBool("display_problem")->setValue(false);
+  r_options->findBool("display_size")->setValue(false);
+  r_options->findBool("display_solution")->setValue(false);
+  r_options->findBool("write_sol_file")->setValue(false);
+  r_options->findString("load_presolved")->setValue("");
+  r_options->findString("save_presolved")->setValue("");
+  r_options->findString("record_file")->setValue("");
+  r_options->findString("vbc_file")->setValue("");
+  // runners check time_limit against wall time.
+  t_limit = options->findDouble("time_limit")->getValue();
+  if(t_limit < 1e20) {
+    r_options->findDouble("time_limit")
+        ->setValue(std::max(0.0, t_limit - env_->getWTime()));
+  }
+
+  // options of this runner, like brancher=maxvio:divheur=-1
+  if(!opts.empty()) {
+    str = "--" + opts;
+    for(size_t pos = str.find(':'); std::string::npos != pos;
+        pos = str.find(':', pos)) {
+      str.replace(pos, 1, " --");
+    }
+    r->env->readOptions(str);
+  }
+  r->env->setLogLevel((LogLevel)r_options->findInt("log_level")->getValue());
+}
+
+void Race::setRunnerProfiler_(RaceRunner* r, UInt i)
+{
+  OptionDBPtr r_options = r->env->getOptions();
+  std::string fname = r_options->findString("trace_file")->getValue();
+
+  // each runner writes its own trace. readOptions may already have enabled
+  // the profiler with the trace file of the race.
+  if(!fname.empty()) {
+    fname += "." + std::to_string(i);
+    r_options->findString("trace_file")->setValue(fname);
+  }
+  r->env->getProfiler()->enable(r_options->findBool("profile")->getValue(),
+                                fname);
+}
+
+void Race::showHelp() const
+{
+  env_->getLogger()->errStream()
+      << "Usage:" << std::endl
+      << "To show version: mrace -v (or --display_version yes) " << std::endl
+      << "To show all options: mrace -= (or --display_options yes)"
+      << std::endl
+      << "To solve an instance: mrace --race_solvers bnb,qg "
+      << "--option1 [value] ... .nl-file" << std::endl;
+}
+
+int Race::showInfo()
+{
+  OptionDBPtr options = env_->getOptions();
+
+  if(options->findBool("display_options")->getValue() ||
+     options->findFlag("=")->getValue()) {
+    options->write(std::cout);
+    return 1;
+  }
+
+  if(options->findBool("display_help")->getValue() ||
+     options->findFlag("?")->getValue()) {
+    showHelp();
+    return 1;
+  }
+
+  if(options->findBool("display_version")->getValue() ||
+     options->findFlag("v")->getValue()) {
+    env_->getLogger()->msgStream(LogNone) << getAbout();
+    return 1;
+  }
+
+  env_->getLogger()->msgStream(LogInfo) << getAbout();
+  return 0;
+}
+
+int Race::solve(ProblemPtr p)
+{
+  OptionDBPtr options = env_->getOptions();
+  std::vector<RaceRunner*> runners;
+  RaceBoard* board = 0;
+  PresolverPtr pres = 0;
+  VarVector* orig_v = 0;
+  HandlerVector handlers;
+  SolutionPtr sol = 0;
+  DoubleVector x;
+  double val;
+  int owner;
+  int err = 0;
+
+  oinst_ = p;
+  if(oinst_->isQuadratic() && true == options->findBool("cgtoqf")->getValue()) {
+    oinst_->cg2qf();
+  }
+  oinst_->calculateSize();
+
+  if(options->findBool("display_problem")->getValue() == true) {
+    oinst_->write(env_->getLogger()->msgStream(LogNone), 12);
+  }
+  if(options->findBool("display_size")->getValue() == true) {
+    oinst_->writeSize(env_->getLogger()->msgStream(LogNone));
+  }
+
+  if(oinst_->getObjective() &&
+     oinst_->getObjective()->getObjectiveType() == Maximize) {
+    objSense_ = -1.0;
+    env_->getLogger()->msgStream(LogInfo)
+        << me_ << "objective sense: maximize (will be converted to Minimize)"
+        << std::endl;
+  } else {
+    objSense_ = 1.0;
+    env_->getLogger()->msgStream(LogInfo)
+        << me_ << "objective sense: minimize" << std::endl;
+  }
+
+  // presolve once. Runners solve copies of the presolved problem, so that
+  // their solutions are comparable.
+  orig_v = new VarVector(oinst_->varsBegin(), oinst_->varsEnd());
+  pres = loadPresolved_(oinst_, orig_v, &objSense_);
+  if(!pres) {
+    pres = presolve_(handlers);
+  }
+  for(HandlerVector::iterator it = handlers.begin(); it != handlers.end();
+      ++it) {
+    delete(*it);
+  }
+  handlers.clear();
+
+  if(Finished != pres->getStatus() && NotStarted != pres->getStatus()) {
+    status_ = pres->getStatus();
+    env_->getLogger()->msgStream(LogInfo)
+        << me_
+        << "status of presolve: " << getSolveStatusString(status_)
+        << std::endl;
+    writeSol_(env_, orig_v, pres, pres->getSolution(), status_, iface_);
+    goto CLEANUP;
+  }
+  if(savePresolved_(oinst_, pres, orig_v, objSense_)) {
+    goto CLEANUP;
+  }
+  if(options->findBool("solve")->getValue() == false) {
+    env_->getLogger()->msgStream(LogInfo)
+        << me_ << "Solve option is set to 0, Stopping further processing."
+        << std::endl;
+    goto CLEANUP;
+  }
+
+  err = getRunners_(runners);
+  if(err) {
+    goto CLEANUP;
+  }
+
+  board = new RaceBoard(runners.size(), oinst_->getNumVars());
+  for(UInt i = 0; i < runners.size(); ++i) {
+    runners[i]->p = oinst_->clone(runners[i]->env);
+    runners[i]->solver->setPresolved(true);
+    runners[i]->solver->setRaceBoard(board, i);
+    setRunnerProfiler_(runners[i], i);
+  }
+  env_->getLogger()->msgStream(LogInfo)
+      << me_ << "racing " << runners.size() << " solvers: "
+      << options->findString("race_solvers")->getValue() << std::endl;
+  for(UInt i = 0; i < runners.size(); ++i) {
+    runners[i]->thread =
+        std::thread(&Solver::solve, runners[i]->solver, runners[i]->p);
+  }
+  for(UInt i = 0; i < runners.size(); ++i) {
+    runners[i]->thread.join();
+  }
+
+  // the winner proved its result. Without one, report the status of the
+  // runner with the best solution.
+  owner = board->getWinner();
+  if(owner < 0) {
+    owner = std::max(board->getBestOwner(), 0);
+  }
+  status_ = board->getStatus(owner);
+  if(board->getBest(INFINITY, x, val)) {
+    sol = (SolutionPtr) new Solution(val, x, oinst_);
+  }
+  writeSol_(env_, orig_v, pres, sol, status_, iface_);
+  writeRaceStatus_(board, runners);
+
+CLEANUP:
+  for(UInt i = 0; i < runners.size(); ++i) {
+    if(runners[i]->solver) {
+      delete runners[i]->solver;
+    }
+    if(runners[i]->p) {
+      delete runners[i]->p;
+    }
+    delete runners[i]->env;
+    delete runners[i];
+  }
+  runners.clear();
+  if(sol) {
+    delete sol;
+  }
+  if(board) {
+    delete board;
+  }
+  if(pres) {
+    delete pres;
+  }
+  if(orig_v) {
+    delete orig_v;
+  }
+  oinst_ = 0;
+  return err;
+}
+
+void Race::writeRaceStatus_(RaceBoard* board,
+                            const std::vector<RaceRunner*> &runners)
+{
+  LoggerPtr logger = env_->getLogger();
+  int winner = board->getWinner();
+  int owner = board->getBestOwner();
+
+  for(UInt i = 0; i < runners.size(); ++i) {
+    logger->msgStream(LogInfo)
+        << me_ << "solver " << i << " (" << runners[i]->config
+        << "): status = " << getSolveStatusString(board->getStatus(i))
+        << ", better solutions = " << board->getNumPosted(i) << std::endl;
+  }
+  logger->msgStream(LogInfo)
+      << me_ << "winner = "
+      << ((winner < 0) ? "none" : runners[winner]->config) << std::endl
+      << me_ << "best solution found by = "
+      << ((owner < 0) ? "none" : runners[owner]->config) << std::endl
+      << me_ << std::fixed << std::setprecision(4)
+      << "best solution value = " << objSense_ * board->getBestValue()
+      << std::endl
+      << me_ << "cpu time used (s) = " << std::fixed << std::setprecision(2)
+      << env_->getTime() << std::endl
+      << me_ << "wall time used (s) = " << std::fixed << std::setprecision(2)
+      << env_->getWTime() << std::endl
+      << me_ << "status of race = " << getSolveStatusString(status_)
+      << std::endl;
+}
+
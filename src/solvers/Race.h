@@ -0,0 +1,99 @@
+//
+// Minotaur -- It's only half bull!
+//
+// (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file Race.h
+ * \brief Define the Race class for running several solvers at the same time
+ * on one instance.
+ * \author The Minotaur Team
+ */
+
+#ifndef RACE_H
+#define RACE_H
+
+#include <thread>
+
+#include "Types.h"
+#include "Presolver.h"
+#include "Problem.h"
+#include "Solver.h"
+
+namespace Minotaur {
+class RaceBoard;
+
+/// A solver with its own environment and copy of the problem.
+struct RaceRunner {
+  std::string config;   ///> Configuration as given in race_solvers.
+  EnvPtr env;           ///> Environment with the options of this runner.
+  ProblemPtr p;         ///> Copy of the presolved problem.
+  Solver *solver;       ///> Bnb or QG.
+  std::thread thread;   ///> Thread in which solver runs.
+};
+
+/**
+ * The Race class presolves a convex MINLP instance once and then solves it
+ * with several solvers at the same time, each in its own thread and with
+ * its own copy of the presolved problem. The solvers share their best
+ * solutions through a RaceBoard, and all stop as soon as one of them
+ * finishes the search. Option time_limit is in wall time for the race and
+ * for each runner. With option profile, runner i writes its trace to
+ * trace_file.i.
+ */
+class Race : public Solver {
+public:
+  /// Default constructor.
+  Race(EnvPtr env);
+
+  /// Destroy.
+  ~Race();
+
+  void doSetup();
+
+  /// show help messages
+  void showHelp() const;
+
+  /// Display information
+  int showInfo();
+
+  /**
+   * Read the instance. Runners evaluate functions in threads, which
+   * derivatives from AMPL can not do, so option use_native_cgraph is set
+   * first.
+   */
+  virtual ProblemPtr readProblem(std::string fname, std::string dname,
+                                 std::string sname, int &err);
+
+  /// Solve the problem
+  virtual int solve(ProblemPtr p);
+
+  virtual std::string getAbout();
+
+  /// get status of the last solve.
+  virtual SolveStatus getStatus();
+
+private:
+  const static std::string me_;
+  double objSense_;
+  ProblemPtr oinst_;
+  SolveStatus status_;
+
+  /**
+   * Create one runner for each configuration in option race_solvers.
+   * Returns nonzero if a configuration is not understood.
+   */
+  int getRunners_(std::vector<RaceRunner*> &runners);
+  PresolverPtr presolve_(HandlerVector &handlers);
+  void setInitialOptions_();
+  void setRunnerOptions_(RaceRunner *r, const std::string &opts);
+
+  /// Enable the profiler of runner number i if option profile is set.
+  void setRunnerProfiler_(RaceRunner *r, UInt i);
+  void writeRaceStatus_(RaceBoard *board,
+                        const std::vector<RaceRunner*> &runners);
+};
+}
+#endif
+
@@ -0,0 +1,65 @@
+//
+//    Minotaur -- It's only 1/2 bull
+//
+//    (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file RaceMain.cpp
+ * \brief The main function for solving instances by racing several solvers.
+ * \author The Minotaur Team
+ */
+
+#include "MinotaurConfig.h"
+#include "Race.h"
+#include "Problem.h"
+#include "Types.h"
+
+using namespace Minotaur;
+
+
+int main(int argc, char** argv)
+{
+  EnvPtr env      = (EnvPtr) new Environment();
+  Race race(env);
+  int err = 0;
+  std::string dname, fname;
+  ProblemPtr p = 0;
+ 
+  race.doSetup();
+
+  // Parse command line for options set by the user.
+  env->readOptions(argc, argv);
+  
+  if (0!=race.showInfo()) {
+    goto CLEANUP;
+  }
+
+  dname = env->getOptions()->findString("debug_sol")->getValue();
+  fname = env->getOptions()->findString("problem_file")->getValue();
+  if (""==fname &&
+      ""==env->getOptions()->findString("load_presolved")->getValue()) {
+    race.showHelp();
+    goto CLEANUP;
+  }
+
+  p = race.readProblem(fname, dname, "mrace", err);
+  if (err) {
+    goto CLEANUP;
+  }
+
+  err = race.solve(p);
+  if (err) {
+    goto CLEANUP;
+  }
+
+CLEANUP:
+  if (p) {
+    delete p;
+  }
+  delete env;
+
+  return 0;
+}
+
+
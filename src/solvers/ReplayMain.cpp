@@ -0,0 +1,131 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2008 - 2025 The Minotaur Team.
+//
+
+/**
+ * \file ReplayMain.cpp
+ * \brief The main function for solving again, with any engine, the node
+ * relaxations recorded by branch-and-bound with option record_file.
+ * \author The Minotaur Team
+ */
+
+#include <iostream>
+
+#include "MinotaurConfig.h"
+#include "Engine.h"
+#include "EngineFactory.h"
+#include "Environment.h"
+#include "Logger.h"
+#include "NodeRecorder.h"
+#include "Option.h"
+#include "Types.h"
+
+#ifdef USE_CPX
+#include "CplexLPEngine.h"
+#endif
+
+#ifdef USE_IPOPT
+#include "IpoptEngine.h"
+#endif
+
+#ifdef USE_OSILP
+#include "OsiLPEngine.h"
+#endif
+
+using namespace Minotaur;
+
+
+int main(int argc, char** argv)
+{
+  EnvPtr env = (EnvPtr) new Environment();
+  EngineFactory efac(env);
+  EnginePtr engine = 0;
+  NodeReplayer *replayer = 0;
+  std::string fname, etype;
+  UInt num_stats = 0;
+  int iter_ind = -1;
+  int err = 0;
+
+  // Parse command line for options set by the user.
+  env->readOptions(argc, argv);
+
+  fname = env->getOptions()->findString("problem_file")->getValue();
+  if ("" == fname) {
+    env->getLogger()->errStream()
+      << std::endl
+      << "Solve again the node relaxations recorded by branch-and-bound"
+      << std::endl
+      << "Usage:" << std::endl
+      << "mreplay [option] record_file [options]" << std::endl
+      << "Option replay_engine selects the engine: lp, qp or nlp."
+      << std::endl;
+    err = 1;
+    goto CLEANUP;
+  }
+
+  etype = env->getOptions()->findString("replay_engine")->getValue();
+  if ("lp" == etype) {
+    engine = efac.getLPEngine();
+  } else if ("qp" == etype) {
+    engine = efac.getQPEngine();
+  } else if ("nlp" == etype) {
+    engine = efac.getNLPEngine();
+  }
+
+  // layout of the vector filled by fillStats(), for counting iterations.
+#ifdef USE_CPX
+  if (engine && "CplexLP" == engine->getName()) {
+    num_stats = CplexLPEngine::numStats;
+    iter_ind = CplexLPEngine::itersStat;
+  }
+#endif
+#ifdef USE_IPOPT
+  if (engine && "ipopt" == engine->getName()) {
+    num_stats = IpoptEngine::numStats;
+    iter_ind = IpoptEngine::itersStat;
+  }
+#endif
+#ifdef USE_OSILP
+  if (engine && "OsiLP" == engine->getName()) {
+    num_stats = OsiLPEngine::numStats;
+    iter_ind = OsiLPEngine::itersStat;
+  }
+#endif
+  if (!engine) {
+    env->getLogger()->errStream() << "mreplay: no engine of type " << etype
+                                  << " available" << std::endl;
+    err = 1;
+    goto CLEANUP;
+  }
+  env->getLogger()->msgStream(LogInfo) << "mreplay: using engine "
+                                       << engine->getName() << std::endl;
+
+  replayer = new NodeReplayer(env);
+  err = replayer->replay(fname, engine, num_stats, iter_ind);
+  replayer->writeStats(env->getLogger()->msgStream(LogInfo));
+
+CLEANUP:
+  if (replayer) {
+    delete replayer;
+  }
+  if (engine) {
+    delete engine;
+  }
+  delete env;
+
+  return err;
+}
+
+
+// Local Variables:
+// mode: c++
+// eval: (c-set-style "k&r")
+// eval: (c-set-offset 'innamespace 0)
+// eval: (setq c-basic-offset 2)
+// eval: (setq fill-column 78)
+// eval: (auto-fill-mode 1)
+// eval: (setq column-number-mode 1)
+// eval: (setq indent-tabs-mode nil)
+// End:
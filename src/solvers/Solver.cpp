@@ -16,6 +16,7 @@
 #include "Logger.h"
 #include "Option.h"
 #include "Problem.h"
+#include "ProbSnapshot.h"
 #include "Reader.h"
 #include "Solver.h"
 #include "Solution.h"
@@ -27,7 +28,11 @@ const std::string Solver::me_ = "Solver: ";
 Solver::Solver()
 : env_(0),
   iface_(0),
-  ownIface_(true)
+  ownIface_(true),
+  presolved_(false),
+  raceBoard_(0),
+  raceId_(0),
+  snap_(0)
 {
 }
 
@@ -37,6 +42,9 @@ Solver::~Solver()
   if (iface_ && ownIface_) {
     delete iface_;
   }
+  if (snap_) {
+    delete snap_;
+  }
 }
 
 
@@ -44,9 +52,17 @@ FileType Solver::getFileType(std::string fname)
 {
   FileType ft = FileTypeNone;
   size_t pos = fname.find_last_of('.');
-
+  size_t len = std::string::npos;
+
+  // look at the extension before .gz for compressed files
+  if (pos != std::string::npos && pos > 0 && (fname.substr(pos) == ".gz" ||
+                                              fname.substr(pos) == ".GZ")) {
+    len = pos;
+    pos = fname.find_last_of('.', pos - 1);
+    len -= pos;
+  }
   if (pos != std::string::npos) {
-    std::string ext = fname.substr(pos);
+    std::string ext = fname.substr(pos, len);
     for (size_t i=0; i<ext.length(); ++i) {
       ext[i] = std::toupper(ext[i]);
     }
@@ -71,6 +87,21 @@ ProblemPtr Solver::readProblem(std::string fname, std::string dname,
 
   err = 0;
   tstrt = env_->getTime();
+  if (!options->findString("load_presolved")->getValue().empty()) {
+    fname = options->findString("load_presolved")->getValue();
+    snap_ = new ProbSnapshot(env_);
+    p = snap_->read(fname, err);
+    if (err) {
+      return 0;
+    }
+    // snapshots store nonlinear functions as computational graphs only.
+    options->findBool("use_native_cgraph")->setValue(true);
+    env_->getLogger()->msgStream(LogInfo) << me_ 
+      << "time used in loading presolved problem = " << std::fixed 
+      << std::setprecision(2) << env_->getTime()-tstrt << std::endl;
+    return p;
+  }
+
   ft = getFileType(fname);
 
   if (ft==MPS) {
@@ -79,6 +110,9 @@ ProblemPtr Solver::readProblem(std::string fname, std::string dname,
     if (err) {
       return 0;
     }
+    env_->getLogger()->msgStream(LogInfo) << me_ 
+      << "time used in reading instance = " << std::fixed 
+      << std::setprecision(2) << env_->getTime()-tstrt << std::endl;
   } else if ((ft==NL) || 
              options->findFlag("ampl")->getValue()==1 ||
              options->findString("interface_type")->getValue()=="ampl") {
@@ -104,6 +138,44 @@ ProblemPtr Solver::readProblem(std::string fname, std::string dname,
 }
 
 
+PresolverPtr Solver::loadPresolved_(ProblemPtr p, VarVector *orig_v,
+                                    double *obj_sense)
+{
+  if (presolved_) {
+    return (PresolverPtr) new Presolver(p, env_, HandlerVector());
+  }
+  if (!snap_) {
+    return 0;
+  }
+  orig_v->assign(snap_->getOrigVars()->begin(), snap_->getOrigVars()->end());
+  *obj_sense = snap_->getObjSense();
+  return snap_->getPresolver(p);
+}
+
+
+int Solver::savePresolved_(ProblemPtr p, PresolverPtr pres, VarVector *orig_v,
+                           double obj_sense)
+{
+  std::string fname;
+  double tstrt = env_->getTime();
+  int err = 0;
+
+  fname = env_->getOptions()->findString("save_presolved")->getValue();
+  if (fname.empty()) {
+    return 0;
+  }
+
+  ProbSnapshot snap(env_);
+  err = snap.write(p, pres, orig_v, obj_sense, fname);
+  if (0 == err) {
+    env_->getLogger()->msgStream(LogInfo) << me_ 
+      << "presolved problem saved to " << fname << " in " << std::fixed 
+      << std::setprecision(2) << env_->getTime()-tstrt << " s" << std::endl;
+  }
+  return err;
+}
+
+
 void Solver::setIface(MINOTAUR_AMPL::AMPLInterface* iface)
 {
   iface_ = iface;
@@ -111,6 +183,13 @@ void Solver::setIface(MINOTAUR_AMPL::AMPLInterface* iface)
 }
 
 
+void Solver::setRaceBoard(RaceBoard *board, UInt id)
+{
+  raceBoard_ = board;
+  raceId_ = id;
+}
+
+
 int Solver::writeSol_(EnvPtr env, VarVector *orig_v, PresolverPtr pres,
                       SolutionPtr sol, SolveStatus status,
                       MINOTAUR_AMPL::AMPLInterface* iface)
@@ -122,8 +201,8 @@ int Solver::writeSol_(EnvPtr env, VarVector *orig_v, PresolverPtr pres,
     final_sol = pres->getPostSol(sol);
   }
 
-  if (env->getOptions()->findFlag("ampl")->getValue() ||
-      true == env->getOptions()->findBool("write_sol_file")->getValue()) {
+  if (iface && (env->getOptions()->findFlag("ampl")->getValue() ||
+      true == env->getOptions()->findBool("write_sol_file")->getValue())) {
     iface->writeSolution(final_sol, status);
   } 
   
@@ -20,6 +20,9 @@
 #include "Presolver.h"
 
 namespace Minotaur {
+  class ProbSnapshot;
+  class RaceBoard;
+
   /**
    * The Solver base class has methods common for solvers: reading instances,
    * writing files, etc. Solvers like QG, BnB, Glob etc must be derived from
@@ -36,6 +39,11 @@ namespace Minotaur {
     /// Helper function to determin file type (mps, nl etc)
     virtual FileType getFileType(std::string fname);
 
+    /**
+     * \brief Read the instance from a file. If option load_presolved is
+     * set, the presolved problem is loaded from that snapshot instead and
+     * fname is ignored.
+     */
     virtual ProblemPtr readProblem(std::string fname, std::string dname,
                                    std::string sname, int &err);
 
@@ -47,6 +55,18 @@ namespace Minotaur {
 
     void setIface(MINOTAUR_AMPL::AMPLInterface* iface);
 
+    /**
+     * \brief Tell the solver that the problem given to solve() is already
+     * presolved, so that it is solved as it is.
+     */
+    void setPresolved(bool b) { presolved_ = b; };
+
+    /**
+     * \brief Run branch-and-bound as runner id of a race, sharing solutions
+     * through board. The board is not owned.
+     */
+    void setRaceBoard(RaceBoard *board, UInt id);
+
 
   protected:
     EnvPtr env_;
@@ -56,6 +76,35 @@ namespace Minotaur {
     /// calling function.
     bool ownIface_;
 
+    /// True if the problem is already presolved.
+    bool presolved_;
+
+    /// Board of the race this solver runs in. NULL if not racing.
+    RaceBoard *raceBoard_;
+
+    /// Number of this solver on raceBoard_.
+    UInt raceId_;
+
+    /// Snapshot from which the problem was loaded. NULL if none.
+    ProbSnapshot *snap_;
+
+    /**
+     * \brief If the problem was loaded from a snapshot, return a Presolver
+     * with the saved postsolve modifications, copy the original variables
+     * into orig_v and set the original objective sense. If the problem is
+     * already presolved, return a Presolver that does not change anything.
+     * Otherwise return NULL and leave everything unchanged.
+     */
+    PresolverPtr loadPresolved_(ProblemPtr p, VarVector *orig_v,
+                                double *obj_sense);
+
+    /**
+     * \brief Write a snapshot of the presolved problem p if option
+     * save_presolved is set. Returns nonzero on error.
+     */
+    int savePresolved_(ProblemPtr p, PresolverPtr pres, VarVector *orig_v,
+                       double obj_sense);
+
     virtual int writeSol_(EnvPtr env, VarVector *orig_v, PresolverPtr pres,
                           SolutionPtr sol, SolveStatus status,
                           MINOTAUR_AMPL::AMPLInterface* iface);
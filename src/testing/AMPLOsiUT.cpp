@@ -9,7 +9,9 @@
 #include "BranchAndBound.h"
 #include "EngineFactory.h"
 #include "Environment.h"
+#include "Function.h"
 #include "IntVarHandler.h"
+#include "LinearFunction.h"
 #include "LinearHandler.h"
 #include "PCBProcessor.h"
 #include "NodeIncRelaxer.h"
@@ -17,6 +19,7 @@
 #include "Option.h"
 #include "Problem.h"
 #include "ReliabilityBrancher.h"
+#include "Solution.h"
 #include "AMPLInterface.h"
 #include <cmath>
 
@@ -120,6 +123,102 @@ void AMPLOsiUT::testOsiWarmStart()
 }
 
 
+void AMPLOsiUT::testOsiRowAge()
+{
+  EnvPtr env = (EnvPtr) new Environment();
+  ProblemPtr p = (ProblemPtr) new Problem(env);
+  VariablePtr x0, x1;
+  ConstraintPtr c1, c2, c3;
+  LinearFunctionPtr lf;
+  OsiLPEnginePtr e;
+  WarmStartPtr ws;
+  const double *duals;
+
+  // rows not binding in one solve are removed before the next.
+  env->setLogLevel(LogNone);
+  env->getOptions()->findInt("lp_row_age")->setValue(1);
+  e = (OsiLPEnginePtr) new OsiLPEngine(env);
+
+  // min -x0 - 2x1 s.t. x0 + x1 <= 10.
+  x0 = p->newVariable(0.0, 10.0, Continuous);
+  x1 = p->newVariable(0.0, 10.0, Continuous);
+  lf = (LinearFunctionPtr) new LinearFunction();
+  lf->addTerm(x0, 1.0);
+  lf->addTerm(x1, 1.0);
+  p->newConstraint((FunctionPtr) new Function(lf), -INFINITY, 10.0);
+  lf = (LinearFunctionPtr) new LinearFunction();
+  lf->addTerm(x0, -1.0);
+  lf->addTerm(x1, -2.0);
+  p->newObjective((FunctionPtr) new Function(lf), 0.0, Minimize);
+  e->load(p);
+  CPPUNIT_ASSERT(ProvenOptimal == e->solve());
+  CPPUNIT_ASSERT(fabs(e->getSolutionValue() + 20.0) < 1e-6);
+
+  // cuts x0 <= 5, slack, and x1 <= 9, binding.
+  lf = (LinearFunctionPtr) new LinearFunction();
+  lf->addTerm(x0, 1.0);
+  c1 = p->newConstraint((FunctionPtr) new Function(lf), -INFINITY, 5.0);
+  lf = (LinearFunctionPtr) new LinearFunction();
+  lf->addTerm(x1, 1.0);
+  c2 = p->newConstraint((FunctionPtr) new Function(lf), -INFINITY, 9.0);
+  CPPUNIT_ASSERT(ProvenOptimal == e->solve());
+  CPPUNIT_ASSERT(fabs(e->getSolutionValue() + 19.0) < 1e-6);
+  ws = e->getWarmStartCopy();
+
+  // x0 <= 5 ages out. Duals stay in the order of the constraints.
+  CPPUNIT_ASSERT(ProvenOptimal == e->solve());
+  CPPUNIT_ASSERT(2 == e->getNumRows());
+  CPPUNIT_ASSERT(fabs(e->getSolutionValue() + 19.0) < 1e-6);
+  duals = e->getSolution()->getDualOfCons();
+  CPPUNIT_ASSERT(fabs(duals[0] + 1.0) < 1e-6);
+  CPPUNIT_ASSERT(fabs(duals[1]) < 1e-6);
+  CPPUNIT_ASSERT(fabs(duals[2] + 1.0) < 1e-6);
+
+  // the basis saved before aging still fits the rows.
+  e->loadFromWarmStart(ws);
+  CPPUNIT_ASSERT(ProvenOptimal == e->solve());
+  CPPUNIT_ASSERT(fabs(e->getSolutionValue() + 19.0) < 1e-6);
+  CPPUNIT_ASSERT(0 == e->getIterationCount());
+  delete ws;
+
+  // x1 <= 2 makes the solution violate x0 <= 5, which comes back. The
+  // value is the same as without aging.
+  p->changeBound(c2, Upper, 2.0);
+  CPPUNIT_ASSERT(ProvenOptimal == e->solve());
+  CPPUNIT_ASSERT(3 == e->getNumRows());
+  CPPUNIT_ASSERT(fabs(e->getSolutionValue() + 9.0) < 1e-6);
+  CPPUNIT_ASSERT(fabs(e->getSolution()->getPrimal()[0] - 5.0) < 1e-6);
+
+  // x0 + x1 <= 9 ages out, x0 >= 1 is pending, and x0 <= 5 is in the
+  // solver when the first two and x0 <= 5 are deleted.
+  lf = (LinearFunctionPtr) new LinearFunction();
+  lf->addTerm(x0, 1.0);
+  lf->addTerm(x1, 1.0);
+  c3 = p->newConstraint((FunctionPtr) new Function(lf), -INFINITY, 9.0);
+  CPPUNIT_ASSERT(ProvenOptimal == e->solve());
+  CPPUNIT_ASSERT(ProvenOptimal == e->solve());
+  CPPUNIT_ASSERT(3 == e->getNumRows());
+  lf = (LinearFunctionPtr) new LinearFunction();
+  lf->addTerm(x0, 1.0);
+  p->newConstraint((FunctionPtr) new Function(lf), 1.0, INFINITY);
+  p->markDelete(c1);
+  p->markDelete(c3);
+  p->delMarkedCons();
+  CPPUNIT_ASSERT(3 == p->getNumCons());
+  CPPUNIT_ASSERT(ProvenOptimal == e->solve());
+  CPPUNIT_ASSERT(3 == e->getNumRows());
+  CPPUNIT_ASSERT(fabs(e->getSolutionValue() + 12.0) < 1e-6);
+  duals = e->getSolution()->getDualOfCons();
+  CPPUNIT_ASSERT(fabs(duals[0] + 1.0) < 1e-6);
+  CPPUNIT_ASSERT(fabs(duals[1] + 1.0) < 1e-6);
+  CPPUNIT_ASSERT(fabs(duals[2]) < 1e-6);
+
+  delete e;
+  delete p;
+  delete env;
+}
+
+
 void AMPLOsiUT::testOsiBnB()
 {
   EnvPtr env = (EnvPtr) new Environment();
@@ -29,6 +29,7 @@ public:
   void testOsiLP();
   void testOsiLP2();
   void testOsiWarmStart();
+  void testOsiRowAge();
   void testOsiBnB();
   void setUp();
   void tearDown();
@@ -37,6 +38,7 @@ public:
   CPPUNIT_TEST(testOsiLP);
   CPPUNIT_TEST(testOsiLP2);
   CPPUNIT_TEST(testOsiWarmStart);
+  CPPUNIT_TEST(testOsiRowAge);
   CPPUNIT_TEST(testOsiBnB);
   CPPUNIT_TEST_SUITE_END();
 
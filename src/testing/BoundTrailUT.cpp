@@ -0,0 +1,122 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#include "MinotaurConfig.h"
+#include "BoundTrail.h"
+#include "BoundTrailUT.h"
+#include "Environment.h"
+#include "Problem.h"
+#include "Variable.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION(BoundTrailUT);
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(BoundTrailUT, "BoundTrailUT");
+
+using namespace Minotaur;
+
+
+void BoundTrailUT::setUp()
+{
+  env_ = new Environment();
+  p_ = new Problem(env_);
+  p_->newVariable(0.0, 1.0, Binary);
+  p_->newVariable(0.0, 10.0, Integer);
+  p_->newVariable(-5.0, 5.0, Continuous);
+}
+
+
+void BoundTrailUT::tearDown()
+{
+  delete p_;
+  delete env_;
+}
+
+
+void BoundTrailUT::testUndo()
+{
+  BoundTrail trail(p_);
+  VariablePtr x0 = p_->getVariable(0);
+  VariablePtr x1 = p_->getVariable(1);
+  VariablePtr x2 = p_->getVariable(2);
+
+  CPPUNIT_ASSERT(p_->getBoundTrail() == &trail);
+  CPPUNIT_ASSERT(0 == trail.getNumChanges());
+
+  // every change is recorded, also repeated changes of one variable.
+  p_->changeBound(x0, Lower, 1.0);
+  p_->changeBound(x1, Upper, 7.0);
+  p_->changeBound(x1, Lower, 3.0);
+  p_->changeBound(x2, -1.0, 1.0);
+  p_->changeBoundByInd(1, Upper, 4.0);
+  CPPUNIT_ASSERT(5 == trail.getNumChanges());
+
+  trail.undo();
+  CPPUNIT_ASSERT(0 == trail.getNumChanges());
+  CPPUNIT_ASSERT(0.0 == x0->getLb() && 1.0 == x0->getUb());
+  CPPUNIT_ASSERT(0.0 == x1->getLb() && 10.0 == x1->getUb());
+  CPPUNIT_ASSERT(-5.0 == x2->getLb() && 5.0 == x2->getUb());
+
+  // nothing to undo.
+  trail.undo();
+  CPPUNIT_ASSERT(0.0 == x1->getLb() && 10.0 == x1->getUb());
+}
+
+
+void BoundTrailUT::testMarks()
+{
+  BoundTrail trail(p_);
+  VariablePtr x1 = p_->getVariable(1);
+  VariablePtr x2 = p_->getVariable(2);
+  UInt m1, m2;
+
+  p_->changeBound(x1, Upper, 8.0);
+  m1 = trail.getMark();
+  p_->changeBound(x1, Upper, 6.0);
+  p_->changeBound(x2, Lower, 0.0);
+  m2 = trail.getMark();
+  CPPUNIT_ASSERT(2 == trail.getNumChanges(m1));
+  p_->changeBound(x1, Lower, 2.0);
+  p_->changeBound(x1, Upper, 3.0);
+  p_->changeBound(x2, Upper, 1.0);
+
+  // back to the bounds at m2.
+  trail.undo(m2);
+  CPPUNIT_ASSERT(m2 == trail.getMark());
+  CPPUNIT_ASSERT(0.0 == x1->getLb() && 6.0 == x1->getUb());
+  CPPUNIT_ASSERT(0.0 == x2->getLb() && 5.0 == x2->getUb());
+
+  // a later dive from m2, undone again.
+  p_->changeBound(x2, Upper, 0.5);
+  trail.undo(m2);
+  CPPUNIT_ASSERT(0.0 == x2->getLb() && 5.0 == x2->getUb());
+
+  trail.undo(m1);
+  CPPUNIT_ASSERT(0.0 == x1->getLb() && 8.0 == x1->getUb());
+  CPPUNIT_ASSERT(-5.0 == x2->getLb() && 5.0 == x2->getUb());
+  CPPUNIT_ASSERT(1 == trail.getNumChanges());
+
+  trail.undo();
+  CPPUNIT_ASSERT(10.0 == x1->getUb());
+}
+
+
+void BoundTrailUT::testDetach()
+{
+  BoundTrail *trail = new BoundTrail(p_);
+  VariablePtr x1 = p_->getVariable(1);
+
+  p_->changeBound(x1, Upper, 5.0);
+  delete trail;
+  CPPUNIT_ASSERT(0 == p_->getBoundTrail());
+
+  // not recorded anywhere.
+  p_->changeBound(x1, Upper, 4.0);
+  trail = new BoundTrail(p_);
+  CPPUNIT_ASSERT(0 == trail->getNumChanges());
+  p_->changeBound(x1, Upper, 2.0);
+  trail->undo();
+  CPPUNIT_ASSERT(4.0 == x1->getUb());
+  delete trail;
+}
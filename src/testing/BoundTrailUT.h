@@ -0,0 +1,43 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#ifndef BOUNDTRAILUT_H
+#define BOUNDTRAILUT_H
+
+#include <cppunit/TestCase.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Types.h"
+
+using namespace Minotaur;
+
+// Record bound changes of a problem and undo them back to marks.
+class BoundTrailUT : public CppUnit::TestCase {
+  public:
+    BoundTrailUT(std::string name) : TestCase(name) {}
+    BoundTrailUT() {}
+
+    void setUp();
+    void tearDown();
+    void testUndo();
+    void testMarks();
+    void testDetach();
+
+    CPPUNIT_TEST_SUITE(BoundTrailUT);
+    CPPUNIT_TEST(testUndo);
+    CPPUNIT_TEST(testMarks);
+    CPPUNIT_TEST(testDetach);
+    CPPUNIT_TEST_SUITE_END();
+
+  private:
+    EnvPtr env_;
+    ProblemPtr p_;
+};
+
+#endif
@@ -140,6 +140,52 @@ void CGraphUT::testLin()
 }
 
 
+void CGraphUT::testPropMult()
+{
+  VariablePtr v0 = new Variable(0, 0, 0.0, 10.0, Continuous, "x0");
+  VariablePtr v1 = new Variable(1, 1, 0.0, 10.0, Continuous, "x1");
+  CGraphPtr cg = (CGraphPtr) new CGraph();
+  CNode *n0, *n1, *n2;
+  bool is_inf = false;
+  int err = 0;
+
+  // x0*x1 = 0 holds at (0, 5) and (5, 0): neither factor is fixed.
+  n0 = cg->newNode(v0);
+  n1 = cg->newNode(v1);
+  n2 = cg->newNode(OpMult, n0, n1);
+  cg->setOut(n2);
+  cg->finalize();
+  n0->setBounds(0.0, 10.0);
+  n1->setBounds(0.0, 10.0);
+  n2->setBounds(0.0, 0.0);
+  n2->propBounds(&is_inf, &err);
+  CPPUNIT_ASSERT(false == is_inf);
+  CPPUNIT_ASSERT(0 == err);
+  CPPUNIT_ASSERT(0.0 == n0->getLb() && 10.0 == n0->getUb());
+  CPPUNIT_ASSERT(0.0 == n1->getLb() && 10.0 == n1->getUb());
+  delete cg;
+
+  // x0/x1 in [0, 5] with x0 = 0 holds for any x1 in [1, 10].
+  cg = (CGraphPtr) new CGraph();
+  n0 = cg->newNode(v0);
+  n1 = cg->newNode(v1);
+  n2 = cg->newNode(OpDiv, n0, n1);
+  cg->setOut(n2);
+  cg->finalize();
+  n0->setBounds(0.0, 0.0);
+  n1->setBounds(1.0, 10.0);
+  n2->setBounds(0.0, 5.0);
+  n2->propBounds(&is_inf, &err);
+  CPPUNIT_ASSERT(false == is_inf);
+  CPPUNIT_ASSERT(0 == err);
+  CPPUNIT_ASSERT(1.0 == n1->getLb() && 10.0 == n1->getUb());
+  delete cg;
+
+  delete v1;
+  delete v0;
+}
+
+
 void CGraphUT::testQuad()
 {
 
@@ -26,11 +26,13 @@ public:
   void tearDown() { }   // need not implement
   void testIdentical();
   void testLin();
+  void testPropMult();
   void testQuad();
 
   CPPUNIT_TEST_SUITE(CGraphUT);
   CPPUNIT_TEST(testIdentical);
   CPPUNIT_TEST(testLin);
+  CPPUNIT_TEST(testPropMult);
   CPPUNIT_TEST(testQuad);
   CPPUNIT_TEST_SUITE_END();
 
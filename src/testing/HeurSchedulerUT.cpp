@@ -0,0 +1,158 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#include "MinotaurConfig.h"
+#include "Environment.h"
+#include "HeurScheduler.h"
+#include "HeurSchedulerUT.h"
+#include "Node.h"
+#include "Option.h"
+#include "Solution.h"
+#include "SolutionPool.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION(HeurSchedulerUT);
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(HeurSchedulerUT, "HeurSchedulerUT");
+
+using namespace Minotaur;
+
+
+void HeurSchedulerUT::setUp()
+{
+  env_ = new Environment();
+  p_ = new Problem(env_);
+  p_->newVariable(0.0, 1.0, Continuous);
+}
+
+
+void HeurSchedulerUT::tearDown()
+{
+  delete p_;
+  delete env_;
+}
+
+
+void HeurSchedulerUT::testBudget()
+{
+  SolutionPool pool(env_, p_, 1);
+  CountHeur h0(env_, 0.05, false), h1(env_, 0.0, false), h2(env_, 0.0, false);
+  HeurScheduler *sched;
+  NodePtr root = (NodePtr) new Node();
+
+  // h0 takes all the time, and the others must wait for the solver.
+  env_->getOptions()->findDouble("heur_time_pct")->setValue(10.0);
+  sched = new HeurScheduler(env_);
+  sched->addHeur(&h0);
+  sched->addHeur(&h1);
+  sched->addHeur(&h2);
+  sched->solve(0, 0, &pool);
+  CPPUNIT_ASSERT(1 == h0.calls);
+  CPPUNIT_ASSERT(0 == h1.calls);
+  CPPUNIT_ASSERT(0 == h2.calls);
+  sched->solveNode(0, root, 0, &pool);
+  CPPUNIT_ASSERT(1 == h0.calls);
+  CPPUNIT_ASSERT(0 == h1.calls);
+  CPPUNIT_ASSERT(0 == h2.calls);
+  delete sched;
+
+  // no budget: all are called, since none finds a solution.
+  env_->getOptions()->findDouble("heur_time_pct")->setValue(100.0);
+  sched = new HeurScheduler(env_);
+  sched->addHeur(&h0);
+  sched->addHeur(&h1);
+  sched->addHeur(&h2);
+  sched->solve(0, 0, &pool);
+  CPPUNIT_ASSERT(2 == h0.calls);
+  CPPUNIT_ASSERT(1 == h1.calls);
+  CPPUNIT_ASSERT(1 == h2.calls);
+  delete sched;
+  delete root;
+}
+
+
+void HeurSchedulerUT::testNodeChoice()
+{
+  SolutionPool pool(env_, p_, 1);
+  CountHeur bad(env_, 0.0, false), good(env_, 0.0, true);
+  HeurScheduler *sched;
+  NodePtr root = (NodePtr) new Node();
+  NodePtr child = (NodePtr) new Node(root, 0);
+  double x[1] = {0.5};
+  Solution sol(0.0, x, p_);
+
+  env_->getOptions()->findDouble("heur_time_pct")->setValue(100.0);
+  sched = new HeurScheduler(env_);
+  sched->addHeur(&bad);
+  sched->addHeur(&good);
+
+  // both are tried at the root, in the order they were added.
+  sched->solveNode(&sol, root, 0, &pool);
+  CPPUNIT_ASSERT(1 == bad.calls);
+  CPPUNIT_ASSERT(1 == good.calls);
+
+  // one at a time below the root, mostly the one that improves.
+  for (UInt i=0; i<40; ++i) {
+    sched->solveNode(&sol, child, 0, &pool);
+  }
+  CPPUNIT_ASSERT(42 >= bad.calls + good.calls);
+  CPPUNIT_ASSERT(good.calls > 3*bad.calls);
+  delete sched;
+  delete child;
+  delete root;
+}
+
+
+void HeurSchedulerUT::testShared()
+{
+  SolutionPool pool(env_, p_, 1);
+  CountHeur pre(env_, 0.05, false), at_node(env_, 0.0, false);
+  HeurScheduler *bab_sched, *node_sched;
+  NodePtr root = (NodePtr) new Node();
+
+  // time spent before the root counts against the heuristics at nodes.
+  env_->getOptions()->findDouble("heur_time_pct")->setValue(10.0);
+  bab_sched = new HeurScheduler(env_);
+  node_sched = new HeurScheduler(env_);
+  node_sched->shareBudget(bab_sched);
+  bab_sched->addHeur(&pre);
+  node_sched->addHeur(&at_node);
+  bab_sched->solve(0, 0, &pool);
+  CPPUNIT_ASSERT(1 == pre.calls);
+  node_sched->solveNode(0, root, 0, &pool);
+  CPPUNIT_ASSERT(0 == at_node.calls);
+
+  // with budgets of their own, both run.
+  node_sched->shareBudget(0);
+  node_sched->solveNode(0, root, 0, &pool);
+  CPPUNIT_ASSERT(1 == at_node.calls);
+  delete node_sched;
+  delete bab_sched;
+  delete root;
+}
+
+
+void CountHeur::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
+{
+  double x[1] = {0.5};
+  double tstart = env_->getTime();
+
+  ++calls;
+  while (env_->getTime() - tstart < busy_) {
+  }
+  if (improve_) {
+    if (s_pool->hasBest()) {
+      s_pool->addSolution(x, 0.5*s_pool->getBestSolutionValue());
+    } else {
+      s_pool->addSolution(x, 1000.0);
+    }
+  }
+}
+
+
+void CountHeur::solveNode(ConstSolutionPtr, NodePtr node, RelaxationPtr rel,
+                          SolutionPoolPtr s_pool)
+{
+  solve(node, rel, s_pool);
+}
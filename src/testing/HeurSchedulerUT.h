@@ -0,0 +1,68 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#ifndef HEURSCHEDULERUT_H
+#define HEURSCHEDULERUT_H
+
+#include <cppunit/TestCase.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Heuristic.h"
+#include "Problem.h"
+
+using namespace Minotaur;
+
+// Check that the scheduler keeps to its time budget and that it prefers
+// heuristics that improve the incumbent.
+class HeurSchedulerUT : public CppUnit::TestCase {
+  public:
+    HeurSchedulerUT(std::string name) : TestCase(name) {}
+    HeurSchedulerUT() {}
+
+    void setUp();
+    void tearDown();
+    void testBudget();
+    void testNodeChoice();
+    void testShared();
+
+    CPPUNIT_TEST_SUITE(HeurSchedulerUT);
+    CPPUNIT_TEST(testBudget);
+    CPPUNIT_TEST(testNodeChoice);
+    CPPUNIT_TEST(testShared);
+    CPPUNIT_TEST_SUITE_END();
+
+  private:
+    EnvPtr env_;
+    ProblemPtr p_;
+};
+
+// ------------------------------------------------------------------------- //
+// ------------------------------------------------------------------------- //
+// heuristic that spends some time and, if asked to, halves the incumbent.
+class CountHeur : public Heuristic {
+  public:
+    CountHeur(EnvPtr env, double busy, bool improve)
+      : calls(0), busy_(busy), env_(env), improve_(improve) {}
+
+    void solve(NodePtr node, RelaxationPtr rel, SolutionPoolPtr s_pool);
+    void solveNode(ConstSolutionPtr sol, NodePtr node, RelaxationPtr rel,
+                   SolutionPoolPtr s_pool);
+    UInt getNumSolves() const { return calls; }
+    void writeStats(std::ostream &) const {};
+
+    /// Number of times the heuristic was called.
+    UInt calls;
+
+  private:
+    double busy_;
+    EnvPtr env_;
+    bool improve_;
+};
+
+#endif
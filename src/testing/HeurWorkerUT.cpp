@@ -0,0 +1,120 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#include <chrono>
+#include <thread>
+
+#include "MinotaurConfig.h"
+#include "Environment.h"
+#include "HeurWorker.h"
+#include "HeurWorkerUT.h"
+#include "Problem.h"
+#include "Solution.h"
+#include "SolutionPool.h"
+#include "Variable.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION(HeurWorkerUT);
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(HeurWorkerUT, "HeurWorkerUT");
+
+using namespace Minotaur;
+
+
+void HeurWorkerUT::testExchange()
+{
+  EnvPtr env = (EnvPtr) new Environment();
+  ProblemPtr p = (ProblemPtr) new Problem(env);
+  ProblemPtr wp = (ProblemPtr) new Problem(env);
+  SolutionPoolPtr pool;
+  SolutionPtr sol;
+  HeurWorker *worker;
+  ExchHeur *heur;
+  double x = 0.25;
+  bool found = false;
+
+  // the tree and the worker have their own copies of the problem.
+  p->newVariable(0.0, 1.0, Continuous);
+  wp->newVariable(0.0, 1.0, Continuous);
+  pool = new SolutionPool(env, p, 1);
+  worker = new HeurWorker(env, wp);
+  heur = new ExchHeur(wp);
+  worker->addHeur(heur);
+  worker->start();
+
+  // the solution of the first round reaches the pool of the tree.
+  for (UInt i=0; i<500 && false == found; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    found = worker->getSolutions(pool);
+  }
+  CPPUNIT_ASSERT(found);
+  CPPUNIT_ASSERT(10.0 == pool->getBestSolutionValue());
+  CPPUNIT_ASSERT(0.5 == pool->getBestSolution()->getPrimal()[0]);
+
+  // an incumbent of the tree is the cutoff of the next round, which starts
+  // from the point posted.
+  sol = (SolutionPtr) new Solution(5.0, &x, p);
+  worker->postIncumbent(sol);
+  for (UInt i=0; i<500 && heur->calls < 2; ++i) {
+    worker->postPoint(sol);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  worker->stop();
+  CPPUNIT_ASSERT(heur->calls >= 2);
+  CPPUNIT_ASSERT(5.0 == heur->cutoff);
+  CPPUNIT_ASSERT(0.25 == heur->initVal);
+
+  // solutions worse than the incumbent are not sent back.
+  CPPUNIT_ASSERT(false == worker->getSolutions(pool));
+  CPPUNIT_ASSERT(10.0 == pool->getBestSolutionValue());
+
+  delete sol;
+  delete worker;
+  delete pool;
+  delete p;
+  delete env;
+}
+
+
+void HeurWorkerUT::testStop()
+{
+  EnvPtr env = (EnvPtr) new Environment();
+  ProblemPtr p = (ProblemPtr) new Problem(env);
+  HeurWorker *worker;
+  std::chrono::steady_clock::time_point t0;
+  double t;
+
+  p->newVariable(0.0, 1.0, Continuous);
+  worker = new HeurWorker(env, p);
+  worker->addHeur((HeurPtr) new SlowHeur());
+  worker->start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  t0 = std::chrono::steady_clock::now();
+  worker->stop();
+  t = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0)
+      .count();
+  CPPUNIT_ASSERT(t < 1.0);
+  delete worker;
+  delete env;
+}
+
+
+void SlowHeur::solve(NodePtr, RelaxationPtr, SolutionPoolPtr)
+{
+  for (UInt i=0; i<1000 && false == isStopped_(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+}
+
+
+void ExchHeur::solve(NodePtr, RelaxationPtr, SolutionPoolPtr s_pool)
+{
+  double x = 0.5;
+
+  cutoff = s_pool->getBestSolutionValue();
+  initVal = p_->getVariable(0)->getInitVal();
+  s_pool->addSolution(&x, (0 == calls) ? 10.0 : 7.0);
+  ++calls;
+}
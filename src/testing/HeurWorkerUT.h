@@ -0,0 +1,74 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#ifndef HEURWORKERUT_H
+#define HEURWORKERUT_H
+
+#include <cppunit/TestCase.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <atomic>
+#include <cmath>
+
+#include "Heuristic.h"
+#include "Problem.h"
+
+using namespace Minotaur;
+
+// Check the exchange of points and solutions with the worker, and that
+// stopping it does not wait for its heuristics to end.
+class HeurWorkerUT : public CppUnit::TestCase {
+  public:
+    HeurWorkerUT(std::string name) : TestCase(name) {}
+    HeurWorkerUT() {}
+
+    void testExchange();
+    void testStop();
+
+    CPPUNIT_TEST_SUITE(HeurWorkerUT);
+    CPPUNIT_TEST(testExchange);
+    CPPUNIT_TEST(testStop);
+    CPPUNIT_TEST_SUITE_END();
+};
+
+// ------------------------------------------------------------------------- //
+// ------------------------------------------------------------------------- //
+// heuristic that takes ten seconds, in short steps, unless it is stopped.
+class SlowHeur : public Heuristic {
+  public:
+    SlowHeur() {}
+
+    void solve(NodePtr node, RelaxationPtr rel, SolutionPoolPtr s_pool);
+    void writeStats(std::ostream &) const {};
+};
+
+// heuristic that records what the worker gives it. The first call finds a
+// solution of value 10, later calls one of value 7.
+class ExchHeur : public Heuristic {
+  public:
+    ExchHeur(ProblemPtr p) : calls(0), cutoff(INFINITY), initVal(-1.0),
+                             p_(p) {}
+
+    void solve(NodePtr node, RelaxationPtr rel, SolutionPoolPtr s_pool);
+    void writeStats(std::ostream &) const {};
+
+    /// Number of calls.
+    std::atomic<UInt> calls;
+
+    /// Best value in the pool of the worker at the last call.
+    std::atomic<double> cutoff;
+
+    /// Initial value of the variable at the last call.
+    std::atomic<double> initVal;
+
+  private:
+    ProblemPtr p_;
+};
+
+#endif
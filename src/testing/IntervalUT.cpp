@@ -0,0 +1,130 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#include <cfloat>
+#include <cmath>
+
+#include "MinotaurConfig.h"
+#include "Interval.h"
+#include "IntervalUT.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION(IntervalUT);
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(IntervalUT, "IntervalUT");
+
+using namespace Minotaur;
+
+
+void IntervalUT::testAddSub()
+{
+  Interval a;
+
+  // 0.1+0.2 rounds to nearest above the exact sum, the lower end must be
+  // one ulp below.
+  a = IntervalAdd(Interval(0.1, 0.2), Interval(0.2, 0.3));
+  CPPUNIT_ASSERT(a.getLb() < 0.1 + 0.2);
+  CPPUNIT_ASSERT(a.getLb() == NextDown(0.1 + 0.2));
+  CPPUNIT_ASSERT(a.getUb() == 0.5);
+
+  // exact sums are not widened.
+  a = IntervalAdd(Interval(1.0, 2.0), Interval(3.0, 4.0));
+  CPPUNIT_ASSERT(a.getLb() == 4.0);
+  CPPUNIT_ASSERT(a.getUb() == 6.0);
+
+  a = IntervalSub(Interval(1.0, 2.0), Interval(3.0, 5.0));
+  CPPUNIT_ASSERT(a.getLb() == -4.0);
+  CPPUNIT_ASSERT(a.getUb() == -1.0);
+
+  a = IntervalNeg(Interval(1.0, 2.0));
+  CPPUNIT_ASSERT(a.getLb() == -2.0);
+  CPPUNIT_ASSERT(a.getUb() == -1.0);
+
+  // -0.1 is not exact, both products are rounded outwards.
+  a = IntervalScale(Interval(1.0, 2.0), -0.1);
+  CPPUNIT_ASSERT(a.getLb() == -0.2000000000000000111);
+  CPPUNIT_ASSERT(a.getUb() == -0.10000000000000000555);
+}
+
+
+void IntervalUT::testMulDiv()
+{
+  Interval a;
+
+  a = IntervalMul(Interval(1.0/3.0, 1.0/3.0), Interval(3.0, 3.0));
+  CPPUNIT_ASSERT(a.getLb() == 0.99999999999999988898);
+  CPPUNIT_ASSERT(a.getUb() == 1.0);
+
+  CPPUNIT_ASSERT(DivDown(1.0, 3.0) < DivUp(1.0, 3.0));
+  CPPUNIT_ASSERT(DivUp(1.0, 3.0) == NextUp(DivDown(1.0, 3.0)));
+  CPPUNIT_ASSERT(DivDown(1.0, 3.0)*3.0 <= 1.0);
+  CPPUNIT_ASSERT(fma(DivUp(1.0, 3.0), 3.0, -1.0) > 0.0);
+  CPPUNIT_ASSERT(DivDown(1.0, 4.0) == 0.25);
+  CPPUNIT_ASSERT(DivUp(1.0, 4.0) == 0.25);
+
+  a = IntervalSqr(Interval(-3.0, 2.0));
+  CPPUNIT_ASSERT(a.getLb() == 0.0);
+  CPPUNIT_ASSERT(a.getUb() == 9.0);
+
+  a = IntervalSqr(Interval(-3.0, -2.0));
+  CPPUNIT_ASSERT(a.getLb() == 4.0);
+  CPPUNIT_ASSERT(a.getUb() == 9.0);
+}
+
+
+void IntervalUT::testRoots()
+{
+  CPPUNIT_ASSERT(SqrtDown(2.0) < SqrtUp(2.0));
+  CPPUNIT_ASSERT(SqrtUp(2.0) == NextUp(SqrtDown(2.0)));
+  CPPUNIT_ASSERT(fma(SqrtDown(2.0), SqrtDown(2.0), -2.0) < 0.0);
+  CPPUNIT_ASSERT(fma(SqrtUp(2.0), SqrtUp(2.0), -2.0) > 0.0);
+  CPPUNIT_ASSERT(SqrtDown(4.0) == 2.0);
+  CPPUNIT_ASSERT(SqrtUp(4.0) == 2.0);
+
+  CPPUNIT_ASSERT(RootUp(8.0, 3.0) >= 2.0);
+  CPPUNIT_ASSERT(RootDown(8.0, 3.0) <= 2.0);
+  CPPUNIT_ASSERT(RootUp(8.0, 3.0) - RootDown(8.0, 3.0) < 1e-14);
+  CPPUNIT_ASSERT(LibmDown(exp(1.0)) < exp(1.0));
+  CPPUNIT_ASSERT(LibmUp(exp(1.0)) > exp(1.0));
+}
+
+
+void IntervalUT::testUnbounded()
+{
+  Interval a;
+
+  // 0 is an end of the divisor.
+  a = IntervalDiv(Interval(1.0, 2.0), Interval(0.0, 4.0));
+  CPPUNIT_ASSERT(a.getLb() == 0.25);
+  CPPUNIT_ASSERT(a.getUb() == INFINITY);
+
+  // 0 is inside the divisor.
+  a = IntervalDiv(Interval(1.0, 2.0), Interval(-1.0, 4.0));
+  CPPUNIT_ASSERT(a.getLb() == -INFINITY);
+  CPPUNIT_ASSERT(a.getUb() == INFINITY);
+
+  a = IntervalSub(Interval(-INFINITY, 1.0), Interval(2.0, INFINITY));
+  CPPUNIT_ASSERT(a.getLb() == -INFINITY);
+  CPPUNIT_ASSERT(a.getUb() == -1.0);
+
+  // 0*inf is 0, since infinite ends are never attained.
+  a = IntervalMul(Interval(0.0, 1.0), Interval(1.0, INFINITY));
+  CPPUNIT_ASSERT(a.getLb() == 0.0);
+  CPPUNIT_ASSERT(a.getUb() == INFINITY);
+
+  a = IntervalRevMul(Interval(-1.0, 1.0), Interval(-2.0, 2.0));
+  CPPUNIT_ASSERT(a.getLb() == -INFINITY);
+  CPPUNIT_ASSERT(a.getUb() == INFINITY);
+
+  // x1*x2 = 0 with x1 in [0, 10] does not fix x2.
+  a = IntervalRevMul(Interval(0.0, 0.0), Interval(0.0, 10.0));
+  CPPUNIT_ASSERT(a.getLb() == -INFINITY);
+  CPPUNIT_ASSERT(a.getUb() == INFINITY);
+
+  // sums of finite numbers that overflow.
+  CPPUNIT_ASSERT(AddDown(DBL_MAX, DBL_MAX) == DBL_MAX);
+  CPPUNIT_ASSERT(AddUp(DBL_MAX, DBL_MAX) == INFINITY);
+  CPPUNIT_ASSERT(AddUp(-DBL_MAX, -DBL_MAX) == -DBL_MAX);
+  CPPUNIT_ASSERT(AddDown(-DBL_MAX, -DBL_MAX) == -INFINITY);
+}
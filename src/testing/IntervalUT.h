@@ -0,0 +1,39 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#ifndef INTERVALUT_H
+#define INTERVALUT_H
+
+#include <cppunit/TestCase.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Interval.h"
+
+using namespace Minotaur;
+
+// Check that interval operations round outwards.
+class IntervalUT : public CppUnit::TestCase {
+  public:
+    IntervalUT(std::string name) : TestCase(name) {}
+    IntervalUT() {}
+
+    void testAddSub();
+    void testMulDiv();
+    void testRoots();
+    void testUnbounded();
+
+    CPPUNIT_TEST_SUITE(IntervalUT);
+    CPPUNIT_TEST(testAddSub);
+    CPPUNIT_TEST(testMulDiv);
+    CPPUNIT_TEST(testRoots);
+    CPPUNIT_TEST(testUnbounded);
+    CPPUNIT_TEST_SUITE_END();
+};
+
+#endif
@@ -0,0 +1,132 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#include <cmath>
+
+#include "MinotaurConfig.h"
+#include "BrVarCand.h"
+#include "Constraint.h"
+#include "Environment.h"
+#include "Function.h"
+#include "LinearFunction.h"
+#include "LinMods.h"
+#include "LinModsUT.h"
+#include "QuadHandler.h"
+#include "QuadraticFunction.h"
+#include "Relaxation.h"
+#include "Variable.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION(LinModsUT);
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(LinModsUT, "LinModsUT");
+
+using namespace Minotaur;
+
+
+// Return true if constraints of r1 and r2 with the same index have the same
+// bounds and linear functions.
+static bool sameCons_(RelaxationPtr r1, RelaxationPtr r2)
+{
+  ConstraintPtr c1, c2;
+  LinearFunctionPtr lf1, lf2;
+
+  if (r1->getNumCons() != r2->getNumCons()) {
+    return false;
+  }
+  for (UInt i=0; i<r1->getNumCons(); ++i) {
+    c1 = r1->getConstraint(i);
+    c2 = r2->getConstraint(i);
+    if (c1->getLb() != c2->getLb() || c1->getUb() != c2->getUb()) {
+      return false;
+    }
+    lf1 = c1->getLinearFunction();
+    lf2 = c2->getLinearFunction();
+    if (lf1->getNumTerms() != lf2->getNumTerms()) {
+      return false;
+    }
+    for (VariableGroupConstIterator it=lf1->termsBegin();
+         it!=lf1->termsEnd(); ++it) {
+      if (fabs(lf2->getWeight(r2->getVariable(it->first->getIndex())) -
+               it->second) > 1e-12) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+
+void LinModsUT::testToOtherRel()
+{
+  EnvPtr env = (EnvPtr) new Environment();
+  ProblemPtr p = (ProblemPtr) new Problem(env);
+  RelaxationPtr r1, r2;
+  VariablePtr x0, x1, y;
+  LinearFunctionPtr lf;
+  QuadraticFunctionPtr qf;
+  ConstraintPtr c;
+  ModificationPtr mod, pmod, mod2;
+  BrVarCandPtr cand;
+  DoubleVector x(3);
+  bool is_inf = false;
+
+  // x0*x1 - y = 0, x0 in [0, 4], x1 in [1, 3].
+  x0 = p->newVariable(0.0, 4.0, Continuous);
+  x1 = p->newVariable(1.0, 3.0, Continuous);
+  y = p->newVariable(-10.0, 20.0, Continuous);
+  lf = (LinearFunctionPtr) new LinearFunction();
+  lf->addTerm(y, -1.0);
+  qf = (QuadraticFunctionPtr) new QuadraticFunction();
+  qf->addTerm(x0, x1, 1.0);
+  c = p->newConstraint((FunctionPtr) new Function(lf, qf), 0.0, 0.0);
+
+  QuadHandler qh(env, p);
+  qh.addConstraint(c);
+
+  // two relaxations with the same variables and McCormick inequalities, as
+  // made for two threads. The handler keeps the inequalities of the last.
+  r2 = (RelaxationPtr) new Relaxation(env);
+  r1 = (RelaxationPtr) new Relaxation(env);
+  for (RelaxationPtr r : {r2, r1}) {
+    r->setProblem(p);
+    for (VariableConstIterator it=p->varsBegin(); it!=p->varsEnd(); ++it) {
+      r->newVariable((*it)->getLb(), (*it)->getUb(), (*it)->getType());
+    }
+    qh.relaxInitFull(r, 0, &is_inf);
+    CPPUNIT_ASSERT(false == is_inf);
+    CPPUNIT_ASSERT(4 == r->getNumCons());
+  }
+
+  // branch down on x0 at a point where y < x0*x1.
+  x[0] = 2.0;
+  x[1] = 2.0;
+  x[2] = 1.0;
+  cand = (BrVarCandPtr) new BrVarCand(r1->getVariable(0), 0, 1.0, 1.0);
+  mod = qh.getBrMod(cand, x, r1, DownBranch);
+  mod->applyToProblem(r1);
+  CPPUNIT_ASSERT(2.0 == r1->getVariable(0)->getUb());
+  CPPUNIT_ASSERT(false == sameCons_(r1, r2));
+
+  // as in Node::applyRModsTrans().
+  pmod = mod->fromRel(r2, p);
+  mod2 = pmod->toRel(p, r2);
+  mod2->applyToProblem(r2);
+  CPPUNIT_ASSERT(2.0 == r2->getVariable(0)->getUb());
+  CPPUNIT_ASSERT(true == sameCons_(r1, r2));
+
+  mod2->undoToProblem(r2);
+  mod->undoToProblem(r1);
+  CPPUNIT_ASSERT(4.0 == r2->getVariable(0)->getUb());
+  CPPUNIT_ASSERT(true == sameCons_(r1, r2));
+
+  delete mod2;
+  delete pmod;
+  delete mod;
+  delete cand;
+  delete r1;
+  delete r2;
+  delete p;
+  delete env;
+}
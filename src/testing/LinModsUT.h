@@ -0,0 +1,34 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#ifndef LINMODSUT_H
+#define LINMODSUT_H
+
+#include <cppunit/TestCase.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Types.h"
+
+using namespace Minotaur;
+
+// Convert branching modifications of QuadHandler between relaxations.
+class LinModsUT : public CppUnit::TestCase {
+
+public:
+  LinModsUT(std::string name) : TestCase(name) {}
+  LinModsUT() {}
+
+  CPPUNIT_TEST_SUITE(LinModsUT);
+  CPPUNIT_TEST(testToOtherRel);
+  CPPUNIT_TEST_SUITE_END();
+
+  void testToOtherRel();
+};
+
+#endif
@@ -0,0 +1,256 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+
+#include "MinotaurConfig.h"
+#include "Constraint.h"
+#include "Environment.h"
+#include "Function.h"
+#include "LinearFunction.h"
+#include "Node.h"
+#include "NodeRecorder.h"
+#include "NodeRecorderUT.h"
+#include "Relaxation.h"
+#include "Variable.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION(NodeRecorderUT);
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(NodeRecorderUT, "NodeRecorderUT");
+
+using namespace Minotaur;
+
+
+static BndVector conBounds_(ProblemPtr p)
+{
+  BndVector b;
+  for (ConstraintConstIterator it=p->consBegin(); it!=p->consEnd(); ++it) {
+    b.push_back(std::make_pair((*it)->getLb(), (*it)->getUb()));
+  }
+  return b;
+}
+
+
+static BndVector varBounds_(ProblemPtr p)
+{
+  BndVector b;
+  for (VariableConstIterator it=p->varsBegin(); it!=p->varsEnd(); ++it) {
+    b.push_back(std::make_pair((*it)->getLb(), (*it)->getUb()));
+  }
+  return b;
+}
+
+
+void NodeRecorderUT::testIters()
+{
+  const std::string fname = "NodeRecorderUT.rec";
+  EnvPtr env = (EnvPtr) new Environment();
+  RelaxationPtr rel = (RelaxationPtr) new Relaxation(env);
+  std::ostringstream out;
+  LinearFunctionPtr lf;
+  VariablePtr x;
+  NodePtr root, n1;
+  BoundsEngine engine;
+
+  x = rel->newVariable(0.0, 10.0, Continuous);
+  lf = (LinearFunctionPtr) new LinearFunction();
+  lf->addTerm(x, 1.0);
+  rel->newObjective((FunctionPtr) new Function(lf), 0.0, Minimize);
+
+  NodeRecorder rec(env);
+  CPPUNIT_ASSERT(0 == rec.open(fname));
+  root = (NodePtr) new Node();
+  rec.record(root, rel);
+  n1 = (NodePtr) new Node(root, 0);
+  n1->setId(1);
+  rel->changeBound(x, Upper, 4.0);
+  rec.record(n1, rel);
+  rec.close();
+
+  // the engine fills all of its statistics at each call, and makes two
+  // iterations per solve.
+  NodeReplayer replayer(env);
+  CPPUNIT_ASSERT(0 == replayer.replay(fname, &engine, BoundsEngine::numStats,
+                                      BoundsEngine::itersStat));
+  CPPUNIT_ASSERT(2 == engine.varBnds.size());
+  CPPUNIT_ASSERT(false == engine.badStats);
+  replayer.writeStats(out);
+  CPPUNIT_ASSERT(out.str().find("iterations                    = 4") !=
+                 std::string::npos);
+
+  std::remove(fname.c_str());
+  delete n1;
+  delete root;
+  delete rel;
+  delete env;
+}
+
+
+void NodeRecorderUT::testRoundTrip()
+{
+  const std::string fname = "NodeRecorderUT.rec";
+  EnvPtr env = (EnvPtr) new Environment();
+  RelaxationPtr rel = (RelaxationPtr) new Relaxation(env);
+  std::vector<BndVector> con_bnds, var_bnds;
+  VariablePtr x, y;
+  LinearFunctionPtr lf;
+  ConstraintPtr c1, c2;
+  NodePtr root, n1, n2;
+  BoundsEngine engine;
+
+  x = rel->newVariable(0.0, 10.0, Continuous);
+  y = rel->newVariable(0.0, 10.0, Integer);
+
+  // x + y in [1, 8], -5 <= x - y <= 5, min x + 2y.
+  lf = (LinearFunctionPtr) new LinearFunction();
+  lf->addTerm(x, 1.0);
+  lf->addTerm(y, 1.0);
+  c1 = rel->newConstraint((FunctionPtr) new Function(lf), 1.0, 8.0);
+  lf = (LinearFunctionPtr) new LinearFunction();
+  lf->addTerm(x, 1.0);
+  lf->addTerm(y, -1.0);
+  c2 = rel->newConstraint((FunctionPtr) new Function(lf), -5.0, 5.0);
+  lf = (LinearFunctionPtr) new LinearFunction();
+  lf->addTerm(x, 1.0);
+  lf->addTerm(y, 2.0);
+  rel->newObjective((FunctionPtr) new Function(lf), 0.0, Minimize);
+
+  NodeRecorder rec(env);
+  CPPUNIT_ASSERT(0 == rec.open(fname));
+  root = (NodePtr) new Node();
+  rec.record(root, rel);
+  con_bnds.push_back(conBounds_(rel));
+  var_bnds.push_back(varBounds_(rel));
+
+  // both bounds of a constraint and a bound of a variable change.
+  n1 = (NodePtr) new Node(root, 0);
+  n1->setId(1);
+  rel->changeBound(c1, Lower, 2.0);
+  rel->changeBound(c1, Upper, 6.0);
+  rel->changeBound(x, Upper, 4.0);
+  rec.record(n1, rel);
+  con_bnds.push_back(conBounds_(rel));
+  var_bnds.push_back(varBounds_(rel));
+
+  // a cut is added and a constraint deleted.
+  n2 = (NodePtr) new Node(root, 0);
+  n2->setId(2);
+  lf = (LinearFunctionPtr) new LinearFunction();
+  lf->addTerm(y, 1.0);
+  rel->newConstraint((FunctionPtr) new Function(lf), -INFINITY, 3.0);
+  rel->markDelete(c2);
+  rel->delMarkedCons();
+  rel->changeBound(c1, Upper, 5.0);
+  rec.record(n2, rel);
+  con_bnds.push_back(conBounds_(rel));
+  var_bnds.push_back(varBounds_(rel));
+  rec.close();
+
+  NodeReplayer replayer(env);
+  CPPUNIT_ASSERT(0 == replayer.replay(fname, &engine, 0, -1));
+  CPPUNIT_ASSERT(3 == engine.conBnds.size());
+  CPPUNIT_ASSERT(con_bnds == engine.conBnds);
+  CPPUNIT_ASSERT(var_bnds == engine.varBnds);
+
+  std::remove(fname.c_str());
+  delete n2;
+  delete n1;
+  delete root;
+  delete rel;
+  delete env;
+}
+
+
+void BoundsEngine::addConstraint(ConstraintPtr c)
+{
+  cons_[c] = std::make_pair(c->getLb(), c->getUb());
+}
+
+
+void BoundsEngine::changeBound(ConstraintPtr c, BoundType lu, double new_val)
+{
+  if (Lower == lu) {
+    cons_[c].first = new_val;
+  } else {
+    cons_[c].second = new_val;
+  }
+}
+
+
+void BoundsEngine::changeBound(VariablePtr v, BoundType lu, double new_val)
+{
+  if (Lower == lu) {
+    vars_[v->getIndex()].first = new_val;
+  } else {
+    vars_[v->getIndex()].second = new_val;
+  }
+}
+
+
+void BoundsEngine::changeBound(VariablePtr v, double new_lb, double new_ub)
+{
+  vars_[v->getIndex()] = std::make_pair(new_lb, new_ub);
+}
+
+
+void BoundsEngine::clear()
+{
+  if (p_) {
+    p_->unsetEngine();
+  }
+  p_ = 0;
+  cons_.clear();
+  vars_.clear();
+}
+
+
+void BoundsEngine::fillStats(std::vector<double> &stats)
+{
+  if (stats.size() != numStats) {
+    badStats = true;
+    return;
+  }
+  stats[0] += conBnds.size();
+  stats[itersStat] += 2.0*conBnds.size();
+  stats[2] += 1.0;
+}
+
+
+void BoundsEngine::load(ProblemPtr problem)
+{
+  p_ = problem;
+  vars_ = varBounds_(p_);
+  for (ConstraintConstIterator it=p_->consBegin(); it!=p_->consEnd(); ++it) {
+    addConstraint(*it);
+  }
+  p_->setEngine(this);
+}
+
+
+void BoundsEngine::removeCons(std::vector<ConstraintPtr> &delcons)
+{
+  for (UInt i=0; i<delcons.size(); ++i) {
+    cons_.erase(delcons[i]);
+  }
+}
+
+
+EngineStatus BoundsEngine::solve()
+{
+  BndVector b;
+
+  // constraints of the problem, with the bounds known to the engine.
+  for (ConstraintConstIterator it=p_->consBegin(); it!=p_->consEnd(); ++it) {
+    if (cons_.count(*it)) {
+      b.push_back(cons_[*it]);
+    }
+  }
+  conBnds.push_back(b);
+  varBnds.push_back(vars_);
+  status_ = ProvenOptimal;
+  return status_;
+}
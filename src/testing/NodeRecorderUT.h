@@ -0,0 +1,97 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#ifndef NODERECORDERUT_H
+#define NODERECORDERUT_H
+
+#include <map>
+#include <vector>
+
+#include <cppunit/TestCase.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Engine.h"
+#include "Problem.h"
+
+using namespace Minotaur;
+
+typedef std::vector<std::pair<double, double> > BndVector;
+
+// Record nodes of a relaxation and replay them in an engine that only keeps
+// the bounds it is told about.
+class NodeRecorderUT : public CppUnit::TestCase {
+  public:
+    NodeRecorderUT(std::string name) : TestCase(name) {}
+    NodeRecorderUT() {}
+
+    void testIters();
+    void testRoundTrip();
+
+    CPPUNIT_TEST_SUITE(NodeRecorderUT);
+    CPPUNIT_TEST(testIters);
+    CPPUNIT_TEST(testRoundTrip);
+    CPPUNIT_TEST_SUITE_END();
+};
+
+// ------------------------------------------------------------------------- //
+// ------------------------------------------------------------------------- //
+// engine that saves the bounds of variables and constraints at each solve.
+class BoundsEngine : public Engine {
+  public:
+    BoundsEngine() : badStats(false), p_(0) {}
+
+    void addConstraint(ConstraintPtr c);
+    void changeBound(ConstraintPtr c, BoundType lu, double new_val);
+    void changeBound(VariablePtr v, BoundType lu, double new_val);
+    void changeBound(VariablePtr v, double new_lb, double new_ub);
+    void changeConstraint(ConstraintPtr, LinearFunctionPtr, double, double)
+    {};
+    void changeConstraint(ConstraintPtr, NonlinearFunctionPtr) {};
+    void changeObj(FunctionPtr, double) {};
+    void clear();
+    void disableStrBrSetup() {};
+    void enableStrBrSetup() {};
+    void fillStats(std::vector<double> &stats);
+    ConstSolutionPtr getSolution() { return 0; };
+    double getSolutionValue() { return 0.0; };
+    EngineStatus solve();
+    std::string getName() const { return "BoundsEngine"; };
+    EngineStatus getStatus() { return ProvenOptimal; };
+    ConstWarmStartPtr getWarmStart() { return 0; };
+    WarmStartPtr getWarmStartCopy() { return 0; };
+    void load(ProblemPtr problem);
+    void loadFromWarmStart(const WarmStartPtr) {};
+    void negateObj() {};
+    void removeCons(std::vector<ConstraintPtr> &delcons);
+    void resetIterationLimit() {};
+    int setDualObjLimit(double) { return 0; };
+    void setIterationLimit(int) {};
+
+    /// Bounds of constraints at each solve, in the order of the problem.
+    std::vector<BndVector> conBnds;
+
+    /// Bounds of variables at each solve.
+    std::vector<BndVector> varBnds;
+
+    /// True if fillStats() got a vector of the wrong length.
+    bool badStats;
+
+    /// Length of the vector filled by fillStats().
+    static const UInt numStats = 3;
+
+    /// Position of the number of iterations in the vector of fillStats().
+    static const UInt itersStat = 1;
+
+  private:
+    std::map<ConstraintPtr, std::pair<double, double> > cons_;
+    ProblemPtr p_;
+    BndVector vars_;
+};
+
+#endif
@@ -0,0 +1,151 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "MinotaurConfig.h"
+#include "Cut.h"
+#include "Environment.h"
+#include "Function.h"
+#include "LinearFunction.h"
+#include "ParCutStoreUT.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION(ParCutStoreUT);
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(ParCutStoreUT, "ParCutStoreUT");
+
+using namespace Minotaur;
+
+
+void ParCutStoreUT::setUp()
+{
+  env_ = new Environment();
+}
+
+
+void ParCutStoreUT::tearDown()
+{
+  delete env_;
+}
+
+
+RelaxationPtr ParCutStoreUT::newRel_(UInt n)
+{
+  RelaxationPtr rel = (RelaxationPtr) new Relaxation(env_);
+
+  for (UInt i=0; i<n; ++i) {
+    rel->newVariable(0.0, 1.0, Continuous);
+  }
+  return rel;
+}
+
+
+void ParCutStoreUT::publish_(ParCutStore &store, RelaxationPtr rel, UInt t,
+                             UInt i0, double a0, UInt i1, double a1,
+                             double ub)
+{
+  LinearFunctionPtr lf = (LinearFunctionPtr) new LinearFunction();
+  FunctionPtr f;
+  CutPtr cut;
+
+  lf->addTerm(rel->getVariable(i0), a0);
+  lf->addTerm(rel->getVariable(i1), a1);
+  f = (FunctionPtr) new Function(lf);
+  cut = (CutPtr) new Cut(rel->getNumVars(), f, -INFINITY, ub, false, false);
+  store.publish(cut, t);
+  delete cut;
+  delete f;
+}
+
+
+void ParCutStoreUT::testPublishPull()
+{
+  ParCutStore store(2, 100);
+  RelaxationPtr r0 = newRel_(3);
+  RelaxationPtr r1 = newRel_(3);
+  double x[3] = {0.8, 0.8, 0.0};
+  double y[3] = {0.0, 0.0, 0.0};
+
+  // x0 + x1 <= 1 by thread 0, violated at x.
+  publish_(store, r0, 0, 0, 1.0, 1, 1.0, 1.0);
+  CPPUNIT_ASSERT(0 == store.pull(r0, x, 0));
+  CPPUNIT_ASSERT(1 == store.pull(r1, x, 1));
+  CPPUNIT_ASSERT(1 == r1->getNumCons());
+  CPPUNIT_ASSERT(1.0 == r1->getConstraint(0)->getUb());
+
+  // the same cut scaled, by thread 1: not published again.
+  publish_(store, r1, 1, 0, 2.0, 1, 2.0, 2.0);
+  CPPUNIT_ASSERT(0 == store.pull(r0, x, 0));
+
+  // x1 + x2 <= 1 is not violated at y. It waits for a few pulls.
+  publish_(store, r0, 0, 1, 1.0, 2, 1.0, 1.0);
+  CPPUNIT_ASSERT(0 == store.pull(r1, y, 1));
+  CPPUNIT_ASSERT(0 == store.pull(r1, y, 1));
+  y[1] = 0.6;
+  y[2] = 0.6;
+  CPPUNIT_ASSERT(1 == store.pull(r1, y, 1));
+  CPPUNIT_ASSERT(0 == store.pull(r1, y, 1));
+
+  // x0 - x2 <= 0 is never violated and is dropped after waiting.
+  publish_(store, r0, 0, 0, 1.0, 2, -1.0, 0.0);
+  for (UInt i=0; i<20; ++i) {
+    CPPUNIT_ASSERT(0 == store.pull(r1, y, 1));
+  }
+  y[0] = 1.0;
+  CPPUNIT_ASSERT(0 == store.pull(r1, y, 1));
+  CPPUNIT_ASSERT(2 == r1->getNumCons());
+  CPPUNIT_ASSERT(0 == r0->getNumCons());
+
+  delete r1;
+  delete r0;
+}
+
+
+void ParCutStoreUT::testThreads()
+{
+  const UInt nthreads = 4;
+  const UInt ncuts = 200;
+  const UInt nvars = ncuts + 1;
+  ParCutStore store(nthreads, nthreads*ncuts + 10);
+  std::vector<RelaxationPtr> rels;
+  std::vector<std::thread> threads;
+  UInt total = 0;
+
+  for (UInt t=0; t<nthreads; ++t) {
+    rels.push_back(newRel_(nvars));
+  }
+  for (UInt t=0; t<nthreads; ++t) {
+    threads.push_back(std::thread([this, &store, &rels, t, ncuts]() {
+      for (UInt i=0; i<ncuts; ++i) {
+        // distinct cuts x_0 + (t+2) x_{i+1} <= 1, and one cut that all
+        // threads find.
+        publish_(store, rels[t], t, 0, 1.0, i+1, t+2.0, 1.0);
+        if (i == ncuts/2) {
+          publish_(store, rels[t], t, 0, 1.0, 1, 1.0, 1.0);
+        }
+        store.pull(rels[t], 0, t);
+      }
+    }));
+  }
+  for (UInt t=0; t<nthreads; ++t) {
+    threads[t].join();
+  }
+
+  // every thread has all cuts of the others, and the common cut once,
+  // unless it published it.
+  for (UInt t=0; t<nthreads; ++t) {
+    store.pull(rels[t], 0, t);
+    CPPUNIT_ASSERT(rels[t]->getNumCons() >= (nthreads-1)*ncuts);
+    CPPUNIT_ASSERT(rels[t]->getNumCons() <= (nthreads-1)*ncuts + 1);
+    total += rels[t]->getNumCons();
+  }
+  CPPUNIT_ASSERT(total == nthreads*(nthreads-1)*ncuts + nthreads-1);
+
+  for (UInt t=0; t<nthreads; ++t) {
+    delete rels[t];
+  }
+}
@@ -0,0 +1,48 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#ifndef PARCUTSTOREUT_H
+#define PARCUTSTOREUT_H
+
+#include <cppunit/TestCase.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "ParCutStore.h"
+#include "Relaxation.h"
+
+using namespace Minotaur;
+
+// Publish cuts from some threads and pull them in others.
+class ParCutStoreUT : public CppUnit::TestCase {
+  public:
+    ParCutStoreUT(std::string name) : TestCase(name) {}
+    ParCutStoreUT() {}
+
+    void setUp();
+    void tearDown();
+    void testPublishPull();
+    void testThreads();
+
+    CPPUNIT_TEST_SUITE(ParCutStoreUT);
+    CPPUNIT_TEST(testPublishPull);
+    CPPUNIT_TEST(testThreads);
+    CPPUNIT_TEST_SUITE_END();
+
+  private:
+    EnvPtr env_;
+
+    /// Publish a cut a0 x_i0 + a1 x_i1 <= ub found by thread t.
+    void publish_(ParCutStore &store, RelaxationPtr rel, UInt t, UInt i0,
+                  double a0, UInt i1, double a1, double ub);
+
+    /// A relaxation with n continuous variables in [0, 1].
+    RelaxationPtr newRel_(UInt n);
+};
+
+#endif
@@ -0,0 +1,206 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+#include "MinotaurConfig.h"
+#include "CGraph.h"
+#include "CNode.h"
+#include "Constraint.h"
+#include "Environment.h"
+#include "Function.h"
+#include "LinearFunction.h"
+#include "Objective.h"
+#include "PreDelVars.h"
+#include "ProbSnapshot.h"
+#include "ProbSnapshotUT.h"
+#include "Problem.h"
+#include "QuadraticFunction.h"
+#include "Variable.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION(ProbSnapshotUT);
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(ProbSnapshotUT, "ProbSnapshotUT");
+
+using namespace Minotaur;
+
+
+ProblemPtr ProbSnapshotUT::makeProblem_(EnvPtr env, PresolverPtr *pres,
+                                        VarVector *orig_v)
+{
+  ProblemPtr p = (ProblemPtr) new Problem(env);
+  VariablePtr x0, x1, x2, x3;
+  LinearFunctionPtr lf;
+  QuadraticFunctionPtr qf;
+  CGraphPtr cg;
+  CNode *n0, *n1;
+  PreDelVars *dmod = new PreDelVars();
+  ModPresolver *mpres;
+
+  x0 = p->newVariable(0.0, 1.0, Binary, "x0");
+  x1 = p->newVariable(0.0, 5.0, Integer, "x1");
+  x2 = p->newVariable(-1.0, 3.0, Continuous, "x2");
+  x3 = p->newVariable(2.0, 2.0, Continuous, "x3");
+  orig_v->assign(p->varsBegin(), p->varsEnd());
+
+  // x0 + 2x1 - x3 <= 4
+  lf = (LinearFunctionPtr) new LinearFunction();
+  lf->addTerm(x0, 1.0);
+  lf->addTerm(x1, 2.0);
+  lf->addTerm(x3, -1.0);
+  p->newConstraint((FunctionPtr) new Function(lf), -INFINITY, 4.0, "c0");
+
+  // 1 <= x0 + x1*x2 <= 3
+  lf = (LinearFunctionPtr) new LinearFunction();
+  lf->addTerm(x0, 1.0);
+  qf = (QuadraticFunctionPtr) new QuadraticFunction();
+  qf->addTerm(x1, x2, 1.0);
+  p->newConstraint((FunctionPtr) new Function(lf, qf), 1.0, 3.0, "c1");
+
+  // x1 + exp(x2) <= 10
+  lf = (LinearFunctionPtr) new LinearFunction();
+  lf->addTerm(x1, 1.0);
+  cg = (CGraphPtr) new CGraph();
+  n0 = cg->newNode(x2);
+  n1 = cg->newNode(OpExp, n0, 0);
+  cg->setOut(n1);
+  cg->finalize();
+  p->newConstraint((FunctionPtr) new Function(lf, cg), -INFINITY, 10.0,
+                   "c2");
+
+  // min x0 + x2 + 1.5
+  lf = (LinearFunctionPtr) new LinearFunction();
+  lf->addTerm(x0, 1.0);
+  lf->addTerm(x2, 1.0);
+  p->newObjective((FunctionPtr) new Function(lf), 1.5, Minimize, "obj");
+
+  // x3 is fixed and deleted by "presolve".
+  dmod->insert(x3);
+  p->markDelete(x3);
+  p->delMarkedVars(true);
+  mpres = new ModPresolver(p, env);
+  mpres->addMod(dmod);
+  *pres = mpres;
+  return p;
+}
+
+
+void ProbSnapshotUT::testRoundTrip()
+{
+  const std::string fname = "ProbSnapshotUT.snp";
+  EnvPtr env = (EnvPtr) new Environment();
+  PresolverPtr pres, pres2;
+  VarVector orig_v;
+  ProblemPtr p, q;
+  ProbSnapshot *snap;
+  double x[3] = {1.0, 2.0, 0.5};
+  DoubleVector newx, newx2;
+  VariablePtr v, w;
+  int err = 0, err2 = 0;
+
+  p = makeProblem_(env, &pres, &orig_v);
+  snap = new ProbSnapshot(env);
+  CPPUNIT_ASSERT(0 == snap->write(p, pres, &orig_v, -1.0, fname));
+  delete snap;
+
+  snap = new ProbSnapshot(env);
+  q = snap->read(fname, err);
+  CPPUNIT_ASSERT(0 == err);
+  CPPUNIT_ASSERT(q);
+  CPPUNIT_ASSERT(-1.0 == snap->getObjSense());
+
+  CPPUNIT_ASSERT(3 == q->getNumVars());
+  for (UInt i=0; i<p->getNumVars(); ++i) {
+    v = p->getVariable(i);
+    w = q->getVariable(i);
+    CPPUNIT_ASSERT(v->getName() == w->getName());
+    CPPUNIT_ASSERT(v->getType() == w->getType());
+    CPPUNIT_ASSERT(v->getLb() == w->getLb());
+    CPPUNIT_ASSERT(v->getUb() == w->getUb());
+  }
+
+  // same functions: same values at a point.
+  CPPUNIT_ASSERT(3 == q->getNumCons());
+  for (UInt i=0; i<p->getNumCons(); ++i) {
+    ConstraintPtr c = p->getConstraint(i);
+    ConstraintPtr d = q->getConstraint(i);
+    CPPUNIT_ASSERT(c->getName() == d->getName());
+    CPPUNIT_ASSERT(c->getLb() == d->getLb());
+    CPPUNIT_ASSERT(c->getUb() == d->getUb());
+    CPPUNIT_ASSERT(c->getFunctionType() == d->getFunctionType());
+    CPPUNIT_ASSERT(fabs(c->getActivity(x, &err) -
+                        d->getActivity(x, &err2)) < 1e-12);
+    CPPUNIT_ASSERT(0 == err && 0 == err2);
+  }
+  CPPUNIT_ASSERT(q->getObjective());
+  CPPUNIT_ASSERT(1.5 == q->getObjective()->getConstant());
+  CPPUNIT_ASSERT(fabs(p->getObjective()->eval(x, &err) -
+                      q->getObjective()->eval(x, &err2)) < 1e-12);
+
+  // postsolve puts the deleted x3 back.
+  pres2 = snap->getPresolver(q);
+  pres->getX(x, &newx);
+  pres2->getX(x, &newx2);
+  CPPUNIT_ASSERT(4 == newx2.size());
+  CPPUNIT_ASSERT(newx == newx2);
+  CPPUNIT_ASSERT(2.0 == newx2[3]);
+
+  CPPUNIT_ASSERT(4 == snap->getOrigVars()->size());
+  for (UInt i=0; i<orig_v.size(); ++i) {
+    v = (*snap->getOrigVars())[i];
+    CPPUNIT_ASSERT(orig_v[i]->getName() == v->getName());
+    CPPUNIT_ASSERT(orig_v[i]->getLb() == v->getLb());
+  }
+
+  std::remove(fname.c_str());
+  delete pres2;
+  delete snap;
+  delete q;
+  delete pres;
+  delete p;
+  delete env;
+}
+
+
+void ProbSnapshotUT::testTruncated()
+{
+  const std::string fname = "ProbSnapshotUT.snp";
+  EnvPtr env = (EnvPtr) new Environment();
+  PresolverPtr pres;
+  VarVector orig_v;
+  ProblemPtr p, q;
+  ProbSnapshot *snap;
+  std::string bytes;
+  int err = 0;
+
+  p = makeProblem_(env, &pres, &orig_v);
+  snap = new ProbSnapshot(env);
+  CPPUNIT_ASSERT(0 == snap->write(p, pres, &orig_v, 1.0, fname));
+  delete snap;
+
+  {
+    std::ifstream in(fname.c_str(), std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(in),
+                 std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream out(fname.c_str(), std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), bytes.size()/2);
+  }
+
+  snap = new ProbSnapshot(env);
+  q = snap->read(fname, err);
+  CPPUNIT_ASSERT(0 != err);
+  CPPUNIT_ASSERT(0 == q);
+
+  std::remove(fname.c_str());
+  delete snap;
+  delete pres;
+  delete p;
+  delete env;
+}
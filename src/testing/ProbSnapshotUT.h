@@ -0,0 +1,50 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#ifndef PROBSNAPSHOTUT_H
+#define PROBSNAPSHOTUT_H
+
+#include <cppunit/TestCase.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Presolver.h"
+
+using namespace Minotaur;
+
+// Save a presolved problem to a snapshot and load it back.
+class ProbSnapshotUT : public CppUnit::TestCase {
+  public:
+    ProbSnapshotUT(std::string name) : TestCase(name) {}
+    ProbSnapshotUT() {}
+
+    void testRoundTrip();
+    void testTruncated();
+
+    CPPUNIT_TEST_SUITE(ProbSnapshotUT);
+    CPPUNIT_TEST(testRoundTrip);
+    CPPUNIT_TEST(testTruncated);
+    CPPUNIT_TEST_SUITE_END();
+
+  private:
+    ProblemPtr makeProblem_(EnvPtr env, PresolverPtr *pres,
+                            VarVector *orig_v);
+};
+
+// ------------------------------------------------------------------------- //
+// ------------------------------------------------------------------------- //
+// presolver whose postsolve modifications are given by the test.
+class ModPresolver : public Presolver {
+  public:
+    ModPresolver(ProblemPtr p, EnvPtr env)
+      : Presolver(p, env, HandlerVector()) {}
+
+    void addMod(PreMod *mod) { mods_.push_back(mod); }
+};
+
+#endif
@@ -0,0 +1,206 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "MinotaurConfig.h"
+#include "Environment.h"
+#include "Problem.h"
+#include "Solution.h"
+#include "SolutionPool.h"
+#include "SolutionPoolUT.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION(SolutionPoolUT);
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(SolutionPoolUT, "SolutionPoolUT");
+
+using namespace Minotaur;
+
+
+void SolutionPoolUT::setUp()
+{
+  // x0 binary, x1 integer, x2 continuous.
+  env_ = new Environment();
+  p_ = new Problem(env_);
+  p_->newVariable(0.0, 1.0, Binary);
+  p_->newVariable(0.0, 5.0, Integer);
+  p_->newVariable(0.0, 10.0, Continuous);
+}
+
+
+void SolutionPoolUT::tearDown()
+{
+  delete p_;
+  delete env_;
+}
+
+
+void SolutionPoolUT::testEmpty()
+{
+  SolutionPool pool(env_, p_, 10);
+
+  CPPUNIT_ASSERT(false == pool.hasBest());
+  CPPUNIT_ASSERT(0 == pool.getNumSols());
+  CPPUNIT_ASSERT(0 == pool.getNumPoints());
+  CPPUNIT_ASSERT(0 == pool.getBestSolution());
+  CPPUNIT_ASSERT(0 == pool.copyBestSolution());
+  CPPUNIT_ASSERT(0 == pool.getPrimal(0));
+  CPPUNIT_ASSERT(pool.getBestSolutionValue() >= INFINITY);
+}
+
+
+void SolutionPoolUT::testBest()
+{
+  SolutionPool pool(env_, p_, 10);
+  double x[3] = {1.0, 2.0, 0.5};
+  SolutionPtr sol, best;
+
+  pool.addSolution(x, 5.0);
+  CPPUNIT_ASSERT(pool.hasBest());
+  CPPUNIT_ASSERT(1 == pool.getNumSols());
+  CPPUNIT_ASSERT(5.0 == pool.getBestSolutionValue());
+
+  // a worse solution does not change the best.
+  x[1] = 3.0;
+  pool.addSolution(x, 7.0);
+  CPPUNIT_ASSERT(5.0 == pool.getBestSolutionValue());
+  CPPUNIT_ASSERT(2.0 == pool.getBestSolution()->getPrimal()[1]);
+
+  x[1] = 4.0;
+  pool.addSolution(x, 3.0);
+  CPPUNIT_ASSERT(1 == pool.getNumSols());
+  CPPUNIT_ASSERT(3 == pool.getNumPoints());
+  CPPUNIT_ASSERT(3.0 == pool.getBestSolutionValue());
+  CPPUNIT_ASSERT(4.0 == pool.getBestSolution()->getPrimal()[1]);
+  CPPUNIT_ASSERT(3 == pool.getNumSolsFound());
+
+  // the copy, and the best solution itself, stay valid after the best is
+  // replaced.
+  sol = pool.copyBestSolution();
+  best = pool.getBestSolution();
+  x[1] = 5.0;
+  pool.addSolution(x, 1.0);
+  CPPUNIT_ASSERT(3.0 == sol->getObjValue());
+  CPPUNIT_ASSERT(4.0 == sol->getPrimal()[1]);
+  CPPUNIT_ASSERT(3.0 == best->getObjValue());
+  CPPUNIT_ASSERT(4.0 == best->getPrimal()[1]);
+  CPPUNIT_ASSERT(1.0 == pool.getBestSolutionValue());
+  delete sol;
+
+  // a pool that keeps no points still keeps the best.
+  SolutionPool best_only(env_, p_, 0);
+  best_only.addSolution(x, 2.0);
+  CPPUNIT_ASSERT(best_only.hasBest());
+  CPPUNIT_ASSERT(0 == best_only.getNumPoints());
+}
+
+
+void SolutionPoolUT::testDuplicate()
+{
+  SolutionPool pool(env_, p_, 10);
+  double x[3] = {0.0, 1.0, 0.5};
+
+  pool.addSolution(x, 4.0);
+  CPPUNIT_ASSERT(1 == pool.getNumPoints());
+
+  // same integer part, worse: dropped.
+  x[2] = 0.7;
+  pool.addSolution(x, 6.0);
+  CPPUNIT_ASSERT(1 == pool.getNumPoints());
+  CPPUNIT_ASSERT(4.0 == pool.getObjValue(0));
+  CPPUNIT_ASSERT(0.5 == pool.getPrimal(0)[2]);
+
+  // same integer part, better: replaces the point.
+  x[2] = 0.9;
+  pool.addSolution(x, 2.0);
+  CPPUNIT_ASSERT(1 == pool.getNumPoints());
+  CPPUNIT_ASSERT(2.0 == pool.getObjValue(0));
+  CPPUNIT_ASSERT(0.9 == pool.getPrimal(0)[2]);
+}
+
+
+void SolutionPoolUT::testFull()
+{
+  SolutionPool pool(env_, p_, 2);
+  double x[3] = {0.0, 0.0, 0.0};
+  bool found;
+
+  x[1] = 0.0;
+  pool.addSolution(x, 5.0);
+  x[1] = 4.0;
+  pool.addSolution(x, 6.0);
+  CPPUNIT_ASSERT(2 == pool.getNumPoints());
+
+  // worse than all points of a full pool: dropped.
+  x[1] = 2.0;
+  pool.addSolution(x, 9.0);
+  CPPUNIT_ASSERT(2 == pool.getNumPoints());
+
+  // better than x1=4 only: replaces it.
+  x[1] = 3.0;
+  pool.addSolution(x, 5.5);
+  CPPUNIT_ASSERT(2 == pool.getNumPoints());
+  found = false;
+  for (UInt i=0; i<pool.getNumPoints(); ++i) {
+    CPPUNIT_ASSERT(4.0 != pool.getPrimal(i)[1]);
+    found = found || (3.0 == pool.getPrimal(i)[1]);
+  }
+  CPPUNIT_ASSERT(found);
+
+  // shrinking the pool drops the worst points.
+  pool.setSizeLimit(1);
+  CPPUNIT_ASSERT(1 == pool.getNumPoints());
+  CPPUNIT_ASSERT(5.0 == pool.getObjValue(0));
+}
+
+
+void SolutionPoolUT::testThreads()
+{
+  const int nthreads = 4;
+  const int nsols = 500;
+  SolutionPool pool(env_, p_, 20);
+  std::vector<std::thread> threads;
+  bool ok = true;
+
+  for (int t=0; t<nthreads; ++t) {
+    threads.push_back(std::thread([&pool, t, nsols]() {
+      double x[3];
+      for (int i=0; i<nsols; ++i) {
+        x[0] = i % 2;
+        x[1] = (i + t) % 6;
+        x[2] = 0.01 * t;
+        pool.addSolution(x, 1000.0 - i - 0.1 * t);
+      }
+    }));
+  }
+  // read the best, and copies of it, while solutions are added.
+  threads.push_back(std::thread([&pool, &ok, nsols]() {
+    for (int i=0; i<nsols; ++i) {
+      SolutionPtr sol = pool.copyBestSolution();
+      if (sol) {
+        ok = ok && (sol->getObjValue() >= pool.getBestSolutionValue());
+        delete sol;
+      }
+      sol = pool.getBestSolution();
+      if (sol) {
+        ok = ok && (sol->getPrimal()[2] < 0.05);
+      }
+    }
+  }));
+  for (UInt t=0; t<threads.size(); ++t) {
+    threads[t].join();
+  }
+
+  CPPUNIT_ASSERT(ok);
+  CPPUNIT_ASSERT((UInt) nthreads*nsols == pool.getNumSolsFound());
+  CPPUNIT_ASSERT(fabs(pool.getBestSolutionValue() -
+                      (1000.0 - (nsols-1) - 0.1*(nthreads-1))) < 1e-9);
+  CPPUNIT_ASSERT(pool.getNumPoints() <= 12);
+  for (UInt i=0; i<pool.getNumPoints(); ++i) {
+    CPPUNIT_ASSERT(pool.getObjValue(i) >= pool.getBestSolutionValue());
+  }
+}
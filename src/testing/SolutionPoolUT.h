@@ -0,0 +1,49 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#ifndef SOLUTIONPOOLUT_H
+#define SOLUTIONPOOLUT_H
+
+#include <cppunit/TestCase.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "Types.h"
+
+using namespace Minotaur;
+
+// Test the pool of solutions.
+class SolutionPoolUT : public CppUnit::TestCase {
+
+public:
+  SolutionPoolUT(std::string name) : TestCase(name) {}
+  SolutionPoolUT() {}
+
+  void setUp();
+  void tearDown();
+
+  CPPUNIT_TEST_SUITE(SolutionPoolUT);
+  CPPUNIT_TEST(testEmpty);
+  CPPUNIT_TEST(testBest);
+  CPPUNIT_TEST(testDuplicate);
+  CPPUNIT_TEST(testFull);
+  CPPUNIT_TEST(testThreads);
+  CPPUNIT_TEST_SUITE_END();
+
+  void testEmpty();
+  void testBest();
+  void testDuplicate();
+  void testFull();
+  void testThreads();
+
+private:
+  EnvPtr env_;
+  ProblemPtr p_;
+};
+
+#endif
@@ -0,0 +1,83 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#include <map>
+
+#include "MinotaurConfig.h"
+#include "YEqRegistryUT.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION(YEqRegistryUT);
+CPPUNIT_TEST_SUITE_NAMED_REGISTRATION(YEqRegistryUT, "YEqRegistryUT");
+
+using namespace Minotaur;
+
+
+UIntVector YEqRegistryUT::find_(const YEqRegistry &reg, YEqRegistry::Key key)
+{
+  UIntVector inds;
+  UInt pos = reg.begin(key);
+  UInt ind;
+
+  while (reg.next(key, &pos, &ind)) {
+    inds.push_back(ind);
+  }
+  return inds;
+}
+
+
+void YEqRegistryUT::testLookup()
+{
+  YEqRegistry reg;
+  YEqRegistry::Key k1, k2, k3;
+  UIntVector inds;
+
+  k1 = YEqRegistry::mix(YEqRegistry::mix(0, 3), 7);
+  k2 = YEqRegistry::mix(YEqRegistry::mix(0, 7), 3);
+  k3 = YEqRegistry::mix(YEqRegistry::mix(0, 3), 8);
+  CPPUNIT_ASSERT(k1 != k2);
+  CPPUNIT_ASSERT(k1 != k3);
+
+  CPPUNIT_ASSERT(find_(reg, k1).empty());
+  reg.insert(k1, 0);
+  reg.insert(k2, 1);
+  reg.insert(k1, 2);
+  reg.insert(k3, 3);
+  reg.insert(k1, 4);
+
+  // entries with equal keys come in the order they were inserted.
+  inds = find_(reg, k1);
+  CPPUNIT_ASSERT(3 == inds.size());
+  CPPUNIT_ASSERT(0 == inds[0] && 2 == inds[1] && 4 == inds[2]);
+  inds = find_(reg, k2);
+  CPPUNIT_ASSERT(1 == inds.size() && 1 == inds[0]);
+  inds = find_(reg, k3);
+  CPPUNIT_ASSERT(1 == inds.size() && 3 == inds[0]);
+  CPPUNIT_ASSERT(find_(reg, YEqRegistry::mix(k1, 1)).empty());
+}
+
+
+void YEqRegistryUT::testGrow()
+{
+  const UInt n = 2000;
+  YEqRegistry reg;
+  std::map<YEqRegistry::Key, UIntVector> all;
+  YEqRegistry::Key key;
+
+  // close keys, many repeated, across several doublings of the table.
+  for (UInt i=0; i<n; ++i) {
+    key = (i*i) % 97;
+    reg.insert(key, i);
+    all[key].push_back(i);
+    if (0 == i % 250) {
+      CPPUNIT_ASSERT(all[key] == find_(reg, key));
+    }
+  }
+  for (std::map<YEqRegistry::Key, UIntVector>::iterator it=all.begin();
+       it!=all.end(); ++it) {
+    CPPUNIT_ASSERT(it->second == find_(reg, it->first));
+  }
+  CPPUNIT_ASSERT(find_(reg, 98).empty());
+}
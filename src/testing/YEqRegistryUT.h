@@ -0,0 +1,38 @@
+//
+//     Minotaur -- It's only 1/2 bull
+//
+//     (C)opyright 2009 - 2025 The Minotaur Team.
+//
+
+#ifndef YEQREGISTRYUT_H
+#define YEQREGISTRYUT_H
+
+#include <cppunit/TestCase.h>
+#include <cppunit/TestCaller.h>
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestResult.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "YEqRegistry.h"
+
+using namespace Minotaur;
+
+// Insert keys in the registry and look them up.
+class YEqRegistryUT : public CppUnit::TestCase {
+  public:
+    YEqRegistryUT(std::string name) : TestCase(name) {}
+    YEqRegistryUT() {}
+
+    void testLookup();
+    void testGrow();
+
+    CPPUNIT_TEST_SUITE(YEqRegistryUT);
+    CPPUNIT_TEST(testLookup);
+    CPPUNIT_TEST(testGrow);
+    CPPUNIT_TEST_SUITE_END();
+
+  private:
+    UIntVector find_(const YEqRegistry &reg, YEqRegistry::Key key);
+};
+
+#endif